@@ -161,12 +161,7 @@ namespace AZ::Data
         {
             if (AssetManager::IsReady())
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(AssetManager::Instance().m_assetMutex);
-                auto it = AssetManager::Instance().m_assets.find(id);
-                if (it != AssetManager::Instance().m_assets.end())
-                {
-                    return { it->second, assetReferenceLoadBehavior };
-                }
+                return AssetManager::Instance().FindAssetInShard(id, assetReferenceLoadBehavior);
             }
             return {nullptr, assetReferenceLoadBehavior};
         }
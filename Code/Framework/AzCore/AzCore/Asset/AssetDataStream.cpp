@@ -111,7 +111,8 @@ namespace AZ::Data
     }
 
     void AssetDataStream::Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
-        AZ::IO::IStreamerTypes::Deadline deadline, AZ::IO::IStreamerTypes::Priority priority, OnCompleteCallback loadCallback)
+        AZ::IO::IStreamerTypes::Deadline deadline, AZ::IO::IStreamerTypes::Priority priority, OnCompleteCallback loadCallback,
+        RequestBatch* requestBatch)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -178,7 +179,14 @@ namespace AZ::Data
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_privateData->m_curReadRequest, streamerCallback);
 
-            streamer->QueueRequest(m_privateData->m_curReadRequest);
+            if (requestBatch)
+            {
+                requestBatch->push_back(m_privateData->m_curReadRequest);
+            }
+            else
+            {
+                streamer->QueueRequest(m_privateData->m_curReadRequest);
+            }
         }
         else
         {
@@ -10,6 +10,7 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZStd
@@ -18,6 +19,11 @@ namespace AZStd
     class vector;
 }
 
+namespace AZ::IO
+{
+    class ExternalFileRequest;
+}
+
 namespace AZ::Data
 {
     namespace DataStreamInternal
@@ -29,6 +35,7 @@ namespace AZ::Data
     {
     public:
         using VectorDataSource = AZStd::vector<AZ::u8, AZStd::allocator>;
+        using RequestBatch = AZStd::vector<AZStd::intrusive_ptr<AZ::IO::ExternalFileRequest>, AZStd::allocator>;
         // The default Generic Stream APIs in this class will only allow for a single sequential pass
         // through the data, no seeking.  Reads will block when pages aren't available yet, and
         // pages will be marked for recycling once reading has progressed beyond them.
@@ -43,12 +50,14 @@ namespace AZ::Data
         // Open the AssetDataStream and directly take ownership of a pre-populated memory buffer.
         void Open(VectorDataSource&& data);
 
-        // Open the AssetDataStream and load it via file streaming
+        // Open the AssetDataStream and load it via file streaming.
+        // If a request batch is provided the read request is added to it instead of being queued, so the caller can
+        // submit the reads of many streams at once with IStreamer::QueueRequestBatch.
         using OnCompleteCallback = AZStd::function<void(AZ::IO::IStreamerTypes::RequestStatus)>;
         void Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
             AZ::IO::IStreamerTypes::Deadline deadline = AZ::IO::IStreamerTypes::s_noDeadline,
             AZ::IO::IStreamerTypes::Priority priority = AZ::IO::IStreamerTypes::s_priorityMedium,
-            OnCompleteCallback loadCallback = {});
+            OnCompleteCallback loadCallback = {}, RequestBatch* requestBatch = nullptr);
 
         // Reschedule the outstanding request.  Will only update with shorter deadline values or higher priority values
         void Reschedule(AZ::IO::IStreamerTypes::Deadline newDeadline, AZ::IO::IStreamerTypes::Priority newPriority);
@@ -14,7 +14,9 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -566,9 +568,7 @@ namespace AZ::Data
     {
         PrepareShutDown();
 
-        // Acquire the asset lock to make sure nobody else is trying to do anything fancy with assets
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-
+        // UnregisterHandler locks the asset shards while it checks for assets that are still using the handler.
         while (!m_handlers.empty())
         {
             AssetHandlerMap::iterator it = m_handlers.begin();
@@ -697,10 +697,11 @@ namespace AZ::Data
                     // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                     WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                    for (AssetShard& shard : m_assetShards)
                     {
                         // this scope is used to control the scope of the lock.
-                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                        for (const auto &assetEntry : shard.m_assets)
                         {
                             // is the handler that handles this type, this handler we're removing?
                             if (assetEntry.second->m_registeredHandler == handler)
@@ -732,7 +733,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to register a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::unique_lock<AZStd::shared_mutex> l(m_catalogMutex);
             if (m_catalogs.insert(AZStd::make_pair(assetType, catalog)).second == false)
             {
                 AZ_Error("AssetDatabase", false, "Asset type %s already has a catalog registered! New registration ignored!", assetType.ToString<AZStd::string>().c_str());
@@ -749,7 +750,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to unregister a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::unique_lock<AZStd::shared_mutex> l(m_catalogMutex);
             for (AssetCatalogMap::iterator iter = m_catalogs.begin(); iter != m_catalogs.end(); )
             {
                 if (iter->second == catalog)
@@ -771,6 +772,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::GetHandledAssetTypes(AssetCatalog* catalog, AZStd::vector<AssetType>& assetTypes)
     {
+        AZStd::shared_lock<AZStd::shared_mutex> l(m_catalogMutex);
         for (AssetCatalogMap::iterator iter = m_catalogs.begin(); iter != m_catalogs.end(); iter++)
         {
             if (iter->second == catalog)
@@ -792,43 +794,58 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
+        // Releasing containers and assets releases their references to dependent assets, which can live in any shard.
+        // The shard lock is only held to collect what needs releasing, so no shard is ever locked while another one is.
+        struct PendingRelease
         {
-            if (asset->second->m_useCount == 0)
+            AssetData* m_asset;
+            AssetId m_assetId;
+            AssetType m_assetType;
+            int m_creationToken;
+            bool m_removeFromHash;
+        };
+        AZStd::vector<PendingRelease> pendingReleases;
+
+        for (AssetShard& shard : m_assetShards)
+        {
+            // First, release any containers that were loading these assets
+            pendingReleases.clear();
             {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                for (auto&& asset : shard.m_assets)
+                {
+                    if (asset.second->m_useCount == 0)
+                    {
+                        pendingReleases.push_back({ asset.second, asset.first, asset.second->GetType(), asset.second->m_creationToken, false });
+                    }
+                }
             }
-            else
+
+            for (const PendingRelease& release : pendingReleases)
             {
-                ++asset;
+                ReleaseAssetContainersForAsset(release.m_assetId, release.m_creationToken);
             }
-        }
-
-        // Second, release the assets themselves
-
-        AZStd::vector<AssetData*> assetsToRelease;
 
-        for(auto&& asset : m_assets)
-        {
-            if(asset.second->m_weakUseCount == 0)
+            // Second, release the assets themselves, releasing the containers may have dropped the last weak references to them
+            pendingReleases.clear();
             {
-                // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                // currently looping on.
-                assetsToRelease.push_back(asset.second);
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                for (auto&& asset : shard.m_assets)
+                {
+                    if (asset.second->m_weakUseCount == 0)
+                    {
+                        // Default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map.
+                        const bool removeFromHash = (asset.second->m_creationToken != s_defaultCreationToken) && asset.second->IsRegisterReadonlyAndShareable();
+                        pendingReleases.push_back({ asset.second, asset.first, asset.second->GetType(), asset.second->m_creationToken, removeFromHash });
+                    }
+                }
             }
-        }
-
-        for(auto&& asset : assetsToRelease)
-        {
-            bool removeFromHash = asset->IsRegisterReadonlyAndShareable();
-            // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map.
-            removeFromHash = asset->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
 
-            ReleaseAsset(asset, asset->GetId(), asset->GetType(), removeFromHash, asset->m_creationToken);
+            for (const PendingRelease& release : pendingReleases)
+            {
+                // Shareable assets are looked up again under the shard lock, and only destroyed if they are still unreferenced
+                ReleaseAsset(release.m_asset, release.m_assetId, release.m_assetType, release.m_removeFromHash, release.m_creationToken);
+            }
         }
     }
 
@@ -861,7 +878,7 @@ namespace AZ::Data
     {
         // Look up the asset id in the catalog, and use the result of that instead.
         // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
-        // This is because only canonical ids are stored in m_assets (see below).
+        // This is because only canonical ids are stored in the asset map (see below).
         // Only do the look up if upgrading is enabled
         AZ::Data::AssetInfo assetInfo;
         if (GetAssetInfoUpgradingEnabled())
@@ -872,9 +889,18 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
+        return FindAssetInShard(assetToFind, assetReferenceLoadBehavior);
+    }
+
+    //=========================================================================
+    // FindAssetInShard
+    //=========================================================================
+    Asset<AssetData> AssetManager::FindAssetInShard(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+    {
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+        AssetMap::iterator it = shard.m_assets.find(assetId);
+        if (it != shard.m_assets.end())
         {
             Asset<AssetData> asset(assetReferenceLoadBehavior);
             asset.SetData(it->second);
@@ -884,6 +910,28 @@ namespace AZ::Data
         return Asset<AssetData>(assetReferenceLoadBehavior);
     }
 
+    //=========================================================================
+    // GetAssetShard
+    //=========================================================================
+    AssetManager::AssetShard& AssetManager::GetAssetShard(const AssetId& assetId)
+    {
+        return m_assetShards[AZStd::hash<AssetId>{}(assetId) % AssetShardCount];
+    }
+
+    //=========================================================================
+    // GetAllAssets
+    //=========================================================================
+    AssetManager::AssetMap AssetManager::GetAllAssets()
+    {
+        AssetMap assets;
+        for (AssetShard& shard : m_assetShards)
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            assets.insert(shard.m_assets.begin(), shard.m_assets.end());
+        }
+        return assets;
+    }
+
     AZStd::pair<AZ::IO::IStreamerTypes::Deadline, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
         const AssetHandler& handler, AssetType assetType, const AssetLoadParameters& loadParams)
     {
@@ -962,7 +1010,8 @@ namespace AZ::Data
     }
 
     Asset<AssetData> AssetManager::GetAssetInternal(const AssetId& assetId, [[maybe_unused]] const AssetType& assetType,
-        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */)
+        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */,
+        AssetDataStream::RequestBatch* requestBatch /*= nullptr */)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1011,17 +1060,18 @@ namespace AZ::Data
         AssetData* assetData = nullptr;
         Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
 
-        // Control the scope of the assetMutex lock
+        // Control the scope of the asset shard lock
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetShard& shard = GetAssetShard(assetInfo.m_assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             bool isNewEntry = false;
 
             // check if asset already exists
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
+                AssetMap::iterator it = shard.m_assets.find(assetInfo.m_assetId);
+                if (it != shard.m_assets.end())
                 {
                     assetData = it->second;
                     asset.SetData(assetData);
@@ -1070,7 +1120,7 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    shard.m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
                 }
                 if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
                 {
@@ -1103,13 +1153,13 @@ namespace AZ::Data
 
         asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
-        // We delay queueing the async file I/O until we release m_assetMutex
+        // We delay queueing the async file I/O until we release the asset shard lock
         if (dataStream)
         {
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
             constexpr bool isReload = false;
             QueueAsyncStreamLoad(asset, dataStream, loadInfo, isReload,
-                handler, loadParams, signalLoaded);
+                handler, loadParams, signalLoaded, requestBatch);
         }
         else
         {
@@ -1139,6 +1189,136 @@ namespace AZ::Data
         return asset;
     }
 
+    //=========================================================================
+    // PreloadAssets
+    //=========================================================================
+    AZStd::shared_ptr<AssetPreload> AssetManager::PreloadAssets(AZStd::span<const AssetId> rootAssetIds, const AssetLoadParameters& loadParams)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        struct PendingLoad
+        {
+            AssetInfo m_assetInfo;
+            AssetStreamInfo m_streamInfo;
+        };
+
+        AZStd::vector<PendingLoad> pendingLoads;
+        AZStd::unordered_set<AssetId> visitedAssets;
+
+        auto addPendingLoad = [this, &pendingLoads, &visitedAssets](const AssetId& assetId)
+        {
+            if (!visitedAssets.insert(assetId).second)
+            {
+                return;
+            }
+
+            AssetInfo assetInfo;
+            AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+            if (!assetInfo.m_assetId.IsValid())
+            {
+                AZ_Warning("AssetManager", false, "PreloadAssets called for asset which does not exist in asset catalog. AssetId: %s",
+                    assetId.ToString<AZStd::string>().c_str());
+                return;
+            }
+
+            // Legacy ids resolve to the canonical id, which may already be part of the preload.
+            if (assetInfo.m_assetId != assetId && !visitedAssets.insert(assetInfo.m_assetId).second)
+            {
+                return;
+            }
+
+            AssetStreamInfo streamInfo = GetLoadStreamInfoForAsset(assetInfo.m_assetId, assetInfo.m_assetType);
+            pendingLoads.push_back({ AZStd::move(assetInfo), AZStd::move(streamInfo) });
+        };
+
+        {
+            AZ_PROFILE_SCOPE(AzCore, "PreloadAssets: ResolveDependencies");
+
+            for (const AssetId& rootAssetId : rootAssetIds)
+            {
+                addPendingLoad(rootAssetId);
+
+                Outcome<AZStd::vector<ProductDependency>, AZStd::string> getDependenciesResult = Failure(AZStd::string());
+                if (loadParams.m_dependencyRules == AssetDependencyLoadRules::UseLoadBehavior)
+                {
+                    AZStd::unordered_set<AssetId> noloadDependencies;
+                    PreloadAssetListType preloadDependencies;
+                    AssetCatalogRequestBus::BroadcastResult(getDependenciesResult,
+                        &AssetCatalogRequestBus::Events::GetLoadBehaviorProductDependencies, rootAssetId, noloadDependencies,
+                        preloadDependencies);
+                }
+                else if (loadParams.m_dependencyRules == AssetDependencyLoadRules::LoadAll)
+                {
+                    AssetCatalogRequestBus::BroadcastResult(getDependenciesResult,
+                        &AssetCatalogRequestBus::Events::GetAllProductDependencies, rootAssetId);
+                }
+
+                if (!getDependenciesResult.IsSuccess())
+                {
+                    continue;
+                }
+
+                for (const ProductDependency& dependency : getDependenciesResult.GetValue())
+                {
+                    if (loadParams.m_assetLoadFilterCB)
+                    {
+                        AssetInfo dependencyInfo;
+                        AssetCatalogRequestBus::BroadcastResult(dependencyInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById,
+                            dependency.m_assetId);
+                        if (!loadParams.m_assetLoadFilterCB({ dependency.m_assetId, dependencyInfo.m_assetType,
+                            ProductDependencyInfo::LoadBehaviorFromFlags(dependency.m_flags) }))
+                        {
+                            continue;
+                        }
+                    }
+
+                    addPendingLoad(dependency.m_assetId);
+                }
+            }
+        }
+
+        // Order the reads by file and offset, so reads that share a file are queued next to each other. The streamer's scheduler
+        // resolves archive offsets and picks the closest pending read within the same file, which works best on ordered runs.
+        AZStd::sort(pendingLoads.begin(), pendingLoads.end(), [](const PendingLoad& lhs, const PendingLoad& rhs)
+        {
+            const int nameOrder = lhs.m_streamInfo.m_streamName.compare(rhs.m_streamInfo.m_streamName);
+            return nameOrder != 0 ? nameOrder < 0 : lhs.m_streamInfo.m_dataOffset < rhs.m_streamInfo.m_dataOffset;
+        });
+
+        auto preload = AZStd::make_shared<AssetPreload>();
+        preload->m_assets.reserve(pendingLoads.size());
+        preload->m_readSizes.reserve(pendingLoads.size());
+
+        AssetDataStream::RequestBatch requestBatch;
+        requestBatch.reserve(pendingLoads.size());
+
+        {
+            AZ_PROFILE_SCOPE(AzCore, "PreloadAssets: CreateRequests");
+
+            for (const PendingLoad& pendingLoad : pendingLoads)
+            {
+                const size_t batchSize = requestBatch.size();
+                Asset<AssetData> asset = GetAssetInternal(pendingLoad.m_assetInfo.m_assetId, pendingLoad.m_assetInfo.m_assetType,
+                    AssetLoadBehavior::Default, loadParams, pendingLoad.m_assetInfo, false, &requestBatch);
+                if (asset)
+                {
+                    // Assets that were already loaded or loading don't add a read to the batch.
+                    preload->m_readSizes.push_back(requestBatch.size() > batchSize ? pendingLoad.m_streamInfo.m_dataLen : 0);
+                    preload->m_assets.push_back(AZStd::move(asset));
+                }
+            }
+        }
+
+        // Each request already has its completion callback set, which schedules the load job for its asset as soon as the data
+        // has been read, so the deserialization of early reads overlaps with the remaining file I/O.
+        if (!requestBatch.empty())
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Get()->QueueRequestBatch(AZStd::move(requestBatch));
+        }
+
+        return preload;
+    }
+
     void AssetManager::QueueAssetReload(AZ::Data::Asset<AZ::Data::AssetData> newAsset, bool signalLoaded)
     {
         AssetHandler* handler = nullptr;
@@ -1219,7 +1399,7 @@ namespace AZ::Data
 
         // Look up the asset id in the catalog, and use the result of that instead.
         // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
-        // This is because only canonical ids are stored in m_assets.
+        // This is because only canonical ids are stored in the asset map.
         // Only do the look up if upgrading is enabled
         AZ::Data::AssetInfo assetInfo;
         if (GetAssetInfoUpgradingEnabled())
@@ -1230,9 +1410,11 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        // Only the shard the asset id maps to has to be locked to make the find and create atomic. The id has already been
+        // resolved through the catalog, so skip the second catalog lookup FindAsset would do.
+        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(GetAssetShard(assetToFind).m_mutex);
 
-        Asset<AssetData> asset = FindAsset(assetToFind, assetReferenceLoadBehavior);
+        Asset<AssetData> asset = FindAssetInShard(assetToFind, assetReferenceLoadBehavior);
 
         if (!asset)
         {
@@ -1257,11 +1439,12 @@ namespace AZ::Data
             nullAsset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
             return nullAsset;
         }
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        AssetMap::iterator it = shard.m_assets.find(assetId);
+        if (it == shard.m_assets.end())
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1279,7 +1462,7 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        shard.m_assets.insert(AZStd::make_pair(assetId, assetData));
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1313,8 +1496,9 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
+            AssetShard& shard = GetAssetShard(assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
+            AssetMap::iterator it = shard.m_assets.find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
            // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1322,10 +1506,11 @@ namespace AZ::Data
             // if the assetId is not in the map or if the identifierId
             // do not match it implies that the asset has been already destroyed.
             // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            if (it != shard.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
+                asset = it->second; // The caller's pointer may have been collected before the shard was locked
+                shard.m_assets.erase(it);
                 destroyAsset = true;
             }
         }
@@ -1336,7 +1521,7 @@ namespace AZ::Data
             destroyAsset = true;
         }
 
-        // We have to separate the code which was removing the asset from the m_asset map while being locked, but then actually destroy the asset
+        // We have to separate the code which was removing the asset from the asset map while being locked, but then actually destroy the asset
         // while the lock is not held since destroying the asset while holding the lock can cause a deadlock.
         if (destroyAsset)
         {
@@ -1382,23 +1567,41 @@ namespace AZ::Data
 
     void AssetManager::ReleaseAssetContainersForAsset(AssetData* asset)
     {
-        // To be safe, we want to keep the assetMutex locked the whole time to avoid another thread trying to start a load while we're invalidating containers
+        ReleaseAssetContainersForAsset(asset->GetId(), asset->GetCreationToken());
+    }
+
+    void AssetManager::ReleaseAssetContainersForAsset(const AssetId& assetId, int creationToken)
+    {
+        {
+            // This is called every time the last reference to an asset is released, but most assets don't own a container.
+            // Check for that first so the common case doesn't need to lock the asset's shard.
+            AZStd::scoped_lock containerLock(m_assetContainerMutex);
+            if (m_ownedAssetContainerLookup.find(assetId) == m_ownedAssetContainerLookup.end())
+            {
+                return;
+            }
+        }
+
+        // Destroying a container releases its references to the dependent assets, which can live in other shards. Hold on to
+        // the released containers until the locks below have been released so no other shard is locked while this one is.
+        AZStd::vector<AZStd::shared_ptr<AssetContainer>> releasedContainers;
+
+        // To be safe, we want to keep the asset's shard locked the whole time to avoid another thread trying to start a load while we're invalidating containers
         // The container mutex is also needed as we're modifying the container storage
         // Since we need both of these, there's deadlock potential, so passing both to scoped_lock will handle avoiding a deadlock
-        AZStd::scoped_lock assetLock(m_assetMutex, m_assetContainerMutex);
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::scoped_lock assetLock(shard.m_mutex, m_assetContainerMutex);
 
         // Make sure there are no pending reloads using a container before we attempt to release the containers
-        auto reloadsItr = m_reloads.find(asset->GetId());
+        auto reloadsItr = shard.m_reloads.find(assetId);
 
-        if (reloadsItr != m_reloads.end())
+        if (reloadsItr != shard.m_reloads.end())
         {
             return;
         }
 
         // Release any containers that were loading this asset
 
-        AssetId assetId = asset->GetId();
-
         auto rangeItr = m_ownedAssetContainerLookup.equal_range(assetId);
 
         for (auto itr = rangeItr.first; itr != rangeItr.second;)
@@ -1410,7 +1613,7 @@ namespace AZ::Data
             // Sometimes old references (from before a reload) are released which should not cancel newer loads
             const Asset<AssetData>& rootAsset = itr->second->GetRootAsset();
 
-            if (!rootAsset || (rootAsset && rootAsset->GetCreationToken() == asset->GetCreationToken()))
+            if (!rootAsset || (rootAsset && rootAsset->GetCreationToken() == creationToken))
             {
                 itr->second->ClearRootAsset();
 
@@ -1420,7 +1623,12 @@ namespace AZ::Data
                 // the OnAssetContainerReady callback.
                 if (!itr->second->IsLoading())
                 {
-                    m_ownedAssetContainers.erase(itr->second);
+                    auto ownedItr = m_ownedAssetContainers.find(itr->second);
+                    if (ownedItr != m_ownedAssetContainers.end())
+                    {
+                        releasedContainers.push_back(AZStd::move(ownedItr->second));
+                        m_ownedAssetContainers.erase(ownedItr);
+                    }
                     itr = m_ownedAssetContainerLookup.erase(itr);
                     continue;
                 }
@@ -1460,10 +1668,11 @@ namespace AZ::Data
         Asset<AssetData> newAsset;
 
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            auto assetIter = m_assets.find(assetId);
+            AssetShard& shard = GetAssetShard(assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            auto assetIter = shard.m_assets.find(assetId);
 
-            if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+            if (assetIter == shard.m_assets.end() || assetIter->second->IsLoading())
             {
                 // Only existing assets can be reloaded.
                 ASSET_DEBUG_OUTPUT(AZStd::string::format("Asset does not exist or is already loading - reload abort - " AZ_STRING_FORMAT,
@@ -1471,8 +1680,8 @@ namespace AZ::Data
                 return;
             }
 
-            auto reloadIter = m_reloads.find(assetId);
-            if (reloadIter != m_reloads.end())
+            auto reloadIter = shard.m_reloads.find(assetId);
+            if (reloadIter != shard.m_reloads.end())
             {
                 auto curStatus = reloadIter->second.GetData()->GetStatus();
                 // We don't need another reload if we're in "Queued" state because that reload has not actually begun yet.
@@ -1557,7 +1766,7 @@ namespace AZ::Data
                 newAssetData->m_status = AssetData::AssetStatus::Queued;
                 newAsset = Asset<AssetData>(newAssetData, assetReferenceLoadBehavior);
 
-                m_reloads[newAsset.GetId()] = newAsset;
+                shard.m_reloads[newAsset.GetId()] = newAsset;
 
                 UpdateDebugStatus(newAsset);
             }
@@ -1620,17 +1829,18 @@ namespace AZ::Data
 
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetShard& shard = GetAssetShard(asset.GetId());
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
+                shard.m_assets.find(asset.GetId()) != shard.m_assets.end(),
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
             AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                shard.m_assets.find(asset.GetId()) == shard.m_assets.end() ||
+                    asset->RTTI_GetType() == shard.m_assets.find(asset.GetId())->second->RTTI_GetType(),
                 "New and old data types are mismatched!");
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            auto found = shard.m_assets.find(asset.GetId());
+            if ((found == shard.m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
             {
                 return; // this will just lead to crashes down the line and the above asserts cover this.
             }
@@ -1654,7 +1864,7 @@ namespace AZ::Data
             }
         }
 
-        // We specifically perform this outside of the m_assetMutex lock so that the lock isn't held at the point that
+        // We specifically perform this outside of the asset shard lock so that the lock isn't held at the point that
         // OnAssetReload is triggered inside of AssignAssetData.  Otherwise, we open up a high potential for deadlocks.
         if (shouldAssignAssetData)
         {
@@ -1690,10 +1900,13 @@ namespace AZ::Data
         if (asset->IsRegisterReadonlyAndShareable())
         {
             bool requeue{ false };
+            // The reload reference is released after the shard lock, since releasing it can release other assets.
+            Asset<AssetData> reloadAsset;
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                auto found = shard.m_assets.find(assetId);
+                AZ_Assert(found == shard.m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
@@ -1702,21 +1915,22 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
+                if (found != shard.m_assets.end())
                 {
                     found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
                 }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                shard.m_assets[assetId] = asset.Get();
 
                 // Release the reload reference.
-                auto reloadInfo = m_reloads.find(assetId);
-                if (reloadInfo != m_reloads.end())
+                auto reloadInfo = shard.m_reloads.find(assetId);
+                if (reloadInfo != shard.m_reloads.end())
                 {
                     requeue = reloadInfo->second->GetRequeue();
-                    m_reloads.erase(reloadInfo);
+                    reloadAsset = AZStd::move(reloadInfo->second);
+                    shard.m_reloads.erase(reloadInfo);
                 }
             }
             // Call reloaded before we can call ReloadAsset below to preserve order
@@ -1762,7 +1976,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
         const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
+        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded, AssetDataStream::RequestBatch* requestBatch)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1784,7 +1998,7 @@ namespace AZ::Data
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                     loadingAsset.GetHint().c_str());
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetShard(assetId).m_mutex);
                     AssetData* data = loadingAsset.Get();
                     if (data->GetStatus() != AssetData::AssetStatus::Queued)
                     {
@@ -1854,7 +2068,7 @@ namespace AZ::Data
             streamInfo.m_streamName,
             streamInfo.m_dataOffset,
             streamInfo.m_dataLen,
-            deadline, priority, assetDataStreamCallback);
+            deadline, priority, assetDataStreamCallback, requestBatch);
     }
 
     //=========================================================================
@@ -1893,8 +2107,18 @@ namespace AZ::Data
     {
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            m_reloads.erase(asset.GetId());
+            // The reload reference is released after the shard lock, since releasing it can release other assets.
+            Asset<AssetData> reloadAsset;
+            {
+                AssetShard& shard = GetAssetShard(asset.GetId());
+                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                auto reloadInfo = shard.m_reloads.find(asset.GetId());
+                if (reloadInfo != shard.m_reloads.end())
+                {
+                    reloadAsset = AZStd::move(reloadInfo->second);
+                    shard.m_reloads.erase(reloadInfo);
+                }
+            }
         }
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetReloadError, asset); // Broadcast to any containers first
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReloadError, asset);
@@ -1939,7 +2163,7 @@ namespace AZ::Data
         AssetData* data = asset.Get();
         {
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetShard(asset.GetId()).m_mutex);
             if (data)
             {
                 // The purpose of this function is to validate this asset is still in a StreamReady
@@ -2082,7 +2306,9 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetLoadStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        // Catalogs are registered once at startup while stream info is requested for every load, so lookups only take a
+        // shared lock and loads on different threads don't serialize on the catalog map.
+        AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2098,7 +2324,7 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetSaveStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2316,7 +2542,7 @@ namespace AZ::Data
     {
         {
             // We may need to revalidate that this asset hasn't already passed through postLoad
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(GetAssetShard(asset.GetId()).m_mutex);
             if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
             {
                 return;
@@ -2404,29 +2630,40 @@ namespace AZ::Data
         AZStd::map<AZStd::string, TypeInfo> assetTypeInfos;
         uint64_t totalSize = 0;
 
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        // Lock every shard for the whole dump so the assets can't be released while they're being reported.
+        AZStd::vector<AZStd::unique_lock<AZStd::recursive_mutex>> assetLocks;
+        assetLocks.reserve(AssetShardCount);
+        size_t assetCount = 0;
+        for (AssetShard& shard : m_assetShards)
+        {
+            assetLocks.emplace_back(shard.m_mutex);
+            assetCount += shard.m_assets.size();
+        }
 
         // we need to cache the AssetStreamInfo since json objects are referencing the names in it. 
         AZStd::vector<AssetStreamInfo> cachedStreamInfos;
-        cachedStreamInfos.reserve(m_assets.size());
+        cachedStreamInfos.reserve(assetCount);
 
-        for (const auto& assetEntry : m_assets)
+        for (const AssetShard& shard : m_assetShards)
         {
-            cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(assetEntry.first, assetEntry.second->GetType()));
+            for (const auto& assetEntry : shard.m_assets)
+            {
+                cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(assetEntry.first, assetEntry.second->GetType()));
 
-            const AssetStreamInfo& streamInfo = cachedStreamInfos.back();
-            totalSize += streamInfo.m_dataLen;
-            auto& typeInfo = assetTypeInfos[AZStd::string(assetEntry.second->RTTI_GetTypeName())];
-            typeInfo.size += streamInfo.m_dataLen;
-            typeInfo.count++;
+                const AssetStreamInfo& streamInfo = cachedStreamInfos.back();
+                totalSize += streamInfo.m_dataLen;
+                auto& typeInfo = assetTypeInfos[AZStd::string(assetEntry.second->RTTI_GetTypeName())];
+                typeInfo.size += streamInfo.m_dataLen;
+                typeInfo.count++;
 
-            rapidjson::Value assetInfoObject(rapidjson::kObjectType);
+                rapidjson::Value assetInfoObject(rapidjson::kObjectType);
 
-            assetInfoObject.AddMember("Type", rapidjson::StringRef(assetEntry.second->RTTI_GetTypeName()), doc.GetAllocator());
-            assetInfoObject.AddMember("Path", rapidjson::StringRef(streamInfo.m_streamName.c_str()), doc.GetAllocator());
-            assetInfoObject.AddMember("SizeInBytes", static_cast<uint64_t>(streamInfo.m_dataLen), doc.GetAllocator());
-            assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(assetEntry.second->GetUseCount()), doc.GetAllocator());
-            infoArray.PushBack(assetInfoObject, doc.GetAllocator());
+                assetInfoObject.AddMember("Type", rapidjson::StringRef(assetEntry.second->RTTI_GetTypeName()), doc.GetAllocator());
+                assetInfoObject.AddMember("Path", rapidjson::StringRef(streamInfo.m_streamName.c_str()), doc.GetAllocator());
+                assetInfoObject.AddMember("SizeInBytes", static_cast<uint64_t>(streamInfo.m_dataLen), doc.GetAllocator());
+                assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(assetEntry.second->GetUseCount()), doc.GetAllocator());
+                infoArray.PushBack(assetInfoObject, doc.GetAllocator());
+            }
         }
                 
         rapidjson::Value typeSizeArray(rapidjson::kArrayType);
@@ -12,11 +12,15 @@
 #include <AzCore/Asset/AssetContainer.h>
 #include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Asset/AssetPreload.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -153,6 +157,7 @@ namespace AZ
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
+            typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
 
@@ -226,6 +231,18 @@ namespace AZ
             **/
             Asset<AssetData> GetAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{});
 
+            /**
+            * Loads a set of root assets together with all of their dependencies as a single bulk operation.
+            * The dependency closure is resolved from the catalog up front, following loadParams.m_dependencyRules and the optional
+            * load filter. The file reads of all assets are sorted by file and offset and handed to the streamer as one batch, and
+            * each asset is deserialized on a job thread as soon as its data arrives.
+            * Unlike GetAsset, the assets are loaded individually, so an asset can signal ready before its PreLoad dependencies.
+            * Use the returned AssetPreload to track the progress of the whole set or to wait for it to complete.
+            * \param rootAssetIds the assets to load, assets that are also a dependency of another root are only loaded once
+            * \param loadParams optional set of parameters to control loading
+            **/
+            AZStd::shared_ptr<AssetPreload> PreloadAssets(AZStd::span<const AssetId> rootAssetIds, const AssetLoadParameters& loadParams = AssetLoadParameters{});
+
             /**
              * Locates an existing in-memory asset, if the asset is unknown, a new in-memory asset will be created.
              * The asset will not be queued for load.
@@ -343,6 +360,23 @@ namespace AZ
             void ReleaseAsset(AssetData* asset, AssetId assetId, AssetType assetType, bool removeAssetFromHash, int creationToken);
             void OnAssetUnused(AssetData* asset);
 
+            //! The asset map is split into shards by asset id so threads working on different assets don't contend on a single
+            //! lock. All state that's tracked per asset id lives in the shard the id maps to, so operations on a single asset
+            //! only ever need to lock that asset's shard.
+            struct AssetShard
+            {
+                AZStd::recursive_mutex m_mutex; //!< Lock when accessing the assets or reloads in this shard.
+                AssetMap m_assets;
+                ReloadMap m_reloads; //!< Book-keeping and reference-holding for asset reloads.
+            };
+            static constexpr size_t AssetShardCount = 32;
+
+            AssetShard& GetAssetShard(const AssetId& assetId);
+            //! Finds a registered asset by its canonical id without consulting the catalog.
+            Asset<AssetData> FindAssetInShard(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior);
+            //! Returns a copy of the assets in all shards. Only intended for debugging and tests.
+            AssetMap GetAllAssets();
+
             void AddJob(AssetDatabaseJob* job);
             void RemoveJob(AssetDatabaseJob* job);
             void AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest);
@@ -354,7 +388,9 @@ namespace AZ
             void ValidateAndPostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
             void PostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
-            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
+            //! If a request batch is provided, the file read for the asset is added to it instead of being queued with the streamer.
+            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false,
+                AssetDataStream::RequestBatch* requestBatch = nullptr);
             // Alternative path to GetAssetInternal intended to be called by the AssetContainer when reloading an asset
             // Assumes the asset is already ready to go and just needs to be set up for loading
             void QueueAssetReload(AZ::Data::Asset<AZ::Data::AssetData> asset, bool signalLoaded);
@@ -380,6 +416,7 @@ namespace AZ
             * this makes sure that the containers are cleaned up and the loading is canceled as a part of destroying the AssetData.
             **/
             void ReleaseAssetContainersForAsset(AssetData* asset);
+            void ReleaseAssetContainersForAsset(const AssetId& assetId, int creationToken);
 
             /**
             * Clears all references to the owned asset container.
@@ -404,13 +441,13 @@ namespace AZ
             //! Queue an async file load with the AssetDataStream as the first step in an asset load
             void QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
+                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded,
+                AssetDataStream::RequestBatch* requestBatch = nullptr);
 
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
-            AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AZStd::shared_mutex     m_catalogMutex;     // lock when accessing the catalog map, lookups only need a shared lock
+            AZStd::array<AssetShard, AssetShardCount> m_assetShards;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -420,10 +457,7 @@ namespace AZ
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
-            int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
-
-            typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
-            ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
+            AZStd::atomic_int m_creationTokenGenerator{ 0 }; // this is used to generate unique identifiers for assets
 
             typedef AZStd::intrusive_list<AssetDatabaseJob, AZStd::list_base_hook<AssetDatabaseJob> > ActiveJobList;
             ActiveJobList           m_activeJobs;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetPreload.h>
+#include <AzCore/Debug/Profiler.h>
+
+namespace AZ::Data
+{
+    bool AssetPreloadProgress::IsComplete() const
+    {
+        return m_readyCount + m_failedCount == m_assetCount;
+    }
+
+    float AssetPreloadProgress::GetCompletionRatio() const
+    {
+        return m_assetCount > 0 ? static_cast<float>(m_readyCount + m_failedCount) / static_cast<float>(m_assetCount) : 1.0f;
+    }
+
+    double AssetPreloadProgress::GetReadThroughput() const
+    {
+        const AZ::s64 elapsedUs = m_elapsedTime.count();
+        return elapsedUs > 0 ? static_cast<double>(m_streamedBytes) * 1000000.0 / static_cast<double>(elapsedUs) : 0.0;
+    }
+
+    AssetPreload::AssetPreload()
+        : m_startTime(AZStd::chrono::steady_clock::now())
+    {
+    }
+
+    const AZStd::vector<Asset<AssetData>>& AssetPreload::GetAssets() const
+    {
+        return m_assets;
+    }
+
+    AssetPreloadProgress AssetPreload::GetProgress() const
+    {
+        AssetPreloadProgress progress;
+        progress.m_assetCount = m_assets.size();
+
+        for (size_t i = 0; i < m_assets.size(); ++i)
+        {
+            const AssetData::AssetStatus status = m_assets[i].GetStatus();
+            const AZ::u64 readSize = m_readSizes[i];
+            if (readSize > 0)
+            {
+                ++progress.m_readCount;
+                progress.m_requestedBytes += readSize;
+                // Every state past Queued means the streamer has delivered the data to the load job.
+                if (status != AssetData::AssetStatus::NotLoaded && status != AssetData::AssetStatus::Queued)
+                {
+                    ++progress.m_streamedCount;
+                    progress.m_streamedBytes += readSize;
+                }
+            }
+
+            if (status == AssetData::AssetStatus::Ready || status == AssetData::AssetStatus::ReadyPreNotify)
+            {
+                ++progress.m_readyCount;
+            }
+            else if (status == AssetData::AssetStatus::Error)
+            {
+                ++progress.m_failedCount;
+            }
+        }
+
+        const AZ::s64 elapsedUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            AZStd::chrono::steady_clock::now() - m_startTime).count();
+        if (progress.IsComplete())
+        {
+            // Freeze the elapsed time the first time the preload is seen complete, so the throughput doesn't keep decaying.
+            AZ::s64 expected = -1;
+            m_completionTimeUs.compare_exchange_strong(expected, elapsedUs);
+            progress.m_elapsedTime = AZStd::chrono::microseconds(m_completionTimeUs.load());
+        }
+        else
+        {
+            progress.m_elapsedTime = AZStd::chrono::microseconds(elapsedUs);
+        }
+
+        return progress;
+    }
+
+    AssetPreloadProgress AssetPreload::BlockUntilComplete()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        for (Asset<AssetData>& asset : m_assets)
+        {
+            if (!asset.IsReady() && !asset.IsError())
+            {
+                asset.BlockUntilLoadComplete();
+            }
+        }
+
+        return GetProgress();
+    }
+} // namespace AZ::Data
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ::Data
+{
+    class AssetManager;
+
+    //! Snapshot of the state of a bulk preload started with AssetManager::PreloadAssets.
+    struct AssetPreloadProgress
+    {
+        size_t m_assetCount{ 0 };       //!< Number of assets in the preload, including the dependencies of the root assets.
+        size_t m_readCount{ 0 };        //!< Number of assets the preload issued a file read for.
+        size_t m_streamedCount{ 0 };    //!< Number of issued file reads that finished.
+        size_t m_readyCount{ 0 };       //!< Number of assets that finished loading successfully.
+        size_t m_failedCount{ 0 };      //!< Number of assets that failed to load.
+        AZ::u64 m_requestedBytes{ 0 };  //!< Total size of the issued file reads.
+        AZ::u64 m_streamedBytes{ 0 };   //!< Total size of the issued file reads that finished.
+        AZStd::chrono::microseconds m_elapsedTime{ 0 }; //!< Time since the preload started, or its total time once it completed.
+
+        //! True once every asset in the preload finished loading, whether successful or not.
+        bool IsComplete() const;
+        //! Fraction of the assets that finished loading, in the range [0, 1].
+        float GetCompletionRatio() const;
+        //! Average file read throughput in bytes per second over the elapsed time.
+        double GetReadThroughput() const;
+    };
+
+    //! Set of assets that are loaded together by AssetManager::PreloadAssets.
+    //! The preload holds a reference to each of its assets, so they stay loaded for as long as the preload is alive.
+    class AssetPreload
+    {
+        friend class AssetManager;
+
+    public:
+        AZ_CLASS_ALLOCATOR(AssetPreload, SystemAllocator);
+
+        AssetPreload();
+        AssetPreload(const AssetPreload&) = delete;
+        AssetPreload& operator=(const AssetPreload&) = delete;
+
+        //! The root assets and all of their dependencies, in the order their file reads were issued.
+        const AZStd::vector<Asset<AssetData>>& GetAssets() const;
+
+        //! Gathers the current state of all assets in the preload. Can be called from any thread.
+        AssetPreloadProgress GetProgress() const;
+
+        //! Blocks until every asset in the preload finished loading and returns the final progress.
+        AssetPreloadProgress BlockUntilComplete();
+
+    private:
+        AZStd::vector<Asset<AssetData>> m_assets;
+        AZStd::vector<AZ::u64> m_readSizes; //!< Size of the file read issued for each asset, or 0 if no read was issued.
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        mutable AZStd::atomic<AZ::s64> m_completionTimeUs{ -1 }; //!< Elapsed time at which the preload was first seen complete.
+    };
+} // namespace AZ::Data
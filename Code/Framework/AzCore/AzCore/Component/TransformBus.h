@@ -94,6 +94,15 @@ namespace AZ
         //! @param tm A reference to a transform for positioning the entity within the world.
         virtual void SetWorldTM([[maybe_unused]] const Transform& tm) {}
 
+        //! Sets the world transform but defers notifying the listeners until NotifyTransformChanged is called.
+        //! Used by systems that move many entities at once, so all of them are moved before any listener runs.
+        //! Implementations that can't defer the notifications send them right away.
+        //! @param tm A reference to a transform for positioning the entity within the world.
+        virtual void SetWorldTMDeferNotification(const Transform& tm) { SetWorldTM(tm); }
+
+        //! Notifies all listeners of a transform set with SetWorldTMDeferNotification. Does nothing if no notification is pending.
+        virtual void NotifyTransformChanged() {}
+
         //! Retrieves the entity's local and world transforms.
         //! @param[out] localTM A reference to a transform that represents the entity's
         //! position relative to its parent entity.
@@ -412,6 +412,11 @@ namespace AZ
         return nullptr;
     }
 
+    bool TaskExecutor::IsTaskWorkerThread() const
+    {
+        return Internal::TaskWorker::t_worker && Internal::TaskWorker::t_worker->m_executor == this;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
 
@@ -136,6 +136,10 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // Returns true if the calling thread is one of the workers of this executor. Work submitted from a worker
+        // must not be waited on by that worker
+        bool IsTaskWorkerThread() const;
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
     private:
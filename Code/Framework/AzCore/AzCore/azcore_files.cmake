@@ -23,6 +23,8 @@ set(FILES
     Asset/AssetManagerBus.h
     Asset/AssetManagerComponent.cpp
     Asset/AssetManagerComponent.h
+    Asset/AssetPreload.cpp
+    Asset/AssetPreload.h
     Asset/AssetSerializer.cpp
     Asset/AssetSerializer.h
     Asset/AssetTypeInfoBus.h
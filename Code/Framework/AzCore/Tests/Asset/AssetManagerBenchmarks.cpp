@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Asset get/release throughput of the AssetManager from many threads at once. The assets never get loaded, so these
+    // only measure the cost of looking up, creating and releasing assets, which is where job threads contend during
+    // streaming heavy level loads.
+
+    class BenchmarkAsset
+        : public AZ::Data::AssetData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BenchmarkAsset, AZ::SystemAllocator);
+        AZ_RTTI(BenchmarkAsset, "{5F6D0B2A-8E1C-4D57-9C3B-6A2E1F7D4B90}", AZ::Data::AssetData);
+    };
+
+    class BenchmarkAssetHandler
+        : public AZ::Data::AssetHandler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BenchmarkAssetHandler, AZ::SystemAllocator);
+
+        AZ::Data::AssetPtr CreateAsset([[maybe_unused]] const AZ::Data::AssetId& id, [[maybe_unused]] const AZ::Data::AssetType& type) override
+        {
+            return aznew BenchmarkAsset();
+        }
+
+        void DestroyAsset(AZ::Data::AssetPtr ptr) override
+        {
+            delete ptr;
+        }
+
+        void GetHandledAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes) override
+        {
+            assetTypes.push_back(azrtti_typeid<BenchmarkAsset>());
+        }
+
+    protected:
+        LoadResult LoadAssetData(
+            [[maybe_unused]] const AZ::Data::Asset<AZ::Data::AssetData>& asset,
+            [[maybe_unused]] AZStd::shared_ptr<AZ::Data::AssetDataStream> stream,
+            [[maybe_unused]] const AZ::Data::AssetFilterCB& assetLoadFilterCB) override
+        {
+            return LoadResult::Error;
+        }
+    };
+
+    class AssetManagerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t AssetCount = 4096;
+
+    protected:
+        // Only the first thread sets up and tears down the asset manager. All threads wait for each other before and after
+        // the benchmark loop, so the other threads never see a partially initialized asset manager.
+        void SetUpAssetManager(const benchmark::State& state, bool holdAssets)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            AZ::Data::AssetManager::Descriptor desc;
+            AZ::Data::AssetManager::Create(desc);
+            // There's no catalog, so skip the asset id upgrade lookups.
+            AZ::Data::AssetManager::Instance().SetAssetInfoUpgradingEnabled(false);
+            AZ::Data::AssetManager::Instance().RegisterHandler(aznew BenchmarkAssetHandler(), azrtti_typeid<BenchmarkAsset>());
+
+            m_assetIds.reserve(AssetCount);
+            for (size_t i = 0; i < AssetCount; ++i)
+            {
+                m_assetIds.emplace_back(AZ::Uuid::CreateRandom(), 0);
+                if (holdAssets)
+                {
+                    m_heldAssets.push_back(AZ::Data::AssetManager::Instance().FindOrCreateAsset<BenchmarkAsset>(
+                        m_assetIds.back(), AZ::Data::AssetLoadBehavior::Default));
+                }
+            }
+        }
+
+        void TearDownAssetManager(const benchmark::State& state)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            m_heldAssets = {};
+            m_assetIds = {};
+            // Destroying the asset manager also deletes the registered handler.
+            AZ::Data::AssetManager::Destroy();
+        }
+
+        AZStd::vector<AZ::Data::AssetId> m_assetIds;
+        AZStd::vector<AZ::Data::Asset<BenchmarkAsset>> m_heldAssets;
+    };
+
+    // All threads look up assets that are kept alive, so every iteration is a find plus a reference count increment and decrement.
+    BENCHMARK_DEFINE_F(AssetManagerBenchmark, FindOrCreateAsset_ExistingAssets)(benchmark::State& state)
+    {
+        SetUpAssetManager(state, true);
+
+        size_t index = state.thread_index();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Data::Asset<BenchmarkAsset> asset = AZ::Data::AssetManager::Instance().FindOrCreateAsset<BenchmarkAsset>(
+                m_assetIds[index % AssetCount], AZ::Data::AssetLoadBehavior::Default);
+            AZ::Data::Asset<BenchmarkAsset> copy = asset;
+            benchmark::DoNotOptimize(copy.Get());
+            index += state.threads();
+        }
+
+        TearDownAssetManager(state);
+    }
+
+    // Every thread works on its own set of assets that aren't referenced anywhere else, so each iteration creates an asset
+    // and destroys it again when the last reference is released.
+    BENCHMARK_DEFINE_F(AssetManagerBenchmark, FindOrCreateAsset_CreateAndRelease)(benchmark::State& state)
+    {
+        SetUpAssetManager(state, false);
+
+        size_t index = state.thread_index();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Data::Asset<BenchmarkAsset> asset = AZ::Data::AssetManager::Instance().FindOrCreateAsset<BenchmarkAsset>(
+                m_assetIds[index % AssetCount], AZ::Data::AssetLoadBehavior::Default);
+            benchmark::DoNotOptimize(asset.Get());
+            index += state.threads();
+        }
+
+        TearDownAssetManager(state);
+    }
+
+    BENCHMARK_REGISTER_F(AssetManagerBenchmark, FindOrCreateAsset_ExistingAssets)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+    BENCHMARK_REGISTER_F(AssetManagerBenchmark, FindOrCreateAsset_CreateAndRelease)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif
@@ -661,6 +661,101 @@ namespace UnitTest
         AssetManager::Destroy();
     }
 
+    // Resuming asset release destroys containers and assets whose dependencies live in other shards of the asset map.
+    // Run it repeatedly while other threads acquire and release assets with preload dependencies, to catch lock order inversions.
+    TEST_F(AssetJobsFloodTest, SuspendResumeAssetRelease_ConcurrentAcquireAndRelease_NoDeadlock)
+    {
+        auto assetUuids = {
+            MyAsset1Id,
+            MyAsset2Id,
+            MyAsset3Id,
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        AZStd::mutex mutex;
+        AZStd::atomic<int> threadCount(static_cast<int>(assetUuids.size()) + 1);
+        AZStd::condition_variable cv;
+        AZStd::atomic_bool keepDispatching(true);
+        AZStd::atomic_bool keepSuspending(true);
+
+        auto dispatch = [&keepDispatching]() {
+            while (keepDispatching)
+            {
+                AssetManager::Instance().DispatchEvents();
+            }
+        };
+
+        AZStd::thread dispatchThread(dispatch);
+
+        threads.emplace_back([&threadCount, &cv, &keepSuspending]() {
+            while (keepSuspending)
+            {
+                AssetManager::Instance().SuspendAssetRelease();
+                AZStd::this_thread::yield();
+                AssetManager::Instance().ResumeAssetRelease();
+            }
+
+            --threadCount;
+            cv.notify_one();
+        });
+
+        AZStd::atomic<int> acquireThreadCount(static_cast<int>(assetUuids.size()));
+        for (const auto& assetUuid : assetUuids)
+        {
+            threads.emplace_back([this, &threadCount, &acquireThreadCount, &keepSuspending, &cv, assetUuid]() {
+                for (int i = 0; i < 1000; i++)
+                {
+                    // Blocking on a load isn't safe while release is suspended, the assets are released while they are still loading
+                    Asset<AssetWithAssetReference> asset =
+                        m_testAssetManager->GetAsset(assetUuid, azrtti_typeid<AssetWithAssetReference>(), AZ::Data::AssetLoadBehavior::PreLoad);
+                }
+
+                if (--acquireThreadCount == 0)
+                {
+                    keepSuspending = false;
+                }
+                --threadCount;
+                cv.notify_one();
+            });
+        }
+
+        bool timedOut = false;
+
+        // Used to detect a deadlock.  If we wait for more than 5 seconds, it's likely a deadlock has occurred
+        while (threadCount > 0 && !timedOut)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(mutex);
+            timedOut = (AZStd::cv_status::timeout == cv.wait_until(lock, AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds));
+        }
+
+        ASSERT_EQ(threadCount, 0) << "Thread count is non-zero, a thread has likely deadlocked.  Test will not shut down cleanly.";
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        keepDispatching = false;
+        dispatchThread.join();
+
+        // With no references left and releases resumed, every asset and its dependencies are released
+        int retryCount = 100;
+        while ((--retryCount > 0) && !m_testAssetManager->GetAssets().empty())
+        {
+            AssetManager::Instance().DispatchEvents();
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+        }
+        EXPECT_TRUE(m_testAssetManager->GetAssets().empty());
+
+        // And the assets can still be loaded afterwards
+        Asset<AssetWithAssetReference> asset =
+            m_testAssetManager->GetAsset(MyAsset1Id, azrtti_typeid<AssetWithAssetReference>(), AZ::Data::AssetLoadBehavior::PreLoad);
+        asset.BlockUntilLoadComplete();
+        EXPECT_TRUE(asset.IsReady());
+        asset = {};
+        AssetManager::Instance().DispatchEvents();
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_AssetLoadBehaviorIsPreserved)
 #else
@@ -1354,6 +1449,72 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_PreloadAssets_AssetWithNoLoadReference_LoadsRootOnly)
+#else
+    TEST_F(AssetJobsFloodTest, PreloadAssets_AssetWithNoLoadReference_LoadsRootOnly)
+#endif // AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            const AZ::Data::AssetId rootAssets[] = { NoLoadAssetId };
+            AZStd::shared_ptr<AZ::Data::AssetPreload> preload = m_testAssetManager->PreloadAssets(rootAssets);
+            ASSERT_NE(preload, nullptr);
+
+            AZ::Data::AssetPreloadProgress progress = preload->BlockUntilComplete();
+            EXPECT_TRUE(progress.IsComplete());
+            EXPECT_EQ(progress.m_assetCount, 1u);
+            EXPECT_EQ(progress.m_readyCount, 1u);
+            EXPECT_EQ(progress.m_failedCount, 0u);
+            EXPECT_EQ(progress.m_streamedCount, progress.m_readCount);
+            EXPECT_EQ(progress.m_streamedBytes, progress.m_requestedBytes);
+            EXPECT_EQ(preload->GetAssets()[0].GetId(), NoLoadAssetId);
+
+            // The NoLoad dependency was skipped.
+            EXPECT_FALSE(m_testAssetManager->FindAsset(MyAsset2Id, AZ::Data::AssetLoadBehavior::Default));
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_PreloadAssets_LoadAllWithSharedDependencies_LoadsEachAssetOnce)
+#else
+    TEST_F(AssetJobsFloodTest, PreloadAssets_LoadAllWithSharedDependencies_LoadsEachAssetOnce)
+#endif // AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            // MyAsset2 is also a dependency of the NoLoad asset, so it must only be loaded once.
+            const AZ::Data::AssetId rootAssets[] = { NoLoadAssetId, MyAsset2Id };
+            AZStd::shared_ptr<AZ::Data::AssetPreload> preload = m_testAssetManager->PreloadAssets(
+                rootAssets, AssetLoadParameters(nullptr, AZ::Data::AssetDependencyLoadRules::LoadAll));
+            ASSERT_NE(preload, nullptr);
+
+            AZ::Data::AssetPreloadProgress progress = preload->BlockUntilComplete();
+            EXPECT_TRUE(progress.IsComplete());
+            EXPECT_EQ(progress.m_assetCount, 3u);
+            EXPECT_EQ(progress.m_readyCount, 3u);
+            EXPECT_EQ(progress.m_streamedCount, progress.m_readCount);
+            EXPECT_EQ(progress.GetCompletionRatio(), 1.0f);
+
+            for (const AZ::Data::Asset<AZ::Data::AssetData>& asset : preload->GetAssets())
+            {
+                EXPECT_TRUE(asset.IsReady());
+            }
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_AssetWithNoLoadReference_LoadDependencies_BehaviorObeyed)
 #else
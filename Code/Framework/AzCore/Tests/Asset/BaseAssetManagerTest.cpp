@@ -35,10 +35,11 @@ namespace UnitTest
     */
     AZ::Data::AssetData::AssetStatus TestAssetManager::GetReloadStatus(const AssetId& assetId)
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
 
-        auto reloadInfo = m_reloads.find(assetId);
-        if (reloadInfo != m_reloads.end())
+        auto reloadInfo = shard.m_reloads.find(assetId);
+        if (reloadInfo != shard.m_reloads.end())
         {
             return reloadInfo->second.GetStatus();
         }
@@ -50,9 +51,9 @@ namespace UnitTest
         return m_ownedAssetContainers;
     }
 
-    const AssetManager::AssetMap& TestAssetManager::GetAssets() const
+    AssetManager::AssetMap TestAssetManager::GetAssets()
     {
-        return m_assets;
+        return GetAllAssets();
     }
 
     void BaseAssetManagerTest::SetUp()
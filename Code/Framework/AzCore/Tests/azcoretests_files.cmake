@@ -10,6 +10,7 @@ set(FILES
     Main.cpp
     Asset/AssetCommon.cpp
     Asset/AssetDataStreamTests.cpp
+    Asset/AssetManagerBenchmarks.cpp
     Asset/AssetManagerLoadingTests.cpp
     Asset/AssetManagerStreamingTests.cpp
     Asset/BaseAssetManagerTest.cpp
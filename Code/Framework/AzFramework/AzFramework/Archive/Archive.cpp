@@ -383,6 +383,7 @@ namespace AZ::IO
     {
         CompressionBus::Handler::BusDisconnect();
 
+        m_mountedPacks.reset();
         m_arrZips = {};
 
         [[maybe_unused]] uint32_t numFilesForcedToClose = 0;
@@ -701,38 +702,123 @@ namespace AZ::IO
         }
 
 
-        AZStd::shared_lock lock(m_csZips);
-        // scan through registered archive files and try to find this file
-        for (auto itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
+        AZStd::shared_ptr<const MountedPacks> mountedPacks = GetMountedPacks();
+        const ZipArray& zips = mountedPacks->m_zips;
+
+        auto findInPack = [&resolvedPath](const PackDesc& pack) -> ZipDir::FileEntry*
         {
-            if (itZip->pArchive->GetFlags() & INestedArchive::FLAGS_DISABLE_PAK)
+            if (pack.pArchive->GetFlags() & INestedArchive::FLAGS_DISABLE_PAK)
             {
-                continue;
+                return nullptr;
             }
 
-
             // If the bindRootIter is at the end then it is a prefix of the source path
-            if (resolvedPath.IsRelativeTo(itZip->m_pathBindRoot))
+            if (!resolvedPath.IsRelativeTo(pack.m_pathBindRoot))
             {
-                // unaliasedIter is past the bind root, so append the rest of it to a new relative path object
-                AZ::IO::FixedMaxPath relativePathInZip = resolvedPath.LexicallyRelative(itZip->m_pathBindRoot);
+                return nullptr;
+            }
 
-                ZipDir::FileEntry* pFileEntry = itZip->pZip->FindFile(relativePathInZip.Native());
-                if (pFileEntry)
-                {
-                    if (pZip)
-                    {
-                        *pZip = itZip->pZip;
-                    }
+            // unaliasedIter is past the bind root, so append the rest of it to a new relative path object
+            AZ::IO::FixedMaxPath relativePathInZip = resolvedPath.LexicallyRelative(pack.m_pathBindRoot);
+            return pack.pZip->FindFile(relativePathInZip.Native());
+        };
 
-                    nArchiveFlags = itZip->pArchive->GetFlags();
-                    return pFileEntry;
-                }
+        // Archives later in the array have priority for files with the same name, so keep the match with the highest index.
+        // The path index only narrows down the archives to check, every candidate is still confirmed with the archive itself.
+        ZipDir::FileEntry* pFileEntry = nullptr;
+        uint32_t foundZipIndex = 0;
+        auto checkCandidate = [&](uint32_t zipIndex)
+        {
+            if (pFileEntry && zipIndex <= foundZipIndex)
+            {
+                return;
             }
+
+            if (ZipDir::FileEntry* candidateEntry = findInPack(zips[zipIndex]); candidateEntry)
+            {
+                pFileEntry = candidateEntry;
+                foundZipIndex = zipIndex;
+            }
+        };
+
+        const size_t pathHash = AZStd::hash<AZ::IO::PathView>{}(resolvedPath.LexicallyNormal());
+        auto [candidateBegin, candidateEnd] = mountedPacks->m_pathIndex.equal_range(pathHash);
+        for (auto candidateIt = candidateBegin; candidateIt != candidateEnd; ++candidateIt)
+        {
+            checkCandidate(candidateIt->second);
+        }
+        for (uint32_t zipIndex : mountedPacks->m_unindexedZips)
+        {
+            checkCandidate(zipIndex);
         }
-        nArchiveFlags = 0;
 
-        return nullptr;
+        if (!pFileEntry)
+        {
+            nArchiveFlags = 0;
+            return nullptr;
+        }
+
+        if (pZip)
+        {
+            *pZip = zips[foundZipIndex].pZip;
+        }
+
+        nArchiveFlags = zips[foundZipIndex].pArchive->GetFlags();
+        return pFileEntry;
+    }
+
+    auto Archive::GetMountedPacks() const -> AZStd::shared_ptr<const MountedPacks>
+    {
+        {
+            AZStd::shared_lock lock(m_csZips);
+            if (m_mountedPacks)
+            {
+                return m_mountedPacks;
+            }
+        }
+
+        AZStd::unique_lock lock(m_csZips);
+        // another thread may have rebuilt the snapshot while waiting for the lock
+        if (!m_mountedPacks)
+        {
+            m_mountedPacks = BuildMountedPacks(m_arrZips);
+        }
+        return m_mountedPacks;
+    }
+
+    auto Archive::BuildMountedPacks(const ZipArray& zips) -> AZStd::shared_ptr<const MountedPacks>
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        auto mountedPacks = AZStd::make_shared<MountedPacks>();
+        mountedPacks->m_zips = zips;
+
+        size_t indexedFileCount = 0;
+        for (const PackDesc& pack : zips)
+        {
+            indexedFileCount += pack.pZip->HasFileIndex() ? pack.pZip->GetFileIndex().size() : 0;
+        }
+        mountedPacks->m_pathIndex.reserve(indexedFileCount);
+
+        AZ::IO::Path fullPath;
+        for (uint32_t zipIndex = 0; zipIndex < aznumeric_cast<uint32_t>(zips.size()); ++zipIndex)
+        {
+            const PackDesc& pack = zips[zipIndex];
+            if (!pack.pZip->HasFileIndex())
+            {
+                mountedPacks->m_unindexedZips.push_back(zipIndex);
+                continue;
+            }
+
+            for (const auto& [relativePath, fileEntry] : pack.pZip->GetFileIndex())
+            {
+                fullPath = pack.m_pathBindRoot;
+                fullPath /= relativePath;
+                mountedPacks->m_pathIndex.emplace(AZStd::hash<AZ::IO::PathView>{}(fullPath), zipIndex);
+            }
+        }
+
+        return mountedPacks;
     }
 
     ZipDir::FileEntry* Archive::FindPakFileEntry(AZStd::string_view szPath) const
@@ -1206,6 +1292,7 @@ namespace AZ::IO
         }
 
         m_arrZips.insert(revItZip.base(), desc);
+        m_mountedPacks.reset();
 
         if (bundleManifest && bundleCatalog)
         {
@@ -1248,6 +1335,7 @@ namespace AZ::IO
                 }, it->GetFullPath());
 
                 it = m_arrZips.erase(it);
+                m_mountedPacks.reset();
             }
             else
             {
@@ -21,6 +21,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -128,6 +129,20 @@ namespace AZ::IO
         };
         using ZipArray = AZStd::vector<PackDesc, AZ::OSStdAllocator>;
 
+        // Snapshot of the opened archives with an index from the hash of the full path of each file they contain
+        // to the archives containing that file. A snapshot never changes after it's built, so file lookups only
+        // hold m_csZips while they take a reference to the current snapshot.
+        struct MountedPacks
+        {
+            AZ_CLASS_ALLOCATOR(MountedPacks, AZ::SystemAllocator);
+
+            ZipArray m_zips;
+            // full path hash => index in m_zips. Several archives can contain the same file
+            AZStd::unordered_multimap<size_t, uint32_t> m_pathIndex;
+            // indices in m_zips of archives without a file index, these are searched on every lookup
+            AZStd::vector<uint32_t> m_unindexedZips;
+        };
+
         // ArchiveFindDataSet entire purpose is to keep a reference to the intrusive_ptr of ArchiveFindData
         // so that it doesn't go out of scope
         using ArchiveFindDataSet = AZStd::set<AZStd::intrusive_ptr<AZ::IO::FindData>>;
@@ -280,6 +295,10 @@ namespace AZ::IO
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
 
+        // returns the current snapshot of the opened archives, building it if the opened archives changed since the last call
+        AZStd::shared_ptr<const MountedPacks> GetMountedPacks() const;
+        static AZStd::shared_ptr<const MountedPacks> BuildMountedPacks(const ZipArray& zips);
+
         void CheckFileAccess(AZStd::string_view szFilename);
 
         // this function gets the file data for the given file, if found.
@@ -316,6 +335,8 @@ namespace AZ::IO
 
         mutable AZStd::shared_mutex m_csZips;
         ZipArray m_arrZips;
+        // guarded by m_csZips. Reset whenever m_arrZips changes, and rebuilt on the next file lookup
+        mutable AZStd::shared_ptr<const MountedPacks> m_mountedPacks;
 
         AZ::SettingsRegistryInterface::NotifyEventHandler m_componentApplicationLifecycleHandler;
 
@@ -150,6 +150,7 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_fileIndex.clear();
         m_treeDir.Clear();
     }
 
@@ -666,11 +667,6 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
-        {
-            return ZD_ERROR_IO_FAILED;
-        }
-
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
         void* pBuffer = pCompressed; // the buffer where the compressed data will go
@@ -693,9 +689,18 @@ namespace AZ::IO::ZipDir
             pBuffer = memoryBlock->m_address.get();
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
         {
-            return ZD_ERROR_IO_FAILED;
+            // only the seek and read need to be exclusive, the decompression below can run in parallel with reads of other entries
+            AZStd::scoped_lock fileIoLock(m_fileIoMutex);
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
         }
 
         // if there's a buffer for uncompressed data, uncompress it to that buffer
@@ -735,6 +740,21 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
+        if (HasFileIndex())
+        {
+            if (auto fileIt = m_fileIndex.find(szPath); fileIt != m_fileIndex.end())
+            {
+                return fileIt->second;
+            }
+
+            if (az_archive_zip_directory_cache_verbosity)
+            {
+                AZ_TracePrintf("Archive", "File index lookup failed to find file %.*s at root %.*s", AZ_STRING_ARG(szPath.Native()),
+                    AZ_STRING_ARG(GetFilePath().Native()));
+            }
+            return {};
+        }
+
         ZipDir::FindFile fd(GetRoot());
         FileEntry* fileEntry = fd.FindExact(szPath);
         if (!fileEntry)
@@ -760,6 +780,8 @@ namespace AZ::IO::ZipDir
         {
             return ZD_ERROR_SUCCESS; // the data offset has been successfully read..
         }
+        // reading the local header moves the file position
+        AZStd::scoped_lock fileIoLock(m_fileIoMutex);
         CZipFile tmp;
         tmp.m_fileHandle = m_fileHandle;
         return ZipDir::Refresh(&tmp, pFileEntry);
@@ -19,6 +19,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -80,6 +81,8 @@ namespace AZ::IO::ZipDir
 
         FileEntry* FindFile(AZStd::string_view szPath, bool bFullInfo = false);
 
+        // reads the file data and decompresses it if an uncompressed buffer is provided
+        // can be called from several threads at once, only the file reads are serialized, decompression runs concurrently
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
         void Free(void* ptr)
@@ -108,6 +111,18 @@ namespace AZ::IO::ZipDir
             return &m_treeDir;
         }
 
+        // returns true if all files can be looked up through the flat file index.
+        // this is the case for read-only caches, as their directory tree never changes after the CDR has been read
+        bool HasFileIndex() const
+        {
+            return (m_nFlags & FLAGS_READ_ONLY) != 0;
+        }
+
+        const FileEntryIndex& GetFileIndex() const
+        {
+            return m_fileIndex;
+        }
+
         // writes the CDR to the disk
         bool WriteCDR() { return WriteCDR(m_fileHandle); }
         bool WriteCDR(AZ::IO::HandleType fTarget);
@@ -131,7 +146,11 @@ namespace AZ::IO::ZipDir
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
+        // index of all files in m_treeDir by their full path. The paths point into the CDR buffer. Only built for read-only caches
+        FileEntryIndex m_fileIndex;
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
+        // serializes the seek and read pairs on m_fileHandle, so entries can be read from several threads at once
+        AZStd::mutex m_fileIoMutex;
         AZ::IO::Path m_strFilePath;
 
         // String Pool for persistently storing paths as long as they reside in the cache
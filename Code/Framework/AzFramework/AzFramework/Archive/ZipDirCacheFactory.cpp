@@ -164,6 +164,7 @@ namespace AZ::IO::ZipDir
         Adjuster.RefreshEOFOffsets();
 
         m_treeFileEntries.Swap(rwCache.m_treeDir);
+        m_fileIndex.swap(rwCache.m_fileIndex);
         m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
 
         // very important: we need this offset to be able to add to the zip file
@@ -312,6 +313,7 @@ namespace AZ::IO::ZipDir
         m_nCDREndPos = 0;
         memset(&m_CDREnd, 0, sizeof(m_CDREnd));
         m_mapFileEntries.clear();
+        m_fileIndex.clear();
         m_treeFileEntries.Clear();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
     }
@@ -471,6 +473,11 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
+        if (m_bBuildFileEntryTree && (m_nFlags & FLAGS_READ_ONLY))
+        {
+            m_fileIndex.reserve(m_CDREnd.numEntriesTotal);
+        }
+
         // now we've read the complete CDR - parse it.
         ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
         const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
@@ -574,7 +581,16 @@ namespace AZ::IO::ZipDir
 
         if (m_bBuildFileEntryTree)
         {
-            m_treeFileEntries.Add(strFilePath, fileEntry);
+            FileEntry* pFile = m_treeFileEntries.Add(strFilePath);
+            if (pFile && !pFile->IsInitialized())
+            {
+                static_cast<FileEntryBase&>(*pFile) = fileEntry;
+                if (m_nFlags & FLAGS_READ_ONLY)
+                {
+                    // strFilePath lives in the CDR buffer, which is handed over to the cache together with the index
+                    m_fileIndex.emplace(strFilePath, pFile);
+                }
+            }
         }
     }
 
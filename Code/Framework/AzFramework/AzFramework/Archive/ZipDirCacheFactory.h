@@ -95,6 +95,8 @@ namespace AZ::IO::ZipDir
         FileEntryMap m_mapFileEntries;
 
         FileEntryTree m_treeFileEntries;
+        // only built for read-only caches
+        FileEntryIndex m_fileIndex;
 
         AZStd::vector<uint8_t> m_CDR_buffer;
 
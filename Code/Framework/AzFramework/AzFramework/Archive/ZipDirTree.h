@@ -12,6 +12,7 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -80,4 +81,7 @@ namespace AZ::IO::ZipDir
         SubdirMap m_mapDirs;
         FileMap m_mapFiles;
     };
+
+    // flat index from the full relative path of a file to its entry in the FileEntryTree
+    using FileEntryIndex = AZStd::unordered_map<AZ::IO::PathView, FileEntry*>;
 }
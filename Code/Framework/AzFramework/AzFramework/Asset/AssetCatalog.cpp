@@ -32,6 +32,11 @@
 // uncomment to have the catalog be dumped to stdout:
 //#define DEBUG_DUMP_CATALOG
 
+namespace AssetCatalogInternal
+{
+    // When enabled the catalog loads the flat catalog written next to the asset catalog instead of deserializing the asset catalog.
+    static constexpr const char* UseFlatCatalogKey = "/O3DE/AzFramework/AssetCatalog/UseFlatCatalog";
+}
 
 namespace AzFramework
 {
@@ -185,6 +190,11 @@ namespace AzFramework
             return foundIter->second.m_relativePath;
         }
 
+        if (const FlatAssetCatalog::AssetRecord* record = FindFlatAssetInfo(id))
+        {
+            return AZStd::string(m_flatCatalog->GetRelativePath(*record));
+        }
+
         return AZStd::string();
     }
 
@@ -214,6 +224,11 @@ namespace AzFramework
             return foundIter->second;
         }
 
+        if (const FlatAssetCatalog::AssetRecord* record = FindFlatAssetInfo(id))
+        {
+            return m_flatCatalog->GetAssetInfo(*record);
+        }
+
         return AZ::Data::AssetInfo();
     }
 
@@ -232,14 +247,13 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
-            if (foundId.IsValid())
+            AZ::Data::AssetId foundId = GetAssetIdByPathInternal(m_pathBuffer.c_str());
+            AZ::Data::AssetType foundType;
+            if (foundId.IsValid() && FindAssetTypeInternal(foundId, foundType))
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
-
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
-                if (!autoRegisterIfNotFound || !assetInfo.m_assetType.IsNull())
+                if (!autoRegisterIfNotFound || !foundType.IsNull())
                 {
                     return foundId;
                 }
@@ -290,6 +304,19 @@ namespace AzFramework
             registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
         }
 
+        if (m_flatCatalog)
+        {
+            for (size_t i = 0; i < m_flatCatalog->GetRecordCount(); ++i)
+            {
+                const FlatAssetCatalog::AssetRecord& record = m_flatCatalog->GetRecord(i);
+                const AZ::Data::AssetId assetId = FlatAssetCatalog::GetAssetId(record);
+                if (m_registry->m_assetIdToInfo.find(assetId) == m_registry->m_assetIdToInfo.end() && FindFlatAssetInfo(assetId))
+                {
+                    registeredAssetPaths.emplace_back(m_flatCatalog->GetRelativePath(record));
+                }
+            }
+        }
+
         return registeredAssetPaths;
     }
 
@@ -298,12 +325,24 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
         auto itr = m_registry->m_assetDependencies.find(id);
 
-        if (itr == m_registry->m_assetDependencies.end())
+        if (itr != m_registry->m_assetDependencies.end())
+        {
+            return AZ::Success(itr->second);
+        }
+
+        if (const FlatAssetCatalog::AssetRecord* record = FindFlatAssetDependencies(id))
         {
-            return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
+            AZStd::span<const FlatAssetCatalog::DependencyRecord> flatDependencies = m_flatCatalog->GetDependencies(*record);
+            AZStd::vector<AZ::Data::ProductDependency> dependencies;
+            dependencies.reserve(flatDependencies.size());
+            for (const FlatAssetCatalog::DependencyRecord& dependency : flatDependencies)
+            {
+                dependencies.push_back(FlatAssetCatalog::GetDependency(dependency));
+            }
+            return AZ::Success(AZStd::move(dependencies));
         }
 
-        return AZ::Success(itr->second);
+        return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
     }
 
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetAllProductDependencies(const AZ::Data::AssetId& id)
@@ -407,52 +446,57 @@ namespace AzFramework
     {
         using namespace AZ::Data;
 
-        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
-
-        if (itr != m_registry->m_assetDependencies.end())
+        auto addDependency = [&](const ProductDependency& dependency)
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
+            if (!dependency.m_assetId.IsValid())
+            {
+                return;
+            }
 
-            for (const ProductDependency& dependency : assetDependencyList)
+            if(exclusionList.find(dependency.m_assetId) != exclusionList.end())
             {
-                if (!dependency.m_assetId.IsValid())
-                {
-                    continue;
-                }
+                return;
+            }
 
-                if(exclusionList.find(dependency.m_assetId) != exclusionList.end())
+            for (const AZStd::string& wildcardPattern : wildcardPatternExclusionList)
+            {
+                if (DoesAssetIdMatchWildcardPatternInternal(dependency.m_assetId, wildcardPattern))
                 {
-                    continue;
+                    return;
                 }
+            }
 
-                bool isWildcardMatch = false;
-                for (const AZStd::string& wildcardPattern : wildcardPatternExclusionList)
-                {
-                    isWildcardMatch = DoesAssetIdMatchWildcardPatternInternal(dependency.m_assetId, wildcardPattern);
-                    if (isWildcardMatch)
-                    {
-                        break;
-                    }
-                }
-                if (isWildcardMatch)
-                {
-                    continue;
-                }
+            auto loadBehavior = AZ::Data::ProductDependencyInfo::LoadBehaviorFromFlags(dependency.m_flags);
+            if (loadBehavior == AZ::Data::AssetLoadBehavior::PreLoad)
+            {
+                preloadAssetList[searchAssetId].insert(dependency.m_assetId);
+            }
 
-                auto loadBehavior = AZ::Data::ProductDependencyInfo::LoadBehaviorFromFlags(dependency.m_flags);
-                if (loadBehavior == AZ::Data::AssetLoadBehavior::PreLoad)
-                {
-                    preloadAssetList[searchAssetId].insert(dependency.m_assetId);
-                }
+            // Only proceed if this ID is valid and we haven't encountered this assetId before.
+            // Invalid IDs usually come from unmet path product dependencies.
+            if (assetSet.find(dependency.m_assetId) == assetSet.end())
+            {
+                assetSet.insert(dependency.m_assetId); // add to the set of already-encountered assets
+                dependencyList.push_back(dependency); // put it in the flat list of dependencies we've found
+            }
+        };
 
-                // Only proceed if this ID is valid and we haven't encountered this assetId before.
-                // Invalid IDs usually come from unmet path product dependencies.
-                if (assetSet.find(dependency.m_assetId) == assetSet.end())
-                {
-                    assetSet.insert(dependency.m_assetId); // add to the set of already-encountered assets
-                    dependencyList.push_back(dependency); // put it in the flat list of dependencies we've found
-                }
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
+
+        if (itr != m_registry->m_assetDependencies.end())
+        {
+            for (const ProductDependency& dependency : itr->second)
+            {
+                addDependency(dependency);
+            }
+        }
+        else if (const FlatAssetCatalog::AssetRecord* record = FindFlatAssetDependencies(searchAssetId))
+        {
+            // Read the dependencies straight from the flat catalog so walking the dependency tree doesn't copy the lists.
+            for (const FlatAssetCatalog::DependencyRecord& dependency : m_flatCatalog->GetDependencies(*record))
+            {
+                addDependency(FlatAssetCatalog::GetDependency(dependency));
             }
         }
     }
@@ -502,12 +546,38 @@ namespace AzFramework
             // and unlock the registryMutex before calling the callback.
             m_registryMutex.lock();
             auto assetIdToInfoCopy = m_registry->m_assetIdToInfo;
+            // The flat catalog is immutable, so holding on to it is enough to safely read from it without the lock.
+            AZStd::shared_ptr<const FlatAssetCatalog> flatCatalog = m_flatCatalog;
+            AZStd::unordered_set<AZ::Data::AssetId> removedFlatAssets;
+            if (flatCatalog)
+            {
+                removedFlatAssets = m_removedFlatAssets;
+            }
             m_registryMutex.unlock();
 
             for (auto& it : assetIdToInfoCopy)
             {
                 enumerateCB(it.first, it.second);
             }
+
+            if (flatCatalog)
+            {
+                for (size_t i = 0; i < flatCatalog->GetRecordCount(); ++i)
+                {
+                    const FlatAssetCatalog::AssetRecord& record = flatCatalog->GetRecord(i);
+                    if (!(record.m_flags & FlatAssetCatalog::HasAssetInfo))
+                    {
+                        continue;
+                    }
+
+                    const AZ::Data::AssetId assetId = FlatAssetCatalog::GetAssetId(record);
+                    if (assetIdToInfoCopy.find(assetId) == assetIdToInfoCopy.end() &&
+                        removedFlatAssets.find(assetId) == removedFlatAssets.end())
+                    {
+                        enumerateCB(assetId, flatCatalog->GetAssetInfo(record));
+                    }
+                }
+            }
         }
 
         if (endCB)
@@ -552,10 +622,13 @@ namespace AzFramework
 
             AZ_TracePrintf("AssetCatalog", "Initializing asset catalog with root \"%s\"", assetRoot.c_str());
 
+            // The flat catalog is used as is, so there's no need to read and deserialize the regular catalog if it's available.
+            AZStd::shared_ptr<FlatAssetCatalog> flatCatalog = LoadFlatCatalog(catalogRegistryFile);
+
             // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
             // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
             AZStd::vector<char> bytes;
-            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
+            if (!flatCatalog && catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
             {
                 AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
                 AZ::u64 size = 0;
@@ -577,7 +650,7 @@ namespace AzFramework
                 }
             }
 
-            if (!bytes.empty())
+            if (flatCatalog || !bytes.empty())
             {
                 AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
@@ -586,21 +659,36 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
-                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+
+                // Changes tracked against a previous flat catalog don't apply to the new base catalog.
+                m_removedFlatAssets.clear();
+                m_removedFlatPaths.clear();
+                m_replacedFlatDependencies.clear();
+                m_flatCatalog = AZStd::move(flatCatalog);
+
+                if (m_flatCatalog)
+                {
+                    // The registry is left empty and only receives the changes made on top of the flat catalog.
+                    AZ_TracePrintf("AssetCatalog", "Loaded flat registry containing %zu assets.\n", m_flatCatalog->GetAssetCount());
+                }
+                else
+                {
+                    AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
-                    {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
 
-                AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
+                    AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
+                }
 
                 // It's currently possible in tools for us to have received updates from AP which were applied before the catalog was ready to load
                 if (!m_initialized)
@@ -679,12 +767,24 @@ namespace AzFramework
         {
             AZ::Data::AssetInfo assetInfo = GetAssetInfoById(assetId);
 
-            AZ::SystemTickBus::QueueFunction([assetId, assetInfo = AZStd::move(assetInfo)]()
+            AZ::SystemTickBus::QueueFunction([assetId, assetInfo]()
             {
                 AzFramework::AssetCatalogEventBus::Broadcast(&AzFramework::AssetCatalogEventBus::Events::OnCatalogAssetRemoved, assetId, assetInfo);
             });
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            if (m_flatCatalog)
+            {
+                // The flat catalog can't be modified, so hide the asset and its path instead.
+                if (m_flatCatalog->FindAsset(assetId))
+                {
+                    m_removedFlatAssets.insert(assetId);
+                }
+                if (!assetInfo.m_relativePath.empty())
+                {
+                    m_removedFlatPaths.insert(AssetRegistryInternal::CreateUUIDForName(assetInfo.m_relativePath));
+                }
+            }
             m_registry->UnregisterAsset(assetId);
         }
     }
@@ -816,8 +916,8 @@ namespace AzFramework
                     AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
                     // is it an add or a change?
-                    auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-                    isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+                    AZ::Data::AssetType existingAssetType;
+                    isNewAsset = !FindAssetTypeInternal(assetId, existingAssetType);
 
                     if (!isNewAsset && isCatalogInitialize)
                     {
@@ -836,7 +936,7 @@ namespace AzFramework
                     }
 #endif
 
-                    const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+                    const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingAssetType;
 
                     AZ::Data::AssetInfo newData;
                     newData.m_assetId = assetId;
@@ -996,6 +1096,10 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         m_registry->Clear();
+        m_flatCatalog.reset();
+        m_removedFlatAssets.clear();
+        m_removedFlatPaths.clear();
+        m_replacedFlatDependencies.clear();
         m_initialized = false;
     }
 
@@ -1102,6 +1206,14 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        if (m_flatCatalog)
+        {
+            // Adding a registry replaces the dependencies of all the assets in it, which needs to hide the ones in the flat catalog.
+            for (const auto& element : deltaCatalog->m_assetIdToInfo)
+            {
+                m_replacedFlatDependencies.insert(element.first);
+            }
+        }
         m_registry->AddRegistry(deltaCatalog);
         return true;
     }
@@ -1166,6 +1278,12 @@ namespace AzFramework
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        if (m_flatCatalog)
+        {
+            AssetRegistry mergedRegistry;
+            BuildMergedRegistry(mergedRegistry);
+            return SaveCatalog(catalogRegistryFile, &mergedRegistry);
+        }
         return SaveCatalog(catalogRegistryFile, m_registry.get());
     }
 
@@ -1245,7 +1363,11 @@ namespace AzFramework
         AZStd::vector<AZ::Data::AssetId> deltaPakAssetIds;
         for (const AZStd::string& file : files)
         {
-            AZ::Data::AssetId asset = m_registry->GetAssetIdByPath(file.c_str());
+            AZ::Data::AssetId asset;
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+                asset = GetAssetIdByPathInternal(file.c_str());
+            }
             if (!asset.IsValid())
             {
                 // Asset is not listed in the registry, we can early out and fail as there should never be an asset that isn't in the registry.
@@ -1279,4 +1401,163 @@ namespace AzFramework
         return true;
     }
 
+    //=========================================================================
+    // FindFlatAssetInfo
+    //=========================================================================
+    const FlatAssetCatalog::AssetRecord* AssetCatalog::FindFlatAssetInfo(const AZ::Data::AssetId& id) const
+    {
+        if (!m_flatCatalog || m_removedFlatAssets.find(id) != m_removedFlatAssets.end())
+        {
+            return nullptr;
+        }
+
+        const FlatAssetCatalog::AssetRecord* record = m_flatCatalog->FindAsset(id);
+        return (record && (record->m_flags & FlatAssetCatalog::HasAssetInfo)) ? record : nullptr;
+    }
+
+    //=========================================================================
+    // FindFlatAssetDependencies
+    //=========================================================================
+    const FlatAssetCatalog::AssetRecord* AssetCatalog::FindFlatAssetDependencies(const AZ::Data::AssetId& id) const
+    {
+        if (!m_flatCatalog || m_removedFlatAssets.find(id) != m_removedFlatAssets.end() ||
+            m_replacedFlatDependencies.find(id) != m_replacedFlatDependencies.end())
+        {
+            return nullptr;
+        }
+
+        const FlatAssetCatalog::AssetRecord* record = m_flatCatalog->FindAsset(id);
+        return (record && (record->m_flags & FlatAssetCatalog::HasDependencies)) ? record : nullptr;
+    }
+
+    //=========================================================================
+    // FindAssetTypeInternal
+    //=========================================================================
+    bool AssetCatalog::FindAssetTypeInternal(const AZ::Data::AssetId& id, AZ::Data::AssetType& assetType) const
+    {
+        auto foundIter = m_registry->m_assetIdToInfo.find(id);
+        if (foundIter != m_registry->m_assetIdToInfo.end())
+        {
+            assetType = foundIter->second.m_assetType;
+            return true;
+        }
+
+        if (const FlatAssetCatalog::AssetRecord* record = FindFlatAssetInfo(id))
+        {
+            assetType = FlatAssetCatalog::GetAssetType(*record);
+            return true;
+        }
+        return false;
+    }
+
+    //=========================================================================
+    // GetAssetIdByPathInternal
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByPathInternal(const char* assetPath) const
+    {
+        if (!m_flatCatalog)
+        {
+            return m_registry->GetAssetIdByPath(assetPath);
+        }
+
+        if ((!assetPath) || (assetPath[0] == 0))
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::Uuid pathKey = AssetRegistryInternal::CreateUUIDForName(assetPath);
+        auto entry = m_registry->m_assetPathToId.find(pathKey);
+        if (entry != m_registry->m_assetPathToId.end())
+        {
+            return entry->second;
+        }
+
+        if (m_removedFlatPaths.find(pathKey) != m_removedFlatPaths.end())
+        {
+            return AZ::Data::AssetId();
+        }
+        return m_flatCatalog->FindAssetIdByPathKey(pathKey);
+    }
+
+    //=========================================================================
+    // BuildMergedRegistry
+    //=========================================================================
+    void AssetCatalog::BuildMergedRegistry(AssetRegistry& registry) const
+    {
+        if (m_flatCatalog)
+        {
+            m_flatCatalog->CopyToRegistry(registry);
+        }
+
+        for (const AZ::Data::AssetId& assetId : m_removedFlatAssets)
+        {
+            registry.m_assetIdToInfo.erase(assetId);
+            registry.m_assetDependencies.erase(assetId);
+        }
+        for (const AZ::Uuid& pathKey : m_removedFlatPaths)
+        {
+            registry.m_assetPathToId.erase(pathKey);
+        }
+        for (const AZ::Data::AssetId& assetId : m_replacedFlatDependencies)
+        {
+            registry.m_assetDependencies.erase(assetId);
+        }
+
+        for (const auto& element : m_registry->m_assetIdToInfo)
+        {
+            registry.m_assetIdToInfo[element.first] = element.second;
+        }
+        for (const auto& element : m_registry->m_assetDependencies)
+        {
+            registry.m_assetDependencies[element.first] = element.second;
+        }
+        for (const auto& element : m_registry->m_assetPathToId)
+        {
+            registry.m_assetPathToId[element.first] = element.second;
+        }
+    }
+
+    //=========================================================================
+    // LoadFlatCatalog
+    //=========================================================================
+    AZStd::shared_ptr<FlatAssetCatalog> AssetCatalog::LoadFlatCatalog(const char* catalogRegistryFile)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!catalogRegistryFile || !fileIO)
+        {
+            return {};
+        }
+
+        bool useFlatCatalog = true;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(useFlatCatalog, AssetCatalogInternal::UseFlatCatalogKey);
+        }
+        if (!useFlatCatalog)
+        {
+            return {};
+        }
+
+        const AZStd::string flatCatalogFile = FlatAssetCatalog::GetFlatCatalogPath(catalogRegistryFile);
+        if (!fileIO->Exists(flatCatalogFile.c_str()))
+        {
+            return {};
+        }
+
+        // The Asset Processor writes the flat catalog after the regular catalog, so an older flat catalog means it wasn't updated.
+        if (fileIO->Exists(catalogRegistryFile) &&
+            fileIO->ModificationTime(flatCatalogFile.c_str()) < fileIO->ModificationTime(catalogRegistryFile))
+        {
+            AZ_TracePrintf("AssetCatalog", "Ignoring out of date flat catalog %s.\n", flatCatalogFile.c_str());
+            return {};
+        }
+
+        auto flatCatalog = AZStd::make_shared<FlatAssetCatalog>();
+        if (!flatCatalog->LoadFromFile(flatCatalogFile.c_str()))
+        {
+            return {};
+        }
+        return flatCatalog;
+    }
+
 } // namespace AzFramework
@@ -11,12 +11,15 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManager.h>
 
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 
 namespace AzFramework
 {
@@ -129,6 +132,16 @@ namespace AzFramework
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
         bool DoesAssetIdMatchWildcardPatternInternal(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) const;
+
+        // Lookups that combine the registry with the flat catalog underneath it. These expect the registry mutex to be locked.
+        const FlatAssetCatalog::AssetRecord* FindFlatAssetInfo(const AZ::Data::AssetId& id) const;
+        const FlatAssetCatalog::AssetRecord* FindFlatAssetDependencies(const AZ::Data::AssetId& id) const;
+        bool FindAssetTypeInternal(const AZ::Data::AssetId& id, AZ::Data::AssetType& assetType) const;
+        AZ::Data::AssetId GetAssetIdByPathInternal(const char* assetPath) const;
+        // Builds a complete registry from the flat catalog and the changes that were applied on top of it.
+        void BuildMergedRegistry(AssetRegistry& registry) const;
+        // Loads the flat catalog stored next to the provided catalog file if it's enabled and up to date.
+        static AZStd::shared_ptr<FlatAssetCatalog> LoadFlatCatalog(const char* catalogRegistryFile);
     private:
 
         AZStd::atomic_bool m_shutdownThreadSignal;                  ///< Signals the monitoring thread to stop.
@@ -136,6 +149,14 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Base catalog loaded from a flat catalog file. If set, m_registry only holds the changes made on top of it.
+        AZStd::shared_ptr<const FlatAssetCatalog> m_flatCatalog;
+        //! Assets in the flat catalog that were unregistered after it was loaded.
+        AZStd::unordered_set<AZ::Data::AssetId> m_removedFlatAssets;
+        //! Path keys in the flat catalog that were removed together with their asset.
+        AZStd::unordered_set<AZ::Uuid> m_removedFlatPaths;
+        //! Assets whose dependencies in the flat catalog were replaced by a delta catalog.
+        AZStd::unordered_set<AZ::Data::AssetId> m_replacedFlatDependencies;
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -19,6 +19,12 @@ namespace AZ
     class SerializeContext;
 }
 
+namespace AssetRegistryInternal
+{
+    //! Creates the key used to look up assets by path. The path is normalized to lower case with forward slashes first.
+    AZ::Uuid CreateUUIDForName(AZStd::string_view name);
+}
+
 namespace AzFramework
 {
     /**
@@ -28,6 +34,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class FlatAssetCatalog;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator);
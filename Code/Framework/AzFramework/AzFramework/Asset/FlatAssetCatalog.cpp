@@ -0,0 +1,602 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
+
+namespace AzFramework
+{
+    struct FlatAssetCatalog::Header
+    {
+        AZ::u32 m_signature;
+        AZ::u32 m_version;
+        AZ::u32 m_recordCount;
+        AZ::u32 m_assetInfoCount;
+        AZ::u32 m_assetBucketCount;
+        AZ::u32 m_assetSlotCount;
+        AZ::u32 m_pathCount;
+        AZ::u32 m_pathBucketCount;
+        AZ::u32 m_pathSlotCount;
+        AZ::u32 m_dependencyCount;
+        AZ::u32 m_stringTableSize;
+        AZ::u32 m_padding;
+        AZ::u64 m_assetsOffset;
+        AZ::u64 m_assetSeedsOffset;
+        AZ::u64 m_assetSlotsOffset;
+        AZ::u64 m_pathsOffset;
+        AZ::u64 m_pathSeedsOffset;
+        AZ::u64 m_pathSlotsOffset;
+        AZ::u64 m_dependenciesOffset;
+        AZ::u64 m_stringsOffset;
+        AZ::u64 m_fileSize;
+    };
+
+    struct FlatAssetCatalog::PathRecord
+    {
+        AZStd::byte m_pathKey[16];
+        AZStd::byte m_guid[16];
+        AZ::u32 m_subId;
+        AZ::u32 m_padding;
+    };
+
+    namespace FlatAssetCatalogInternal
+    {
+        static constexpr AZ::u32 KeysPerBucket = 4;
+        static constexpr AZ::u32 MaxSeedAttempts = 1 << 20;
+        static constexpr size_t SectionAlignment = alignof(AZ::u64);
+
+        // Finalizer of SplitMix64, used to spread the bits of the keys.
+        AZ::u64 Mix(AZ::u64 value)
+        {
+            value ^= value >> 30;
+            value *= 0xbf58476d1ce4e5b9ull;
+            value ^= value >> 27;
+            value *= 0x94d049bb133111ebull;
+            value ^= value >> 31;
+            return value;
+        }
+
+        AZ::u64 HashKey(const AZStd::byte* guid, AZ::u32 subId)
+        {
+            AZ::u64 low;
+            AZ::u64 high;
+            memcpy(&low, guid, sizeof(low));
+            memcpy(&high, guid + sizeof(low), sizeof(high));
+            return Mix(low ^ Mix(high + subId));
+        }
+
+        AZ::u32 BucketIndex(AZ::u64 keyHash, AZ::u32 bucketCount)
+        {
+            return aznumeric_cast<AZ::u32>((keyHash >> 32) % bucketCount);
+        }
+
+        AZ::u32 SlotIndex(AZ::u64 keyHash, AZ::u32 seed, AZ::u32 slotCount)
+        {
+            return aznumeric_cast<AZ::u32>(Mix(keyHash + seed * 0x9e3779b97f4a7c15ull) % slotCount);
+        }
+
+        void CopyUuid(const AZ::Uuid& uuid, AZStd::byte* target)
+        {
+            AZStd::copy(uuid.begin(), uuid.end(), target);
+        }
+
+        AZ::Uuid ToUuid(const AZStd::byte* source)
+        {
+            AZ::Uuid uuid;
+            AZStd::copy(source, source + uuid.size(), uuid.begin());
+            return uuid;
+        }
+
+        // Builds a hash and displace table. The keys are divided over buckets and for each bucket, starting with the largest, a seed
+        // is searched that moves all keys in the bucket to free slots. A lookup then only needs the bucket's seed to find the slot.
+        bool BuildHashTable(const AZStd::vector<AZ::u64>& keyHashes, AZStd::vector<AZ::u32>& seeds, AZStd::vector<AZ::u32>& slots)
+        {
+            const AZ::u32 keyCount = aznumeric_cast<AZ::u32>(keyHashes.size());
+            const AZ::u32 bucketCount = AZStd::max<AZ::u32>(1, (keyCount + KeysPerBucket - 1) / KeysPerBucket);
+            // Leave some slots empty so the seeds for the last buckets can be found quickly.
+            const AZ::u32 slotCount = AZStd::max<AZ::u32>(1, keyCount + keyCount / 4);
+
+            seeds.assign(bucketCount, 0);
+            slots.assign(slotCount, FlatAssetCatalog::InvalidIndex);
+
+            AZStd::vector<AZStd::vector<AZ::u32>> buckets(bucketCount);
+            for (AZ::u32 keyIndex = 0; keyIndex < keyCount; ++keyIndex)
+            {
+                buckets[BucketIndex(keyHashes[keyIndex], bucketCount)].push_back(keyIndex);
+            }
+
+            AZStd::vector<AZ::u32> bucketOrder(bucketCount);
+            for (AZ::u32 i = 0; i < bucketCount; ++i)
+            {
+                bucketOrder[i] = i;
+            }
+            AZStd::stable_sort(
+                bucketOrder.begin(), bucketOrder.end(),
+                [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+                {
+                    return buckets[lhs].size() > buckets[rhs].size();
+                });
+
+            AZStd::vector<AZ::u32> bucketSlots;
+            for (AZ::u32 bucketIndex : bucketOrder)
+            {
+                const AZStd::vector<AZ::u32>& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                {
+                    break;
+                }
+
+                bool placed = false;
+                for (AZ::u32 seed = 0; seed < MaxSeedAttempts && !placed; ++seed)
+                {
+                    bucketSlots.clear();
+                    placed = true;
+                    for (AZ::u32 keyIndex : bucket)
+                    {
+                        const AZ::u32 slot = SlotIndex(keyHashes[keyIndex], seed, slotCount);
+                        if (slots[slot] != FlatAssetCatalog::InvalidIndex ||
+                            AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        bucketSlots.push_back(slot);
+                    }
+
+                    if (placed)
+                    {
+                        seeds[bucketIndex] = seed;
+                        for (size_t i = 0; i < bucket.size(); ++i)
+                        {
+                            slots[bucketSlots[i]] = bucket[i];
+                        }
+                    }
+                }
+
+                if (!placed)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace FlatAssetCatalogInternal
+
+    using namespace FlatAssetCatalogInternal;
+
+    bool FlatAssetCatalog::Write(const AssetRegistry& registry, AZStd::vector<char>& output)
+    {
+        output.clear();
+
+        // Sort the assets and paths so the same registry always produces the same file.
+        AZStd::vector<AZ::Data::AssetId> assetIds;
+        assetIds.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& element : registry.m_assetIdToInfo)
+        {
+            assetIds.push_back(element.first);
+        }
+        for (const auto& element : registry.m_assetDependencies)
+        {
+            if (registry.m_assetIdToInfo.find(element.first) == registry.m_assetIdToInfo.end())
+            {
+                assetIds.push_back(element.first);
+            }
+        }
+        AZStd::sort(assetIds.begin(), assetIds.end());
+
+        AZStd::vector<AZStd::pair<AZ::Uuid, AZ::Data::AssetId>> pathKeys(registry.m_assetPathToId.begin(), registry.m_assetPathToId.end());
+        AZStd::sort(pathKeys.begin(), pathKeys.end());
+
+        AZStd::vector<AssetRecord> assets(assetIds.size(), AssetRecord{});
+        AZStd::vector<AZ::u64> assetHashes(assetIds.size());
+        AZStd::vector<DependencyRecord> dependencies;
+        AZStd::vector<char> strings;
+        AZ::u32 assetInfoCount = 0;
+        for (size_t i = 0; i < assetIds.size(); ++i)
+        {
+            const AZ::Data::AssetId& assetId = assetIds[i];
+            AssetRecord& record = assets[i];
+            CopyUuid(assetId.m_guid, record.m_guid);
+            record.m_subId = assetId.m_subId;
+
+            if (auto infoIt = registry.m_assetIdToInfo.find(assetId); infoIt != registry.m_assetIdToInfo.end())
+            {
+                const AZ::Data::AssetInfo& assetInfo = infoIt->second;
+                record.m_flags |= HasAssetInfo;
+                CopyUuid(assetInfo.m_assetType, record.m_assetType);
+                record.m_sizeBytes = assetInfo.m_sizeBytes;
+                record.m_pathOffset = aznumeric_caster(strings.size());
+                record.m_pathLength = aznumeric_caster(assetInfo.m_relativePath.size());
+                strings.insert(strings.end(), assetInfo.m_relativePath.begin(), assetInfo.m_relativePath.end());
+                strings.push_back('\0');
+                assetInfoCount++;
+            }
+
+            if (auto dependencyIt = registry.m_assetDependencies.find(assetId); dependencyIt != registry.m_assetDependencies.end())
+            {
+                record.m_flags |= HasDependencies;
+                record.m_firstDependency = aznumeric_caster(dependencies.size());
+                record.m_dependencyCount = aznumeric_caster(dependencyIt->second.size());
+                for (const AZ::Data::ProductDependency& dependency : dependencyIt->second)
+                {
+                    DependencyRecord& dependencyRecord = dependencies.emplace_back(DependencyRecord{});
+                    CopyUuid(dependency.m_assetId.m_guid, dependencyRecord.m_guid);
+                    dependencyRecord.m_subId = dependency.m_assetId.m_subId;
+                    dependencyRecord.m_flags = dependency.m_flags.to_ullong();
+                }
+            }
+
+            assetHashes[i] = HashKey(record.m_guid, record.m_subId);
+        }
+
+        AZStd::vector<PathRecord> paths(pathKeys.size(), PathRecord{});
+        AZStd::vector<AZ::u64> pathHashes(pathKeys.size());
+        for (size_t i = 0; i < pathKeys.size(); ++i)
+        {
+            PathRecord& record = paths[i];
+            CopyUuid(pathKeys[i].first, record.m_pathKey);
+            CopyUuid(pathKeys[i].second.m_guid, record.m_guid);
+            record.m_subId = pathKeys[i].second.m_subId;
+            pathHashes[i] = HashKey(record.m_pathKey, 0);
+        }
+
+        constexpr size_t MaxCount = AZStd::numeric_limits<AZ::u32>::max();
+        if (assets.size() >= MaxCount || paths.size() >= MaxCount || dependencies.size() >= MaxCount || strings.size() >= MaxCount)
+        {
+            AZ_Warning("FlatAssetCatalog", false, "Asset registry is too large to be stored as a flat catalog.");
+            return false;
+        }
+
+        AZStd::vector<AZ::u32> assetSeeds;
+        AZStd::vector<AZ::u32> assetSlots;
+        AZStd::vector<AZ::u32> pathSeeds;
+        AZStd::vector<AZ::u32> pathSlots;
+        if (!BuildHashTable(assetHashes, assetSeeds, assetSlots) || !BuildHashTable(pathHashes, pathSeeds, pathSlots))
+        {
+            AZ_Warning("FlatAssetCatalog", false, "Unable to build the lookup tables for the flat catalog.");
+            return false;
+        }
+
+        Header header{};
+        header.m_signature = Signature;
+        header.m_version = Version;
+        header.m_recordCount = aznumeric_caster(assets.size());
+        header.m_assetInfoCount = assetInfoCount;
+        header.m_assetBucketCount = aznumeric_caster(assetSeeds.size());
+        header.m_assetSlotCount = aznumeric_caster(assetSlots.size());
+        header.m_pathCount = aznumeric_caster(paths.size());
+        header.m_pathBucketCount = aznumeric_caster(pathSeeds.size());
+        header.m_pathSlotCount = aznumeric_caster(pathSlots.size());
+        header.m_dependencyCount = aznumeric_caster(dependencies.size());
+        header.m_stringTableSize = aznumeric_caster(strings.size());
+
+        AZ::u64 fileSize = AZ_SIZE_ALIGN_UP(sizeof(Header), SectionAlignment);
+        auto reserveSection = [&fileSize](size_t sectionSize) -> AZ::u64
+        {
+            const AZ::u64 offset = fileSize;
+            fileSize = AZ_SIZE_ALIGN_UP(fileSize + sectionSize, SectionAlignment);
+            return offset;
+        };
+        header.m_assetsOffset = reserveSection(assets.size() * sizeof(AssetRecord));
+        header.m_assetSeedsOffset = reserveSection(assetSeeds.size() * sizeof(AZ::u32));
+        header.m_assetSlotsOffset = reserveSection(assetSlots.size() * sizeof(AZ::u32));
+        header.m_pathsOffset = reserveSection(paths.size() * sizeof(PathRecord));
+        header.m_pathSeedsOffset = reserveSection(pathSeeds.size() * sizeof(AZ::u32));
+        header.m_pathSlotsOffset = reserveSection(pathSlots.size() * sizeof(AZ::u32));
+        header.m_dependenciesOffset = reserveSection(dependencies.size() * sizeof(DependencyRecord));
+        header.m_stringsOffset = reserveSection(strings.size());
+        header.m_fileSize = fileSize;
+
+        output.resize(aznumeric_cast<size_t>(fileSize), 0);
+        auto writeSection = [&output](AZ::u64 offset, const void* data, size_t size)
+        {
+            if (size > 0)
+            {
+                memcpy(output.data() + offset, data, size);
+            }
+        };
+        writeSection(0, &header, sizeof(Header));
+        writeSection(header.m_assetsOffset, assets.data(), assets.size() * sizeof(AssetRecord));
+        writeSection(header.m_assetSeedsOffset, assetSeeds.data(), assetSeeds.size() * sizeof(AZ::u32));
+        writeSection(header.m_assetSlotsOffset, assetSlots.data(), assetSlots.size() * sizeof(AZ::u32));
+        writeSection(header.m_pathsOffset, paths.data(), paths.size() * sizeof(PathRecord));
+        writeSection(header.m_pathSeedsOffset, pathSeeds.data(), pathSeeds.size() * sizeof(AZ::u32));
+        writeSection(header.m_pathSlotsOffset, pathSlots.data(), pathSlots.size() * sizeof(AZ::u32));
+        writeSection(header.m_dependenciesOffset, dependencies.data(), dependencies.size() * sizeof(DependencyRecord));
+        writeSection(header.m_stringsOffset, strings.data(), strings.size());
+        return true;
+    }
+
+    AZStd::string FlatAssetCatalog::GetFlatCatalogPath(AZStd::string_view catalogFile)
+    {
+        AZ::IO::Path flatCatalogPath(catalogFile);
+        flatCatalogPath.ReplaceExtension(FileExtension);
+        return flatCatalogPath.Native();
+    }
+
+    bool FlatAssetCatalog::LoadFromFile(const char* filePath)
+    {
+        Clear();
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::u64 size = 0;
+        if (!fileIO || !filePath || !fileIO->Size(filePath, size) || size < sizeof(Header))
+        {
+            return false;
+        }
+
+        AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, handle))
+        {
+            return false;
+        }
+
+        m_storage.resize_no_construct(aznumeric_cast<size_t>((size + sizeof(AZ::u64) - 1) / sizeof(AZ::u64)));
+        // this call will fail on purpose if the full size couldn't be read.
+        const bool readResult = fileIO->Read(handle, m_storage.data(), size, true);
+        fileIO->Close(handle);
+        if (!readResult)
+        {
+            AZ_Error("FlatAssetCatalog", false, "File %s failed read - read was truncated!", filePath);
+            Clear();
+            return false;
+        }
+
+        if (!Initialize(aznumeric_cast<size_t>(size)))
+        {
+            AZ_Warning("FlatAssetCatalog", false, "File %s isn't a valid flat asset catalog.", filePath);
+            Clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool FlatAssetCatalog::LoadFromBuffer(const void* data, size_t size)
+    {
+        Clear();
+        if (!data || size < sizeof(Header))
+        {
+            return false;
+        }
+
+        m_storage.resize_no_construct((size + sizeof(AZ::u64) - 1) / sizeof(AZ::u64));
+        memcpy(m_storage.data(), data, size);
+        if (!Initialize(size))
+        {
+            Clear();
+            return false;
+        }
+        return true;
+    }
+
+    void FlatAssetCatalog::Clear()
+    {
+        m_storage = {};
+        m_header = nullptr;
+        m_assets = nullptr;
+        m_paths = nullptr;
+        m_dependencies = nullptr;
+        m_strings = nullptr;
+        m_assetTable = {};
+        m_pathTable = {};
+    }
+
+    bool FlatAssetCatalog::IsLoaded() const
+    {
+        return m_header != nullptr;
+    }
+
+    bool FlatAssetCatalog::Initialize(size_t size)
+    {
+        const Header* header = reinterpret_cast<const Header*>(m_storage.data());
+        if (header->m_signature != Signature || header->m_version != Version || header->m_fileSize > size ||
+            header->m_assetInfoCount > header->m_recordCount)
+        {
+            return false;
+        }
+
+        // Only the table bounds are validated so opening the catalog doesn't depend on its size. Individual records are checked
+        // when they're accessed.
+        const AZ::u64 fileSize = header->m_fileSize;
+        auto sectionFits = [fileSize](AZ::u64 offset, AZ::u64 count, AZ::u64 elementSize)
+        {
+            return (offset % SectionAlignment) == 0 && offset <= fileSize && count <= (fileSize - offset) / elementSize;
+        };
+        auto tableIsValid = [](AZ::u32 keyCount, AZ::u32 bucketCount, AZ::u32 slotCount)
+        {
+            return bucketCount > 0 && slotCount > 0 && slotCount >= keyCount;
+        };
+        if (!sectionFits(header->m_assetsOffset, header->m_recordCount, sizeof(AssetRecord)) ||
+            !sectionFits(header->m_assetSeedsOffset, header->m_assetBucketCount, sizeof(AZ::u32)) ||
+            !sectionFits(header->m_assetSlotsOffset, header->m_assetSlotCount, sizeof(AZ::u32)) ||
+            !sectionFits(header->m_pathsOffset, header->m_pathCount, sizeof(PathRecord)) ||
+            !sectionFits(header->m_pathSeedsOffset, header->m_pathBucketCount, sizeof(AZ::u32)) ||
+            !sectionFits(header->m_pathSlotsOffset, header->m_pathSlotCount, sizeof(AZ::u32)) ||
+            !sectionFits(header->m_dependenciesOffset, header->m_dependencyCount, sizeof(DependencyRecord)) ||
+            !sectionFits(header->m_stringsOffset, header->m_stringTableSize, 1) ||
+            !tableIsValid(header->m_recordCount, header->m_assetBucketCount, header->m_assetSlotCount) ||
+            !tableIsValid(header->m_pathCount, header->m_pathBucketCount, header->m_pathSlotCount))
+        {
+            return false;
+        }
+
+        const char* base = reinterpret_cast<const char*>(m_storage.data());
+        m_header = header;
+        m_assets = reinterpret_cast<const AssetRecord*>(base + header->m_assetsOffset);
+        m_paths = reinterpret_cast<const PathRecord*>(base + header->m_pathsOffset);
+        m_dependencies = reinterpret_cast<const DependencyRecord*>(base + header->m_dependenciesOffset);
+        m_strings = base + header->m_stringsOffset;
+
+        m_assetTable.m_seeds = reinterpret_cast<const AZ::u32*>(base + header->m_assetSeedsOffset);
+        m_assetTable.m_slots = reinterpret_cast<const AZ::u32*>(base + header->m_assetSlotsOffset);
+        m_assetTable.m_bucketCount = header->m_assetBucketCount;
+        m_assetTable.m_slotCount = header->m_assetSlotCount;
+
+        m_pathTable.m_seeds = reinterpret_cast<const AZ::u32*>(base + header->m_pathSeedsOffset);
+        m_pathTable.m_slots = reinterpret_cast<const AZ::u32*>(base + header->m_pathSlotsOffset);
+        m_pathTable.m_bucketCount = header->m_pathBucketCount;
+        m_pathTable.m_slotCount = header->m_pathSlotCount;
+        return true;
+    }
+
+    size_t FlatAssetCatalog::GetAssetCount() const
+    {
+        return m_header ? m_header->m_assetInfoCount : 0;
+    }
+
+    size_t FlatAssetCatalog::GetRecordCount() const
+    {
+        return m_header ? m_header->m_recordCount : 0;
+    }
+
+    auto FlatAssetCatalog::GetRecord(size_t index) const -> const AssetRecord&
+    {
+        AZ_Assert(index < GetRecordCount(), "Record index %zu is out of bounds.", index);
+        return m_assets[index];
+    }
+
+    auto FlatAssetCatalog::FindAsset(const AZ::Data::AssetId& id) const -> const AssetRecord*
+    {
+        if (!m_header)
+        {
+            return nullptr;
+        }
+
+        const AZ::u32 index = FindIndex(m_assetTable, HashKey(id.m_guid.begin(), id.m_subId));
+        if (index >= m_header->m_recordCount)
+        {
+            return nullptr;
+        }
+
+        const AssetRecord& record = m_assets[index];
+        if (record.m_subId != id.m_subId || memcmp(record.m_guid, id.m_guid.begin(), sizeof(record.m_guid)) != 0)
+        {
+            return nullptr;
+        }
+        return &record;
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::FindAssetIdByPath(AZStd::string_view assetPath) const
+    {
+        if (assetPath.empty())
+        {
+            // the empty path has no asset ID.
+            return AZ::Data::AssetId();
+        }
+        return FindAssetIdByPathKey(AssetRegistryInternal::CreateUUIDForName(assetPath));
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::FindAssetIdByPathKey(const AZ::Uuid& pathKey) const
+    {
+        if (!m_header)
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::u32 index = FindIndex(m_pathTable, HashKey(pathKey.begin(), 0));
+        if (index >= m_header->m_pathCount)
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const PathRecord& record = m_paths[index];
+        if (memcmp(record.m_pathKey, pathKey.begin(), sizeof(record.m_pathKey)) != 0)
+        {
+            return AZ::Data::AssetId();
+        }
+        return AZ::Data::AssetId(ToUuid(record.m_guid), record.m_subId);
+    }
+
+    AZStd::string_view FlatAssetCatalog::GetRelativePath(const AssetRecord& record) const
+    {
+        if (!(record.m_flags & HasAssetInfo) ||
+            static_cast<AZ::u64>(record.m_pathOffset) + record.m_pathLength > m_header->m_stringTableSize)
+        {
+            return {};
+        }
+        return AZStd::string_view(m_strings + record.m_pathOffset, record.m_pathLength);
+    }
+
+    AZ::Data::AssetInfo FlatAssetCatalog::GetAssetInfo(const AssetRecord& record) const
+    {
+        AZ::Data::AssetInfo assetInfo;
+        if (record.m_flags & HasAssetInfo)
+        {
+            assetInfo.m_assetId = GetAssetId(record);
+            assetInfo.m_assetType = GetAssetType(record);
+            assetInfo.m_sizeBytes = record.m_sizeBytes;
+            assetInfo.m_relativePath = GetRelativePath(record);
+        }
+        return assetInfo;
+    }
+
+    auto FlatAssetCatalog::GetDependencies(const AssetRecord& record) const -> AZStd::span<const DependencyRecord>
+    {
+        if (static_cast<AZ::u64>(record.m_firstDependency) + record.m_dependencyCount > m_header->m_dependencyCount)
+        {
+            return {};
+        }
+        return AZStd::span<const DependencyRecord>(m_dependencies + record.m_firstDependency, record.m_dependencyCount);
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::GetAssetId(const AssetRecord& record)
+    {
+        return AZ::Data::AssetId(ToUuid(record.m_guid), record.m_subId);
+    }
+
+    AZ::Data::AssetType FlatAssetCatalog::GetAssetType(const AssetRecord& record)
+    {
+        return ToUuid(record.m_assetType);
+    }
+
+    AZ::Data::ProductDependency FlatAssetCatalog::GetDependency(const DependencyRecord& record)
+    {
+        return AZ::Data::ProductDependency(AZ::Data::AssetId(ToUuid(record.m_guid), record.m_subId), AZStd::bitset<64>(record.m_flags));
+    }
+
+    void FlatAssetCatalog::CopyToRegistry(AssetRegistry& registry) const
+    {
+        const size_t recordCount = GetRecordCount();
+        for (size_t i = 0; i < recordCount; ++i)
+        {
+            const AssetRecord& record = m_assets[i];
+            const AZ::Data::AssetId assetId = GetAssetId(record);
+            if (record.m_flags & HasAssetInfo)
+            {
+                registry.m_assetIdToInfo[assetId] = GetAssetInfo(record);
+            }
+            if (record.m_flags & HasDependencies)
+            {
+                AZStd::vector<AZ::Data::ProductDependency>& dependencies = registry.m_assetDependencies[assetId];
+                dependencies.clear();
+                for (const DependencyRecord& dependency : GetDependencies(record))
+                {
+                    dependencies.push_back(GetDependency(dependency));
+                }
+            }
+        }
+
+        const size_t pathCount = m_header ? m_header->m_pathCount : 0;
+        for (size_t i = 0; i < pathCount; ++i)
+        {
+            const PathRecord& record = m_paths[i];
+            registry.m_assetPathToId[ToUuid(record.m_pathKey)] = AZ::Data::AssetId(ToUuid(record.m_guid), record.m_subId);
+        }
+    }
+
+    AZ::u32 FlatAssetCatalog::FindIndex(const HashTable& table, AZ::u64 keyHash)
+    {
+        const AZ::u32 seed = table.m_seeds[BucketIndex(keyHash, table.m_bucketCount)];
+        return table.m_slots[SlotIndex(keyHash, seed, table.m_slotCount)];
+    }
+} // namespace AzFramework
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    //! Read-only asset catalog stored in a flat binary layout.
+    //! The Asset Processor writes this file next to the regular asset catalog. All data is stored in fixed size records that
+    //! are indexed by perfect hash tables on the asset id and on the hashed relative path, so opening the catalog only requires
+    //! reading the file and validating the header, and lookups don't allocate. The layout uses the native little endian byte
+    //! order of all supported platforms.
+    class FlatAssetCatalog final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FlatAssetCatalog, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 Signature = 0x4C464341; // "ACFL"
+        static constexpr AZ::u32 Version = 1;
+        static constexpr const char* FileExtension = "flatcatalog";
+        static constexpr AZ::u32 InvalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+
+        enum RecordFlags : AZ::u32
+        {
+            HasAssetInfo = 1 << 0, //!< The record holds the info of a registered asset.
+            HasDependencies = 1 << 1 //!< The record holds a list of product dependencies, which may be empty.
+        };
+
+        //! Information about a single asset. Assets that only have dependencies registered don't have the HasAssetInfo flag set.
+        struct AssetRecord
+        {
+            AZStd::byte m_guid[16];
+            AZStd::byte m_assetType[16];
+            AZ::u64 m_sizeBytes;
+            AZ::u32 m_subId;
+            AZ::u32 m_flags;
+            AZ::u32 m_pathOffset; //!< Offset of the relative path in the string table.
+            AZ::u32 m_pathLength;
+            AZ::u32 m_firstDependency; //!< Index of the first dependency in the dependency table.
+            AZ::u32 m_dependencyCount;
+        };
+
+        //! A single product dependency. The dependencies of an asset are stored next to each other.
+        struct DependencyRecord
+        {
+            AZStd::byte m_guid[16];
+            AZ::u64 m_flags;
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+        };
+
+        //! Writes the contents of the registry in the flat layout.
+        //! @return False if the registry is too large to be stored, in which case the output is left empty.
+        static bool Write(const AssetRegistry& registry, AZStd::vector<char>& output);
+
+        //! Returns the path of the flat catalog that's stored next to the provided asset catalog.
+        static AZStd::string GetFlatCatalogPath(AZStd::string_view catalogFile);
+
+        //! Loads the flat catalog from the provided file. Any previously loaded data is released.
+        bool LoadFromFile(const char* filePath);
+        //! Loads the flat catalog from a copy of the provided memory. Any previously loaded data is released.
+        bool LoadFromBuffer(const void* data, size_t size);
+        void Clear();
+        bool IsLoaded() const;
+
+        //! Number of records with asset info.
+        size_t GetAssetCount() const;
+        //! Number of records, including records that only hold dependencies.
+        size_t GetRecordCount() const;
+        const AssetRecord& GetRecord(size_t index) const;
+
+        //! Returns the record for the asset or nullptr if the catalog doesn't contain the asset.
+        const AssetRecord* FindAsset(const AZ::Data::AssetId& id) const;
+        //! Returns the asset registered for the provided relative path, using the same path normalization as AssetRegistry.
+        AZ::Data::AssetId FindAssetIdByPath(AZStd::string_view assetPath) const;
+        //! Returns the asset registered for the provided path key as created by AssetRegistryInternal::CreateUUIDForName.
+        AZ::Data::AssetId FindAssetIdByPathKey(const AZ::Uuid& pathKey) const;
+
+        AZStd::string_view GetRelativePath(const AssetRecord& record) const;
+        AZ::Data::AssetInfo GetAssetInfo(const AssetRecord& record) const;
+        AZStd::span<const DependencyRecord> GetDependencies(const AssetRecord& record) const;
+
+        static AZ::Data::AssetId GetAssetId(const AssetRecord& record);
+        static AZ::Data::AssetType GetAssetType(const AssetRecord& record);
+        static AZ::Data::ProductDependency GetDependency(const DependencyRecord& record);
+
+        //! Adds the full contents of the flat catalog to the registry.
+        void CopyToRegistry(AssetRegistry& registry) const;
+
+    private:
+        struct Header;
+        struct PathRecord;
+
+        //! View on one of the perfect hash tables in the file.
+        struct HashTable
+        {
+            const AZ::u32* m_seeds{ nullptr }; //!< Displacement seed per bucket.
+            const AZ::u32* m_slots{ nullptr }; //!< Record index per slot or InvalidIndex for empty slots.
+            AZ::u32 m_bucketCount{ 0 };
+            AZ::u32 m_slotCount{ 0 };
+        };
+
+        bool Initialize(size_t size);
+        static AZ::u32 FindIndex(const HashTable& table, AZ::u64 keyHash);
+
+        AZStd::vector<AZ::u64> m_storage; //!< Backing memory, kept as 64-bit values so all records are suitably aligned.
+        const Header* m_header{ nullptr };
+        const AssetRecord* m_assets{ nullptr };
+        const PathRecord* m_paths{ nullptr };
+        const DependencyRecord* m_dependencies{ nullptr };
+        const char* m_strings{ nullptr };
+        HashTable m_assetTable;
+        HashTable m_pathTable;
+    };
+} // namespace AzFramework
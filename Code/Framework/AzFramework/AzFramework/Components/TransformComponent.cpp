@@ -211,6 +211,24 @@ namespace AzFramework
         }
     }
 
+    void TransformComponent::SetWorldTMDeferNotification(const AZ::Transform& tm)
+    {
+        if (AreMoveRequestsAllowed())
+        {
+            m_worldTM = tm;
+            UpdateLocalTM();
+            m_transformNotificationPending = true;
+        }
+    }
+
+    void TransformComponent::NotifyTransformChanged()
+    {
+        if (m_transformNotificationPending)
+        {
+            SendLocalTMChangedNotifications();
+        }
+    }
+
     void TransformComponent::SetParent(AZ::EntityId id)
     {
         SetParentImpl(id, true);
@@ -653,6 +671,12 @@ namespace AzFramework
     }
 
     void TransformComponent::ComputeLocalTM()
+    {
+        UpdateLocalTM();
+        SendLocalTMChangedNotifications();
+    }
+
+    void TransformComponent::UpdateLocalTM()
     {
         if (m_parentTM)
         {
@@ -662,6 +686,11 @@ namespace AzFramework
         {
             m_localTM = m_worldTM;
         }
+    }
+
+    void TransformComponent::SendLocalTMChangedNotifications()
+    {
+        m_transformNotificationPending = false;
 
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
@@ -685,6 +714,8 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        m_transformNotificationPending = false;
+
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -67,6 +67,10 @@ namespace AzFramework
         void SetLocalTM(const AZ::Transform& tm) override;
         //! Sets the world transform and notifies all interested parties.
         void SetWorldTM(const AZ::Transform& tm) override;
+        //! Sets the world transform and notifies all interested parties once NotifyTransformChanged is called.
+        void SetWorldTMDeferNotification(const AZ::Transform& tm) override;
+        //! Notifies all interested parties of a transform set with SetWorldTMDeferNotification.
+        void NotifyTransformChanged() override;
         //! Set parent entity and notifies all interested parties.
         //! The object localTM will be moved into parent space so we will preserve the same worldTM.
         void SetParent(AZ::EntityId id) override;
@@ -160,6 +164,8 @@ namespace AzFramework
         void OnTransformChangedImpl(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM);
         void ComputeLocalTM();
         void ComputeWorldTM();
+        void UpdateLocalTM();
+        void SendLocalTMChangedNotifications();
         //////////////////////////////////////////////////////////////////////////
 
         //! Returns whether external calls are currently allowed to move the transform.
@@ -188,6 +194,7 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_transformNotificationPending = false; ///< If set, the transform changed and the notifications were deferred.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
     };
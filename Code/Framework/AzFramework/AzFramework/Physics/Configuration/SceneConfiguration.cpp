@@ -31,6 +31,7 @@ namespace AzPhysics
                 ->Field("EnableActiveActors", &SceneConfiguration::m_enableActiveActors)
                 ->Field("EnablePcm", &SceneConfiguration::m_enablePcm)
                 ->Field("BounceThresholdVelocity", &SceneConfiguration::m_bounceThresholdVelocity)
+                ->Field("MaxConcurrentSimulationTasks", &SceneConfiguration::m_maxConcurrentSimulationTasks)
                 ;
 
             if (auto* editContext = serializeContext->GetEditContext())
@@ -57,6 +58,8 @@ namespace AzPhysics
                     ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_bounceThresholdVelocity,
                         "Bounce Threshold Velocity", "Relative velocity below which colliding objects will not bounce")
                     ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_maxConcurrentSimulationTasks,
+                        "Max Concurrent Simulation Tasks", "Maximum number of simulation tasks of the scene running at the same time, 0 for no limit")
                     ;
             }
         }
@@ -78,6 +81,7 @@ namespace AzPhysics
             && m_kinematicStaticFiltering == other.m_kinematicStaticFiltering
             && m_customUserData == other.m_customUserData
             && m_maxCcdPasses == other.m_maxCcdPasses
+            && m_maxConcurrentSimulationTasks == other.m_maxConcurrentSimulationTasks
             && AZ::IsClose(m_bounceThresholdVelocity, other.m_bounceThresholdVelocity)
             && m_gravity.IsClose(other.m_gravity)
             && m_worldBounds == other.m_worldBounds
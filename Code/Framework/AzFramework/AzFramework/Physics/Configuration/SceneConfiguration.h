@@ -46,6 +46,9 @@ namespace AzPhysics
         bool m_kinematicFiltering = true; //!< Enables filtering between kinematic/kinematic  objects.
         bool m_kinematicStaticFiltering = true; //!< Enables filtering between kinematic/static objects.
         float m_bounceThresholdVelocity = 2.0f; //!< Relative velocity below which colliding objects will not bounce.
+        //! Maximum number of simulation tasks of the scene running at the same time, 0 for no limit.
+        //! Keeps a scene from taking all the worker threads when several scenes are simulated concurrently.
+        AZ::u32 m_maxConcurrentSimulationTasks = 0;
 
         bool operator==(const SceneConfiguration& other) const;
         bool operator!=(const SceneConfiguration& other) const;
@@ -453,6 +453,25 @@ namespace AzFramework
         return m_metaData;
     }
 
+    void Spawnable::BuildClonePlan(AZ::SerializeContext& serializeContext)
+    {
+        if (!m_clonePlan)
+        {
+            m_clonePlan = AZStd::make_unique<SpawnableClonePlan>();
+        }
+        m_clonePlan->Build(m_entities, serializeContext);
+    }
+
+    void Spawnable::ResetClonePlan()
+    {
+        m_clonePlan.reset();
+    }
+
+    const SpawnableClonePlan* Spawnable::GetClonePlan() const
+    {
+        return m_clonePlan.get();
+    }
+
     void Spawnable::Reflect(AZ::ReflectContext* context)
     {
         EntityAlias::Reflect(context);
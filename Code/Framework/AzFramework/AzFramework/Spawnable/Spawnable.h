@@ -14,11 +14,13 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -170,6 +172,15 @@ namespace AzFramework
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
+        //! Builds the plan used to remap entity ids on spawned entities without walking the reflection data of every clone.
+        //! This is called by the asset handler after loading. Spawnables that are constructed in memory can call this once their
+        //! entities are final. If entities are added, removed or get their components replaced afterwards, the affected entities
+        //! automatically fall back to reflection based remapping until the plan is rebuilt.
+        void BuildClonePlan(AZ::SerializeContext& serializeContext);
+        void ResetClonePlan();
+        //! Returns the clone plan for this spawnable or nullptr if no plan was built.
+        const SpawnableClonePlan* GetClonePlan() const;
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -180,6 +191,8 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        // Precompiled id remapping instructions for m_entities. Not serialized.
+        AZStd::unique_ptr<SpawnableClonePlan> m_clonePlan;
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
     };
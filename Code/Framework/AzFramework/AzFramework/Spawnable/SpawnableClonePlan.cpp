@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    void SpawnableClonePlan::Build(const AZStd::vector<AZStd::unique_ptr<AZ::Entity>>& entities, AZ::SerializeContext& serializeContext)
+    {
+        m_entityPlans.clear();
+        m_entityPlans.resize(entities.size());
+        m_compiledEntityCount = 0;
+
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            if (entities[i])
+            {
+                BuildEntityPlan(m_entityPlans[i], *entities[i], serializeContext);
+                if (m_entityPlans[i].m_isCompiled)
+                {
+                    m_compiledEntityCount++;
+                }
+            }
+        }
+    }
+
+    auto SpawnableClonePlan::FindEntityPlan(size_t entityIndex, const AZ::Entity& prototype) const -> const EntityPlan*
+    {
+        if (entityIndex >= m_entityPlans.size())
+        {
+            return nullptr;
+        }
+
+        const EntityPlan& plan = m_entityPlans[entityIndex];
+        if (!plan.m_isCompiled || plan.m_prototype != &prototype)
+        {
+            return nullptr;
+        }
+
+        // The recorded offsets only depend on the types of the components, so as long as the prototype still holds the same
+        // component instances the plan remains valid, even if the values in those components have been changed.
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        if (components.size() != plan.m_components.size() ||
+            !AZStd::equal(components.begin(), components.end(), plan.m_components.begin()))
+        {
+            return nullptr;
+        }
+        return &plan;
+    }
+
+    bool SpawnableClonePlan::RemapIds(const EntityPlan& plan, AZ::Entity& clone, EntityIdMap& idMap)
+    {
+        const AZ::Entity::ComponentArrayType& components = clone.GetComponents();
+        if (components.size() != plan.m_components.size())
+        {
+            return false;
+        }
+
+        // Mirror the two passes done by AZ::IdUtils::Remapper: first generate new ids, keeping any mapping that was already
+        // registered, then update all references using the now complete map.
+        for (const IdSlot& slot : plan.m_generatedIds)
+        {
+            AZ::EntityId& id = ResolveSlot(slot, clone, components);
+            auto it = idMap.find(id);
+            if (it == idMap.end())
+            {
+                it = idMap.emplace(id, slot.m_idGenerator->Invoke(nullptr)).first;
+            }
+            id = it->second;
+        }
+
+        for (const IdSlot& slot : plan.m_referencedIds)
+        {
+            AZ::EntityId& id = ResolveSlot(slot, clone, components);
+            if (auto it = idMap.find(id); it != idMap.end())
+            {
+                id = it->second;
+            }
+        }
+        return true;
+    }
+
+    size_t SpawnableClonePlan::GetEntityCount() const
+    {
+        return m_entityPlans.size();
+    }
+
+    size_t SpawnableClonePlan::GetCompiledEntityCount() const
+    {
+        return m_compiledEntityCount;
+    }
+
+    void SpawnableClonePlan::BuildEntityPlan(EntityPlan& plan, const AZ::Entity& prototype, AZ::SerializeContext& serializeContext)
+    {
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        plan.m_prototype = &prototype;
+        plan.m_components = prototype.GetComponents();
+        plan.m_isCompiled = true;
+
+        struct StackEntry
+        {
+            const ClassData* m_classData;
+            const char* m_rootAddress; // Start of the object the element is at a fixed offset in or nullptr if there's no such object.
+            uint32_t m_rootIndex;
+            bool m_hasEventHandler;
+        };
+        AZStd::vector<StackEntry> stack;
+        stack.reserve(30);
+
+        const AZ::Uuid entityIdTypeId = AZ::SerializeTypeInfo<AZ::EntityId>::GetUuid();
+
+        auto beginCB = [&](void* ptr, const ClassData* classData, const ClassElement* elementData) -> bool
+        {
+            const bool isPointer = elementData && (elementData->m_flags & ClassElement::FLG_POINTER);
+
+            StackEntry entry{ classData, nullptr, EntityRootIndex, classData->m_eventHandler != nullptr };
+            if (stack.empty())
+            {
+                entry.m_rootAddress = reinterpret_cast<const char*>(ptr);
+            }
+            else
+            {
+                const StackEntry& parent = stack.back();
+                entry.m_hasEventHandler = entry.m_hasEventHandler || parent.m_hasEventHandler;
+                if (parent.m_classData->m_container)
+                {
+                    // The only container elements that can be found again in the clone are the components of the entity. Everything
+                    // else is stored in memory owned by the container and won't be at a fixed offset.
+                    if (isPointer && stack.size() == 2)
+                    {
+                        const AZ::Component* component = *reinterpret_cast<AZ::Component**>(ptr);
+                        auto it = AZStd::find(plan.m_components.begin(), plan.m_components.end(), component);
+                        if (it != plan.m_components.end())
+                        {
+                            entry.m_rootAddress = reinterpret_cast<const char*>(component);
+                            entry.m_rootIndex = aznumeric_caster(AZStd::distance(plan.m_components.begin(), it));
+                        }
+                    }
+                }
+                else if (!isPointer && parent.m_rootAddress)
+                {
+                    entry.m_rootAddress = parent.m_rootAddress;
+                    entry.m_rootIndex = parent.m_rootIndex;
+                }
+            }
+            stack.push_back(entry);
+
+            if (classData->m_typeId == entityIdTypeId)
+            {
+                if (!entry.m_rootAddress || isPointer || entry.m_hasEventHandler)
+                {
+                    plan.m_isCompiled = false;
+                    return false;
+                }
+
+                IdSlot slot;
+                slot.m_rootIndex = entry.m_rootIndex;
+                slot.m_offset = aznumeric_caster(reinterpret_cast<const char*>(ptr) - entry.m_rootAddress);
+                if (elementData)
+                {
+                    if (AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes))
+                    {
+                        slot.m_idGenerator = azrtti_cast<IdGenerator*>(attribute);
+                    }
+                }
+                (slot.m_idGenerator ? plan.m_generatedIds : plan.m_referencedIds).push_back(slot);
+            }
+            return plan.m_isCompiled;
+        };
+
+        auto endCB = [&stack]() -> bool
+        {
+            stack.pop_back();
+            return true;
+        };
+
+        serializeContext.EnumerateObject(&prototype, beginCB, endCB, AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+
+        if (!plan.m_isCompiled)
+        {
+            plan.m_generatedIds.clear();
+            plan.m_referencedIds.clear();
+        }
+    }
+
+    AZ::EntityId& SpawnableClonePlan::ResolveSlot(const IdSlot& slot, AZ::Entity& clone, const AZ::Entity::ComponentArrayType& components)
+    {
+        char* root = (slot.m_rootIndex == EntityRootIndex) ? reinterpret_cast<char*>(&clone)
+                                                           : reinterpret_cast<char*>(components[slot.m_rootIndex]);
+        return *reinterpret_cast<AZ::EntityId*>(root + slot.m_offset);
+    }
+} // namespace AzFramework
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class SerializeContext;
+
+    template<class F>
+    class AttributeFunction;
+}
+
+namespace AzFramework
+{
+    //! Precompiled entity id remapping instructions for the entities in a spawnable.
+    //! Spawning an entity clones its prototype and then walks the clone's reflection data twice to generate new entity ids
+    //! and to fix up references to other entities. The clone plan does that walk once per prototype and records where every
+    //! AZ::EntityId lives relative to the entity or to one of its components, so spawning can patch the ids on the clone directly.
+    //! Only ids at a fixed offset can be recorded. Prototypes that store ids in containers, behind pointers or in classes with
+    //! serialization event handlers are marked as not compiled and continue to use the reflection based remapping.
+    class SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+        using IdGenerator = AZ::AttributeFunction<AZ::EntityId()>;
+
+        //! Index used for ids that are stored directly in the entity instead of in one of its components.
+        static constexpr uint32_t EntityRootIndex = AZStd::numeric_limits<uint32_t>::max();
+
+        //! Location of a single entity id in a cloned entity.
+        struct IdSlot
+        {
+            uint32_t m_rootIndex{ EntityRootIndex }; //!< Index of the component holding the id or EntityRootIndex for the entity itself.
+            uint32_t m_offset{ 0 }; //!< Byte offset of the id from the start of the root object.
+            IdGenerator* m_idGenerator{ nullptr }; //!< If set the id is replaced with a newly generated id, otherwise it's a reference.
+        };
+
+        //! Remapping instructions for a single prototype entity.
+        struct EntityPlan
+        {
+            const AZ::Entity* m_prototype{ nullptr }; //!< The prototype the plan was built from.
+            AZ::Entity::ComponentArrayType m_components; //!< The prototype's components at the time the plan was built.
+            AZStd::vector<IdSlot> m_generatedIds; //!< Ids that get a new id generated for them.
+            AZStd::vector<IdSlot> m_referencedIds; //!< Ids that refer to another entity and are looked up in the id map.
+            bool m_isCompiled{ false }; //!< Whether all ids in the prototype could be recorded.
+        };
+
+        //! Builds the plans for all entities in the provided list.
+        void Build(const AZStd::vector<AZStd::unique_ptr<AZ::Entity>>& entities, AZ::SerializeContext& serializeContext);
+
+        //! Returns the plan for the entity at the provided index or nullptr if there's no compiled plan for it. A plan is only
+        //! returned if it was built from the provided prototype and the prototype's components haven't been changed since.
+        const EntityPlan* FindEntityPlan(size_t entityIndex, const AZ::Entity& prototype) const;
+
+        //! Generates new ids and fixes up id references on an entity cloned from the prototype the plan was built for.
+        //! @return False if the clone doesn't match the layout of the prototype, in which case no ids were changed.
+        static bool RemapIds(const EntityPlan& plan, AZ::Entity& clone, EntityIdMap& idMap);
+
+        size_t GetEntityCount() const;
+        size_t GetCompiledEntityCount() const;
+
+    private:
+        static void BuildEntityPlan(EntityPlan& plan, const AZ::Entity& prototype, AZ::SerializeContext& serializeContext);
+        static AZ::EntityId& ResolveSlot(const IdSlot& slot, AZ::Entity& clone, const AZ::Entity::ComponentArrayType& components);
+
+        AZStd::vector<EntityPlan> m_entityPlans;
+        size_t m_compiledEntityCount{ 0 };
+    };
+} // namespace AzFramework
@@ -8,9 +8,12 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/numeric.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -44,6 +47,18 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 budget = 0;
+            if (settingsRegistry->Get(budget, "/O3DE/AzFramework/Spawnables/HighPriorityFrameBudgetUs"))
+            {
+                m_highPriorityQueue.m_frameBudget = AZStd::chrono::microseconds(budget);
+            }
+            budget = 0;
+            if (settingsRegistry->Get(budget, "/O3DE/AzFramework/Spawnables/RegularPriorityFrameBudgetUs"))
+            {
+                m_regularPriorityQueue.m_frameBudget = AZStd::chrono::microseconds(budget);
+            }
+            settingsRegistry->Get(m_parallelCloneThreshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
         }
     }
 
@@ -232,12 +247,73 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
+        const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
+        m_hasFrameDeadline = queue.m_frameBudget.count() > 0;
+        m_frameDeadline = startTime + queue.m_frameBudget;
+        m_deferredByFrameBudget = false;
+
         // Process delayed requests first.
         // Only process the requests that are currently in this queue, not the ones that could be re-added if they still can't complete.
-        size_t delayedSize = queue.m_delayed.size();
-        for (size_t i = 0; i < delayedSize; ++i)
+        bool deferred = !ProcessRequests(queue, queue.m_delayed, queue.m_delayed.size());
+
+        // Process newly added requests.
+        while (!deferred)
+        {
+            AZStd::queue<Requests> pendingRequestQueue;
+            {
+                AZStd::scoped_lock queueLock(queue.m_pendingRequestMutex);
+                if (IsFrameBudgetExhausted())
+                {
+                    deferred = !queue.m_pendingRequest.empty();
+                    break;
+                }
+                queue.m_pendingRequest.swap(pendingRequestQueue);
+            }
+
+            if (pendingRequestQueue.empty())
+            {
+                break;
+            }
+
+            deferred = !ProcessRequests(queue, pendingRequestQueue, pendingRequestQueue.size());
+            // Anything that's left didn't fit in the frame budget, so pick it up again on the next call.
+            while (!pendingRequestQueue.empty())
+            {
+                queue.m_delayed.emplace_back(AZStd::move(pendingRequestQueue.front()));
+                pendingRequestQueue.pop();
+            }
+        }
+        deferred = deferred || m_deferredByFrameBudget;
+
+        const auto processingTime =
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        QueueMetrics& metrics = queue.m_metrics;
+        metrics.m_processedFrames++;
+        metrics.m_lastProcessingTime = processingTime;
+        metrics.m_maxProcessingTime = AZStd::max(metrics.m_maxProcessingTime, processingTime);
+        if (m_hasFrameDeadline)
+        {
+            if (processingTime > queue.m_frameBudget)
+            {
+                metrics.m_budgetOverruns++;
+                metrics.m_maxOverrun = AZStd::max(metrics.m_maxOverrun, processingTime - queue.m_frameBudget);
+            }
+            if (deferred)
+            {
+                metrics.m_deferrals++;
+            }
+        }
+        m_hasFrameDeadline = false;
+
+        return (deferred || !queue.m_delayed.empty()) ? CommandQueueStatus::HasCommandsLeft : CommandQueueStatus::NoCommandsLeft;
+    }
+
+    template<typename RequestContainer>
+    bool SpawnableEntitiesManager::ProcessRequests(Queue& queue, RequestContainer& requests, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
         {
-            Requests& request = queue.m_delayed.front();
+            Requests& request = requests.front();
             CommandResult result = AZStd::visit(
                 [this](auto&& args) -> CommandResult
                 {
@@ -248,43 +324,49 @@ namespace AzFramework
             {
                 queue.m_delayed.emplace_back(AZStd::move(request));
             }
-            queue.m_delayed.pop_front();
-        }
-
-        // Process newly added requests.
-        while (true)
-        {
-            AZStd::queue<Requests> pendingRequestQueue;
+            if constexpr (AZStd::is_same_v<RequestContainer, AZStd::deque<Requests>>)
             {
-                AZStd::scoped_lock queueLock(queue.m_pendingRequestMutex);
-                queue.m_pendingRequest.swap(pendingRequestQueue);
+                requests.pop_front();
             }
-
-            if (!pendingRequestQueue.empty())
+            else
             {
-                while (!pendingRequestQueue.empty())
-                {
-                    Requests& request = pendingRequestQueue.front();
-                    CommandResult result = AZStd::visit(
-                        [this](auto&& args) -> CommandResult
-                        {
-                            return ProcessRequest(args);
-                        },
-                        request);
-                    if (result == CommandResult::Requeue)
-                    {
-                        queue.m_delayed.emplace_back(AZStd::move(request));
-                    }
-                    pendingRequestQueue.pop();
-                }
+                requests.pop();
             }
-            else
+
+            // The budget is checked after executing a request so at least one request makes progress on every call.
+            if (i + 1 < count && IsFrameBudgetExhausted())
             {
-                break;
+                return false;
             }
-        };
+        }
+        return true;
+    }
 
-        return queue.m_delayed.empty() ? CommandQueueStatus::NoCommandsLeft : CommandQueueStatus::HasCommandsLeft;
+    bool SpawnableEntitiesManager::IsFrameBudgetExhausted() const
+    {
+        return m_hasFrameDeadline && AZStd::chrono::steady_clock::now() >= m_frameDeadline;
+    }
+
+    void SpawnableEntitiesManager::SetFrameBudget(CommandQueuePriority priority, AZStd::chrono::microseconds budget)
+    {
+        if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
+        {
+            m_highPriorityQueue.m_frameBudget = budget;
+        }
+        if ((priority & CommandQueuePriority::Regular) == CommandQueuePriority::Regular)
+        {
+            m_regularPriorityQueue.m_frameBudget = budget;
+        }
+    }
+
+    AZStd::chrono::microseconds SpawnableEntitiesManager::GetFrameBudget(CommandQueuePriority priority) const
+    {
+        return priority == CommandQueuePriority::High ? m_highPriorityQueue.m_frameBudget : m_regularPriorityQueue.m_frameBudget;
+    }
+
+    auto SpawnableEntitiesManager::GetQueueMetrics(CommandQueuePriority priority) const -> QueueMetrics
+    {
+        return priority == CommandQueuePriority::High ? m_highPriorityQueue.m_metrics : m_regularPriorityQueue.m_metrics;
     }
 
     void* SpawnableEntitiesManager::CreateTicket(AZ::Data::Asset<Spawnable>&& spawnable)
@@ -352,6 +434,65 @@ namespace AzFramework
             &entityPrototype, prototypeToCloneMap, &serializeContext);
     }
 
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(
+        const Spawnable& spawnable, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        AZ::Entity* clone = serializeContext.CloneObject(spawnable.GetEntities()[entityIndex].get());
+        if (clone)
+        {
+            RemapClonedEntity(spawnable, entityIndex, *clone, prototypeToCloneMap, serializeContext);
+        }
+        return clone;
+    }
+
+    void SpawnableEntitiesManager::CloneEntities(
+        const Spawnable::EntityList& prototypes,
+        const uint32_t* indices,
+        size_t count,
+        AZ::Entity** clones,
+        AZ::SerializeContext& serializeContext)
+    {
+        auto cloneEntity = [&prototypes, indices, clones, &serializeContext](int i)
+        {
+            clones[i] = serializeContext.CloneObject(prototypes[indices[i]].get());
+        };
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext && m_parallelCloneThreshold > 0 && count >= m_parallelCloneThreshold)
+        {
+            // Cloning only reads from the prototypes and the serialize context so it can be spread across the job threads. Remapping
+            // the entity ids updates the ticket's id map and is done afterwards on the calling thread.
+            AZ::parallel_for(0, aznumeric_cast<int>(count), cloneEntity, jobContext);
+        }
+        else
+        {
+            for (int i = 0; i < aznumeric_cast<int>(count); ++i)
+            {
+                cloneEntity(i);
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::RemapClonedEntity(
+        const Spawnable& spawnable,
+        uint32_t entityIndex,
+        AZ::Entity& clone,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+        constexpr bool allowDuplicateIds = false;
+
+        // The plan already knows where all entity ids are stored, so the reflection data only needs to be walked if there's no plan.
+        const SpawnableClonePlan* clonePlan = spawnable.GetClonePlan();
+        const SpawnableClonePlan::EntityPlan* entityPlan =
+            clonePlan ? clonePlan->FindEntityPlan(entityIndex, *spawnable.GetEntities()[entityIndex]) : nullptr;
+        if (!entityPlan || !SpawnableClonePlan::RemapIds(*entityPlan, clone, prototypeToCloneMap))
+        {
+            AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::GenerateNewIdsAndFixRefs(&clone, prototypeToCloneMap, &serializeContext);
+        }
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
         const AZ::Entity& entityPrototype,
         const Spawnable::EntityAlias& alias,
@@ -446,6 +587,8 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
+        using Stage = SpawnAllEntitiesCommand::Stage;
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -455,94 +598,154 @@ namespace AzFramework
                 AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
                 AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-                // Keep track how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
-
                 // These are 'prototype' entities we'll be cloning from
                 const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
                 uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
 
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                if (request.m_stage == Stage::Start)
+                {
+                    // Keep track how many entities there were in the array initially
+                    request.m_spawnedEntitiesInitialCount = spawnedEntities.size();
 
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Reserve buffers
+                    spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                    spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
-                {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
+                    // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
+                    // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
+                    // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
-                    }
+                    request.m_stage = Stage::Cloning;
+                    request.m_nextEntityIndex = 0;
                 }
-                else
+
+                if (request.m_stage == Stage::Cloning)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    auto aliasIt = aliases.begin();
+                    auto aliasEnd = aliases.end();
+                    if (aliasIt == aliasEnd)
                     {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                        // Clone in batches so the work can be paused when the frame budget runs out. Without a budget everything
+                        // is cloned in a single batch.
+                        while (request.m_nextEntityIndex < entitiesToSpawnSize)
                         {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(i);
+                            const uint32_t batchBegin = request.m_nextEntityIndex;
+                            const uint32_t batchEnd = m_hasFrameDeadline
+                                ? AZStd::min(batchBegin + BudgetedCloneBatchSize, entitiesToSpawnSize)
+                                : entitiesToSpawnSize;
+                            const uint32_t batchSize = batchEnd - batchBegin;
+
+                            m_cloneIndices.resize(batchSize);
+                            AZStd::iota(m_cloneIndices.begin(), m_cloneIndices.end(), batchBegin);
+                            m_cloneBuffer.resize(batchSize);
+                            CloneEntities(entitiesToSpawn, m_cloneIndices.data(), batchSize, m_cloneBuffer.data(), *request.m_serializeContext);
+
+                            for (uint32_t i = 0; i < batchSize; ++i)
+                            {
+                                const uint32_t index = batchBegin + i;
+                                // If this entity has previously been spawned, give it a new id in the reference map
+                                RefreshEntityIdMapping(
+                                    entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                                AZ::Entity* clone = m_cloneBuffer[i];
+                                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                                RemapClonedEntity(
+                                    *ticket.m_spawnable, index, *clone, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                                spawnedEntities.emplace_back(clone);
+                                spawnedEntityIndices.push_back(index);
+                            }
+                            request.m_nextEntityIndex = batchEnd;
+
+                            if (request.m_nextEntityIndex < entitiesToSpawnSize && IsFrameBudgetExhausted())
+                            {
+                                m_deferredByFrameBudget = true;
+                                return CommandResult::Requeue;
+                            }
                         }
-                        else
+                    }
+                    else
+                    {
+                        // Aliases can be redirected to other spawnables in between frames, so aliased spawnables are always cloned
+                        // in one go.
+                        for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                         {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
+                            // If this entity has previously been spawned, give it a new id in the reference map
+                            RefreshEntityIdMapping(
+                                entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                            if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
                             {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
+                                spawnedEntities.emplace_back(
+                                    CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntityIndices.push_back(i);
+                            }
+                            else
+                            {
+                                // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
+                                // be safely executed in order without risking an invalid state.
+                                AZ::Entity* previousEntity = nullptr;
+                                do
                                 {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                                    AZ::Entity* clone = CloneSingleAliasedEntity(
+                                        *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *request.m_serializeContext);
+                                    previousEntity = clone;
+                                    if (clone)
+                                    {
+                                        spawnedEntities.emplace_back(clone);
+                                        spawnedEntityIndices.push_back(i);
+                                    }
+                                    ++aliasIt;
+                                } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                            }
                         }
                     }
-                }
 
-                // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+                    // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
+                    // a new set are not added so it no longer holds exactly the number of entities.
+                    ticket.m_loadAll = request.m_spawnedEntitiesInitialCount == 0;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
-                {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                    if (request.m_preInsertionCallback)
+                    {
+                        request.m_preInsertionCallback(
+                            request.m_ticketId,
+                            SpawnableEntityContainerView(
+                                ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                    }
+
+                    request.m_stage = Stage::Activating;
+                    request.m_nextEntityIndex = 0;
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount;
+                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+                const uint32_t newEntitiesCount = aznumeric_caster(AZStd::distance(newEntitiesBegin, newEntitiesEnd));
+
+                // Add to the game context, now the entities are active. This has to happen on the calling thread, so when there's a
+                // frame budget this is done in batches that can be resumed in the next frame.
+                while (request.m_nextEntityIndex < newEntitiesCount)
                 {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    const uint32_t batchEnd = m_hasFrameDeadline
+                        ? AZStd::min(request.m_nextEntityIndex + BudgetedActivationBatchSize, newEntitiesCount)
+                        : newEntitiesCount;
+                    for (auto it = newEntitiesBegin + request.m_nextEntityIndex; it != newEntitiesBegin + batchEnd; ++it)
+                    {
+                        AZ::Entity* clone = (*it);
+                        clone->SetEntitySpawnTicketId(request.m_ticketId);
+                        GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    }
+                    request.m_nextEntityIndex = batchEnd;
+
+                    if (request.m_nextEntityIndex < newEntitiesCount && IsFrameBudgetExhausted())
+                    {
+                        m_deferredByFrameBudget = true;
+                        return CommandResult::Requeue;
+                    }
                 }
 
                 // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
@@ -599,19 +802,31 @@ namespace AzFramework
                 auto aliasEnd = aliases.end();
                 if (aliasBegin == aliasEnd)
                 {
+                    m_cloneIndices.clear();
                     for (uint32_t index : request.m_entityIndices)
                     {
                         if (index < entitiesToSpawn.size())
                         {
-                            // If this entity has previously been spawned, give it a new id in the reference map
-                            RefreshEntityIdMapping(
-                                entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(index);
+                            m_cloneIndices.push_back(index);
                         }
                     }
+                    m_cloneBuffer.resize(m_cloneIndices.size());
+                    CloneEntities(
+                        entitiesToSpawn, m_cloneIndices.data(), m_cloneIndices.size(), m_cloneBuffer.data(), *request.m_serializeContext);
+
+                    for (size_t i = 0; i < m_cloneIndices.size(); ++i)
+                    {
+                        const uint32_t index = m_cloneIndices[i];
+                        // If this entity has previously been spawned, give it a new id in the reference map
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                        AZ::Entity* clone = m_cloneBuffer[i];
+                        AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                        RemapClonedEntity(*ticket.m_spawnable, index, *clone, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        spawnedEntities.push_back(clone);
+                        spawnedEntityIndices.push_back(index);
+                    }
                 }
                 else
                 {
@@ -633,7 +848,7 @@ namespace AzFramework
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
                                 spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                    CloneSingleEntity(*ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -802,7 +1017,7 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(*request.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -823,7 +1038,7 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(*request.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
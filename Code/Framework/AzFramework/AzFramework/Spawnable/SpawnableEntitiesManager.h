@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -47,6 +48,17 @@ namespace AzFramework
             Regular = 1 << 1
         };
 
+        //! Timing information for a command queue, collected while processing the queue.
+        struct QueueMetrics
+        {
+            AZ::u64 m_processedFrames{ 0 }; //!< Number of times the queue has been processed.
+            AZ::u64 m_budgetOverruns{ 0 }; //!< Number of times processing took longer than the frame budget.
+            AZ::u64 m_deferrals{ 0 }; //!< Number of times processing stopped with work left because the frame budget ran out.
+            AZStd::chrono::microseconds m_lastProcessingTime{ 0 }; //!< Time spent processing the queue the last time it was processed.
+            AZStd::chrono::microseconds m_maxProcessingTime{ 0 }; //!< Longest time spent processing the queue.
+            AZStd::chrono::microseconds m_maxOverrun{ 0 }; //!< Largest amount of time processing exceeded the frame budget by.
+        };
+
         SpawnableEntitiesManager();
         ~SpawnableEntitiesManager() override;
 
@@ -88,6 +100,17 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! Sets the amount of time that can be spent per call to ProcessQueue on the queues for the provided priorities. Once the
+        //! budget is used up the remaining commands are left for the next call and large spawn commands are paused and resumed
+        //! where they left off. A budget of zero disables the budget and processes the queue until it's empty, which is the default.
+        //! The starting values can be configured through the Settings Registry under the keys
+        //! "/O3DE/AzFramework/Spawnables/HighPriorityFrameBudgetUs" and "/O3DE/AzFramework/Spawnables/RegularPriorityFrameBudgetUs".
+        void SetFrameBudget(CommandQueuePriority priority, AZStd::chrono::microseconds budget);
+        //! Returns the frame budget for the queue of a single priority.
+        AZStd::chrono::microseconds GetFrameBudget(CommandQueuePriority priority) const;
+        //! Returns the timing information collected for the queue of a single priority.
+        QueueMetrics GetQueueMetrics(CommandQueuePriority priority) const;
+
     protected:
         enum class CommandResult : bool
         {
@@ -95,6 +118,11 @@ namespace AzFramework
             Requeue
         };
 
+        //! The number of entities that are cloned between checks of the frame budget.
+        static constexpr uint32_t BudgetedCloneBatchSize = 128;
+        //! The number of entities that are added to the game context between checks of the frame budget.
+        static constexpr uint32_t BudgetedActivationBatchSize = 16;
+
         struct Ticket final
         {
             AZ_CLASS_ALLOCATOR(Ticket, AZ::ThreadPoolAllocator);
@@ -128,12 +156,23 @@ namespace AzFramework
 
         struct SpawnAllEntitiesCommand final
         {
+            //! Progress of a spawn command, so it can be resumed in a later frame if the frame budget ran out.
+            enum class Stage : uint8_t
+            {
+                Start,
+                Cloning,
+                Activating
+            };
+
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            size_t m_spawnedEntitiesInitialCount{ 0 }; //!< Number of entities in the ticket before this command started.
+            uint32_t m_nextEntityIndex{ 0 }; //!< Index of the next prototype to clone or spawned entity to activate.
+            Stage m_stage{ Stage::Start };
         };
         struct SpawnEntitiesCommand final
         {
@@ -251,6 +290,8 @@ namespace AzFramework
             AZStd::deque<Requests> m_delayed; //!< Requests that were processed before, but couldn't be completed.
             AZStd::queue<Requests> m_pendingRequest; //!< Requests waiting to be processed for the first time.
             AZStd::mutex m_pendingRequestMutex;
+            AZStd::chrono::microseconds m_frameBudget{ 0 }; //!< Time per ProcessQueue call the queue can use. Zero for no limit.
+            QueueMetrics m_metrics;
         };
 
         template<typename T>
@@ -263,9 +304,34 @@ namespace AzFramework
         const AZ::Data::Asset<Spawnable>& GetSpawnableOnTicket(void* ticket) override;
         
         CommandQueueStatus ProcessQueue(Queue& queue);
+        //! Processes up to count requests from the front of the container.
+        //! @return False if processing stopped early because the frame budget ran out.
+        template<typename RequestContainer>
+        bool ProcessRequests(Queue& queue, RequestContainer& requests, size_t count);
+        //! Returns true if a frame budget is active for the queue being processed and it has been used up.
+        bool IsFrameBudgetExhausted() const;
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones the entity at the provided index in the spawnable, using the spawnable's clone plan to remap entity ids if
+        //! one is available for the entity.
+        AZ::Entity* CloneSingleEntity(
+            const Spawnable& spawnable, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones the prototypes at the provided indices without remapping their entity ids. If there are enough entities the clones
+        //! are created in parallel on the job threads.
+        void CloneEntities(
+            const Spawnable::EntityList& prototypes,
+            const uint32_t* indices,
+            size_t count,
+            AZ::Entity** clones,
+            AZ::SerializeContext& serializeContext);
+        //! Generates new entity ids and fixes up entity references for an entity cloned from the entity at the provided index.
+        void RemapClonedEntity(
+            const Spawnable& spawnable,
+            uint32_t entityIndex,
+            AZ::Entity& clone,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
@@ -311,6 +377,19 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities that need to be cloned at once before the cloning is spread across the job threads.
+        //! This can be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold".
+        //! A value of zero disables cloning in parallel.
+        AZ::u64 m_parallelCloneThreshold { 64 };
+
+        //! The point in time the queue that's currently being processed needs to stop, if it has a frame budget.
+        AZStd::chrono::steady_clock::time_point m_frameDeadline;
+        bool m_hasFrameDeadline{ false };
+        //! Set when a command was paused because the frame budget ran out.
+        bool m_deferredByFrameBudget{ false };
+        //! Scratch buffers used while cloning batches of entities.
+        AZStd::vector<AZ::Entity*> m_cloneBuffer;
+        AZStd::vector<uint32_t> m_cloneIndices;
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
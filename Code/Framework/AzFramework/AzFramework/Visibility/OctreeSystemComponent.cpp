@@ -8,6 +8,7 @@
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AzFramework
@@ -16,6 +17,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to child node bounds on split, values above 1 create a loose octree so entries straddling split planes can still descend (clamped to [1, 2])");
 
     static uint32_t GetChildNodeCount()
     {
@@ -34,6 +36,7 @@ namespace AzFramework
         : m_bounds(rhs.m_bounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
+        , m_childBounds(rhs.m_childBounds)
         , m_entries(AZStd::move(rhs.m_entries))
     {
         // Correct internal node pointers
@@ -48,6 +51,7 @@ namespace AzFramework
         m_bounds = rhs.m_bounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
+        m_childBounds = rhs.m_childBounds;
         m_entries = AZStd::move(rhs.m_entries);
 
         // Correct internal node pointers
@@ -282,10 +286,11 @@ namespace AzFramework
         if (m_children != nullptr)
         {
             // If this is not a leaf node, recurse into the children
+            const uint32_t childMask = GetOverlappingChildren(boundingVolume);
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (childMask & (1 << child))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -293,16 +298,141 @@ namespace AzFramework
         }
     }
 
+    template <typename T>
+    uint32_t OctreeNode::GetOverlappingChildren(const T& boundingVolume) const
+    {
+        uint32_t childMask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+            {
+                childMask |= (1 << child);
+            }
+        }
+        return childMask;
+    }
+
+    // Converts a per-lane comparison result into a bitmask, with lane N of the group mapping to bit (laneOffset + N)
+    static uint32_t LaneMaskToBits(AZ::Simd::Vec4::FloatArgType laneMask, uint32_t laneOffset)
+    {
+        alignas(16) int32_t lanes[4];
+        AZ::Simd::Vec4::StoreAligned(lanes, AZ::Simd::Vec4::CastToInt(laneMask));
+        return ((lanes[0] != 0 ? 0x1 : 0) | (lanes[1] != 0 ? 0x2 : 0) | (lanes[2] != 0 ? 0x4 : 0) | (lanes[3] != 0 ? 0x8 : 0)) << laneOffset;
+    }
+
+    uint32_t OctreeNode::GetOverlappingChildren(const AZ::Aabb& aabb) const
+    {
+        using namespace AZ::Simd;
+        const Vec4::FloatType queryMinX = Vec4::Splat(aabb.GetMin().GetX());
+        const Vec4::FloatType queryMinY = Vec4::Splat(aabb.GetMin().GetY());
+        const Vec4::FloatType queryMinZ = Vec4::Splat(aabb.GetMin().GetZ());
+        const Vec4::FloatType queryMaxX = Vec4::Splat(aabb.GetMax().GetX());
+        const Vec4::FloatType queryMaxY = Vec4::Splat(aabb.GetMax().GetY());
+        const Vec4::FloatType queryMaxZ = Vec4::Splat(aabb.GetMax().GetZ());
+
+        uint32_t childMask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t lane = 0; lane < childCount; lane += 4)
+        {
+            // Matches AZ::Aabb::Overlaps, query.min <= child.max && query.max >= child.min on every axis
+            Vec4::FloatType overlap = Vec4::And(
+                Vec4::CmpLtEq(queryMinX, Vec4::LoadAligned(&m_childBounds->m_maxX[lane])),
+                Vec4::CmpGtEq(queryMaxX, Vec4::LoadAligned(&m_childBounds->m_minX[lane])));
+            overlap = Vec4::And(overlap, Vec4::CmpLtEq(queryMinY, Vec4::LoadAligned(&m_childBounds->m_maxY[lane])));
+            overlap = Vec4::And(overlap, Vec4::CmpGtEq(queryMaxY, Vec4::LoadAligned(&m_childBounds->m_minY[lane])));
+            overlap = Vec4::And(overlap, Vec4::CmpLtEq(queryMinZ, Vec4::LoadAligned(&m_childBounds->m_maxZ[lane])));
+            overlap = Vec4::And(overlap, Vec4::CmpGtEq(queryMaxZ, Vec4::LoadAligned(&m_childBounds->m_minZ[lane])));
+            childMask |= LaneMaskToBits(overlap, lane);
+        }
+        return childMask;
+    }
+
+    uint32_t OctreeNode::GetOverlappingChildren(const AZ::Sphere& sphere) const
+    {
+        using namespace AZ::Simd;
+        const Vec4::FloatType centerX = Vec4::Splat(sphere.GetCenter().GetX());
+        const Vec4::FloatType centerY = Vec4::Splat(sphere.GetCenter().GetY());
+        const Vec4::FloatType centerZ = Vec4::Splat(sphere.GetCenter().GetZ());
+        const Vec4::FloatType radiusSq = Vec4::Splat(sphere.GetRadius() * sphere.GetRadius());
+
+        uint32_t childMask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t lane = 0; lane < childCount; lane += 4)
+        {
+            // Distance from the sphere center to the closest point on each child's bounds
+            const Vec4::FloatType deltaX = Vec4::Sub(centerX, Vec4::Clamp(centerX, Vec4::LoadAligned(&m_childBounds->m_minX[lane]), Vec4::LoadAligned(&m_childBounds->m_maxX[lane])));
+            const Vec4::FloatType deltaY = Vec4::Sub(centerY, Vec4::Clamp(centerY, Vec4::LoadAligned(&m_childBounds->m_minY[lane]), Vec4::LoadAligned(&m_childBounds->m_maxY[lane])));
+            const Vec4::FloatType deltaZ = Vec4::Sub(centerZ, Vec4::Clamp(centerZ, Vec4::LoadAligned(&m_childBounds->m_minZ[lane]), Vec4::LoadAligned(&m_childBounds->m_maxZ[lane])));
+            const Vec4::FloatType distSq = Vec4::Madd(deltaX, deltaX, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaZ, deltaZ)));
+            childMask |= LaneMaskToBits(Vec4::CmpLtEq(distSq, radiusSq), lane);
+        }
+        return childMask;
+    }
+
+    uint32_t OctreeNode::GetOverlappingChildren(const AZ::Frustum& frustum) const
+    {
+        using namespace AZ::Simd;
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        uint32_t childMask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t lane = 0; lane < childCount; lane += 4)
+        {
+            // Same separation test as AZ::ShapeIntersection::Overlaps(Frustum, Aabb), scaling before subtracting to avoid overflow on huge bounds
+            const Vec4::FloatType minX = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_minX[lane]));
+            const Vec4::FloatType minY = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_minY[lane]));
+            const Vec4::FloatType minZ = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_minZ[lane]));
+            const Vec4::FloatType maxX = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_maxX[lane]));
+            const Vec4::FloatType maxY = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_maxY[lane]));
+            const Vec4::FloatType maxZ = Vec4::Mul(half, Vec4::LoadAligned(&m_childBounds->m_maxZ[lane]));
+            const Vec4::FloatType centerX = Vec4::Add(minX, maxX);
+            const Vec4::FloatType centerY = Vec4::Add(minY, maxY);
+            const Vec4::FloatType centerZ = Vec4::Add(minZ, maxZ);
+            const Vec4::FloatType extentX = Vec4::Sub(maxX, minX);
+            const Vec4::FloatType extentY = Vec4::Sub(maxY, minY);
+            const Vec4::FloatType extentZ = Vec4::Sub(maxZ, minZ);
+
+            Vec4::FloatType outside = Vec4::CmpGt(zero, zero);
+            for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Plane plane = frustum.GetPlane(planeId);
+                const AZ::Vector3 normal = plane.GetNormal();
+                const AZ::Vector3 normalAbs = normal.GetAbs();
+                const Vec4::FloatType centerDist = Vec4::Madd(Vec4::Splat(normal.GetX()), centerX,
+                    Vec4::Madd(Vec4::Splat(normal.GetY()), centerY, Vec4::Madd(Vec4::Splat(normal.GetZ()), centerZ, Vec4::Splat(plane.GetDistance()))));
+                const Vec4::FloatType radius = Vec4::Madd(Vec4::Splat(normalAbs.GetX()), extentX,
+                    Vec4::Madd(Vec4::Splat(normalAbs.GetY()), extentY, Vec4::Mul(Vec4::Splat(normalAbs.GetZ()), extentZ)));
+                outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(centerDist, radius), zero));
+            }
+            childMask |= LaneMaskToBits(Vec4::Not(outside), lane);
+        }
+        return childMask;
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
         m_childNodeIndex = octreeScene.AllocateChildNodes();
         m_children = octreeScene.GetChildNodesAtIndex(m_childNodeIndex);
+        m_childBounds = octreeScene.GetChildBoundsAtIndex(m_childNodeIndex);
 
         // Set child split planes and bounding volumes
         {
-            const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
-            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
+            // A loose node's bounds are scaled up around its center, so the split is taken from the tight bounds it was created with
+            const float looseness = AZ::GetClamp(static_cast<float>(bg_octreeLooseness), 1.0f, 2.0f);
+            AZ::Vector3 tightMin = m_bounds.GetMin();
+            AZ::Vector3 tightExtent = m_bounds.GetMax() - m_bounds.GetMin();
+            if ((m_parent != nullptr) && (looseness > 1.0f))
+            {
+                tightExtent /= looseness;
+                tightMin = m_bounds.GetCenter() - tightExtent * 0.5f;
+            }
+
+            const AZ::Vector3 childExtent = tightExtent * 0.5f;
+            const AZ::Vector3 childMargin = childExtent * ((looseness - 1.0f) * 0.5f);
+            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(tightMin - childMargin, tightMin + childExtent + childMargin);
             const uint32_t childCount = GetChildNodeCount();
 
             for (uint32_t child = 0; child < childCount; ++child)
@@ -329,6 +459,14 @@ namespace AzFramework
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
+
+                const AZ::Aabb& bounds = m_children[child].m_bounds;
+                m_childBounds->m_minX[child] = bounds.GetMin().GetX();
+                m_childBounds->m_minY[child] = bounds.GetMin().GetY();
+                m_childBounds->m_minZ[child] = bounds.GetMin().GetZ();
+                m_childBounds->m_maxX[child] = bounds.GetMax().GetX();
+                m_childBounds->m_maxY[child] = bounds.GetMax().GetY();
+                m_childBounds->m_maxZ[child] = bounds.GetMax().GetZ();
             }
         }
 
@@ -362,6 +500,7 @@ namespace AzFramework
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
+        m_childBounds = nullptr;
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
@@ -379,6 +518,13 @@ namespace AzFramework
         }
         m_nodeCache.reserve(0);
         m_nodeCache.shrink_to_fit();
+
+        for (auto page : m_childBoundsCache)
+        {
+            delete page;
+        }
+        m_childBoundsCache.reserve(0);
+        m_childBoundsCache.shrink_to_fit();
     }
 
     const AZ::Name& OctreeScene::GetName() const
@@ -507,6 +653,7 @@ namespace AzFramework
         if (m_nodeCache.empty())
         {
             m_nodeCache.push_back(new OctreeNodePage);
+            m_childBoundsCache.push_back(new OctreeChildBoundsPage);
         }
 
         uint32_t nextChildPage = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
@@ -524,6 +671,7 @@ namespace AzFramework
             {
                 // Our last page is already full, so we need to allocate a new page
                 m_nodeCache.push_back(new OctreeNodePage);
+                m_childBoundsCache.push_back(new OctreeChildBoundsPage);
                 ++nextChildPage;
                 nextChildOffset = 0;
             }
@@ -556,6 +704,14 @@ namespace AzFramework
         return &(*m_nodeCache[childPage])[childOffset];
     }
 
+    OctreeChildBounds* OctreeScene::GetChildBoundsAtIndex(uint32_t nodeIndex) const
+    {
+        uint32_t childPage;
+        uint32_t childOffset;
+        ExtractPageAndOffsetFromIndex(nodeIndex, childPage, childOffset);
+        return &(*m_childBoundsCache[childPage])[childOffset / MinChildNodeCount];
+    }
+
     void OctreeSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
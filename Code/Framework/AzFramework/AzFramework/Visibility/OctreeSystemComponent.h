@@ -11,6 +11,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
@@ -21,6 +22,19 @@ namespace AzFramework
     class OctreeSystemComponent;
     class OctreeScene;
 
+    //! Bounds of a node's children, stored as a structure of arrays so that every child can be tested against a query volume at once using SIMD.
+    struct OctreeChildBounds
+    {
+        static constexpr uint32_t MaxChildCount = 8;
+
+        alignas(16) float m_minX[MaxChildCount];
+        alignas(16) float m_minY[MaxChildCount];
+        alignas(16) float m_minZ[MaxChildCount];
+        alignas(16) float m_maxX[MaxChildCount];
+        alignas(16) float m_maxY[MaxChildCount];
+        alignas(16) float m_maxZ[MaxChildCount];
+    };
+
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
     class OctreeNode
@@ -76,6 +90,16 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Returns a bitmask of the child nodes that overlap the provided bounding volume.
+        //! Aabb, sphere and frustum queries test all children at once against the structure of arrays child bounds.
+        //! @{
+        template <typename T>
+        uint32_t GetOverlappingChildren(const T& boundingVolume) const;
+        uint32_t GetOverlappingChildren(const AZ::Aabb& aabb) const;
+        uint32_t GetOverlappingChildren(const AZ::Sphere& sphere) const;
+        uint32_t GetOverlappingChildren(const AZ::Frustum& frustum) const;
+        //! @}
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
@@ -86,6 +110,7 @@ namespace AzFramework
         AZ::Aabb m_bounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
+        OctreeChildBounds* m_childBounds = nullptr; //< Copy of the children's bounds laid out for SIMD culling, or nullptr if this is a leaf node
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
@@ -130,6 +155,7 @@ namespace AzFramework
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
+        OctreeChildBounds* GetChildBoundsAtIndex(uint32_t nodeIndex) const;
 
         mutable AZStd::shared_mutex m_sharedMutex;
 
@@ -144,6 +170,10 @@ namespace AzFramework
 
         using OctreeNodePage = AZStd::fixed_vector<OctreeNode, BlockSize>;
         AZStd::vector<OctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
+
+        static constexpr uint32_t MinChildNodeCount = 4; //< Child blocks start at multiples of the child count, so this bounds the number of blocks per page
+        using OctreeChildBoundsPage = AZStd::array<OctreeChildBounds, BlockSize / MinChildNodeCount>;
+        AZStd::vector<OctreeChildBoundsPage*> m_childBoundsCache; //< Child bounds for each block of child nodes, paged in parallel with m_nodeCache.
         AZStd::stack<uint32_t> m_freeOctreeNodes; //< Indices of free nodes, each entry represents a contiguous block of free OctreeNodeChildCount nodes.
 
         friend class OctreeNode; // For access to the node allocator methods
@@ -56,6 +56,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/FlatAssetCatalog.h
+    Asset/FlatAssetCatalog.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -364,6 +366,8 @@ set(FILES
     Spawnable/SpawnableAssetHandler.cpp
     Spawnable/SpawnableAssetUtils.h
     Spawnable/SpawnableAssetUtils.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
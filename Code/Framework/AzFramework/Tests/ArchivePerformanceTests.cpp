@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/INestedArchive.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Opens and reads files spread over several mounted archives from many threads at once. This measures the file lookup
+    // across all opened archives and the reads of the archive entries, which is what job threads contend on while
+    // streaming in a level.
+    class ArchiveBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PakCount = 5;
+        static constexpr size_t FilesPerPak = 10000;
+
+    protected:
+        // Only the first thread sets up and tears down the application and the archives. All threads wait for each other
+        // before and after the benchmark loop, so the other threads never see partially mounted archives.
+        void SetUpArchives(const benchmark::State& state)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            m_application = AZStd::make_unique<AzFramework::Application>();
+
+            // The archives are written to the user cache of the AutomatedTesting project
+            AZ::SettingsRegistryInterface* registry = AZ::SettingsRegistry::Get();
+            auto projectPathKey =
+                AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey) + "/project_path";
+            AZ::IO::FixedMaxPath enginePath;
+            registry->Get(enginePath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder);
+            registry->Set(projectPathKey, (enginePath / "AutomatedTesting").Native());
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*registry);
+
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start({}, startupParameters);
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+
+            const AZStd::string fileData(256, 'x');
+            m_filePaths.reserve(PakCount * FilesPerPak);
+            for (size_t pakIndex = 0; pakIndex < PakCount; ++pakIndex)
+            {
+                AZStd::string pakPath = AZStd::string::format("@usercache@/archive_benchmark_%zu.pak", pakIndex);
+                archive->ClosePack(pakPath.c_str());
+                fileIo->Remove(pakPath.c_str());
+
+                auto pArchive = archive->OpenArchive(pakPath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+                for (size_t fileIndex = 0; fileIndex < FilesPerPak; ++fileIndex)
+                {
+                    m_filePaths.push_back(AZStd::string::format("levels/benchmark/pak%zu/folder%zu/file%zu.txt", pakIndex, fileIndex % 64, fileIndex));
+                    pArchive->UpdateFile(m_filePaths.back(), fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_STORE);
+                }
+                pArchive.reset();
+
+                archive->OpenPack("@products@", pakPath.c_str());
+                m_pakPaths.push_back(AZStd::move(pakPath));
+            }
+        }
+
+        void TearDownArchives(const benchmark::State& state)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+            for (const AZStd::string& pakPath : m_pakPaths)
+            {
+                archive->ClosePack(pakPath.c_str());
+                fileIo->Remove(pakPath.c_str());
+            }
+
+            m_pakPaths = {};
+            m_filePaths = {};
+            m_application->Stop();
+            m_application.reset();
+        }
+
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AZStd::vector<AZStd::string> m_pakPaths;
+        AZStd::vector<AZStd::string> m_filePaths;
+    };
+
+    // Every iteration looks up a file in the mounted archives without opening it.
+    BENCHMARK_DEFINE_F(ArchiveBenchmark, IsFileExist)(benchmark::State& state)
+    {
+        SetUpArchives(state);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        size_t index = state.thread_index();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(archive->IsFileExist(m_filePaths[index % m_filePaths.size()], AZ::IO::FileSearchLocation::InPak));
+            index += state.threads();
+        }
+
+        TearDownArchives(state);
+    }
+
+    // Every iteration opens, reads and closes a file from the mounted archives.
+    BENCHMARK_DEFINE_F(ArchiveBenchmark, OpenReadClose)(benchmark::State& state)
+    {
+        SetUpArchives(state);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        char buffer[256];
+        size_t index = state.thread_index();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::HandleType fileHandle = archive->FOpen(m_filePaths[index % m_filePaths.size()], "rb");
+            benchmark::DoNotOptimize(archive->FRead(buffer, sizeof(buffer), fileHandle));
+            archive->FClose(fileHandle);
+            index += state.threads();
+        }
+
+        TearDownArchives(state);
+    }
+
+    BENCHMARK_REGISTER_F(ArchiveBenchmark, IsFileExist)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+    BENCHMARK_REGISTER_F(ArchiveBenchmark, OpenReadClose)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif
@@ -312,6 +312,70 @@ namespace UnitTest
         EXPECT_TRUE(AZStd::any_of(fullPaths.cbegin(), fullPaths.cend(), [](auto& path) { return path.ends_with("two.pak"); }));
     }
 
+    TEST_F(ArchiveTestFixture, FileInMultiplePaks_ReadFromHighestPriorityPak_AfterPaksChange)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* sharedFile = "levels/priority/shared.txt";
+        constexpr const char* uniqueFile = "levels/priority/unique.txt";
+        constexpr AZStd::string_view lowPriorityData = "LOW PRIORITY";
+        constexpr AZStd::string_view highPriorityData = "HIGH PRIORITY";
+
+        // Archives are sorted by their full path, archives later in that order take priority
+        AZStd::string lowPriorityPak = "@usercache@/priority_a.pak";
+        AZStd::string highPriorityPak = "@usercache@/priority_b.pak";
+
+        auto createPak = [archive, fileIo](const AZStd::string& pakPath, AZStd::string_view fileData, bool addUniqueFile)
+        {
+            archive->ClosePack(pakPath.c_str());
+            fileIo->Remove(pakPath.c_str());
+
+            auto pArchive = archive->OpenArchive(pakPath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(sharedFile, fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_STORE));
+            if (addUniqueFile)
+            {
+                EXPECT_EQ(0, pArchive->UpdateFile(uniqueFile, fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_STORE));
+            }
+        };
+
+        auto readFile = [archive](const char* filePath)
+        {
+            AZStd::string fileData;
+            AZ::IO::HandleType fileHandle = archive->FOpen(filePath, "rb");
+            if (fileHandle != AZ::IO::InvalidHandle)
+            {
+                fileData.resize_no_construct(archive->FGetSize(fileHandle));
+                fileData.resize_no_construct(archive->FRead(fileData.data(), fileData.size(), fileHandle));
+                archive->FClose(fileHandle);
+            }
+            return fileData;
+        };
+
+        createPak(lowPriorityPak, lowPriorityData, true);
+        createPak(highPriorityPak, highPriorityData, false);
+
+        EXPECT_TRUE(archive->OpenPack("@products@", lowPriorityPak.c_str()));
+        EXPECT_EQ(lowPriorityData, readFile(sharedFile));
+
+        EXPECT_TRUE(archive->OpenPack("@products@", highPriorityPak.c_str()));
+        EXPECT_EQ(highPriorityData, readFile(sharedFile));
+        EXPECT_EQ(lowPriorityData, readFile(uniqueFile));
+
+        EXPECT_TRUE(archive->ClosePack(highPriorityPak.c_str()));
+        EXPECT_EQ(lowPriorityData, readFile(sharedFile));
+
+        EXPECT_TRUE(archive->ClosePack(lowPriorityPak.c_str()));
+        EXPECT_FALSE(archive->IsFileExist(sharedFile, AZ::IO::FileSearchLocation::InPak));
+
+        fileIo->Remove(lowPriorityPak.c_str());
+        fileIo->Remove(highPriorityPak.c_str());
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_LooseFile)
     {
         // ------setup loose file FGetCachedFileData tests -------------------------
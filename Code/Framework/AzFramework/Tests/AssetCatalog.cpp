@@ -25,8 +25,11 @@
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -826,6 +829,136 @@ namespace UnitTest
         CheckNoDependencies(asset1);
     }
 
+    TEST_F(AssetCatalogDeltaTest, FlatCatalog_StoredNextToCatalog_LoadedWithDeltaCatalogOnTop)
+    {
+        // sourcecatalog2 - asset1 path3 (depends on asset 2), asset2 path2, asset4 path4, asset5 path5 (depends on asset 2)
+        AZStd::shared_ptr<AzFramework::AssetRegistry> sourceCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(sourceCatalogPath2.c_str());
+        ASSERT_NE(nullptr, sourceCatalog);
+        AZStd::vector<char> flatCatalogData;
+        ASSERT_TRUE(AzFramework::FlatAssetCatalog::Write(*sourceCatalog, flatCatalogData));
+        const AZStd::string flatCatalogPath = AzFramework::FlatAssetCatalog::GetFlatCatalogPath(sourceCatalogPath2.Native());
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string_view(flatCatalogData.data(), flatCatalogData.size()), flatCatalogPath).IsSuccess());
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::ClearCatalog);
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::LoadCatalog, sourceCatalogPath2.c_str());
+
+        AZStd::string assetPath;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path5);
+        CheckDirectDependencies(asset1, { asset2 });
+        CheckNoDependencies(asset2);
+
+        AZ::Data::AssetId assetId;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_EQ(assetId, asset4);
+
+        // deltacatalog3 - asset1 path6, asset5 path4 (depends on asset 2)
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::AddDeltaCatalog, deltaCatalog3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path6);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path4);
+        CheckNoDependencies(asset1);
+        CheckDirectDependencies(asset5, { asset2 });
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, asset2);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, "");
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, path2, AZ::Data::s_invalidAssetType, false);
+        EXPECT_FALSE(assetId.IsValid());
+
+        // Removing the delta catalog reloads the flat catalog without the changes made on top of it.
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RemoveDeltaCatalog, deltaCatalog3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        CheckDirectDependencies(asset1, { asset2 });
+    }
+
+    class FlatAssetCatalogTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FlatAssetCatalogTest, Write_ManyAssets_AllAssetsCanBeFound)
+    {
+        constexpr size_t AssetCount = 5000;
+        const AZ::Data::AssetType assetType = AZ::Uuid::CreateRandom();
+
+        AZStd::vector<AZ::Data::AssetId> assetIds;
+        AzFramework::AssetRegistry registry;
+        for (size_t i = 0; i < AssetCount; ++i)
+        {
+            AZ::Data::AssetInfo assetInfo;
+            assetInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), aznumeric_cast<AZ::u32>(i % 3));
+            assetInfo.m_assetType = assetType;
+            assetInfo.m_sizeBytes = i;
+            assetInfo.m_relativePath = AZStd::string::format("Folder/Asset%zu.txt", i);
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            if (!assetIds.empty())
+            {
+                registry.RegisterAssetDependency(assetInfo.m_assetId, AZ::Data::ProductDependency(assetIds.back(), 1));
+            }
+            assetIds.push_back(assetInfo.m_assetId);
+        }
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(AzFramework::FlatAssetCatalog::Write(registry, data));
+
+        AzFramework::FlatAssetCatalog flatCatalog;
+        ASSERT_TRUE(flatCatalog.LoadFromBuffer(data.data(), data.size()));
+        EXPECT_EQ(AssetCount, flatCatalog.GetAssetCount());
+
+        for (size_t i = 0; i < AssetCount; ++i)
+        {
+            const AzFramework::FlatAssetCatalog::AssetRecord* record = flatCatalog.FindAsset(assetIds[i]);
+            ASSERT_NE(nullptr, record);
+
+            AZ::Data::AssetInfo assetInfo = flatCatalog.GetAssetInfo(*record);
+            EXPECT_EQ(assetIds[i], assetInfo.m_assetId);
+            EXPECT_EQ(assetType, assetInfo.m_assetType);
+            EXPECT_EQ(i, assetInfo.m_sizeBytes);
+            EXPECT_EQ(AZStd::string::format("Folder/Asset%zu.txt", i), assetInfo.m_relativePath);
+            // Path lookups use the same normalization as the registry.
+            EXPECT_EQ(assetIds[i], flatCatalog.FindAssetIdByPath(AZStd::string::format("FOLDER\\asset%zu.txt", i)));
+
+            AZStd::span<const AzFramework::FlatAssetCatalog::DependencyRecord> dependencies = flatCatalog.GetDependencies(*record);
+            if (i == 0)
+            {
+                EXPECT_TRUE(dependencies.empty());
+            }
+            else
+            {
+                ASSERT_EQ(1u, dependencies.size());
+                AZ::Data::ProductDependency dependency = AzFramework::FlatAssetCatalog::GetDependency(dependencies[0]);
+                EXPECT_EQ(assetIds[i - 1], dependency.m_assetId);
+                EXPECT_EQ(1u, dependency.m_flags.to_ullong());
+            }
+        }
+
+        EXPECT_EQ(nullptr, flatCatalog.FindAsset(AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0)));
+        EXPECT_FALSE(flatCatalog.FindAssetIdByPath("Folder/Missing.txt").IsValid());
+    }
+
+    TEST_F(FlatAssetCatalogTest, LoadFromBuffer_InvalidData_Fails)
+    {
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<char> data;
+        ASSERT_TRUE(AzFramework::FlatAssetCatalog::Write(registry, data));
+
+        AzFramework::FlatAssetCatalog flatCatalog;
+        EXPECT_TRUE(flatCatalog.LoadFromBuffer(data.data(), data.size()));
+        EXPECT_FALSE(flatCatalog.LoadFromBuffer(data.data(), data.size() / 2));
+        data[0] = 0;
+        EXPECT_FALSE(flatCatalog.LoadFromBuffer(data.data(), data.size()));
+        EXPECT_FALSE(flatCatalog.IsLoaded());
+    }
+
     class AssetCatalogAPITest
         : public LeakDetectionFixture
     {
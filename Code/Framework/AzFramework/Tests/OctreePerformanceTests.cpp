@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -332,6 +333,51 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    // Mirrors a renderer visibility pass, nodes are culled by the octree and each surviving entry is then tested individually
+    BENCHMARK_F(BM_Octree, VisibilityFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.frustum, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, VisibilityFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.frustum, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
@@ -12,6 +12,7 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -467,4 +468,88 @@ namespace UnitTest
         }
 
     }
+
+    TEST_F(OctreeTests, LooseSplit_EntryStraddlingSplitPlane_DescendsIntoChild)
+    {
+        float savedLooseness = 1.0f;
+        m_console->GetCvarValue("bg_octreeLooseness", savedLooseness);
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.9f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.1f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(m_octreeScene->GetNodeCount(), 1 + m_octreeScene->GetChildNodeCount());
+
+        // With tight bounds the second entry would be stuck in the root, the loose child bounds extend 0.25 past the split planes
+        const AZ::Aabb looseChildBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.25f), AZ::Vector3(0.25f));
+        uint32_t nodesWithEntries = 0;
+        m_octreeScene->EnumerateNoCull([&visEntry, &looseChildBounds, &nodesWithEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            ++nodesWithEntries;
+            if (nodeData.m_entries[0] == &visEntry[1])
+            {
+                EXPECT_TRUE(nodeData.m_bounds.IsClose(looseChildBounds));
+            }
+        });
+        EXPECT_EQ(nodesWithEntries, 2);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 2);
+
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        EXPECT_EQ(m_octreeScene->GetNodeCount(), 1);
+
+        AZStd::string commandString;
+        commandString.format("bg_octreeLooseness %f", savedLooseness);
+        m_console->PerformCommand(commandString.c_str());
+    }
+
+    TEST_F(OctreeTests, Enumerate_RandomEntries_NeverCullsOverlappingEntries)
+    {
+        // Exercises the SIMD child culling paths against the scalar per-entry tests across a deep tree
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+        constexpr uint32_t EntryCount = 512;
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            const AZ::Vector3 center(unif(rng) * 0.9f, unif(rng) * 0.9f, unif(rng) * 0.9f);
+            visEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.05f));
+            m_octreeScene->InsertOrUpdateEntry(visEntry);
+        }
+
+        auto validateQuery = [this, &visEntries](const auto& query)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(query, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+            for (AzFramework::VisibilityEntry& visEntry : visEntries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(query, visEntry.m_boundingVolume))
+                {
+                    EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry), gatheredEntries.end());
+                }
+            }
+        };
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            const AZ::Vector3 center(unif(rng), unif(rng), unif(rng));
+            validateQuery(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.2f)));
+            validateQuery(AZ::Sphere(center, 0.3f));
+
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(unif(rng) * AZ::Constants::Pi);
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, center * 2.0f);
+            validateQuery(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.1f, 2.0f)));
+        }
+
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(visEntry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
 }
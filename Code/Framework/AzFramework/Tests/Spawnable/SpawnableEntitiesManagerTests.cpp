@@ -581,6 +581,60 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ClonePlanBuilt_EntityIdsAreMappedCorrectly)
+    {
+        // Same as above, but the entity ids are remapped through the precompiled clone plan instead of the reflection data.
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 4;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+            m_spawnable->BuildClonePlan(*m_application->GetSerializeContext());
+            ASSERT_NE(nullptr, m_spawnable->GetClonePlan());
+            EXPECT_EQ(NumEntities, m_spawnable->GetClonePlan()->GetCompiledEntityCount());
+
+            auto callback = [this, refScheme]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+                for (const AZ::Entity* entity : entities)
+                {
+                    const AZ::u64 id = static_cast<AZ::u64>(entity->GetId());
+                    EXPECT_FALSE(id >= EntityIdStartId && id < EntityIdStartId + NumEntities);
+                }
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ComponentsChangedAfterClonePlanBuilt_FallsBackToReflection)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_spawnable->BuildClonePlan(*m_application->GetSerializeContext());
+
+        // Adding a component after building the plan invalidates the plan for the changed entities.
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        const AzFramework::SpawnableClonePlan* clonePlan = m_spawnable->GetClonePlan();
+        ASSERT_NE(nullptr, clonePlan);
+        EXPECT_EQ(nullptr, clonePlan->FindEntityPlan(0, *m_spawnable->GetEntities()[0]));
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -622,6 +676,64 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_FrameBudgetExhausted_SpawnResumesInLaterFrames)
+    {
+        using CommandQueuePriority = AzFramework::SpawnableEntitiesManager::CommandQueuePriority;
+        using CommandQueueStatus = AzFramework::SpawnableEntitiesManager::CommandQueueStatus;
+
+        static constexpr size_t NumEntities = 1000;
+        FillSpawnable(NumEntities);
+        // A budget this small is always exceeded after the first batch, so the spawn has to be spread out over multiple calls.
+        m_manager->SetFrameBudget(CommandQueuePriority::High | CommandQueuePriority::Regular, AZStd::chrono::microseconds(1));
+
+        size_t completionCallCount = 0;
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [&completionCallCount, &spawnedEntitiesCount](
+                            AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            completionCallCount++;
+            spawnedEntitiesCount += entities.size();
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        EXPECT_EQ(CommandQueueStatus::HasCommandsLeft, m_manager->ProcessQueue(CommandQueuePriority::High | CommandQueuePriority::Regular));
+        EXPECT_EQ(0u, completionCallCount);
+
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1u, completionCallCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        AzFramework::SpawnableEntitiesManager::QueueMetrics metrics = m_manager->GetQueueMetrics(CommandQueuePriority::Regular);
+        EXPECT_GT(metrics.m_deferrals, 0u);
+        EXPECT_GT(metrics.m_processedFrames, 1u);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_FrameBudgetWithManyEntities_EntityIdsAreMappedCorrectly)
+    {
+        using CommandQueuePriority = AzFramework::SpawnableEntitiesManager::CommandQueuePriority;
+
+        // Enough entities to clone in parallel and to need multiple batches when the frame budget runs out.
+        constexpr size_t NumEntities = 512;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        m_manager->SetFrameBudget(CommandQueuePriority::High | CommandQueuePriority::Regular, AZStd::chrono::microseconds(1));
+
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [this, &spawnedEntitiesCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
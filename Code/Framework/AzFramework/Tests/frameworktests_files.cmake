@@ -13,6 +13,7 @@ set(FILES
     Spawnable/SpawnableScriptMediatorTests.cpp
     Spawnable/SpawnableTests.cpp
     ArchiveCompressionTests.cpp
+    ArchivePerformanceTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
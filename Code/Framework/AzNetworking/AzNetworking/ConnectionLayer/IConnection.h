@@ -12,6 +12,7 @@
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/ConnectionLayer/ConnectionMetrics.h>
+#include <AzCore/std/limits.h>
 
 namespace AzNetworking
 {
@@ -95,6 +96,21 @@ namespace AzNetworking
         //! @return the max transmission unit for this connection
         virtual uint32_t GetConnectionMtu() const = 0;
 
+        //! Returns the number of bytes the connection's congestion controller will currently allow to be sent.
+        //! Callers producing optional or deferrable traffic should use this to budget their sends.
+        //! TcpConnections rely on the kernel's congestion control and always report an unlimited budget
+        //! @return the number of bytes that may be sent now without exceeding the pacing rate or congestion window
+        virtual uint32_t GetAvailableSendBytes();
+
+        //! Enables or disables compression of the packets sent over this connection.
+        //! Used when the remote endpoint can't decompress the packets of the local compressor, received packets are unaffected.
+        //! @param enabled boolean true to compress packets when the network interface has a compressor
+        void SetCompressionEnabled(bool enabled);
+
+        //! Returns whether packets sent over this connection are compressed when the network interface has a compressor.
+        //! @return boolean true if compression is enabled for this connection
+        bool IsCompressionEnabled() const;
+
         //! Returns the connection identifier for this connection instance.
         //! @return the connection identifier for this connection instance
         ConnectionId GetConnectionId() const;
@@ -141,6 +157,7 @@ namespace AzNetworking
         ConnectionMetrics m_connectionMetrics;
         ConnectionQuality m_connectionQuality;
         void*             m_userData = nullptr;
+        bool              m_compressionEnabled = true;
     };
 }
 
@@ -25,6 +25,21 @@ namespace AzNetworking
         ;
     }
 
+    inline uint32_t IConnection::GetAvailableSendBytes()
+    {
+        return AZStd::numeric_limits<uint32_t>::max();
+    }
+
+    inline void IConnection::SetCompressionEnabled(bool enabled)
+    {
+        m_compressionEnabled = enabled;
+    }
+
+    inline bool IConnection::IsCompressionEnabled() const
+    {
+        return m_compressionEnabled;
+    }
+
     inline ConnectionId IConnection::GetConnectionId() const
     {
         return m_connectionId;
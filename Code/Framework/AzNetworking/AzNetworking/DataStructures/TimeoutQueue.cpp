@@ -8,55 +8,88 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <climits>
 #include <cinttypes>
 
 namespace AzNetworking
 {
+    TimeoutQueue::TimeoutQueue(uint32_t maxItemCount)
+        : m_maxSlots(AZStd::min(maxItemCount, MaxItemCount))
+    {
+        m_bucketHeads.fill(InvalidSlot);
+        m_occupiedBuckets.fill(0);
+    }
+
     void TimeoutQueue::Reset()
     {
-        m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
-        m_nextTimeoutId = TimeoutId{0};
+        AZStd::lock_guard lock(m_mutex);
+
+        m_slotPages.clear();
+        m_bucketHeads.fill(InvalidSlot);
+        m_occupiedBuckets.fill(0);
+        m_freeSlotHead = InvalidSlot;
+        m_freeSlotTail = InvalidSlot;
+        m_allocatedSlots = 0;
+        m_itemCount = 0;
+        m_wheelTimeMs = 0;
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        const TimeoutId timeoutId = m_nextTimeoutId;
-        const AZ::TimeMs timeoutTimeMs = AZ::GetElapsedTimeMs() + timeoutMs;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_itemCount == 0 && !m_isUpdating)
+        {
+            // Nothing is scheduled, so the wheel can jump straight to the current time rather than stepping through idle time
+            m_wheelTimeMs = AZStd::max(m_wheelTimeMs, static_cast<uint64_t>(currentTimeMs));
+        }
+
+        const uint32_t slotIndex = AllocateSlot();
+        if (slotIndex == InvalidSlot)
+        {
+            AZLOG_ERROR("TimeoutQueue exceeded its maximum of %u outstanding items, item with user data %" PRIu64 " is not registered", m_maxSlots, userData);
+            return InvalidTimeoutId;
+        }
+
+        TimeoutSlot& slot = GetSlot(slotIndex);
+        slot.m_item = TimeoutItem(userData, timeoutMs);
+        LinkSlot(slotIndex);
+
         AZLOG(TimeoutQueue, "Pushing timeoutid %u with user data %" PRIu64 " to expire at time %u",
-            aznumeric_cast<uint32_t>(timeoutId),
+            aznumeric_cast<uint32_t>(slot.m_timeoutId),
             userData,
-            aznumeric_cast<uint32_t>(timeoutTimeMs)
+            aznumeric_cast<uint32_t>(slot.m_item.m_nextTimeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
-        ++m_nextTimeoutId;
-
-        return timeoutId;
+        return slot.m_timeoutId;
     }
 
     TimeoutQueue::TimeoutItem *TimeoutQueue::RetrieveItem(TimeoutId timeoutId)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
-        if (iter != m_timeoutItemMap.end())
-        {
-            return &(iter->second);
-        }
-        return nullptr;
+        TimeoutSlot* slot = FindSlot(timeoutId);
+        return (slot != nullptr) ? &slot->m_item : nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        m_timeoutItemMap.erase(timeoutId);
+        if (FindSlot(timeoutId) != nullptr)
+        {
+            const uint32_t slotIndex = static_cast<uint32_t>(timeoutId) & SlotIndexMask;
+            UnlinkSlot(slotIndex);
+            FreeSlot(slotIndex);
+        }
+    }
+
+    uint32_t TimeoutQueue::GetItemCount() const
+    {
+        AZStd::lock_guard lock(m_mutex);
+        return m_itemCount;
     }
 
     void TimeoutQueue::UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
@@ -68,67 +101,274 @@ namespace AzNetworking
         {
             maxTimeouts = INT_MAX;
         }
-        AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
-        {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const uint64_t currentWheelTimeMs = static_cast<uint64_t>(currentTimeMs);
 
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
+        m_isUpdating = true;
+        while (m_wheelTimeMs < currentWheelTimeMs)
+        {
+            if (m_itemCount == 0)
             {
+                m_wheelTimeMs = currentWheelTimeMs;
                 break;
             }
 
-            ++numTimeouts;
+            // Entering a new rotation of the first level, pull down anything now within range from the higher levels
+            if ((m_wheelTimeMs & WheelMask) == 0)
+            {
+                CascadeBuckets();
+            }
 
-            if (numTimeouts >= maxTimeouts)
+            const uint32_t bucket = FindNextOccupiedBucket(static_cast<uint32_t>(m_wheelTimeMs & WheelMask));
+            if (bucket >= WheelSize)
             {
-                AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", numTimeouts);
-                break;
+                // Nothing left to expire in this rotation, skip to the start of the next one
+                m_wheelTimeMs = AZStd::min(currentWheelTimeMs, (m_wheelTimeMs | WheelMask) + 1);
+                continue;
             }
 
-            // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+            const uint64_t bucketTimeMs = (m_wheelTimeMs & ~static_cast<uint64_t>(WheelMask)) | bucket;
+            if (bucketTimeMs >= currentWheelTimeMs)
+            {
+                // Head bucket has not timed out yet, we can terminate because we've run out of timed out items
+                m_wheelTimeMs = currentWheelTimeMs;
+                break;
+            }
+            m_wheelTimeMs = bucketTimeMs;
 
-            TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
-            if (iter == m_timeoutItemMap.end())
+            while (m_bucketHeads[bucket] != InvalidSlot)
             {
-                // Item has already been deleted, just continue
-                continue;
+                if (numTimeouts >= maxTimeouts)
+                {
+                    // Leave the wheel on this bucket so the remaining items are processed on the next update
+                    AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", numTimeouts);
+                    m_isUpdating = false;
+                    return;
+                }
+
+                const uint32_t slotIndex = m_bucketHeads[bucket];
+                UnlinkSlot(slotIndex);
+                TimeoutSlot& slot = GetSlot(slotIndex);
+
+                // Check to see if the item has been refreshed since it was scheduled
+                if (slot.m_item.m_nextTimeoutTimeMs > currentTimeMs)
+                {
+                    LinkSlot(slotIndex);
+                    continue;
+                }
+
+                ++numTimeouts;
+
+                // By this point, the item is definitely timed out
+                // Invoke the timeout function to see how to proceed
+                const TimeoutId timeoutId = slot.m_timeoutId;
+                const TimeoutResult result = timeoutHandler(slot.m_item);
+
+                if (!slot.m_inUse || slot.m_timeoutId != timeoutId)
+                {
+                    // The handler removed the item itself
+                    continue;
+                }
+
+                if (result == TimeoutResult::Refresh)
+                {
+                    slot.m_item.UpdateTimeoutTime(currentTimeMs);
+                    LinkSlot(slotIndex);
+                    continue;
+                }
+
+                AZLOG(TimeoutQueue, "Popping timeoutid %u with user data %" PRIu64 ", expire time %d, current time %u",
+                    aznumeric_cast<uint32_t>(timeoutId),
+                    slot.m_item.m_userData,
+                    aznumeric_cast<uint32_t>(slot.m_item.m_nextTimeoutTimeMs),
+                    aznumeric_cast<uint32_t>(currentTimeMs));
+
+                FreeSlot(slotIndex);
             }
 
-            TimeoutItem mapItem = iter->second;
+            ++m_wheelTimeMs;
+        }
+        m_isUpdating = false;
+    }
+
+    TimeoutQueue::TimeoutSlot& TimeoutQueue::GetSlot(uint32_t slotIndex)
+    {
+        return (*m_slotPages[slotIndex / SlotsPerPage])[slotIndex % SlotsPerPage];
+    }
 
-            // Check to see if the item has been refreshed since it was inserted
-            if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+    TimeoutQueue::TimeoutSlot* TimeoutQueue::FindSlot(TimeoutId timeoutId)
+    {
+        const uint32_t slotIndex = static_cast<uint32_t>(timeoutId) & SlotIndexMask;
+        if (slotIndex >= m_allocatedSlots)
+        {
+            return nullptr;
+        }
+
+        TimeoutSlot& slot = GetSlot(slotIndex);
+        return (slot.m_inUse && slot.m_timeoutId == timeoutId) ? &slot : nullptr;
+    }
+
+    uint32_t TimeoutQueue::AllocateSlot()
+    {
+        uint32_t slotIndex = InvalidSlot;
+        if (m_freeSlotHead != InvalidSlot)
+        {
+            // Free slots are reused in FIFO order to maximize the time before any given TimeoutId is recycled
+            slotIndex = m_freeSlotHead;
+            TimeoutSlot& slot = GetSlot(slotIndex);
+            m_freeSlotHead = slot.m_next;
+            if (m_freeSlotHead == InvalidSlot)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
-                continue;
+                m_freeSlotTail = InvalidSlot;
             }
 
-            // By this point, the item is definitely timed out
-            // Invoke the timeout function to see how to proceed
-            const TimeoutResult result = timeoutHandler(mapItem);
+            const uint32_t reuseCount = (static_cast<uint32_t>(slot.m_timeoutId) >> SlotIndexBits) + 1;
+            slot.m_timeoutId = TimeoutId{ (reuseCount << SlotIndexBits) | slotIndex };
+        }
+        else if (m_allocatedSlots < m_maxSlots)
+        {
+            slotIndex = m_allocatedSlots++;
+            if (slotIndex / SlotsPerPage >= m_slotPages.size())
+            {
+                m_slotPages.push_back(AZStd::make_unique<TimeoutSlotPage>());
+            }
+            GetSlot(slotIndex).m_timeoutId = TimeoutId{ slotIndex };
+        }
+        else
+        {
+            return InvalidSlot;
+        }
+
+        TimeoutSlot& slot = GetSlot(slotIndex);
+        slot.m_prev = InvalidSlot;
+        slot.m_next = InvalidSlot;
+        slot.m_bucket = InvalidBucket;
+        slot.m_inUse = true;
+        ++m_itemCount;
+        return slotIndex;
+    }
+
+    void TimeoutQueue::FreeSlot(uint32_t slotIndex)
+    {
+        TimeoutSlot& slot = GetSlot(slotIndex);
+        AZ_Assert(slot.m_bucket == InvalidBucket, "Freeing a timeout slot that is still scheduled");
+        slot.m_inUse = false;
+        slot.m_next = InvalidSlot;
+        if (m_freeSlotTail != InvalidSlot)
+        {
+            GetSlot(m_freeSlotTail).m_next = slotIndex;
+        }
+        else
+        {
+            m_freeSlotHead = slotIndex;
+        }
+        m_freeSlotTail = slotIndex;
+        --m_itemCount;
+    }
+
+    void TimeoutQueue::LinkSlot(uint32_t slotIndex)
+    {
+        TimeoutSlot& slot = GetSlot(slotIndex);
+
+        // Items that are already due are placed in the current bucket, items beyond the range of the wheel are clamped and rescheduled on expiry
+        const int64_t timeoutTimeMs = static_cast<int64_t>(slot.m_item.m_nextTimeoutTimeMs);
+        const uint64_t maxDeltaMs = (static_cast<uint64_t>(1) << (WheelBits * WheelLevels)) - 1;
+        uint64_t expiryTimeMs = (timeoutTimeMs > static_cast<int64_t>(m_wheelTimeMs)) ? static_cast<uint64_t>(timeoutTimeMs) : m_wheelTimeMs;
+        expiryTimeMs = AZStd::min(expiryTimeMs, m_wheelTimeMs + maxDeltaMs);
+
+        const uint64_t deltaMs = expiryTimeMs - m_wheelTimeMs;
+        uint32_t level = 0;
+        while ((level < WheelLevels - 1) && (deltaMs >> (WheelBits * (level + 1))) != 0)
+        {
+            ++level;
+        }
+
+        const uint32_t levelBucket = static_cast<uint32_t>(expiryTimeMs >> (WheelBits * level)) & WheelMask;
+        const uint32_t bucket = level * WheelSize + levelBucket;
+
+        slot.m_bucket = static_cast<uint16_t>(bucket);
+        slot.m_prev = InvalidSlot;
+        slot.m_next = m_bucketHeads[bucket];
+        if (slot.m_next != InvalidSlot)
+        {
+            GetSlot(slot.m_next).m_prev = slotIndex;
+        }
+        m_bucketHeads[bucket] = slotIndex;
+
+        if (level == 0)
+        {
+            m_occupiedBuckets[levelBucket / 64] |= static_cast<uint64_t>(1) << (levelBucket % 64);
+        }
+    }
+
+    void TimeoutQueue::UnlinkSlot(uint32_t slotIndex)
+    {
+        TimeoutSlot& slot = GetSlot(slotIndex);
+        if (slot.m_bucket == InvalidBucket)
+        {
+            return;
+        }
 
-            if (result == TimeoutResult::Refresh)
+        if (slot.m_prev != InvalidSlot)
+        {
+            GetSlot(slot.m_prev).m_next = slot.m_next;
+        }
+        else
+        {
+            m_bucketHeads[slot.m_bucket] = slot.m_next;
+        }
+
+        if (slot.m_next != InvalidSlot)
+        {
+            GetSlot(slot.m_next).m_prev = slot.m_prev;
+        }
+
+        if (slot.m_bucket < WheelSize && m_bucketHeads[slot.m_bucket] == InvalidSlot)
+        {
+            m_occupiedBuckets[slot.m_bucket / 64] &= ~(static_cast<uint64_t>(1) << (slot.m_bucket % 64));
+        }
+
+        slot.m_prev = InvalidSlot;
+        slot.m_next = InvalidSlot;
+        slot.m_bucket = InvalidBucket;
+    }
+
+    void TimeoutQueue::CascadeBuckets()
+    {
+        for (uint32_t level = 1; level < WheelLevels; ++level)
+        {
+            const uint32_t levelBucket = static_cast<uint32_t>(m_wheelTimeMs >> (WheelBits * level)) & WheelMask;
+            const uint32_t bucket = level * WheelSize + levelBucket;
+            while (m_bucketHeads[bucket] != InvalidSlot)
             {
-                mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
-                continue;
+                const uint32_t slotIndex = m_bucketHeads[bucket];
+                UnlinkSlot(slotIndex);
+                LinkSlot(slotIndex);
             }
 
-            AZLOG(TimeoutQueue, "Popping timeoutid %u with user data %" PRIu64 ", expire time %d, current time %u",
-                aznumeric_cast<uint32_t>(itemTimeoutId),
-                mapItem.m_userData,
-                aznumeric_cast<uint32_t>(mapItem.m_nextTimeoutTimeMs),
-                aznumeric_cast<uint32_t>(currentTimeMs));
+            // Higher levels only need to cascade when this level has also wrapped
+            if (levelBucket != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    uint32_t TimeoutQueue::FindNextOccupiedBucket(uint32_t startBucket) const
+    {
+        for (uint32_t word = startBucket / 64; word < m_occupiedBuckets.size(); ++word)
+        {
+            uint64_t occupied = m_occupiedBuckets[word];
+            if (word == startBucket / 64)
+            {
+                occupied &= ~static_cast<uint64_t>(0) << (startBucket % 64);
+            }
 
-            m_timeoutItemMap.erase(itemTimeoutId);
+            if (occupied != 0)
+            {
+                return word * 64 + static_cast<uint32_t>(az_ctz_u64(occupied));
+            }
         }
+        return WheelSize;
     }
 }
@@ -10,12 +10,16 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
-#include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
     AZ_TYPE_SAFE_INTEGRAL(TimeoutId, uint32_t);
+    static constexpr TimeoutId InvalidTimeoutId = TimeoutId{ 0xFFFFFFFF };
 
     enum class TimeoutResult
     {
@@ -25,6 +29,10 @@ namespace AzNetworking
 
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
+    //! Items are scheduled on a hierarchical timing wheel with millisecond resolution, so registering and removing an item are O(1)
+    //! and UpdateTimeouts only visits the buckets that expire during the elapsed interval.
+    //! TimeoutIds encode the storage slot of the item along with a reuse counter, so an id is only recycled once its slot has been freed
+    //! and reallocated many times over.
     class TimeoutQueue
     {
     public:
@@ -41,7 +49,11 @@ namespace AzNetworking
             AZ::TimeMs m_nextTimeoutTimeMs = AZ::Time::ZeroTimeMs;
         };
 
-        TimeoutQueue() = default;
+        //! Largest number of items that can be registered at the same time.
+        static constexpr uint32_t MaxItemCount = (1 << 22) - 1;
+
+        //! @param maxItemCount the number of items that can be registered at the same time, clamped to MaxItemCount
+        explicit TimeoutQueue(uint32_t maxItemCount = MaxItemCount);
         ~TimeoutQueue() = default;
 
         //! Resets all internal state for this timeout queue.
@@ -50,18 +62,22 @@ namespace AzNetworking
         //! Registers a new item with the TimeoutQueue.
         //! @param userData  value to register a timeout callback for
         //! @param timeoutMs number of milliseconds to trigger the callback after
-        //! @return boolean true if registration was successful
+        //! @return the identifier of the new item, or InvalidTimeoutId if the maximum number of items is already registered
         TimeoutId RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs);
 
         //! Returns the provided timeout item if it exists, also refreshes the timeout value.
         //! @param timeoutId the identifier of the item to fetch
-        //! @return pointer to the timeout item if it exists
+        //! @return pointer to the timeout item if it exists, remains valid until the item is removed or timed out
         TimeoutItem* RetrieveItem(TimeoutId timeoutId);
 
         //! Removes an item from the TimeoutQueue.
         //! @param timeoutId the identifier of the item to remove
         void RemoveItem(TimeoutId timeoutId);
 
+        //! Returns the number of items currently registered with the TimeoutQueue.
+        //! @return the number of registered items
+        uint32_t GetItemCount() const;
+
         //! Updates timeouts for all items, invokes the provided timeout functor if required.
         //! @param timeoutHandler lambda to invoke for all timeouts
         //! @param maxTimeouts    the maximum number of timeouts to process before breaking iteration
@@ -70,26 +86,53 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
+        static constexpr uint32_t WheelBits = 8;
+        static constexpr uint32_t WheelSize = 1 << WheelBits;
+        static constexpr uint32_t WheelMask = WheelSize - 1;
+        static constexpr uint32_t WheelLevels = 4; // Covers 2^32 milliseconds, longer timeouts are rescheduled when they reach the last level
+        static constexpr uint32_t SlotIndexBits = 22;
+        static constexpr uint32_t SlotIndexMask = (1 << SlotIndexBits) - 1;
+        static_assert(MaxItemCount == SlotIndexMask, "The all ones slot index is never allocated, so InvalidTimeoutId never matches an item");
+        static constexpr uint32_t SlotsPerPage = 4096;
+        static constexpr uint32_t InvalidSlot = static_cast<uint32_t>(-1);
+        static constexpr uint16_t InvalidBucket = static_cast<uint16_t>(-1);
+
+        struct TimeoutSlot
         {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
-
-            bool operator < (const TimeoutQueueItem &rhs) const;
-
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
+            TimeoutItem m_item;
+            TimeoutId m_timeoutId = TimeoutId{ 0 };
+            uint32_t m_prev = InvalidSlot;
+            uint32_t m_next = InvalidSlot;
+            uint16_t m_bucket = InvalidBucket;
+            bool m_inUse = false;
         };
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
-
-        TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
-        TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        // Slots are allocated in pages so that item pointers remain stable as the queue grows
+        using TimeoutSlotPage = AZStd::array<TimeoutSlot, SlotsPerPage>;
+
+        TimeoutSlot& GetSlot(uint32_t slotIndex);
+        TimeoutSlot* FindSlot(TimeoutId timeoutId);
+        uint32_t AllocateSlot();
+        void FreeSlot(uint32_t slotIndex);
+        void LinkSlot(uint32_t slotIndex);
+        void UnlinkSlot(uint32_t slotIndex);
+        void CascadeBuckets();
+        uint32_t FindNextOccupiedBucket(uint32_t startBucket) const;
+
+        AZStd::vector<AZStd::unique_ptr<TimeoutSlotPage>> m_slotPages;
+        AZStd::array<uint32_t, WheelLevels * WheelSize> m_bucketHeads;
+        AZStd::array<uint64_t, WheelSize / 64> m_occupiedBuckets; // Occupancy of the first level, used to skip idle milliseconds
+        uint32_t m_freeSlotHead = InvalidSlot;
+        uint32_t m_freeSlotTail = InvalidSlot;
+        uint32_t m_allocatedSlots = 0;
+        uint32_t m_maxSlots = MaxItemCount;
+        uint32_t m_itemCount = 0;
+        uint64_t m_wheelTimeMs = 0;
+        bool m_isUpdating = false;
 
         // TimeoutQueue is a shared resource among connections. A mutex (or a read-write sync object) is required with multi-threaded sends.
         // See @sv_multithreadedConnectionUpdates cvar.
-        AZStd::recursive_mutex m_mutex;
+        mutable AZStd::recursive_mutex m_mutex;
     };
 }
 
@@ -26,6 +26,7 @@ namespace AzNetworking
 
     //! Unique identifier of a given compressor
     AZ_TYPE_SAFE_INTEGRAL(CompressorType, uint32_t);
+    static constexpr CompressorType InvalidCompressorType = CompressorType{ 0 };
 
     //! @class ICompressor
     //! @brief Packet data compressor interface.
@@ -11,6 +11,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzNetworking/Framework/NetworkInterfaceMetrics.h>
+#include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzCore/std/containers/vector.h>
@@ -127,6 +128,11 @@ namespace AzNetworking
         //! @return boolean true if this connection instance is in an open state
         virtual bool IsOpen() const = 0;
 
+        //! Returns the type of the compressor applied to packets sent over this network interface.
+        //! Remote endpoints must agree on the compressor type (including any compression dictionaries) to exchange compressed packets.
+        //! @return the compressor type, or InvalidCompressorType if packets are not compressed
+        virtual CompressorType GetCompressorType() const = 0;
+
     private:
 
         NetworkInterfaceMetrics m_metrics;
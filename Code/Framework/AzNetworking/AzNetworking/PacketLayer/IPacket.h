@@ -45,6 +45,11 @@ namespace AzNetworking
         //! @return copy of the current packet instance, caller assumes ownership
         virtual AZStd::unique_ptr<IPacket> Clone() const = 0;
 
+        //! Returns whether the packet may be compressed when sent.
+        //! Packets that negotiate compression must be readable by endpoints using a different compressor, so they are sent uncompressed.
+        //! @return boolean true if the packet may be compressed, false if it is always sent uncompressed
+        virtual bool IsCompressible() const { return true; }
+
         //! Base serialize method for all serializable structures or classes to implement.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
@@ -109,6 +109,11 @@ namespace AzNetworking
         }
 
         m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
+        UpdateSendMetrics(numSendBytes, sentBytes);
+    }
+
+    void TcpConnection::UpdateSendMetrics(uint32_t numSendBytes, int32_t sentBytes)
+    {
         m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
         m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
 
@@ -124,7 +129,8 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Keep reading until the socket is drained, with edge-triggered socket polling we will not be notified again for data already pending
+        for (;;)
         {
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
@@ -137,8 +143,8 @@ namespace AzNetworking
             const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // No more data on the socket
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
@@ -150,15 +156,27 @@ namespace AzNetworking
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
             m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+
+            // Process received packets
+            ProcessReceivedPackets(startTimeMs);
+            if (m_state == ConnectionState::Disconnected)
+            {
+                break;
+            }
         }
 
-        // Process received packets
+        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
+    }
+
+    void TcpConnection::ProcessReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
         for (;;)
         {
             TcpPacketHeader header(PacketType(0), 0);
             TcpPacketEncodingBuffer buffer;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            if (!ReceivePacketInternal(header, buffer, currentTimeMs))
             {
                 break;
             }
@@ -182,9 +200,6 @@ namespace AzNetworking
                 m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
             }
         }
-
-        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
-        return true;
     }
 
     bool TcpConnection::SendReliablePacket(const IPacket& packet)
@@ -202,7 +217,7 @@ namespace AzNetworking
 
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         ++m_lastSentPacketId;
-        return SendPacketInternal(packet.GetPacketType(), buffer, currentTimeMs);
+        return SendPacketInternal(packet.GetPacketType(), buffer, currentTimeMs, packet.IsCompressible());
     }
 
     PacketId TcpConnection::SendUnreliablePacket(const IPacket& packet)
@@ -260,11 +275,12 @@ namespace AzNetworking
         return 0; // do nothing, unsupported on TCP connections
     }
 
-    bool TcpConnection::SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs)
+    bool TcpConnection::SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs, bool compressible)
     {
         AZ_Assert(payloadBuffer.GetCapacity() < AZStd::numeric_limits<uint16_t>::max(), "Buffer capacity should be representable using 2 bytes or less");
         int32_t payloadSize = aznumeric_cast<int32_t>(payloadBuffer.GetSize());
-        bool shouldCompress = m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = m_compressor && compressible && IsCompressionEnabled()
+            && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         // Create and serialize uncompressed version of header
         TcpPacketEncodingBuffer headerBuffer;
@@ -283,7 +299,7 @@ namespace AzNetworking
 
         // Compress send data
         TcpPacketEncodingBuffer writeBuffer;
-        if (m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
+        if (shouldCompress)
         {
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
@@ -323,29 +339,68 @@ namespace AzNetworking
             }
         }
 
-        const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
-        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
+        const uint32_t headerSize = aznumeric_cast<uint32_t>(headerBuffer.GetSize());
+        const uint32_t numPayloadBytes = aznumeric_cast<uint32_t>(payloadSize);
+        const uint32_t packetSize = headerSize + numPayloadBytes;
 
-        if (dstData == nullptr)
+        // Ensure the whole packet can be queued before writing any of it, a partially sent packet would corrupt the stream
+        if (m_sendRingbuffer.ReserveBlockForWrite(packetSize) == nullptr)
         {
             AZLOG_ERROR("Send ringbuffer full, dropped packet");
             return false;
         }
 
-        // Copy the header data to the ring buffer
+        // Write any previously queued data, the header and the payload with a single gathered send
+        // Only the bytes the socket does not accept are copied into the send ringbuffer
+        const uint32_t numQueuedBytes = m_sendRingbuffer.GetReadBufferSize();
+        TcpSocket::SendSegment segments[3];
+        uint32_t segmentCount = 0;
+        if (numQueuedBytes > 0)
+        {
+            segments[segmentCount++] = { m_sendRingbuffer.GetReadBufferData(), numQueuedBytes };
+        }
+        segments[segmentCount++] = { headerBuffer.GetBuffer(), headerSize };
+        segments[segmentCount++] = { srcData, numPayloadBytes };
+
+        const int32_t sentBytes = m_socket->SendGather(segments, segmentCount);
+        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
+        if (disconnectReason != DisconnectReason::MAX)
         {
-            memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
+            Disconnect(disconnectReason, TerminationEndpoint::Remote);
+            return false;
         }
 
-        // Write payload...
+        const uint32_t numSentBytes = (sentBytes > 0) ? aznumeric_cast<uint32_t>(sentBytes) : 0;
+        const uint32_t numSentQueuedBytes = AZStd::min(numSentBytes, numQueuedBytes);
+        m_sendRingbuffer.AdvanceReadBuffer(numSentQueuedBytes);
+
+        uint32_t numSentPacketBytes = numSentBytes - numSentQueuedBytes;
+        if (numSentPacketBytes < packetSize)
         {
-            memcpy(dstData + headerSize, srcData, payloadSize);
+            // Space was verified above, and sending queued data only frees more
+            const uint32_t numUnsentBytes = packetSize - numSentPacketBytes;
+            uint8_t* dstData = m_sendRingbuffer.ReserveBlockForWrite(numUnsentBytes);
+
+            // Copy whatever remains of the header to the ring buffer
+            if (numSentPacketBytes < headerSize)
+            {
+                memcpy(dstData, headerBuffer.GetBuffer() + numSentPacketBytes, headerSize - numSentPacketBytes);
+                dstData += headerSize - numSentPacketBytes;
+                numSentPacketBytes = headerSize;
+            }
+
+            // Write payload...
+            {
+                const uint32_t numSentPayloadBytes = numSentPacketBytes - headerSize;
+                memcpy(dstData, srcData + numSentPayloadBytes, numPayloadBytes - numSentPayloadBytes);
+            }
+
+            m_sendRingbuffer.AdvanceWriteBuffer(numUnsentBytes);
         }
 
-        m_sendRingbuffer.AdvanceWriteBuffer(headerSize + payloadSize);
-        GetMetrics().LogPacketSent(headerSize + payloadSize, currentTimeMs);
+        UpdateSendMetrics(numQueuedBytes + packetSize, sentBytes);
+        GetMetrics().LogPacketSent(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_sendPackets++;
-        UpdateSend();
         return true;
     }
 
@@ -109,8 +109,18 @@ namespace AzNetworking
         //! @param packetType     packet type of the buffer being transmitted
         //! @param payloadBuffer  packet buffer to transmit
         //! @param currentTimeMs current process time in milliseconds
+        //! @param compressible  false if the packet must be sent uncompressed
         //! @return boolean true if the packet was transmitted (NOT AN INDICATION OF DELIVERY)
-        bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
+        bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs, bool compressible = true);
+
+        //! Updates send metrics after writing to the socket.
+        //! @param numSendBytes number of bytes the send was attempted with
+        //! @param sentBytes    result returned by the socket send call
+        void UpdateSendMetrics(uint32_t numSendBytes, int32_t sentBytes);
+
+        //! Dispatches every complete packet currently held in the receive ringbuffer.
+        //! @param currentTimeMs current process time in milliseconds
+        void ProcessReceivedPackets(AZ::TimeMs currentTimeMs);
 
         //! Receives a packet from the connected connection.
         //! @param outHeader      header of the received packet
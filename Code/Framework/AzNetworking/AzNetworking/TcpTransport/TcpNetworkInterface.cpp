@@ -9,8 +9,10 @@
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
 #include <AzNetworking/TcpTransport/TcpSocketManager.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzNetworking/Framework/INetworking.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace AzNetworking
@@ -21,13 +23,20 @@ namespace AzNetworking
     static const bool net_TcpUseEncryption = false;
 #endif
 
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, net_TcpCompressor);
+
     TcpNetworkInterface::TcpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
         , m_listenThread(listenThread)
     {
-        ;
+        // Tcp connections each own their compressor, create a temporary instance to resolve the type used by this interface
+        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_TcpCompressor);
+        if (AZStd::unique_ptr<ICompressor> compressorInstance = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor))
+        {
+            m_compressorType = compressorInstance->GetType();
+        }
     }
 
     TcpNetworkInterface::~TcpNetworkInterface()
@@ -188,6 +197,11 @@ namespace AzNetworking
         return m_listenThread.GetSocketCount() > 0;
     }
 
+    CompressorType TcpNetworkInterface::GetCompressorType() const
+    {
+        return m_compressorType;
+    }
+
     void TcpNetworkInterface::QueueNewConnection(const PendingConnection& pendingConnection)
     {
         m_pendingConnections.PushBackItem(pendingConnection);
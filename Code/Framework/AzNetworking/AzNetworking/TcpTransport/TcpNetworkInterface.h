@@ -103,6 +103,7 @@ namespace AzNetworking
         AZ::TimeMs GetTimeoutMs() const override;
         bool IsEncrypted() const override;
         bool IsOpen() const override;
+        CompressorType GetCompressorType() const override;
         //! @}
 
         //! Queues a new incoming connection for this network interface.
@@ -149,6 +150,7 @@ namespace AzNetworking
         TrustZone m_trustZone;
         uint16_t m_port = 0;
         AZ::TimeMs m_timeoutMs = AZ::Time::ZeroTimeMs;
+        CompressorType m_compressorType = InvalidCompressorType;
         IConnectionListener& m_connectionListener;
         TcpConnectionSet m_connectionSet;
         TcpSocketManager m_tcpSocketManager;
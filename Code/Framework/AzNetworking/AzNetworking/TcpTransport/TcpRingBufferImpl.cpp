@@ -57,6 +57,13 @@ namespace AzNetworking
         }
 
         m_readPtr += numBytes;
+
+        // Once fully drained, rewind to the start of the buffer so subsequent writes don't need to be compacted
+        if (m_readPtr == m_writePtr)
+        {
+            m_readPtr = m_bufferStart;
+            m_writePtr = m_bufferStart;
+        }
         return true;
     }
 }
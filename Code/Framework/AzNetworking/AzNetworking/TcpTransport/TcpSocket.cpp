@@ -96,6 +96,17 @@ namespace AzNetworking
         return SendInternal(data, size);
     }
 
+    int32_t TcpSocket::SendGather(const SendSegment* segments, uint32_t segmentCount) const
+    {
+        AZ_Assert(segmentCount > 0 && segmentCount <= MaxSendSegments, "Invalid segment count for gathered send");
+        AZ_Assert(segments != nullptr, "NULL segment pointer passed to gathered send");
+        if (!IsOpen())
+        {
+            return SocketOpResultErrorNotOpen;
+        }
+        return SendGatherInternal(segments, segmentCount);
+    }
+
     int32_t TcpSocket::Receive(uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for receive");
@@ -124,6 +135,45 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    int32_t TcpSocket::SendGatherInternal(const SendSegment* segments, uint32_t segmentCount) const
+    {
+#if AZ_TRAIT_OS_USE_WINSOCK
+        WSABUF buffers[MaxSendSegments];
+        for (uint32_t i = 0; i < segmentCount; ++i)
+        {
+            buffers[i].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(segments[i].m_data));
+            buffers[i].len = static_cast<ULONG>(segments[i].m_size);
+        }
+        DWORD numBytesSent = 0;
+        const int32_t sendResult = WSASend(static_cast<SOCKET>(m_socketFd), buffers, static_cast<DWORD>(segmentCount), &numBytesSent, 0, nullptr, nullptr);
+        const int32_t sentBytes = (sendResult == 0) ? static_cast<int32_t>(numBytesSent) : -1;
+#else
+        struct iovec buffers[MaxSendSegments];
+        for (uint32_t i = 0; i < segmentCount; ++i)
+        {
+            buffers[i].iov_base = const_cast<uint8_t*>(segments[i].m_data);
+            buffers[i].iov_len = segments[i].m_size;
+        }
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = buffers;
+        message.msg_iovlen = segmentCount;
+        const int32_t sentBytes = static_cast<int32_t>(sendmsg(aznumeric_cast<int32_t>(m_socketFd), &message, 0));
+#endif
+
+        if (sentBytes < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+
+        return sentBytes;
+    }
+
     int32_t TcpSocket::ReceiveInternal(uint8_t* outData, uint32_t size) const
     {
         const int32_t receivedBytes = static_cast<int32_t>(recv(aznumeric_cast<int32_t>(m_socketFd), (char*)outData, (int32_t)size, 0));
@@ -20,6 +20,16 @@ namespace AzNetworking
     {
     public:
 
+        //! A contiguous block of memory written as part of a gathered send.
+        struct SendSegment
+        {
+            const uint8_t* m_data = nullptr;
+            uint32_t m_size = 0;
+        };
+
+        //! The maximum number of segments that can be passed to a single SendGather call.
+        static constexpr uint32_t MaxSendSegments = 4;
+
         TcpSocket();
 
         //! Construct with an existing socket file descriptor.
@@ -69,6 +79,12 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const uint8_t* data, uint32_t size) const;
 
+        //! Sends several non-contiguous chunks of data to the connected endpoint in order, using a single system call where supported.
+        //! @param segments     the memory segments to send, in stream order
+        //! @param segmentCount number of segments, must not exceed MaxSendSegments
+        //! @return total number of bytes sent across all segments, <= 0 on error
+        int32_t SendGather(const SendSegment* segments, uint32_t segmentCount) const;
+
         //! Receives a payload from the TCP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -79,6 +95,7 @@ namespace AzNetworking
     protected:
 
         virtual int32_t SendInternal(const uint8_t* data, uint32_t size) const;
+        virtual int32_t SendGatherInternal(const SendSegment* segments, uint32_t segmentCount) const;
         virtual int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const;
 
         bool BindSocketForListenInternal(uint16_t port);
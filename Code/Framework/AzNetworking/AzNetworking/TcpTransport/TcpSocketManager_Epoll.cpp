@@ -52,17 +52,24 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        // Failure is expected and harmless if the socket was already closed, the kernel drops closed descriptors from the epoll set
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr);
         ClearSocketHelper(socketFd);
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
+        // Sockets are registered edge-triggered, so callbacks must drain their socket until it would block
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
+            if (error == EINTR)
+            {
+                return;
+            }
             AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
         }
 
@@ -71,7 +78,9 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+
+                // Hangups and errors are routed through the read callback so the failed receive tears the connection down
+                if (socketEvents[event].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
                 {
                     readCallback(socketFd);
                 }
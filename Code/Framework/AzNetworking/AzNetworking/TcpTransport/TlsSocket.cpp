@@ -197,6 +197,28 @@ namespace AzNetworking
 #endif
     }
 
+    int32_t TlsSocket::SendGatherInternal(const SendSegment* segments, uint32_t segmentCount) const
+    {
+        // Each segment has to be encrypted separately, stop at the first segment the socket does not fully accept
+        // SSL_write either accepts a whole segment or blocks, in which case the segment and everything after it is queued in the send ringbuffer
+        // The retry is made from the ringbuffer, so it starts with the same bytes and is at least as long, as OpenSSL requires
+        int32_t totalSentBytes = 0;
+        for (uint32_t i = 0; i < segmentCount; ++i)
+        {
+            const int32_t sentBytes = SendInternal(segments[i].m_data, segments[i].m_size);
+            if (sentBytes < 0)
+            {
+                return (totalSentBytes > 0) ? totalSentBytes : sentBytes;
+            }
+            totalSentBytes += sentBytes;
+            if (static_cast<uint32_t>(sentBytes) < segments[i].m_size)
+            {
+                break;
+            }
+        }
+        return totalSentBytes;
+    }
+
     int32_t TlsSocket::ReceiveInternal([[maybe_unused]] uint8_t* outData, [[maybe_unused]] uint32_t size) const
     {
         if (m_sslSocket == nullptr)
@@ -54,6 +54,7 @@ namespace AzNetworking
     protected:
 
         int32_t SendInternal(const uint8_t* data, uint32_t size) const override;
+        int32_t SendGatherInternal(const SendSegment* segments, uint32_t segmentCount) const override;
         int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const override;
 
         SSL_CTX* m_sslContext;
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(float, net_UdpCongestionLossThreshold, 0.05f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Fraction of packets lost above which the congestion controller backs off its bandwidth estimate");
+    AZ_CVAR(float, net_UdpCongestionLossBackoff, 0.85f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar applied to the bandwidth estimate when a round trip exceeds the loss threshold");
+    AZ_CVAR(AZ::TimeMs, net_UdpPacingBurstMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Number of milliseconds of data at the pacing rate a connection may send in a single burst");
+
+    static constexpr float StartupGain = 2.885f; // 2 / ln(2), doubles the delivery rate every round trip
+    static constexpr float DrainGain = 1.0f / StartupGain;
+    static constexpr float ProbeBandwidthCwndGain = 2.0f;
+    static constexpr float ProbeBandwidthGains[] = { 1.25f, 0.75f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    static constexpr uint32_t ProbeBandwidthGainCount = AZ_ARRAY_SIZE(ProbeBandwidthGains);
+    static constexpr uint32_t ProbeBandwidthCruiseIndex = 2;
+    static constexpr float FullBandwidthGrowth = 1.25f; // Startup ends once the estimate grows by less than this for FullBandwidthRounds
+    static constexpr uint32_t FullBandwidthRounds = 3;
+    static constexpr uint32_t BandwidthWindowRounds = 10;
+    static constexpr AZ::TimeMs MinRttWindowMs = AZ::TimeMs{ 10 * 1000 };
+    static constexpr AZ::TimeMs InitialRttMs = AZ::TimeMs{ 100 };
+    static constexpr uint32_t InitialCongestionWindow = 10 * MaxUdpTransmissionUnit;
+    static constexpr uint32_t MinCongestionWindow = 4 * MaxUdpTransmissionUnit;
+    static constexpr uint32_t LossSamplePackets = 100; // Minimum number of packets to measure the loss rate over
+
+    float UdpNullCongestionController::GetPacingRateBytesPerSecond() const
+    {
+        return AZStd::numeric_limits<float>::max();
+    }
+
+    uint32_t UdpNullCongestionController::GetCongestionWindowBytes() const
+    {
+        return UnlimitedCongestionWindow;
+    }
+
+    uint32_t UdpNullCongestionController::GetBytesInFlight() const
+    {
+        return 0;
+    }
+
+    float UdpNullCongestionController::GetEstimatedBandwidthBytesPerSecond() const
+    {
+        return 0.0f;
+    }
+
+    UdpBbrCongestionController::UdpBbrCongestionController()
+    {
+        Reset();
+    }
+
+    void UdpBbrCongestionController::Reset()
+    {
+        m_sentPackets.assign(InitialTrackedPackets, SentPacketRecord());
+        m_mode = Mode::Startup;
+        m_pacingGain = StartupGain;
+        m_cwndGain = StartupGain;
+        m_probeCycleIndex = 0;
+        m_probeCycleStartMs = AZ::Time::ZeroTimeMs;
+        m_maxBandwidth = 0.0f;
+        m_maxBandwidthRound = 0;
+        m_fullBandwidth = 0.0f;
+        m_fullBandwidthRounds = 0;
+        m_minRttMs = AZ::Time::ZeroTimeMs;
+        m_minRttTimeMs = AZ::Time::ZeroTimeMs;
+        m_delivered = 0;
+        m_deliveredTimeMs = AZ::Time::ZeroTimeMs;
+        m_firstSentTimeMs = AZ::Time::ZeroTimeMs;
+        m_nextRoundDelivered = 0;
+        m_roundCount = 0;
+        m_lossSamplePacketsAcked = 0;
+        m_lossSamplePacketsLost = 0;
+        m_isRoundAppLimited = false;
+        m_bytesInFlight = 0;
+    }
+
+    void UdpBbrCongestionController::OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs)
+    {
+        if (GetRecordSlot(packetId).m_packetId != InvalidPacketId)
+        {
+            GrowTrackedPackets(packetId);
+        }
+
+        SentPacketRecord& record = GetRecordSlot(packetId);
+        if (record.m_packetId != InvalidPacketId)
+        {
+            // Still too many packets outstanding to track, the oldest one hasn't been acked or lost yet so nothing is known about its delivery.
+            // Drop its sample without counting it as a loss, which would inflate the loss rate of high bandwidth delay product paths
+            ReleaseRecord(record);
+        }
+
+        if (m_bytesInFlight == 0)
+        {
+            // Restarting from idle, don't let the idle period count towards the delivery rate of the next packets
+            m_deliveredTimeMs = currentTimeMs;
+            m_firstSentTimeMs = currentTimeMs;
+        }
+
+        record.m_packetId = packetId;
+        record.m_packetSize = packetSize;
+        record.m_sentTimeMs = currentTimeMs;
+        record.m_deliveredAtSend = m_delivered;
+        record.m_deliveredTimeAtSendMs = m_deliveredTimeMs;
+        record.m_firstSentTimeAtSendMs = m_firstSentTimeMs;
+        // If the application isn't filling the pipe, delivery rate samples measure the application rather than the network
+        record.m_isAppLimited = (m_maxBandwidth > 0.0f) && (m_bytesInFlight + packetSize < GetBandwidthDelayProduct() / 2);
+
+        m_bytesInFlight += packetSize;
+    }
+
+    void UdpBbrCongestionController::OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
+    {
+        SentPacketRecord* record = FindRecord(packetId);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        m_delivered += record->m_packetSize;
+        m_deliveredTimeMs = currentTimeMs;
+        m_firstSentTimeMs = record->m_sentTimeMs;
+        ++m_lossSamplePacketsAcked;
+
+        UpdateMinRtt(currentTimeMs - record->m_sentTimeMs, currentTimeMs);
+
+        // The delivery rate is bounded by both the rate data was sent at and the rate it was acked at
+        const AZ::TimeMs sendElapsedMs = record->m_sentTimeMs - record->m_firstSentTimeAtSendMs;
+        const AZ::TimeMs ackElapsedMs = currentTimeMs - record->m_deliveredTimeAtSendMs;
+        const AZ::TimeMs intervalMs = AZStd::max(AZStd::max(sendElapsedMs, ackElapsedMs), AZ::TimeMs{ 1 });
+        const float deliveryRate = static_cast<float>(m_delivered - record->m_deliveredAtSend) * 1000.0f / static_cast<float>(intervalMs);
+
+        const bool isRoundStart = (record->m_deliveredAtSend >= m_nextRoundDelivered);
+        const bool isAppLimited = record->m_isAppLimited;
+        ReleaseRecord(*record);
+
+        UpdateBandwidthSample(deliveryRate, isAppLimited);
+        m_isRoundAppLimited = m_isRoundAppLimited || isAppLimited;
+
+        if (isRoundStart)
+        {
+            m_nextRoundDelivered = m_delivered;
+            OnRoundStart(currentTimeMs);
+        }
+
+        UpdateGains(currentTimeMs);
+    }
+
+    void UdpBbrCongestionController::OnPacketLost(PacketId packetId, [[maybe_unused]] AZ::TimeMs currentTimeMs)
+    {
+        SentPacketRecord* record = FindRecord(packetId);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        ++m_lossSamplePacketsLost;
+        ReleaseRecord(*record);
+    }
+
+    float UdpBbrCongestionController::GetPacingRateBytesPerSecond() const
+    {
+        if (m_maxBandwidth <= 0.0f)
+        {
+            // No bandwidth samples yet, pace the initial window over the best known round trip time
+            const AZ::TimeMs rttMs = (m_minRttMs > AZ::Time::ZeroTimeMs) ? m_minRttMs : InitialRttMs;
+            return m_pacingGain * static_cast<float>(InitialCongestionWindow) * 1000.0f / static_cast<float>(rttMs);
+        }
+        return m_pacingGain * m_maxBandwidth;
+    }
+
+    uint32_t UdpBbrCongestionController::GetCongestionWindowBytes() const
+    {
+        if (m_maxBandwidth <= 0.0f || m_minRttMs <= AZ::Time::ZeroTimeMs)
+        {
+            return InitialCongestionWindow;
+        }
+        const uint32_t congestionWindow = static_cast<uint32_t>(m_cwndGain * static_cast<float>(GetBandwidthDelayProduct()));
+        return AZStd::max(congestionWindow, MinCongestionWindow);
+    }
+
+    uint32_t UdpBbrCongestionController::GetBytesInFlight() const
+    {
+        return m_bytesInFlight;
+    }
+
+    float UdpBbrCongestionController::GetEstimatedBandwidthBytesPerSecond() const
+    {
+        return m_maxBandwidth;
+    }
+
+    UdpBbrCongestionController::Mode UdpBbrCongestionController::GetMode() const
+    {
+        return m_mode;
+    }
+
+    AZ::TimeMs UdpBbrCongestionController::GetMinRttMs() const
+    {
+        return m_minRttMs;
+    }
+
+    uint32_t UdpBbrCongestionController::GetTrackedPacketCapacity() const
+    {
+        return static_cast<uint32_t>(m_sentPackets.size());
+    }
+
+    UdpBbrCongestionController::SentPacketRecord* UdpBbrCongestionController::FindRecord(PacketId packetId)
+    {
+        SentPacketRecord& record = GetRecordSlot(packetId);
+        return (record.m_packetId == packetId) ? &record : nullptr;
+    }
+
+    UdpBbrCongestionController::SentPacketRecord& UdpBbrCongestionController::GetRecordSlot(PacketId packetId)
+    {
+        return m_sentPackets[static_cast<uint32_t>(packetId) & (m_sentPackets.size() - 1)];
+    }
+
+    void UdpBbrCongestionController::GrowTrackedPackets(PacketId packetId)
+    {
+        // Double the ring until the new packet no longer collides with an outstanding one, records keep their packet id so they are simply rehashed
+        while (m_sentPackets.size() < MaxTrackedPackets && GetRecordSlot(packetId).m_packetId != InvalidPacketId)
+        {
+            AZStd::vector<SentPacketRecord> sentPackets(m_sentPackets.size() * 2);
+            for (const SentPacketRecord& record : m_sentPackets)
+            {
+                if (record.m_packetId != InvalidPacketId)
+                {
+                    sentPackets[static_cast<uint32_t>(record.m_packetId) & (sentPackets.size() - 1)] = record;
+                }
+            }
+            m_sentPackets.swap(sentPackets);
+            AZLOG(NET_Congestion, "Grew the congestion controller packet tracking ring to %u packets", GetTrackedPacketCapacity());
+        }
+    }
+
+    void UdpBbrCongestionController::ReleaseRecord(SentPacketRecord& record)
+    {
+        AZ_Assert(m_bytesInFlight >= record.m_packetSize, "Bytes in flight underflow");
+        m_bytesInFlight -= AZStd::min(m_bytesInFlight, record.m_packetSize);
+        record.m_packetId = InvalidPacketId;
+    }
+
+    void UdpBbrCongestionController::OnRoundStart([[maybe_unused]] AZ::TimeMs currentTimeMs)
+    {
+        ++m_roundCount;
+
+        // Back off on sustained loss, which indicates a shallow buffer or policer that the delivery rate alone did not reveal
+        // Loss is measured over enough packets that the occasional random loss of a wireless link doesn't trigger a backoff
+        bool isLossy = false;
+        const uint32_t sampledPackets = m_lossSamplePacketsAcked + m_lossSamplePacketsLost;
+        if (sampledPackets >= LossSamplePackets)
+        {
+            isLossy = (static_cast<float>(m_lossSamplePacketsLost) > static_cast<float>(sampledPackets) * net_UdpCongestionLossThreshold);
+            if (isLossy)
+            {
+                m_maxBandwidth *= net_UdpCongestionLossBackoff;
+                m_maxBandwidthRound = m_roundCount;
+                AZLOG(NET_Congestion, "Lost %u of %u packets, backing off bandwidth estimate to %f bytes per second",
+                    m_lossSamplePacketsLost, sampledPackets, m_maxBandwidth);
+            }
+            m_lossSamplePacketsAcked = 0;
+            m_lossSamplePacketsLost = 0;
+        }
+
+        if (m_mode == Mode::Startup && !m_isRoundAppLimited)
+        {
+            if (m_maxBandwidth >= m_fullBandwidth * FullBandwidthGrowth)
+            {
+                m_fullBandwidth = m_maxBandwidth;
+                m_fullBandwidthRounds = 0;
+            }
+            else
+            {
+                ++m_fullBandwidthRounds;
+            }
+
+            if (m_fullBandwidthRounds >= FullBandwidthRounds || isLossy)
+            {
+                AZLOG(NET_Congestion, "Bottleneck bandwidth found at %f bytes per second, draining queue", m_maxBandwidth);
+                m_mode = Mode::Drain;
+            }
+        }
+
+        m_isRoundAppLimited = false;
+    }
+
+    void UdpBbrCongestionController::UpdateBandwidthSample(float deliveryRate, bool isAppLimited)
+    {
+        // App limited samples may raise the estimate but never refresh or lower it, the connection simply wasn't sending enough to measure
+        const bool isExpired = (m_roundCount - m_maxBandwidthRound) > BandwidthWindowRounds;
+        if (deliveryRate >= m_maxBandwidth || (isExpired && !isAppLimited))
+        {
+            m_maxBandwidth = deliveryRate;
+            m_maxBandwidthRound = m_roundCount;
+        }
+    }
+
+    void UdpBbrCongestionController::UpdateMinRtt(AZ::TimeMs rttMs, AZ::TimeMs currentTimeMs)
+    {
+        rttMs = AZStd::max(rttMs, AZ::TimeMs{ 1 });
+        const bool isExpired = (currentTimeMs - m_minRttTimeMs) > MinRttWindowMs;
+        if (m_minRttMs <= AZ::Time::ZeroTimeMs || rttMs <= m_minRttMs || isExpired)
+        {
+            m_minRttMs = rttMs;
+            m_minRttTimeMs = currentTimeMs;
+        }
+    }
+
+    void UdpBbrCongestionController::UpdateGains(AZ::TimeMs currentTimeMs)
+    {
+        switch (m_mode)
+        {
+        case Mode::Startup:
+            m_pacingGain = StartupGain;
+            m_cwndGain = StartupGain;
+            break;
+
+        case Mode::Drain:
+            m_pacingGain = DrainGain;
+            m_cwndGain = StartupGain;
+            if (m_bytesInFlight <= GetBandwidthDelayProduct())
+            {
+                // The queue built during startup has drained, begin cruising at the estimated bandwidth
+                m_mode = Mode::ProbeBandwidth;
+                m_probeCycleIndex = ProbeBandwidthCruiseIndex;
+                m_probeCycleStartMs = currentTimeMs;
+                m_pacingGain = ProbeBandwidthGains[m_probeCycleIndex];
+                m_cwndGain = ProbeBandwidthCwndGain;
+            }
+            break;
+
+        case Mode::ProbeBandwidth:
+            // Cycle through probing for more bandwidth, draining any queue the probe created, then cruising, one round trip per phase
+            if ((currentTimeMs - m_probeCycleStartMs) > m_minRttMs)
+            {
+                m_probeCycleIndex = (m_probeCycleIndex + 1) % ProbeBandwidthGainCount;
+                m_probeCycleStartMs = currentTimeMs;
+            }
+            m_pacingGain = ProbeBandwidthGains[m_probeCycleIndex];
+            m_cwndGain = ProbeBandwidthCwndGain;
+            break;
+        }
+    }
+
+    uint32_t UdpBbrCongestionController::GetBandwidthDelayProduct() const
+    {
+        const AZ::TimeMs rttMs = (m_minRttMs > AZ::Time::ZeroTimeMs) ? m_minRttMs : InitialRttMs;
+        return static_cast<uint32_t>(m_maxBandwidth * static_cast<float>(rttMs) / 1000.0f);
+    }
+
+    void UdpSendPacer::Reset()
+    {
+        m_tokens = 0.0f;
+        m_lastRefillTimeMs = AZ::Time::ZeroTimeMs;
+        m_initialized = false;
+    }
+
+    uint32_t UdpSendPacer::GetAvailableBytes(const IUdpCongestionController& controller, AZ::TimeMs currentTimeMs)
+    {
+        const uint32_t congestionWindow = controller.GetCongestionWindowBytes();
+        if (congestionWindow == UnlimitedCongestionWindow)
+        {
+            return UnlimitedCongestionWindow;
+        }
+
+        Refill(controller, currentTimeMs);
+
+        const uint32_t bytesInFlight = controller.GetBytesInFlight();
+        const uint32_t windowBytes = (congestionWindow > bytesInFlight) ? congestionWindow - bytesInFlight : 0;
+        const uint32_t pacedBytes = (m_tokens > 0.0f) ? static_cast<uint32_t>(m_tokens) : 0;
+        return AZStd::min(windowBytes, pacedBytes);
+    }
+
+    void UdpSendPacer::OnPacketSent(uint32_t packetSize)
+    {
+        m_tokens -= static_cast<float>(packetSize);
+    }
+
+    void UdpSendPacer::Refill(const IUdpCongestionController& controller, AZ::TimeMs currentTimeMs)
+    {
+        const float pacingRate = controller.GetPacingRateBytesPerSecond();
+        const float maxTokens = AZStd::max(pacingRate * static_cast<float>(net_UdpPacingBurstMs) / 1000.0f, 2.0f * MaxUdpTransmissionUnit);
+
+        if (!m_initialized)
+        {
+            m_tokens = maxTokens;
+            m_lastRefillTimeMs = currentTimeMs;
+            m_initialized = true;
+            return;
+        }
+
+        const AZ::TimeMs elapsedMs = currentTimeMs - m_lastRefillTimeMs;
+        if (elapsedMs > AZ::Time::ZeroTimeMs)
+        {
+            m_tokens = AZStd::min(m_tokens + pacingRate * static_cast<float>(elapsedMs) / 1000.0f, maxTokens);
+            m_lastRefillTimeMs = currentTimeMs;
+        }
+    }
+
+    AZStd::unique_ptr<IUdpCongestionController> CreateCongestionController(AZStd::string_view name)
+    {
+        if (name == "Bbr")
+        {
+            return AZStd::make_unique<UdpBbrCongestionController>();
+        }
+
+        if (name != "None")
+        {
+            AZLOG_WARN("Unknown congestion controller %.*s, congestion control is disabled", AZ_STRING_ARG(name));
+        }
+        return AZStd::make_unique<UdpNullCongestionController>();
+    }
+}
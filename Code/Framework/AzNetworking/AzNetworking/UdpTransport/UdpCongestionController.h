@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzNetworking
+{
+    //! Congestion window reported by controllers that do not limit the send rate.
+    static constexpr uint32_t UnlimitedCongestionWindow = AZStd::numeric_limits<uint32_t>::max();
+
+    //! @class IUdpCongestionController
+    //! @brief Interface for estimating how much data a udp connection can put on the wire without inducing loss.
+    //! Controllers are driven by the per packet send, ack and loss notifications produced by UdpConnection and UdpPacketTracker.
+    class IUdpCongestionController
+    {
+    public:
+
+        virtual ~IUdpCongestionController() = default;
+
+        //! Resets all internal state for this controller.
+        virtual void Reset() = 0;
+
+        //! Invoked whenever a packet is written to the socket.
+        //! @param packetId      identifier of the packet being sent
+        //! @param packetSize    size of the packet in bytes
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Invoked whenever the remote endpoint acknowledges a packet.
+        //! @param packetId      identifier of the packet being acked
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Invoked whenever a packet is determined to be lost.
+        //! @param packetId      identifier of the packet that was lost
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Returns the rate at which the connection should release data onto the wire.
+        //! @return the pacing rate in bytes per second
+        virtual float GetPacingRateBytesPerSecond() const = 0;
+
+        //! Returns the maximum number of unacknowledged bytes the connection should have outstanding.
+        //! @return the congestion window in bytes
+        virtual uint32_t GetCongestionWindowBytes() const = 0;
+
+        //! Returns the number of sent bytes that have not yet been acked or declared lost.
+        //! @return the number of bytes in flight
+        virtual uint32_t GetBytesInFlight() const = 0;
+
+        //! Returns the current estimate of the bottleneck bandwidth of the path to the remote endpoint.
+        //! @return the estimated bandwidth in bytes per second, or 0 if no estimate is available yet
+        virtual float GetEstimatedBandwidthBytesPerSecond() const = 0;
+    };
+
+    //! @class UdpNullCongestionController
+    //! @brief Congestion controller that places no limit on the send rate, matching the behaviour of an uncontrolled connection.
+    class UdpNullCongestionController final
+        : public IUdpCongestionController
+    {
+    public:
+
+        //! IUdpCongestionController interface
+        //! @{
+        void Reset() override {}
+        void OnPacketSent(PacketId, uint32_t, AZ::TimeMs) override {}
+        void OnPacketAcked(PacketId, AZ::TimeMs) override {}
+        void OnPacketLost(PacketId, AZ::TimeMs) override {}
+        float GetPacingRateBytesPerSecond() const override;
+        uint32_t GetCongestionWindowBytes() const override;
+        uint32_t GetBytesInFlight() const override;
+        float GetEstimatedBandwidthBytesPerSecond() const override;
+        //! @}
+    };
+
+    //! @class UdpBbrCongestionController
+    //! @brief Model based congestion controller in the style of BBR.
+    //! The controller measures the delivery rate of every acked packet to maintain a windowed maximum of the bottleneck bandwidth,
+    //! along with a windowed minimum of the round trip time. The pacing rate and congestion window are derived from the resulting
+    //! bandwidth-delay product rather than from loss, so random loss on lossy links does not collapse the send rate.
+    //! Sustained loss above net_UdpCongestionLossThreshold backs the bandwidth estimate off to cope with policers.
+    class UdpBbrCongestionController final
+        : public IUdpCongestionController
+    {
+    public:
+
+        UdpBbrCongestionController();
+
+        //! IUdpCongestionController interface
+        //! @{
+        void Reset() override;
+        void OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs) override;
+        void OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs) override;
+        void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs) override;
+        float GetPacingRateBytesPerSecond() const override;
+        uint32_t GetCongestionWindowBytes() const override;
+        uint32_t GetBytesInFlight() const override;
+        float GetEstimatedBandwidthBytesPerSecond() const override;
+        //! @}
+
+        enum class Mode
+        {
+            Startup,
+            Drain,
+            ProbeBandwidth
+        };
+
+        //! Returns the current mode of the controller state machine.
+        //! @return the current controller mode
+        Mode GetMode() const;
+
+        //! Returns the current estimate of the minimum round trip time of the path to the remote endpoint.
+        //! @return the minimum round trip time in milliseconds
+        AZ::TimeMs GetMinRttMs() const;
+
+        //! Returns the number of outstanding packets that can be tracked before the ring of sent packets grows.
+        //! @return the capacity of the ring of sent packets
+        uint32_t GetTrackedPacketCapacity() const;
+
+        static constexpr uint32_t InitialTrackedPackets = 1024;
+        static constexpr uint32_t MaxTrackedPackets = 64 * 1024;
+
+    private:
+
+        struct SentPacketRecord
+        {
+            PacketId   m_packetId = InvalidPacketId;
+            uint32_t   m_packetSize = 0;
+            AZ::TimeMs m_sentTimeMs = AZ::Time::ZeroTimeMs;
+            uint64_t   m_deliveredAtSend = 0;
+            AZ::TimeMs m_deliveredTimeAtSendMs = AZ::Time::ZeroTimeMs;
+            AZ::TimeMs m_firstSentTimeAtSendMs = AZ::Time::ZeroTimeMs;
+            bool       m_isAppLimited = false;
+        };
+
+        SentPacketRecord* FindRecord(PacketId packetId);
+        SentPacketRecord& GetRecordSlot(PacketId packetId);
+        void GrowTrackedPackets(PacketId packetId);
+        void ReleaseRecord(SentPacketRecord& record);
+        void OnRoundStart(AZ::TimeMs currentTimeMs);
+        void UpdateBandwidthSample(float deliveryRate, bool isAppLimited);
+        void UpdateMinRtt(AZ::TimeMs rttMs, AZ::TimeMs currentTimeMs);
+        void UpdateGains(AZ::TimeMs currentTimeMs);
+        uint32_t GetBandwidthDelayProduct() const;
+
+        static_assert(AZ::IsPowerOfTwo(InitialTrackedPackets) && AZ::IsPowerOfTwo(MaxTrackedPackets), "Tracked packet counts must be powers of two");
+
+        // Ring indexed by packet id, grows when a high bandwidth delay product keeps more packets outstanding than it can hold
+        AZStd::vector<SentPacketRecord> m_sentPackets;
+
+        Mode       m_mode = Mode::Startup;
+        float      m_pacingGain = 0.0f;
+        float      m_cwndGain = 0.0f;
+        uint32_t   m_probeCycleIndex = 0;
+        AZ::TimeMs m_probeCycleStartMs = AZ::Time::ZeroTimeMs;
+
+        float      m_maxBandwidth = 0.0f; // Bytes per second
+        uint32_t   m_maxBandwidthRound = 0;
+        float      m_fullBandwidth = 0.0f;
+        uint32_t   m_fullBandwidthRounds = 0;
+
+        AZ::TimeMs m_minRttMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_minRttTimeMs = AZ::Time::ZeroTimeMs;
+
+        uint64_t   m_delivered = 0;
+        AZ::TimeMs m_deliveredTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_firstSentTimeMs = AZ::Time::ZeroTimeMs;
+        uint64_t   m_nextRoundDelivered = 0;
+        uint32_t   m_roundCount = 0;
+        uint32_t   m_lossSamplePacketsAcked = 0;
+        uint32_t   m_lossSamplePacketsLost = 0;
+        bool       m_isRoundAppLimited = false;
+
+        uint32_t   m_bytesInFlight = 0;
+    };
+
+    //! @class UdpSendPacer
+    //! @brief Token bucket used to release data at a congestion controller's pacing rate.
+    //! Tokens accrue at the pacing rate up to a configurable burst, so a connection serviced once per frame sends an even
+    //! amount of data each frame instead of bursting its entire congestion window at once.
+    class UdpSendPacer
+    {
+    public:
+
+        UdpSendPacer() = default;
+
+        //! Resets all internal state for this pacer.
+        void Reset();
+
+        //! Returns the number of bytes that may be sent now without exceeding either the pacing rate or the congestion window.
+        //! @param controller    the congestion controller providing the pacing rate and congestion window
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return the number of bytes available to send
+        uint32_t GetAvailableBytes(const IUdpCongestionController& controller, AZ::TimeMs currentTimeMs);
+
+        //! Consumes tokens for a sent packet, the token count may go negative for packets that could not be deferred.
+        //! @param packetSize size of the sent packet in bytes
+        void OnPacketSent(uint32_t packetSize);
+
+    private:
+
+        void Refill(const IUdpCongestionController& controller, AZ::TimeMs currentTimeMs);
+
+        float      m_tokens = 0.0f;
+        AZ::TimeMs m_lastRefillTimeMs = AZ::Time::ZeroTimeMs;
+        bool       m_initialized = false;
+    };
+
+    //! Creates a congestion controller by name.
+    //! @param name the name of the controller to create, "Bbr" or "None"
+    //! @return the requested controller, or a null controller if the name is not recognized
+    AZStd::unique_ptr<IUdpCongestionController> CreateCongestionController(AZStd::string_view name);
+}
@@ -19,6 +19,7 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(AZ::CVarFixedString, net_UdpCongestionControl, "None", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Congestion controller to use for new Udp connections, None or Bbr");
     AZ_CVAR(uint32_t, net_UdpMaxUnackedPacketCount, 10, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum packets to receive before forcing a heartbeat packet for acking");
 
     // Track every 8th packet to determine Rtt
@@ -51,7 +52,8 @@ namespace AzNetworking
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
     {
-        ;
+        const AZ::CVarFixedString congestionControl = static_cast<AZ::CVarFixedString>(net_UdpCongestionControl);
+        m_congestionController = CreateCongestionController(congestionControl);
     }
 
     UdpConnection::~UdpConnection()
@@ -154,9 +156,19 @@ namespace AzNetworking
         return m_connectionMtu;
     }
 
+    uint32_t UdpConnection::GetAvailableSendBytes()
+    {
+        AZStd::lock_guard lock(m_congestionMutex);
+        return m_sendPacer.GetAvailableBytes(*m_congestionController, AZ::GetElapsedTimeMs());
+    }
+
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
+        {
+            AZStd::lock_guard lock(m_congestionMutex);
+            m_congestionController->OnPacketAcked(packetId, currentTimeMs);
+        }
         m_reliableQueue.OnPacketAcked(m_networkInterface, *this, packetId);
 
         // Compute Rtt adjustments
@@ -176,6 +188,12 @@ namespace AzNetworking
             GetMetrics().m_connectionRtt.LogPacketSent(packetId, currentTimeMs);
         }
 
+        {
+            AZStd::lock_guard lock(m_congestionMutex);
+            m_congestionController->OnPacketSent(packetId, packetSize, currentTimeMs);
+            m_sendPacer.OnPacketSent(packetSize);
+        }
+
         GetMetrics().LogPacketSent(packetSize, currentTimeMs);
         m_lastSentPacketMs = currentTimeMs;
         m_unackedPacketCount = 0;
@@ -197,6 +215,10 @@ namespace AzNetworking
 
         case PacketAckState::Nacked:
             GetMetrics().LogPacketLost();
+            {
+                AZStd::lock_guard lock(m_congestionMutex);
+                m_congestionController->OnPacketLost(packetId, AZ::GetElapsedTimeMs());
+            }
             if (reliability == ReliabilityType::Reliable)
             {
                 m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
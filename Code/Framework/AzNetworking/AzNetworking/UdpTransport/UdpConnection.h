@@ -11,6 +11,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
@@ -66,6 +67,7 @@ namespace AzNetworking
         bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
         void SetConnectionMtu(uint32_t connectionMtu) override;
         uint32_t GetConnectionMtu() const override;
+        uint32_t GetAvailableSendBytes() override;
         // @}
 
         //! Returns a suitable encryption endpoint for this connection type.
@@ -80,6 +82,10 @@ namespace AzNetworking
         //! @return reference to the requested packet tracker instance
         UdpPacketTracker& GetPacketTracker();
 
+        //! Retrieves the congestion controller instance for this connection.
+        //! @return reference to the congestion controller for this connection
+        const IUdpCongestionController& GetCongestionController() const;
+
         //! Returns the number of unacked reliable messages still pending in the reliable queue.
         //! @return the number of unacked reliable messages still pending in the reliable queue
         uint32_t GetReliableQueueSize() const;
@@ -150,7 +156,11 @@ namespace AzNetworking
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
 
+        AZStd::unique_ptr<IUdpCongestionController> m_congestionController;
+        UdpSendPacer m_sendPacer;
+
         AZStd::mutex m_sendPacketMutex;
+        AZStd::mutex m_congestionMutex; // Separate from m_sendPacketMutex, acks may trigger reliable resends
     };
 }
 
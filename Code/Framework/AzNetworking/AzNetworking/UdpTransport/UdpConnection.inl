@@ -25,6 +25,11 @@ namespace AzNetworking
         return m_packetTracker;
     }
 
+    inline const IUdpCongestionController& UdpConnection::GetCongestionController() const
+    {
+        return *m_congestionController;
+    }
+
     inline uint32_t UdpConnection::GetReliableQueueSize() const
     {
         return m_reliableQueue.GetQueueSize();
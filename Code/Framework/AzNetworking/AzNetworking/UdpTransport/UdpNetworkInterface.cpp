@@ -432,6 +432,11 @@ namespace AzNetworking
         return m_socket->IsOpen();
     }
 
+    CompressorType UdpNetworkInterface::GetCompressorType() const
+    {
+        return m_compressor ? m_compressor->GetType() : InvalidCompressorType;
+    }
+
     void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
@@ -476,8 +481,10 @@ namespace AzNetworking
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
-        // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two,
+        // nor packets negotiating compression or packets to an endpoint that can't decompress them
+        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket)
+            && packet.IsCompressible() && connection.IsCompressionEnabled();
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
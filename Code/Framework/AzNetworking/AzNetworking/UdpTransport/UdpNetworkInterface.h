@@ -118,6 +118,7 @@ namespace AzNetworking
         AZ::TimeMs GetTimeoutMs() const override;
         bool IsEncrypted() const override;
         bool IsOpen() const override;
+        CompressorType GetCompressorType() const override;
         //! @}
 
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
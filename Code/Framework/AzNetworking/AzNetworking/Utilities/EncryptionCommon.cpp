@@ -483,7 +483,8 @@ namespace AzNetworking
         }
 
         // Enable automatic retries for sends if renegotiation is required, makes our code simpler
-        SSL_CTX_set_mode(context, SSL_MODE_AUTO_RETRY);
+        // A write that would block is retried from the TCP send ringbuffer, which may have moved the data since the original call
+        SSL_CTX_set_mode(context, SSL_MODE_AUTO_RETRY | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
 
         AZStd::string certificatePath;
         AZStd::string privateKeyPath;
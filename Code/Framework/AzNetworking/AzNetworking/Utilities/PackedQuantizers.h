@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! Calculates at compile-time the number of bits required to represent a range of values at the requested precision.
+    //! @param range     the total range of the values to quantize (max - min)
+    //! @param precision the largest acceptable distance between two adjacent quantized values
+    //! @return the number of bits required per element, clamped to [1, 32]
+    constexpr uint32_t RequiredQuantizationBits(double range, double precision);
+
+    //! Maps a quantizable value type to its element count and element accessors.
+    template <typename VALUE_TYPE>
+    struct QuantizerElementTraits;
+
+    template <>
+    struct QuantizerElementTraits<float>
+    {
+        static constexpr uint32_t ElementCount = 1;
+        static float GetElement(const float& value, uint32_t index);
+        static float FromElements(const float* elements);
+    };
+
+    template <>
+    struct QuantizerElementTraits<AZ::Vector2>
+    {
+        static constexpr uint32_t ElementCount = 2;
+        static float GetElement(const AZ::Vector2& value, uint32_t index);
+        static AZ::Vector2 FromElements(const float* elements);
+    };
+
+    template <>
+    struct QuantizerElementTraits<AZ::Vector3>
+    {
+        static constexpr uint32_t ElementCount = 3;
+        static float GetElement(const AZ::Vector3& value, uint32_t index);
+        static AZ::Vector3 FromElements(const float* elements);
+    };
+
+    template <>
+    struct QuantizerElementTraits<AZ::Vector4>
+    {
+        static constexpr uint32_t ElementCount = 4;
+        static float GetElement(const AZ::Vector4& value, uint32_t index);
+        static AZ::Vector4 FromElements(const float* elements);
+    };
+
+    //! Branch-free scalar quantization of a single element into an unsigned integer of NUM_BITS bits.
+    template <uint32_t NUM_BITS>
+    struct QuantizedElement
+    {
+        static_assert(NUM_BITS > 0 && NUM_BITS <= 32, "Quantized elements must use between 1 and 32 bits");
+        static constexpr uint64_t MaxIntegralValue = (uint64_t(1) << NUM_BITS) - 1;
+
+        //! Encodes a floating point value in [minValue, maxValue] into an integral value, clamping out of range inputs.
+        static uint64_t Encode(float value, float minValue, float maxValue);
+
+        //! Decodes an integral value produced by Encode back into the range [minValue, maxValue].
+        static float Decode(uint64_t value, float minValue, float maxValue);
+    };
+
+    //! @class RangeQuantizer
+    //! @brief Quantizes every element of a float, Vector2, Vector3 or Vector4 to NUM_BITS bits within [MIN_VALUE, MAX_VALUE].
+    //!
+    //! All elements are bit-packed into a single integral word which is then handed to the serializer, so a Vector3 quantized
+    //! to 16 bits per element costs 6 bytes on the wire rather than 12. Encoding and decoding are branch-free.
+    template <typename VALUE_TYPE, int32_t MIN_VALUE, int32_t MAX_VALUE, uint32_t NUM_BITS>
+    struct RangeQuantizer
+    {
+        static_assert(MIN_VALUE < MAX_VALUE, "Invalid quantization range");
+        static constexpr uint32_t ElementCount = QuantizerElementTraits<VALUE_TYPE>::ElementCount;
+        static constexpr uint32_t TotalBits = ElementCount * NUM_BITS;
+        static_assert(TotalBits <= 64, "Quantized value does not fit into 64 bits, reduce the precision");
+        using PackedType = typename AZ::SizeType<AZ::RequiredBytesForBitfield<TotalBits>(), false>::Type;
+
+        //! Quantizes and bit-packs the provided value.
+        static PackedType Pack(const VALUE_TYPE& value);
+
+        //! Unpacks and decodes a value produced by Pack.
+        static VALUE_TYPE Unpack(PackedType packed);
+
+        //! Serializes the provided value in its quantized form, writing back the decoded value when reading from the network.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param value      the value to serialize
+        //! @param name       string name of the value being serialized
+        //! @return boolean true for success, false for serialization failure
+        static bool Serialize(ISerializer& serializer, VALUE_TYPE& value, const char* name);
+    };
+
+    //! @class SmallestThreeQuantizer
+    //! @brief Quantizes a unit quaternion using smallest-three compression.
+    //!
+    //! The largest magnitude component is dropped and reconstructed from the unit length constraint, the remaining three
+    //! components lie within [-1/sqrt(2), 1/sqrt(2)] and are quantized to NUM_BITS bits each. Two bits encode the index of the
+    //! dropped component. With 10 bits per component a quaternion packs into 4 bytes instead of 16.
+    template <uint32_t NUM_BITS>
+    struct SmallestThreeQuantizer
+    {
+        static constexpr uint32_t TotalBits = 2 + 3 * NUM_BITS;
+        static_assert(TotalBits <= 64, "Quantized quaternion does not fit into 64 bits, reduce the precision");
+        using PackedType = typename AZ::SizeType<AZ::RequiredBytesForBitfield<TotalBits>(), false>::Type;
+
+        //! Quantizes and bit-packs the provided quaternion, which is expected to be normalized.
+        static PackedType Pack(const AZ::Quaternion& value);
+
+        //! Unpacks and decodes a quaternion produced by Pack.
+        static AZ::Quaternion Unpack(PackedType packed);
+
+        //! Serializes the provided quaternion in its quantized form, writing back the decoded value when reading from the network.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param value      the value to serialize
+        //! @param name       string name of the value being serialized
+        //! @return boolean true for success, false for serialization failure
+        static bool Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name);
+    };
+
+    //! @class CellRelativeQuantizer
+    //! @brief Quantizes a Vector3 position as a cell index plus a quantized offset within that cell.
+    //!
+    //! The world range [MIN_VALUE, MAX_VALUE] is divided into cubic cells of CELL_SIZE units. The cell coordinates and the
+    //! offset within the cell are packed into two separate words, the cell word remains constant while an entity moves inside
+    //! a cell which allows delta compression to elide it.
+    template <int32_t MIN_VALUE, int32_t MAX_VALUE, int32_t CELL_SIZE, uint32_t NUM_OFFSET_BITS>
+    struct CellRelativeQuantizer
+    {
+        static_assert(MIN_VALUE < MAX_VALUE, "Invalid quantization range");
+        static_assert(CELL_SIZE > 0 && CELL_SIZE <= (MAX_VALUE - MIN_VALUE), "Invalid cell size");
+        static constexpr uint32_t CellCount = static_cast<uint32_t>((static_cast<int64_t>(MAX_VALUE) - MIN_VALUE + CELL_SIZE - 1) / CELL_SIZE);
+        static constexpr uint32_t CellBits = AZ::Log2(CellCount - 1);
+        static_assert(3 * CellBits <= 64, "Too many cells, increase the cell size");
+        static_assert(3 * NUM_OFFSET_BITS <= 64, "Quantized offset does not fit into 64 bits, reduce the precision");
+        using CellType = typename AZ::SizeType<AZ::RequiredBytesForBitfield<3 * CellBits>(), false>::Type;
+        using OffsetType = typename AZ::SizeType<AZ::RequiredBytesForBitfield<3 * NUM_OFFSET_BITS>(), false>::Type;
+
+        //! Quantizes and bit-packs the provided position.
+        static void Pack(const AZ::Vector3& value, CellType& outCell, OffsetType& outOffset);
+
+        //! Unpacks and decodes a position produced by Pack.
+        static AZ::Vector3 Unpack(CellType cell, OffsetType offset);
+
+        //! Serializes the provided position in its quantized form, writing back the decoded value when reading from the network.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param value      the value to serialize
+        //! @param name       string name of the value being serialized
+        //! @return boolean true for success, false for serialization failure
+        static bool Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name);
+    };
+}
+
+#include <AzNetworking/Utilities/PackedQuantizers.inl>
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AzNetworking
+{
+    constexpr uint32_t RequiredQuantizationBits(double range, double precision)
+    {
+        const double steps = range / precision;
+        uint32_t bits = 1;
+        while ((bits < 32) && (static_cast<double>((uint64_t(1) << bits) - 1) < steps))
+        {
+            ++bits;
+        }
+        return bits;
+    }
+
+    inline float QuantizerElementTraits<float>::GetElement(const float& value, [[maybe_unused]] uint32_t index)
+    {
+        return value;
+    }
+
+    inline float QuantizerElementTraits<float>::FromElements(const float* elements)
+    {
+        return elements[0];
+    }
+
+    inline float QuantizerElementTraits<AZ::Vector2>::GetElement(const AZ::Vector2& value, uint32_t index)
+    {
+        return value.GetElement(static_cast<int32_t>(index));
+    }
+
+    inline AZ::Vector2 QuantizerElementTraits<AZ::Vector2>::FromElements(const float* elements)
+    {
+        return AZ::Vector2(elements[0], elements[1]);
+    }
+
+    inline float QuantizerElementTraits<AZ::Vector3>::GetElement(const AZ::Vector3& value, uint32_t index)
+    {
+        return value.GetElement(static_cast<int32_t>(index));
+    }
+
+    inline AZ::Vector3 QuantizerElementTraits<AZ::Vector3>::FromElements(const float* elements)
+    {
+        return AZ::Vector3(elements[0], elements[1], elements[2]);
+    }
+
+    inline float QuantizerElementTraits<AZ::Vector4>::GetElement(const AZ::Vector4& value, uint32_t index)
+    {
+        return value.GetElement(static_cast<int32_t>(index));
+    }
+
+    inline AZ::Vector4 QuantizerElementTraits<AZ::Vector4>::FromElements(const float* elements)
+    {
+        return AZ::Vector4(elements[0], elements[1], elements[2], elements[3]);
+    }
+
+    template <uint32_t NUM_BITS>
+    inline uint64_t QuantizedElement<NUM_BITS>::Encode(float value, float minValue, float maxValue)
+    {
+        constexpr float maxIntegral = static_cast<float>(MaxIntegralValue);
+        const float normalized = (value - minValue) * (maxIntegral / (maxValue - minValue));
+        // Round to nearest, clamping compiles down to min/max instructions so out of range inputs never branch.
+        // The float maximum is rounded up to 2^NUM_BITS for wide elements, so the result is clamped again in integer space
+        const uint64_t quantized = static_cast<uint64_t>(AZStd::clamp(normalized + 0.5f, 0.0f, maxIntegral));
+        return AZStd::min(quantized, MaxIntegralValue);
+    }
+
+    template <uint32_t NUM_BITS>
+    inline float QuantizedElement<NUM_BITS>::Decode(uint64_t value, float minValue, float maxValue)
+    {
+        constexpr float maxIntegral = static_cast<float>(MaxIntegralValue);
+        return minValue + static_cast<float>(value & MaxIntegralValue) * ((maxValue - minValue) / maxIntegral);
+    }
+
+    template <typename VALUE_TYPE, int32_t MIN_VALUE, int32_t MAX_VALUE, uint32_t NUM_BITS>
+    inline auto RangeQuantizer<VALUE_TYPE, MIN_VALUE, MAX_VALUE, NUM_BITS>::Pack(const VALUE_TYPE& value) -> PackedType
+    {
+        uint64_t packed = 0;
+        for (uint32_t i = 0; i < ElementCount; ++i)
+        {
+            const float element = QuantizerElementTraits<VALUE_TYPE>::GetElement(value, i);
+            packed |= QuantizedElement<NUM_BITS>::Encode(element, static_cast<float>(MIN_VALUE), static_cast<float>(MAX_VALUE)) << (i * NUM_BITS);
+        }
+        return static_cast<PackedType>(packed);
+    }
+
+    template <typename VALUE_TYPE, int32_t MIN_VALUE, int32_t MAX_VALUE, uint32_t NUM_BITS>
+    inline VALUE_TYPE RangeQuantizer<VALUE_TYPE, MIN_VALUE, MAX_VALUE, NUM_BITS>::Unpack(PackedType packed)
+    {
+        float elements[ElementCount];
+        for (uint32_t i = 0; i < ElementCount; ++i)
+        {
+            const uint64_t element = static_cast<uint64_t>(packed) >> (i * NUM_BITS);
+            elements[i] = QuantizedElement<NUM_BITS>::Decode(element, static_cast<float>(MIN_VALUE), static_cast<float>(MAX_VALUE));
+        }
+        return QuantizerElementTraits<VALUE_TYPE>::FromElements(elements);
+    }
+
+    template <typename VALUE_TYPE, int32_t MIN_VALUE, int32_t MAX_VALUE, uint32_t NUM_BITS>
+    inline bool RangeQuantizer<VALUE_TYPE, MIN_VALUE, MAX_VALUE, NUM_BITS>::Serialize(ISerializer& serializer, VALUE_TYPE& value, const char* name)
+    {
+        PackedType packed = Pack(value);
+        if (serializer.Serialize(packed, name) && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            value = Unpack(packed);
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t NUM_BITS>
+    inline auto SmallestThreeQuantizer<NUM_BITS>::Pack(const AZ::Quaternion& value) -> PackedType
+    {
+        constexpr float componentBound = 0.70710678118f; // 1 / sqrt(2)
+
+        float elements[4];
+        value.StoreToFloat4(elements);
+
+        // Select the largest magnitude component without branching
+        uint32_t largestIndex = 0;
+        float largestMagnitude = AZStd::abs(elements[0]);
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            const float magnitude = AZStd::abs(elements[i]);
+            const bool isLarger = magnitude > largestMagnitude;
+            largestIndex = isLarger ? i : largestIndex;
+            largestMagnitude = AZStd::max(magnitude, largestMagnitude);
+        }
+
+        // q and -q represent the same rotation, flip the sign so the dropped component is always positive
+        const float sign = (elements[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+
+        uint64_t packed = largestIndex;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float element = sign * elements[(largestIndex + i + 1) & 3];
+            packed |= QuantizedElement<NUM_BITS>::Encode(element, -componentBound, componentBound) << (2 + i * NUM_BITS);
+        }
+        return static_cast<PackedType>(packed);
+    }
+
+    template <uint32_t NUM_BITS>
+    inline AZ::Quaternion SmallestThreeQuantizer<NUM_BITS>::Unpack(PackedType packed)
+    {
+        constexpr float componentBound = 0.70710678118f; // 1 / sqrt(2)
+
+        const uint32_t largestIndex = static_cast<uint32_t>(packed & 3);
+        float elements[4];
+        float sumSquares = 0.0f;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const uint64_t quantized = static_cast<uint64_t>(packed) >> (2 + i * NUM_BITS);
+            const float element = QuantizedElement<NUM_BITS>::Decode(quantized, -componentBound, componentBound);
+            elements[(largestIndex + i + 1) & 3] = element;
+            sumSquares += element * element;
+        }
+        elements[largestIndex] = AZStd::sqrt(AZStd::max(0.0f, 1.0f - sumSquares));
+        return AZ::Quaternion::CreateFromFloat4(elements);
+    }
+
+    template <uint32_t NUM_BITS>
+    inline bool SmallestThreeQuantizer<NUM_BITS>::Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name)
+    {
+        PackedType packed = Pack(value);
+        if (serializer.Serialize(packed, name) && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            value = Unpack(packed);
+        }
+        return serializer.IsValid();
+    }
+
+    template <int32_t MIN_VALUE, int32_t MAX_VALUE, int32_t CELL_SIZE, uint32_t NUM_OFFSET_BITS>
+    inline void CellRelativeQuantizer<MIN_VALUE, MAX_VALUE, CELL_SIZE, NUM_OFFSET_BITS>::Pack(const AZ::Vector3& value, CellType& outCell, OffsetType& outOffset)
+    {
+        constexpr float cellSize = static_cast<float>(CELL_SIZE);
+        constexpr float maxCell = static_cast<float>(CellCount - 1);
+
+        uint64_t cell = 0;
+        uint64_t offset = 0;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float relative = value.GetElement(static_cast<int32_t>(i)) - static_cast<float>(MIN_VALUE);
+            const float cellIndex = AZStd::clamp(AZStd::floor(relative / cellSize), 0.0f, maxCell);
+            const float cellOffset = relative - cellIndex * cellSize;
+            cell |= static_cast<uint64_t>(cellIndex) << (i * CellBits);
+            offset |= QuantizedElement<NUM_OFFSET_BITS>::Encode(cellOffset, 0.0f, cellSize) << (i * NUM_OFFSET_BITS);
+        }
+        outCell = static_cast<CellType>(cell);
+        outOffset = static_cast<OffsetType>(offset);
+    }
+
+    template <int32_t MIN_VALUE, int32_t MAX_VALUE, int32_t CELL_SIZE, uint32_t NUM_OFFSET_BITS>
+    inline AZ::Vector3 CellRelativeQuantizer<MIN_VALUE, MAX_VALUE, CELL_SIZE, NUM_OFFSET_BITS>::Unpack(CellType cell, OffsetType offset)
+    {
+        constexpr float cellSize = static_cast<float>(CELL_SIZE);
+        constexpr uint64_t cellMask = (uint64_t(1) << CellBits) - 1;
+
+        float elements[3];
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float cellIndex = static_cast<float>((static_cast<uint64_t>(cell) >> (i * CellBits)) & cellMask);
+            const uint64_t quantizedOffset = static_cast<uint64_t>(offset) >> (i * NUM_OFFSET_BITS);
+            const float cellOffset = QuantizedElement<NUM_OFFSET_BITS>::Decode(quantizedOffset, 0.0f, cellSize);
+            elements[i] = static_cast<float>(MIN_VALUE) + cellIndex * cellSize + cellOffset;
+        }
+        return AZ::Vector3(elements[0], elements[1], elements[2]);
+    }
+
+    template <int32_t MIN_VALUE, int32_t MAX_VALUE, int32_t CELL_SIZE, uint32_t NUM_OFFSET_BITS>
+    inline bool CellRelativeQuantizer<MIN_VALUE, MAX_VALUE, CELL_SIZE, NUM_OFFSET_BITS>::Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name)
+    {
+        CellType cell = 0;
+        OffsetType offset = 0;
+        Pack(value, cell, offset);
+        serializer.Serialize(cell, "Cell");
+        serializer.Serialize(offset, name);
+        if (serializer.IsValid() && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            value = Unpack(cell, offset);
+        }
+        return serializer.IsValid();
+    }
+}
@@ -97,6 +97,8 @@ set(FILES
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
     UdpTransport/DtlsSocket.h
+    UdpTransport/UdpCongestionController.cpp
+    UdpTransport/UdpCongestionController.h
     UdpTransport/UdpConnection.cpp
     UdpTransport/UdpConnection.h
     UdpTransport/UdpConnection.inl
@@ -136,6 +138,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/PackedQuantizers.h
+    Utilities/PackedQuantizers.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AzNetworking::TimeoutQueueBenchmarks
+{
+    static constexpr uint32_t OutstandingTimeouts = 1000000;
+    static constexpr uint32_t MaxTimeoutMs = 1000;
+    static constexpr AZ::TimeMs FrameTimeMs = AZ::TimeMs{ 16 };
+
+    class TimeoutQueueBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_timeSystem->SetElapsedTimeMsDebug(AZ::Time::ZeroTimeMs);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_timeSystem->SetElapsedTimeMsDebug(AZ::Time::ZeroTimeMs);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            m_timeSystem.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            m_timeSystem.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        // Registers timeouts spread evenly over MaxTimeoutMs, similar to the resend timers of many active connections
+        void RegisterOutstandingTimeouts(TimeoutQueue& timeoutQueue, AZStd::vector<TimeoutId>& timeoutIds)
+        {
+            timeoutIds.reserve(OutstandingTimeouts);
+            for (uint32_t i = 0; i < OutstandingTimeouts; ++i)
+            {
+                timeoutIds.push_back(timeoutQueue.RegisterItem(i, AZ::TimeMs{ (i * 7919) % MaxTimeoutMs + 1 }));
+            }
+        }
+
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+    };
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmarkFixture, RegisterRemove)(::benchmark::State& state)
+    {
+        TimeoutQueue timeoutQueue;
+        AZStd::vector<TimeoutId> timeoutIds;
+        RegisterOutstandingTimeouts(timeoutQueue, timeoutIds);
+
+        // Cancel the oldest outstanding timeout and register a replacement, keeping the queue at OutstandingTimeouts items
+        uint32_t oldest = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            timeoutQueue.RemoveItem(timeoutIds[oldest]);
+            timeoutIds[oldest] = timeoutQueue.RegisterItem(oldest, AZ::TimeMs{ (oldest * 7919) % MaxTimeoutMs + 1 });
+            oldest = (oldest + 1) % OutstandingTimeouts;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmarkFixture, RegisterRemove)
+        ->Unit(benchmark::kNanosecond);
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmarkFixture, RetrieveRefresh)(::benchmark::State& state)
+    {
+        TimeoutQueue timeoutQueue;
+        AZStd::vector<TimeoutId> timeoutIds;
+        RegisterOutstandingTimeouts(timeoutQueue, timeoutIds);
+
+        // Mirrors the refresh performed for every packet received on a connection
+        uint32_t next = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TimeoutQueue::TimeoutItem* item = timeoutQueue.RetrieveItem(timeoutIds[next]);
+            item->UpdateTimeoutTime(AZ::GetElapsedTimeMs());
+            benchmark::DoNotOptimize(item);
+            next = (next + 1) % OutstandingTimeouts;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmarkFixture, RetrieveRefresh)
+        ->Unit(benchmark::kNanosecond);
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmarkFixture, ExpireAll)(::benchmark::State& state)
+    {
+        uint64_t expiredCount = 0;
+        auto handler = [&expiredCount](TimeoutQueue::TimeoutItem&)
+        {
+            ++expiredCount;
+            return TimeoutResult::Delete;
+        };
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_timeSystem->SetElapsedTimeMsDebug(AZ::Time::ZeroTimeMs);
+            TimeoutQueue timeoutQueue;
+            AZStd::vector<TimeoutId> timeoutIds;
+            RegisterOutstandingTimeouts(timeoutQueue, timeoutIds);
+            state.ResumeTiming();
+
+            // Step the clock a frame at a time, expiring a batch of timeouts each update
+            while (timeoutQueue.GetItemCount() > 0)
+            {
+                m_timeSystem->SetElapsedTimeMsDebug(m_timeSystem->GetElapsedTimeMs() + FrameTimeMs);
+                timeoutQueue.UpdateTimeouts(handler);
+            }
+        }
+
+        state.SetItemsProcessed(expiredCount);
+    }
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmarkFixture, ExpireAll)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif
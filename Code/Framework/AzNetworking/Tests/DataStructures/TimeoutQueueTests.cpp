@@ -7,8 +7,205 @@
  */
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    class TimeoutQueueTests
+        : public LeakDetectionFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+            ON_CALL(*m_timeSystem, GetElapsedTimeMs()).WillByDefault(::testing::ReturnPointee(&m_currentTimeMs));
+        }
+
+        void TearDown() override
+        {
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+        }
+
+        void AdvanceTime(AZ::TimeMs deltaMs)
+        {
+            m_currentTimeMs = m_currentTimeMs + deltaMs;
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_timeSystem;
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1000 };
+    };
+
+    TEST_F(TimeoutQueueTests, ItemsExpireInOrder)
+    {
+        TimeoutQueue timeoutQueue;
+        timeoutQueue.RegisterItem(2, AZ::TimeMs{ 200 });
+        timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+        timeoutQueue.RegisterItem(3, AZ::TimeMs{ 70000 });
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 3u);
+
+        AZStd::vector<uint64_t> expired;
+        auto handler = [&expired](TimeoutQueue::TimeoutItem& item)
+        {
+            expired.push_back(item.m_userData);
+            return TimeoutResult::Delete;
+        };
+
+        // Items are only due once the current time has passed their timeout time
+        AdvanceTime(AZ::TimeMs{ 100 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_TRUE(expired.empty());
+
+        AdvanceTime(AZ::TimeMs{ 101 });
+        timeoutQueue.UpdateTimeouts(handler);
+        ASSERT_EQ(expired.size(), 2u);
+        EXPECT_EQ(expired[0], 1u);
+        EXPECT_EQ(expired[1], 2u);
+
+        // Crosses multiple wheel levels
+        AdvanceTime(AZ::TimeMs{ 70000 });
+        timeoutQueue.UpdateTimeouts(handler);
+        ASSERT_EQ(expired.size(), 3u);
+        EXPECT_EQ(expired[2], 3u);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 0u);
+    }
+
+    TEST_F(TimeoutQueueTests, RemovedItemsDoNotExpire)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId timeoutId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        timeoutQueue.RemoveItem(timeoutId);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(timeoutId), nullptr);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 0u);
+
+        uint32_t expiredCount = 0;
+        AdvanceTime(AZ::TimeMs{ 100 });
+        timeoutQueue.UpdateTimeouts([&expiredCount](TimeoutQueue::TimeoutItem&) { ++expiredCount; return TimeoutResult::Delete; });
+        EXPECT_EQ(expiredCount, 0u);
+    }
+
+    TEST_F(TimeoutQueueTests, StaleIdIsNotRetrieved)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId firstId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        timeoutQueue.RemoveItem(firstId);
+
+        // The freed slot is reused, but the previous id must not resolve to the new item
+        const TimeoutId secondId = timeoutQueue.RegisterItem(2, AZ::TimeMs{ 10 });
+        EXPECT_NE(firstId, secondId);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(firstId), nullptr);
+        ASSERT_NE(timeoutQueue.RetrieveItem(secondId), nullptr);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(secondId)->m_userData, 2u);
+    }
+
+    TEST_F(TimeoutQueueTests, RefreshedItemsAreRescheduled)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId timeoutId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+
+        uint32_t expiredCount = 0;
+        auto handler = [&expiredCount](TimeoutQueue::TimeoutItem&)
+        {
+            ++expiredCount;
+            return TimeoutResult::Refresh;
+        };
+
+        // Refreshing through RetrieveItem defers the timeout without invoking the handler
+        AdvanceTime(AZ::TimeMs{ 50 });
+        timeoutQueue.RetrieveItem(timeoutId)->UpdateTimeoutTime(m_currentTimeMs);
+        AdvanceTime(AZ::TimeMs{ 60 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(expiredCount, 0u);
+
+        AdvanceTime(AZ::TimeMs{ 50 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(expiredCount, 1u);
+
+        // The handler requested a refresh, so the item remains registered
+        EXPECT_NE(timeoutQueue.RetrieveItem(timeoutId), nullptr);
+        AdvanceTime(AZ::TimeMs{ 101 });
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(expiredCount, 2u);
+    }
+
+    TEST_F(TimeoutQueueTests, MaxTimeoutsDefersRemainingItems)
+    {
+        TimeoutQueue timeoutQueue;
+        for (uint64_t i = 0; i < 10; ++i)
+        {
+            timeoutQueue.RegisterItem(i, AZ::TimeMs{ 10 });
+        }
+
+        uint32_t expiredCount = 0;
+        auto handler = [&expiredCount](TimeoutQueue::TimeoutItem&)
+        {
+            ++expiredCount;
+            return TimeoutResult::Delete;
+        };
+
+        AdvanceTime(AZ::TimeMs{ 20 });
+        timeoutQueue.UpdateTimeouts(handler, 4);
+        EXPECT_EQ(expiredCount, 4u);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 6u);
+
+        timeoutQueue.UpdateTimeouts(handler);
+        EXPECT_EQ(expiredCount, 10u);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 0u);
+    }
+
+    TEST_F(TimeoutQueueTests, HandlerCanRegisterItems)
+    {
+        TimeoutQueue timeoutQueue;
+        timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+
+        AZStd::vector<uint64_t> expired;
+        auto handler = [&expired, &timeoutQueue](TimeoutQueue::TimeoutItem& item)
+        {
+            expired.push_back(item.m_userData);
+            if (item.m_userData == 1)
+            {
+                timeoutQueue.RegisterItem(2, AZ::TimeMs{ 10 });
+            }
+            return TimeoutResult::Delete;
+        };
+
+        AdvanceTime(AZ::TimeMs{ 20 });
+        timeoutQueue.UpdateTimeouts(handler);
+        ASSERT_EQ(expired.size(), 1u);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 1u);
+
+        AdvanceTime(AZ::TimeMs{ 20 });
+        timeoutQueue.UpdateTimeouts(handler);
+        ASSERT_EQ(expired.size(), 2u);
+        EXPECT_EQ(expired[1], 2u);
+    }
+
+    TEST_F(TimeoutQueueTests, RegisterFailsWhenFull)
+    {
+        TimeoutQueue timeoutQueue(2);
+        const TimeoutId first = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+        const TimeoutId second = timeoutQueue.RegisterItem(2, AZ::TimeMs{ 100 });
+        EXPECT_NE(first, InvalidTimeoutId);
+        EXPECT_NE(second, InvalidTimeoutId);
+
+        // The queue is full, registration fails without touching the registered items
+        EXPECT_EQ(timeoutQueue.RegisterItem(3, AZ::TimeMs{ 100 }), InvalidTimeoutId);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 2u);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(InvalidTimeoutId), nullptr);
+        timeoutQueue.RemoveItem(InvalidTimeoutId);
+        EXPECT_EQ(timeoutQueue.GetItemCount(), 2u);
+
+        // Freed slots can be registered again
+        timeoutQueue.RemoveItem(first);
+        const TimeoutId third = timeoutQueue.RegisterItem(3, AZ::TimeMs{ 100 });
+        ASSERT_NE(third, InvalidTimeoutId);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(third)->m_userData, 3u);
+    }
 }
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AzNetworking::TcpTransportBenchmarks
+{
+    static constexpr uint16_t BenchmarkPort = 12346;
+    static constexpr uint64_t TransferSizeBytes = 1024ull * 1024ull * 1024ull; // 1 GB per iteration
+    static constexpr uint32_t PayloadSizeBytes = MaxPacketSize - 64; // Leave room for the encoded buffer size and packet header
+    static constexpr uint32_t PacketsPerTick = 32; // 512 KB per tick, half of the 1 MB send ringbuffer
+    static constexpr AZ::TimeMs ConnectTimeoutMs = AZ::TimeMs{ 5000 };
+
+    class ThroughputConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, [[maybe_unused]] const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            m_receivedBytes += serializer.GetSize();
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+
+        uint64_t m_receivedBytes = 0;
+    };
+
+    class TcpTransportBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpNetworking();
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpNetworking();
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            TearDownNetworking();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            TearDownNetworking();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void SetUpNetworking()
+        {
+            m_connected = false;
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_networkingSystemComponent = AZStd::make_unique<NetworkingSystemComponent>();
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            m_serverNetworkInterface = networking->CreateNetworkInterface(m_serverName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, m_serverListener);
+            m_clientNetworkInterface = networking->CreateNetworkInterface(m_clientName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, m_clientListener);
+            m_serverNetworkInterface->Listen(BenchmarkPort);
+            m_clientConnectionId = m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, BenchmarkPort));
+
+            // Wait for both ends of the connection to complete the handshake
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (AZ::GetElapsedTimeMs() - startTimeMs < ConnectTimeoutMs)
+            {
+                m_networkingSystemComponent->OnSystemTick();
+                IConnection* clientConnection = m_clientNetworkInterface->GetConnectionSet().GetConnection(m_clientConnectionId);
+                if ((clientConnection != nullptr) && (clientConnection->GetConnectionState() == ConnectionState::Connected)
+                 && (m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 1))
+                {
+                    m_connected = true;
+                    break;
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        void TearDownNetworking()
+        {
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            networking->DestroyNetworkInterface(m_clientName);
+            networking->DestroyNetworkInterface(m_serverName);
+            m_networkingSystemComponent.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        AZ::Name m_serverName = AZ::Name(AZStd::string_view("TcpBenchmarkServer"));
+        AZ::Name m_clientName = AZ::Name(AZStd::string_view("TcpBenchmarkClient"));
+        ThroughputConnectionListener m_serverListener;
+        ThroughputConnectionListener m_clientListener;
+        INetworkInterface* m_serverNetworkInterface = nullptr;
+        INetworkInterface* m_clientNetworkInterface = nullptr;
+        ConnectionId m_clientConnectionId = InvalidConnectionId;
+        bool m_connected = false;
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<NetworkingSystemComponent> m_networkingSystemComponent;
+    };
+
+    BENCHMARK_DEFINE_F(TcpTransportBenchmarkFixture, LoopbackThroughput)(::benchmark::State& state)
+    {
+        UdpPacketEncodingBuffer payload;
+        payload.Resize(PayloadSizeBytes);
+        memset(payload.GetBuffer(), 0xA5, PayloadSizeBytes);
+        const CorePackets::InitiateConnectionPacket packet(payload);
+
+        // Measuring a connection that never completed its handshake would only time the send ringbuffer filling up
+        IConnection* clientConnection = m_clientNetworkInterface->GetConnectionSet().GetConnection(m_clientConnectionId);
+        if (!m_connected || (clientConnection == nullptr))
+        {
+            state.SkipWithError("Failed to establish loopback connection within the connect timeout");
+            return;
+        }
+
+        uint64_t totalReceivedBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_serverListener.m_receivedBytes = 0;
+            uint64_t sentBytes = 0;
+
+            // Queue a batch of packets per tick, then tick both interfaces so the sender and receiver make progress
+            while (m_serverListener.m_receivedBytes < TransferSizeBytes)
+            {
+                for (uint32_t i = 0; (i < PacketsPerTick) && (sentBytes < TransferSizeBytes); ++i)
+                {
+                    if (!clientConnection->SendReliablePacket(packet))
+                    {
+                        break;
+                    }
+                    sentBytes += PayloadSizeBytes;
+                }
+                m_networkingSystemComponent->OnSystemTick();
+
+                if (clientConnection->GetConnectionState() != ConnectionState::Connected)
+                {
+                    state.SkipWithError("Loopback connection dropped during transfer");
+                    return;
+                }
+            }
+            totalReceivedBytes += m_serverListener.m_receivedBytes;
+        }
+
+        state.SetBytesProcessed(totalReceivedBytes);
+    }
+    BENCHMARK_REGISTER_F(TcpTransportBenchmarkFixture, LoopbackThroughput)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(3);
+}
+
+#endif
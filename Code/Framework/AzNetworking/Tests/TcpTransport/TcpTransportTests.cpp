@@ -7,6 +7,8 @@
  */
 
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/TcpTransport/TcpConnection.h>
+#include <AzNetworking/TcpTransport/TcpSocket.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -93,6 +95,94 @@ namespace UnitTest
         INetworkInterface* m_serverNetworkInterface;
     };
 
+    //! Records everything written to it instead of sending it, accepting at most m_maxBytesPerSend bytes per send call.
+    //! In record mode each segment is accepted whole or not at all, and a blocked segment must be retried first with the
+    //! same bytes and at least the same length, matching the retry requirements of SSL_write.
+    class PartialSendTcpSocket
+        : public TcpSocket
+    {
+    public:
+        struct Wire
+        {
+            AZStd::vector<uint8_t> m_bytes;
+            AZStd::vector<uint8_t> m_blockedRecord;
+            uint32_t m_maxBytesPerSend = AZStd::numeric_limits<uint32_t>::max();
+            bool m_recordMode = false;
+        };
+
+        PartialSendTcpSocket(SocketFd socketFd, Wire& wire)
+            : TcpSocket(socketFd)
+            , m_wire(wire)
+        {
+            ;
+        }
+
+        ~PartialSendTcpSocket() override
+        {
+            // The socket fd is only a placeholder to mark the socket open, don't let the base class close it
+            m_socketFd = InvalidSocketFd;
+        }
+
+        TcpSocket* CloneAndTakeOwnership() override
+        {
+            TcpSocket* result = new PartialSendTcpSocket(m_socketFd, m_wire);
+            m_socketFd = InvalidSocketFd;
+            return result;
+        }
+
+    protected:
+        int32_t SendInternal(const uint8_t* data, uint32_t size) const override
+        {
+            SendSegment segment{ data, size };
+            return SendGatherInternal(&segment, 1);
+        }
+
+        int32_t SendGatherInternal(const SendSegment* segments, uint32_t segmentCount) const override
+        {
+            uint32_t budget = m_wire.m_maxBytesPerSend;
+            int32_t totalSentBytes = 0;
+            for (uint32_t i = 0; i < segmentCount; ++i)
+            {
+                const SendSegment& segment = segments[i];
+                if (m_wire.m_recordMode && !m_wire.m_blockedRecord.empty())
+                {
+                    // A moved buffer is fine, but it must start with the blocked record
+                    const uint32_t blockedSize = static_cast<uint32_t>(m_wire.m_blockedRecord.size());
+                    EXPECT_GE(segment.m_size, blockedSize);
+                    EXPECT_EQ(memcmp(segment.m_data, m_wire.m_blockedRecord.data(), AZStd::min(segment.m_size, blockedSize)), 0);
+                }
+
+                uint32_t sentBytes = AZStd::min(segment.m_size, budget);
+                if (m_wire.m_recordMode && (sentBytes < segment.m_size))
+                {
+                    m_wire.m_blockedRecord.assign(segment.m_data, segment.m_data + segment.m_size);
+                    sentBytes = 0;
+                }
+                else if (m_wire.m_recordMode)
+                {
+                    m_wire.m_blockedRecord.clear();
+                }
+
+                m_wire.m_bytes.insert(m_wire.m_bytes.end(), segment.m_data, segment.m_data + sentBytes);
+                budget -= sentBytes;
+                totalSentBytes += static_cast<int32_t>(sentBytes);
+                if (sentBytes < segment.m_size)
+                {
+                    break;
+                }
+            }
+            return totalSentBytes;
+        }
+
+        int32_t ReceiveInternal([[maybe_unused]] uint8_t* outData, [[maybe_unused]] uint32_t size) const override
+        {
+            return SocketOpResultSuccess;
+        }
+
+    private:
+        Wire& m_wire;
+    };
+
     class TcpTransportTests
         : public LeakDetectionFixture
     {
@@ -190,4 +280,63 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(TcpTransportTests, PartialSends_RequeueUnsentBytesInStreamOrder)
+    {
+        const AZ::Name interfaceName = AZ::Name(AZStd::string_view("TcpPartialSend"));
+        TestTcpConnectionListener connectionListener;
+        INetworkInterface* networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+            interfaceName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, connectionListener);
+        TcpNetworkInterface& tcpNetworkInterface = static_cast<TcpNetworkInterface&>(*networkInterface);
+
+        UdpPacketEncodingBuffer payload;
+        payload.Resize(1000);
+        for (uint32_t i = 0; i < payload.GetSize(); ++i)
+        {
+            payload.GetBuffer()[i] = static_cast<uint8_t>(i);
+        }
+        const CorePackets::InitiateConnectionPacket packet(payload);
+        constexpr SocketFd PlaceholderSocketFd = SocketFd{ 1 };
+
+        // Reference stream, everything is accepted as soon as it is sent
+        PartialSendTcpSocket::Wire referenceWire;
+        {
+            PartialSendTcpSocket referenceSocket(PlaceholderSocketFd, referenceWire);
+            TcpConnection referenceConnection(ConnectionId{ 1 }, IpAddress(127, 0, 0, 1, 12345), tcpNetworkInterface, referenceSocket);
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                EXPECT_TRUE(referenceConnection.SendReliablePacket(packet));
+            }
+        }
+
+        for (const bool recordMode : { false, true })
+        {
+            PartialSendTcpSocket::Wire wire;
+            wire.m_recordMode = recordMode;
+            PartialSendTcpSocket socket(PlaceholderSocketFd, wire);
+            TcpConnection connection(ConnectionId{ 2 }, IpAddress(127, 0, 0, 1, 12345), tcpNetworkInterface, socket);
+
+            // The socket only takes part of the first packet, the rest must be queued
+            wire.m_maxBytesPerSend = 10;
+            EXPECT_TRUE(connection.SendReliablePacket(packet));
+            EXPECT_LT(wire.m_bytes.size(), referenceWire.m_bytes.size() / 3);
+
+            // The socket is blocked, the second packet is queued behind the first
+            wire.m_maxBytesPerSend = 0;
+            EXPECT_TRUE(connection.SendReliablePacket(packet));
+
+            // Only part of the queue drains, the third packet is queued behind what's left of it
+            wire.m_maxBytesPerSend = 600;
+            EXPECT_TRUE(connection.SendReliablePacket(packet));
+            EXPECT_LT(wire.m_bytes.size(), referenceWire.m_bytes.size());
+
+            // Flushing the queue produces exactly the stream that was sent without back pressure
+            wire.m_maxBytesPerSend = AZStd::numeric_limits<uint32_t>::max();
+            connection.UpdateSend();
+            EXPECT_EQ(wire.m_bytes, referenceWire.m_bytes);
+            EXPECT_TRUE(wire.m_blockedRecord.empty());
+        }
+
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(interfaceName);
+    }
 }
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    //! Simulates a bottleneck link in the style of netem, a fixed rate drop-tail queue followed by a fixed propagation delay.
+    //! Packets may additionally be dropped at random, and acks travel back over an uncongested path.
+    class LinkSimulator
+    {
+    public:
+
+        LinkSimulator(uint32_t bandwidthBytesPerSecond, AZ::TimeMs oneWayDelayMs, uint32_t queueLimitBytes, uint32_t lossPercent)
+            : m_bandwidthBytesPerSecond(bandwidthBytesPerSecond)
+            , m_oneWayDelayMs(oneWayDelayMs)
+            , m_queueLimitBytes(queueLimitBytes)
+            , m_lossPercent(lossPercent)
+        {
+            ;
+        }
+
+        void Send(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs)
+        {
+            ++m_packetsSent;
+
+            // Loss is only detected once the sender's timeout fires, which the transport sets to twice the round trip time
+            const AZ::TimeMs lossDetectedMs = currentTimeMs + AZ::TimeMs{ 4 } * m_oneWayDelayMs;
+            if (NextRandom() % 100 < m_lossPercent)
+            {
+                m_events.push_back({ packetId, lossDetectedMs, false });
+                ++m_packetsLost;
+                return;
+            }
+
+            if (m_queuedBytes + packetSize > m_queueLimitBytes)
+            {
+                m_events.push_back({ packetId, lossDetectedMs, false });
+                ++m_packetsLost;
+                return;
+            }
+
+            m_queue.push_back({ packetId, packetSize });
+            m_queuedBytes += packetSize;
+            m_maxQueuedBytes = AZStd::max(m_maxQueuedBytes, m_queuedBytes);
+        }
+
+        void Update(AZ::TimeMs currentTimeMs, IUdpCongestionController& controller)
+        {
+            // Drain the bottleneck queue at the link rate
+            m_serviceCredit += static_cast<float>(m_bandwidthBytesPerSecond) * static_cast<float>(currentTimeMs - m_lastUpdateTimeMs) / 1000.0f;
+            m_lastUpdateTimeMs = currentTimeMs;
+            while (!m_queue.empty() && m_serviceCredit >= static_cast<float>(m_queue.front().m_packetSize))
+            {
+                m_serviceCredit -= static_cast<float>(m_queue.front().m_packetSize);
+                m_queuedBytes -= m_queue.front().m_packetSize;
+                m_bytesDelivered += m_queue.front().m_packetSize;
+                m_events.push_back({ m_queue.front().m_packetId, currentTimeMs + AZ::TimeMs{ 2 } * m_oneWayDelayMs, true });
+                m_queue.pop_front();
+            }
+            if (m_queue.empty())
+            {
+                // An idle link can't bank capacity for later
+                m_serviceCredit = 0.0f;
+            }
+
+            for (auto iter = m_events.begin(); iter != m_events.end();)
+            {
+                if (iter->m_timeMs > currentTimeMs)
+                {
+                    ++iter;
+                    continue;
+                }
+
+                if (iter->m_acked)
+                {
+                    controller.OnPacketAcked(iter->m_packetId, currentTimeMs);
+                }
+                else
+                {
+                    controller.OnPacketLost(iter->m_packetId, currentTimeMs);
+                }
+                iter = m_events.erase(iter);
+            }
+        }
+
+        void ResetCounters()
+        {
+            m_packetsSent = 0;
+            m_packetsLost = 0;
+            m_bytesDelivered = 0;
+            m_maxQueuedBytes = 0;
+        }
+
+        float GetLossRate() const
+        {
+            return (m_packetsSent > 0) ? static_cast<float>(m_packetsLost) / static_cast<float>(m_packetsSent) : 0.0f;
+        }
+
+        uint64_t GetBytesDelivered() const
+        {
+            return m_bytesDelivered;
+        }
+
+        uint32_t GetMaxQueuedBytes() const
+        {
+            return m_maxQueuedBytes;
+        }
+
+    private:
+
+        uint32_t NextRandom()
+        {
+            m_randomState = m_randomState * 1664525u + 1013904223u;
+            return m_randomState >> 8;
+        }
+
+        struct QueuedPacket
+        {
+            PacketId m_packetId;
+            uint32_t m_packetSize;
+        };
+
+        struct PacketEvent
+        {
+            PacketId m_packetId;
+            AZ::TimeMs m_timeMs;
+            bool m_acked;
+        };
+
+        uint32_t m_bandwidthBytesPerSecond;
+        AZ::TimeMs m_oneWayDelayMs;
+        uint32_t m_queueLimitBytes;
+        uint32_t m_lossPercent;
+
+        AZStd::deque<QueuedPacket> m_queue;
+        AZStd::vector<PacketEvent> m_events;
+        uint32_t m_queuedBytes = 0;
+        float m_serviceCredit = 0.0f;
+        AZ::TimeMs m_lastUpdateTimeMs = AZ::Time::ZeroTimeMs;
+        uint32_t m_randomState = 12345;
+
+        uint32_t m_packetsSent = 0;
+        uint32_t m_packetsLost = 0;
+        uint64_t m_bytesDelivered = 0;
+        uint32_t m_maxQueuedBytes = 0;
+    };
+
+    class UdpCongestionControllerTests
+        : public LeakDetectionFixture
+    {
+    public:
+
+        static constexpr uint32_t PacketSize = MaxUdpTransmissionUnit;
+        static constexpr AZ::TimeMs FrameTimeMs = AZ::TimeMs{ 16 };
+
+        //! Runs a sender with unlimited data that is serviced once per frame, as the replication layer is.
+        //! If paced, the sender sends whatever the pacer allows, otherwise it sends a fixed number of packets every frame.
+        void Simulate(LinkSimulator& link, IUdpCongestionController& controller, UdpSendPacer* pacer, uint32_t unpacedPacketsPerFrame, AZ::TimeMs durationMs)
+        {
+            const AZ::TimeMs endTimeMs = m_currentTimeMs + durationMs;
+            for (; m_currentTimeMs < endTimeMs; m_currentTimeMs = m_currentTimeMs + AZ::TimeMs{ 1 })
+            {
+                link.Update(m_currentTimeMs, controller);
+
+                if (static_cast<int64_t>(m_currentTimeMs) % static_cast<int64_t>(FrameTimeMs) != 0)
+                {
+                    continue;
+                }
+
+                uint32_t packetsToSend = unpacedPacketsPerFrame;
+                if (pacer != nullptr)
+                {
+                    packetsToSend = pacer->GetAvailableBytes(controller, m_currentTimeMs) / PacketSize;
+                }
+
+                for (uint32_t i = 0; i < packetsToSend; ++i)
+                {
+                    const PacketId packetId = m_nextPacketId;
+                    m_nextPacketId = PacketId{ static_cast<uint32_t>(m_nextPacketId) + 1 };
+                    controller.OnPacketSent(packetId, PacketSize, m_currentTimeMs);
+                    if (pacer != nullptr)
+                    {
+                        pacer->OnPacketSent(PacketSize);
+                    }
+                    link.Send(packetId, PacketSize, m_currentTimeMs);
+                }
+            }
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1 };
+        PacketId m_nextPacketId = PacketId{ 0 };
+    };
+
+    TEST_F(UdpCongestionControllerTests, NullControllerIsUnlimited)
+    {
+        UdpNullCongestionController controller;
+        UdpSendPacer pacer;
+        EXPECT_EQ(pacer.GetAvailableBytes(controller, AZ::TimeMs{ 0 }), UnlimitedCongestionWindow);
+        controller.OnPacketSent(PacketId{ 0 }, PacketSize, AZ::TimeMs{ 0 });
+        pacer.OnPacketSent(PacketSize);
+        EXPECT_EQ(pacer.GetAvailableBytes(controller, AZ::TimeMs{ 0 }), UnlimitedCongestionWindow);
+    }
+
+    TEST_F(UdpCongestionControllerTests, TrackingRingGrowsWithOutstandingPackets)
+    {
+        UdpBbrCongestionController controller;
+        const uint32_t initialCapacity = controller.GetTrackedPacketCapacity();
+
+        // More packets outstanding than the initial ring holds, as on a path with a high bandwidth delay product
+        const uint32_t outstandingPackets = initialCapacity * 3;
+        for (uint32_t i = 0; i < outstandingPackets; ++i)
+        {
+            controller.OnPacketSent(PacketId{ i }, PacketSize, AZ::TimeMs{ 1 });
+        }
+        EXPECT_GE(controller.GetTrackedPacketCapacity(), outstandingPackets);
+        EXPECT_EQ(controller.GetBytesInFlight(), outstandingPackets * PacketSize);
+
+        // Every packet is still tracked, so acking them all empties the pipe and none were treated as lost
+        for (uint32_t i = 0; i < outstandingPackets; ++i)
+        {
+            controller.OnPacketAcked(PacketId{ i }, AZ::TimeMs{ 50 });
+        }
+        EXPECT_EQ(controller.GetBytesInFlight(), 0u);
+        EXPECT_GT(controller.GetEstimatedBandwidthBytesPerSecond(), 0.0f);
+    }
+
+    TEST_F(UdpCongestionControllerTests, TrackingRingOverflowDropsOldestSample)
+    {
+        UdpBbrCongestionController controller;
+
+        // Beyond the maximum ring size the oldest records are dropped rather than reported as lost
+        const uint32_t outstandingPackets = UdpBbrCongestionController::MaxTrackedPackets + 16;
+        for (uint32_t i = 0; i < outstandingPackets; ++i)
+        {
+            controller.OnPacketSent(PacketId{ i }, PacketSize, AZ::TimeMs{ 1 });
+        }
+        EXPECT_EQ(controller.GetTrackedPacketCapacity(), UdpBbrCongestionController::MaxTrackedPackets);
+        EXPECT_EQ(controller.GetBytesInFlight(), UdpBbrCongestionController::MaxTrackedPackets * PacketSize);
+
+        // Acks of dropped packets are ignored
+        controller.OnPacketAcked(PacketId{ 0 }, AZ::TimeMs{ 50 });
+        EXPECT_EQ(controller.GetBytesInFlight(), UdpBbrCongestionController::MaxTrackedPackets * PacketSize);
+    }
+
+    TEST_F(UdpCongestionControllerTests, CreateCongestionControllerByName)
+    {
+        EXPECT_NE(CreateCongestionController("Bbr")->GetCongestionWindowBytes(), UnlimitedCongestionWindow);
+        EXPECT_EQ(CreateCongestionController("None")->GetCongestionWindowBytes(), UnlimitedCongestionWindow);
+    }
+
+    TEST_F(UdpCongestionControllerTests, ConvergesToBottleneckBandwidth)
+    {
+        constexpr uint32_t BandwidthBytesPerSecond = 256 * 1024;
+        LinkSimulator link(BandwidthBytesPerSecond, AZ::TimeMs{ 30 }, 64 * 1024, 0);
+        UdpBbrCongestionController controller;
+        UdpSendPacer pacer;
+
+        Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+        EXPECT_EQ(controller.GetMode(), UdpBbrCongestionController::Mode::ProbeBandwidth);
+        EXPECT_NEAR(static_cast<float>(controller.GetMinRttMs()), 60.0f, 5.0f);
+
+        link.ResetCounters();
+        Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+
+        const float estimate = controller.GetEstimatedBandwidthBytesPerSecond();
+        EXPECT_GT(estimate, BandwidthBytesPerSecond * 0.8f);
+        EXPECT_LT(estimate, BandwidthBytesPerSecond * 1.2f);
+
+        // The link stays busy without building a standing queue
+        const float throughput = static_cast<float>(link.GetBytesDelivered()) / 5.0f;
+        EXPECT_GT(throughput, BandwidthBytesPerSecond * 0.8f);
+        EXPECT_EQ(link.GetLossRate(), 0.0f);
+        EXPECT_LT(link.GetMaxQueuedBytes(), 32u * 1024u);
+    }
+
+    TEST_F(UdpCongestionControllerTests, PacingAvoidsShallowQueueOverflow)
+    {
+        constexpr uint32_t BandwidthBytesPerSecond = 256 * 1024;
+        constexpr uint32_t QueueLimitBytes = 16 * 1024;
+
+        // An uncontrolled sender producing more than the link can carry overflows the queue continuously
+        {
+            LinkSimulator link(BandwidthBytesPerSecond, AZ::TimeMs{ 30 }, QueueLimitBytes, 0);
+            UdpNullCongestionController controller;
+            const uint32_t packetsPerFrame = (BandwidthBytesPerSecond * 3 / 2) / PacketSize * static_cast<uint32_t>(FrameTimeMs) / 1000 + 1;
+            Simulate(link, controller, nullptr, packetsPerFrame, AZ::TimeMs{ 5000 });
+            link.ResetCounters();
+            Simulate(link, controller, nullptr, packetsPerFrame, AZ::TimeMs{ 5000 });
+            EXPECT_GT(link.GetLossRate(), 0.2f);
+        }
+
+        // The paced sender may overflow the queue while searching for the bottleneck, but not once it has converged
+        {
+            LinkSimulator link(BandwidthBytesPerSecond, AZ::TimeMs{ 30 }, QueueLimitBytes, 0);
+            UdpBbrCongestionController controller;
+            UdpSendPacer pacer;
+            Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+            link.ResetCounters();
+            Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+            EXPECT_LT(link.GetLossRate(), 0.02f);
+            EXPECT_GT(static_cast<float>(link.GetBytesDelivered()) / 5.0f, BandwidthBytesPerSecond * 0.7f);
+        }
+    }
+
+    TEST_F(UdpCongestionControllerTests, RandomLossDoesNotCollapseSendRate)
+    {
+        constexpr uint32_t BandwidthBytesPerSecond = 256 * 1024;
+        LinkSimulator link(BandwidthBytesPerSecond, AZ::TimeMs{ 40 }, 64 * 1024, 1);
+        UdpBbrCongestionController controller;
+        UdpSendPacer pacer;
+
+        Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+        link.ResetCounters();
+        Simulate(link, controller, &pacer, 0, AZ::TimeMs{ 5000 });
+
+        EXPECT_GT(controller.GetEstimatedBandwidthBytesPerSecond(), BandwidthBytesPerSecond * 0.7f);
+        EXPECT_GT(static_cast<float>(link.GetBytesDelivered()) / 5.0f, BandwidthBytesPerSecond * 0.7f);
+    }
+
+    TEST_F(UdpCongestionControllerTests, PacerLimitsBurstToPacingRate)
+    {
+        UdpBbrCongestionController controller;
+        UdpSendPacer pacer;
+
+        // The initial burst is bounded by the congestion window, then data is released at the pacing rate
+        uint32_t availableBytes = pacer.GetAvailableBytes(controller, AZ::TimeMs{ 0 });
+        EXPECT_GT(availableBytes, 0u);
+        EXPECT_LE(availableBytes, controller.GetCongestionWindowBytes());
+        while (availableBytes > 0)
+        {
+            pacer.OnPacketSent(availableBytes);
+            availableBytes = pacer.GetAvailableBytes(controller, AZ::TimeMs{ 0 });
+        }
+
+        const uint32_t pacedBytes = pacer.GetAvailableBytes(controller, AZ::TimeMs{ 10 });
+        EXPECT_NEAR(static_cast<float>(pacedBytes), controller.GetPacingRateBytesPerSecond() * 0.01f, 2.0f);
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/PackedQuantizers.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    TEST(PackedQuantizers, RequiredQuantizationBits)
+    {
+        EXPECT_EQ(AzNetworking::RequiredQuantizationBits(1.0, 1.0), 1);
+        EXPECT_EQ(AzNetworking::RequiredQuantizationBits(255.0, 1.0), 8);
+        EXPECT_EQ(AzNetworking::RequiredQuantizationBits(256.0, 1.0), 9);
+        EXPECT_EQ(AzNetworking::RequiredQuantizationBits(64.0, 0.01), 13);
+        EXPECT_EQ(AzNetworking::RequiredQuantizationBits(1.0e12, 1.0), 32);
+    }
+
+    TEST(PackedQuantizers, RangeQuantizerFloat)
+    {
+        using Quantizer = AzNetworking::RangeQuantizer<float, 0, 64, 12>;
+        static_assert(sizeof(Quantizer::PackedType) == 2, "12 bits should pack into a uint16_t");
+
+        EXPECT_NEAR(Quantizer::Unpack(Quantizer::Pack(0.0f)), 0.0f, 0.001f);
+        EXPECT_NEAR(Quantizer::Unpack(Quantizer::Pack(64.0f)), 64.0f, 0.001f);
+        EXPECT_NEAR(Quantizer::Unpack(Quantizer::Pack(17.3f)), 17.3f, 64.0f / 4095.0f);
+
+        // Out of range values are clamped
+        EXPECT_NEAR(Quantizer::Unpack(Quantizer::Pack(-10.0f)), 0.0f, 0.001f);
+        EXPECT_NEAR(Quantizer::Unpack(Quantizer::Pack(100.0f)), 64.0f, 0.001f);
+    }
+
+    TEST(PackedQuantizers, QuantizedElement32BitsDoesNotWrap)
+    {
+        using Element = AzNetworking::QuantizedElement<32>;
+
+        // 2^32 - 1 is not representable as a float, the maximum must not round up to 2^32 and wrap to zero
+        EXPECT_EQ(Element::Encode(1.0f, 0.0f, 1.0f), Element::MaxIntegralValue);
+        EXPECT_EQ(Element::Encode(2.0f, 0.0f, 1.0f), Element::MaxIntegralValue);
+        EXPECT_EQ(static_cast<uint32_t>(Element::Encode(1.0f, 0.0f, 1.0f)), 0xFFFFFFFFu);
+        EXPECT_NEAR(Element::Decode(Element::Encode(1.0f, 0.0f, 1.0f), 0.0f, 1.0f), 1.0f, 0.0001f);
+    }
+
+    TEST(PackedQuantizers, RangeQuantizerVector3)
+    {
+        using Quantizer = AzNetworking::RangeQuantizer<AZ::Vector3, -1024, 1024, 20>;
+        static_assert(sizeof(Quantizer::PackedType) == 8, "60 bits should pack into a uint64_t");
+
+        const AZ::Vector3 value(-1000.5f, 0.25f, 777.7f);
+        EXPECT_TRUE(Quantizer::Unpack(Quantizer::Pack(value)).IsClose(value, 0.002f));
+    }
+
+    TEST(PackedQuantizers, SmallestThreeQuantizer)
+    {
+        using Quantizer = AzNetworking::SmallestThreeQuantizer<10>;
+        static_assert(sizeof(Quantizer::PackedType) == 4, "Smallest three with 10 bits per component should pack into a uint32_t");
+
+        for (float angle = -6.0f; angle < 6.0f; angle += 0.25f)
+        {
+            const AZ::Quaternion value = (AZ::Quaternion::CreateRotationZ(angle)
+                * AZ::Quaternion::CreateRotationX(angle * 0.7f)
+                * AZ::Quaternion::CreateRotationY(angle * -1.3f)).GetNormalized();
+            const AZ::Quaternion result = Quantizer::Unpack(Quantizer::Pack(value));
+
+            // q and -q describe the same rotation
+            EXPECT_TRUE(result.IsClose(value, 0.003f) || result.IsClose(-value, 0.003f));
+            EXPECT_NEAR(result.GetLength(), 1.0f, 0.003f);
+        }
+    }
+
+    TEST(PackedQuantizers, CellRelativeQuantizer)
+    {
+        using Quantizer = AzNetworking::CellRelativeQuantizer<-8192, 8192, 64, AzNetworking::RequiredQuantizationBits(64.0, 0.01)>;
+        static_assert(Quantizer::CellBits == 8, "16384 units of 64 unit cells require 8 bits per axis");
+
+        const AZ::Vector3 values[] = { AZ::Vector3(-8192.0f), AZ::Vector3(0.0f), AZ::Vector3(1234.56f, -7000.01f, 63.99f), AZ::Vector3(8191.0f) };
+        for (const AZ::Vector3& value : values)
+        {
+            Quantizer::CellType cell = 0;
+            Quantizer::OffsetType offset = 0;
+            Quantizer::Pack(value, cell, offset);
+            EXPECT_TRUE(Quantizer::Unpack(cell, offset).IsClose(value, 0.01f));
+        }
+    }
+
+    TEST(PackedQuantizers, SerializeRoundTrip)
+    {
+        using PositionQuantizer = AzNetworking::CellRelativeQuantizer<-8192, 8192, 64, 13>;
+        using RotationQuantizer = AzNetworking::SmallestThreeQuantizer<10>;
+        using ScaleQuantizer = AzNetworking::RangeQuantizer<float, 0, 16, 8>;
+
+        AZ::Vector3 positionIn(100.1f, -200.2f, 300.3f);
+        AZ::Quaternion rotationIn = AZ::Quaternion::CreateRotationY(1.1f);
+        float scaleIn = 2.0f;
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(PositionQuantizer::Serialize(inputSerializer, positionIn, "Position"));
+        EXPECT_TRUE(RotationQuantizer::Serialize(inputSerializer, rotationIn, "Rotation"));
+        EXPECT_TRUE(ScaleQuantizer::Serialize(inputSerializer, scaleIn, "Scale"));
+        EXPECT_EQ(inputSerializer.GetSize(), sizeof(PositionQuantizer::CellType) + sizeof(PositionQuantizer::OffsetType)
+            + sizeof(RotationQuantizer::PackedType) + sizeof(ScaleQuantizer::PackedType));
+
+        AZ::Vector3 positionOut = AZ::Vector3::CreateZero();
+        AZ::Quaternion rotationOut = AZ::Quaternion::CreateIdentity();
+        float scaleOut = 0.0f;
+
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(PositionQuantizer::Serialize(outputSerializer, positionOut, "Position"));
+        EXPECT_TRUE(RotationQuantizer::Serialize(outputSerializer, rotationOut, "Rotation"));
+        EXPECT_TRUE(ScaleQuantizer::Serialize(outputSerializer, scaleOut, "Scale"));
+
+        EXPECT_TRUE(positionOut.IsClose(positionIn, 0.01f));
+        EXPECT_TRUE(rotationOut.IsClose(rotationIn, 0.003f) || rotationOut.IsClose(-rotationIn, 0.003f));
+        EXPECT_NEAR(scaleOut, scaleIn, 16.0f / 255.0f);
+    }
+}
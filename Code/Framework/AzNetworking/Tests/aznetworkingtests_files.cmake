@@ -14,6 +14,7 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/TimeoutQueueBenchmarks.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
@@ -21,10 +22,13 @@ set(FILES
     Serialization/StringifySerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
+    TcpTransport/TcpTransportBenchmarks.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpCongestionControllerTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/PackedQuantizersTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
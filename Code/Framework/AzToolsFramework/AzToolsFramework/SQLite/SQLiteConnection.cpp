@@ -111,6 +111,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -221,7 +222,16 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%i;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -231,7 +241,22 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 0)
+            {
+                return;
+            }
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("RELEASE SAVEPOINT nested_%i;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -241,7 +266,28 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 0)
+            {
+                return;
+            }
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // rolling back to a savepoint leaves it open, so it has to be released as well.
+                AZStd::string savepoint = AZStd::string::format("ROLLBACK TO SAVEPOINT nested_%i; RELEASE SAVEPOINT nested_%i;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+        }
+
+        int Connection::GetTransactionDepth() const
+        {
+            return m_transactionDepth;
         }
 
         void Connection::Vacuum()
@@ -54,9 +54,14 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested, nested transactions are savepoints inside of the outermost transaction.
+            //! Committing a nested transaction only makes its changes part of the outer transaction, and rolling it back
+            //! only reverts the changes made since it began.  Other connections see the changes once the outermost transaction commits.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
+            //! Returns the number of transactions currently open on this connection, 0 if none.
+            int GetTransactionDepth() const;
             // -------------------------------
 
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
@@ -95,6 +100,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
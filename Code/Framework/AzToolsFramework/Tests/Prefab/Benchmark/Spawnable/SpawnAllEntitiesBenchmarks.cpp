@@ -13,7 +13,43 @@
 
 namespace Benchmark
 {
-    using BM_SpawnAllEntities = BM_Spawnable;
+    class BM_SpawnAllEntities
+        : public BM_Spawnable
+    {
+    protected:
+        void SpawnAllEntitiesOnce(::benchmark::State& state, bool useClonePlan)
+        {
+            const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range());
+
+            SetUpSpawnableAsset(entityCountInSpawnable);
+            if (useClonePlan)
+            {
+                AZ::SerializeContext* serializeContext = m_app->GetSerializeContext();
+                m_spawnableAsset->BuildClonePlan(*serializeContext);
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                m_spawnTicket = aznew AzFramework::EntitySpawnTicket(m_spawnableAsset);
+                state.ResumeTiming();
+
+                AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*m_spawnTicket);
+                m_rootSpawnableInterface->ProcessSpawnableQueue();
+
+                // Destroy the ticket so that this queues a request to delete all the entities spawned with this ticket.
+                state.PauseTiming();
+                delete m_spawnTicket;
+                m_spawnTicket = nullptr;
+
+                // This will process the request to delete all entities spawned with the ticket
+                m_rootSpawnableInterface->ProcessSpawnableQueue();
+                state.ResumeTiming();
+            }
+
+            state.SetComplexityN(entityCountInSpawnable);
+        }
+    };
 
     BENCHMARK_DEFINE_F(BM_SpawnAllEntities, SingleEntitySpawnable_SpawnCallVariable)(::benchmark::State& state)
     {
@@ -55,30 +91,7 @@ namespace Benchmark
 
     BENCHMARK_DEFINE_F(BM_SpawnAllEntities, SingleSpawnCall_EntityCountVariable)(::benchmark::State& state)
     {
-        const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range());
-
-        SetUpSpawnableAsset(entityCountInSpawnable);
-
-        for ([[maybe_unused]] auto _ : state)
-        {
-            state.PauseTiming();
-            m_spawnTicket = aznew AzFramework::EntitySpawnTicket(m_spawnableAsset);
-            state.ResumeTiming();
-
-            AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*m_spawnTicket);
-            m_rootSpawnableInterface->ProcessSpawnableQueue();
-
-            // Destroy the ticket so that this queues a request to delete all the entities spawned with this ticket.
-            state.PauseTiming();
-            delete m_spawnTicket;
-            m_spawnTicket = nullptr;
-
-            // This will process the request to delete all entities spawned with the ticket
-            m_rootSpawnableInterface->ProcessSpawnableQueue();
-            state.ResumeTiming();
-        }
-
-        state.SetComplexityN(entityCountInSpawnable);
+        SpawnAllEntitiesOnce(state, false);
     }
     BENCHMARK_REGISTER_F(BM_SpawnAllEntities, SingleSpawnCall_EntityCountVariable)
         ->RangeMultiplier(10)
@@ -86,6 +99,18 @@ namespace Benchmark
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
 
+    // Same as SingleSpawnCall_EntityCountVariable, but entity ids are remapped through the spawnable's precompiled clone plan
+    // instead of walking the reflection data of every clone.
+    BENCHMARK_DEFINE_F(BM_SpawnAllEntities, SingleSpawnCall_EntityCountVariable_ClonePlan)(::benchmark::State& state)
+    {
+        SpawnAllEntitiesOnce(state, true);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnAllEntities, SingleSpawnCall_EntityCountVariable_ClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
     BENCHMARK_DEFINE_F(BM_SpawnAllEntities, EntityCountVariable_SpawnCallCountVariable)(::benchmark::State& state)
     {
         const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range(0));
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/IO/SystemFile.h>
@@ -126,4 +127,43 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SQLiteTest, NestedTransaction_RollbackOnlyRevertsNestedChanges)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+
+        m_database->AddStatement("CreateTable", "CREATE TABLE IF NOT EXISTS testtable(rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);");
+        m_database->AddStatement("InsertOuter", "INSERT INTO testtable (value) VALUES (1);");
+        m_database->AddStatement("InsertNested", "INSERT INTO testtable (value) VALUES (2);");
+        m_database->AddStatement("InsertCommittedNested", "INSERT INTO testtable (value) VALUES (3);");
+        ASSERT_TRUE(m_database->ExecuteOneOffStatement("CreateTable"));
+
+        {
+            SQLite::ScopedTransaction outerTransaction(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertOuter"));
+            {
+                // not committed, so this one is rolled back when it goes out of scope
+                SQLite::ScopedTransaction nestedTransaction(m_database.get());
+                EXPECT_EQ(m_database->GetTransactionDepth(), 2);
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertNested"));
+            }
+            {
+                SQLite::ScopedTransaction nestedTransaction(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertCommittedNested"));
+                nestedTransaction.Commit();
+            }
+            EXPECT_EQ(m_database->GetTransactionDepth(), 1);
+            outerTransaction.Commit();
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+
+        AZStd::vector<int> values;
+        m_database->ExecuteRawSqlQuery("SELECT value FROM testtable ORDER BY value;",
+            [&values](sqlite3_stmt* statement)
+            {
+                values.push_back(SQLite::GetColumnInt(statement, 0));
+                return true;
+            }, nullptr);
+
+        EXPECT_THAT(values, ::testing::ElementsAre(1, 3));
+    }
 }
@@ -54,6 +54,7 @@ static const char* const s_paramDebugProcess = "debug_process"; // Debug mode fo
 static const char* const s_paramPlatformTags = "tags"; // Additional list of tags to add platform tag list.
 static const char* const s_paramPlatform = "platform"; // Platform to use
 static const char* const s_paramRegisterBuilders = "register"; // Indicates the AP is starting up and requesting a list of registered builders
+static const char* const s_paramJobChannel = "jobchannel"; // Optional, name of the shared memory job channel created by the AP.  Only used for resident mode.
 
 // Task modes:
 static const char* const s_taskResident = "resident"; // stays up and running indefinitely, accepting jobs via network connection
@@ -148,6 +149,7 @@ void AssetBuilderComponent::PrintHelp()
     AZ_TracePrintf("Help", "%s - For resident mode, the path to the builder dll folder, otherwise the full path to a single builder dll to use.\n", s_paramModule);
     AZ_TracePrintf("Help", "%s - Optional, port number to use to connect to the AP.\n", s_paramPort);
     AZ_TracePrintf("Help", "%s - UUID string that identifies the builder.  Only used for resident mode when the AP directly starts up the AssetBuilder.\n", s_paramId);
+    AZ_TracePrintf("Help", "%s - Optional, name of the shared memory job channel created by the AP.  Only used for resident mode.\n", s_paramJobChannel);
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file containing the serialized job request.\n", s_paramInput);
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file to write the job response to.\n", s_paramOutput);
     AZ_TracePrintf("Help", "%s - Debug mode for the create and process job of the specified file.\n", s_paramDebug);
@@ -445,6 +447,19 @@ bool AssetBuilderComponent::RunInResidentMode(bool sendRegistration)
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(CreateJobsNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::CreateJobsResidentHandler, this, _1, _2, _3, _4));
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(ProcessJobNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::ProcessJobResidentHandler, this, _1, _2, _3, _4));
 
+    AZStd::string jobChannelName;
+    if (GetParameter(s_paramJobChannel, jobChannelName, false))
+    {
+        m_jobChannel = AZStd::make_unique<JobChannel>();
+        if (!m_jobChannel->Open(jobChannelName.c_str()))
+        {
+            // the handler is still registered so jobs sent through the channel fail instead of waiting for a response that never comes
+            AZ_Error("AssetBuilder", false, "Failed to open job channel %s", jobChannelName.c_str());
+            m_jobChannel.reset();
+        }
+        AzFramework::SocketConnection::GetInstance()->AddMessageHandler(SharedMemoryJobNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::SharedMemoryJobResidentHandler, this, _1, _2, _3, _4));
+    }
+
     bool result = DoHelloPing() && ((sendRegistration && SendRegisteredBuildersToAp()) || !sendRegistration);
 
     if (result)
@@ -848,19 +863,20 @@ bool AssetBuilderComponent::GetAssetDatabaseLocation(AZStd::string& location)
 }
 
 template<typename TNetRequest, typename TNetResponse>
-void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType)
+void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType, bool respondThroughJobChannel)
 {
     auto job = AZStd::make_unique<Job>();
     job->m_netResponse = AZStd::make_unique<TNetResponse>();
     job->m_requestSerial = serial;
     job->m_jobType = jobType;
+    job->m_respondThroughJobChannel = respondThroughJobChannel;
 
     auto* request = AZ::Utils::LoadObjectFromBuffer<TNetRequest>(data, dataLength);
 
     if (!request)
     {
         AZ_Error("AssetBuilder", false, "Problem deserializing net request");
-        AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), serial);
+        SendJobResponse(*job);
 
         return;
     }
@@ -878,7 +894,7 @@ void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data,
         else
         {
             AZ_Error("AssetBuilder", false, "Builder already has a job queued");
-            AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), serial);
+            SendJobResponse(*job);
 
             return;
         }
@@ -1026,7 +1042,7 @@ void AssetBuilderComponent::JobThread()
         AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.00f, AZ::ScriptTimePoint(AZStd::chrono::steady_clock::now()));
         AZ::AllocatorManager::Instance().GarbageCollect();
 
-        AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), job->m_requestSerial);
+        SendJobResponse(*job);
     }
 }
 
@@ -1044,6 +1060,59 @@ void AssetBuilderComponent::ProcessJobResidentHandler(AZ::u32 /*typeId*/, AZ::u3
     ResidentJobHandler<ProcessJobNetRequest, ProcessJobNetResponse>(serial, data, dataLength, JobType::Process);
 }
 
+void AssetBuilderComponent::SharedMemoryJobResidentHandler(AZ::u32 /*typeId*/, AZ::u32 serial, const void* data, AZ::u32 dataLength)
+{
+    using namespace AssetBuilder;
+
+    SharedMemoryJobNetRequest channelRequest;
+    AZStd::vector<AZ::u8> requestData;
+    if (!AZ::Utils::LoadObjectFromBufferInPlace(data, dataLength, channelRequest) || !m_jobChannel ||
+        !m_jobChannel->ReadRequest(requestData, channelRequest.m_requestSize))
+    {
+        AZ_Error("AssetBuilder", false, "Problem reading net request from the job channel");
+    }
+
+    // a request that could not be read fails to deserialize below, which sends back an empty response
+    if (channelRequest.m_requestType == ProcessJobNetRequest::MessageType())
+    {
+        ResidentJobHandler<ProcessJobNetRequest, ProcessJobNetResponse>(
+            serial, requestData.data(), aznumeric_cast<AZ::u32>(requestData.size()), JobType::Process, true);
+    }
+    else if (channelRequest.m_requestType == CreateJobsNetRequest::MessageType())
+    {
+        ResidentJobHandler<CreateJobsNetRequest, CreateJobsNetResponse>(
+            serial, requestData.data(), aznumeric_cast<AZ::u32>(requestData.size()), JobType::Create, true);
+    }
+    else
+    {
+        AZ_Error("AssetBuilder", false, "Unknown request type %u in the job channel", channelRequest.m_requestType);
+        AzFramework::AssetSystem::SendResponse(SharedMemoryJobNetResponse(), serial);
+    }
+}
+
+void AssetBuilderComponent::SendJobResponse(const Job& job)
+{
+    using namespace AssetBuilder;
+
+    if (!job.m_respondThroughJobChannel)
+    {
+        AzFramework::AssetSystem::SendResponse(*(job.m_netResponse), job.m_requestSerial);
+        return;
+    }
+
+    SharedMemoryJobNetResponse channelResponse;
+    AzFramework::AssetSystem::PackMessage(*(job.m_netResponse), channelResponse.m_response);
+
+    // responses that don't fit in the job channel are sent inline
+    if (m_jobChannel && m_jobChannel->WriteResponse(channelResponse.m_response))
+    {
+        channelResponse.m_responseSize = aznumeric_cast<AZ::u32>(channelResponse.m_response.size());
+        channelResponse.m_response.clear();
+    }
+
+    AzFramework::AssetSystem::SendResponse(channelResponse, job.m_requestSerial);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 template<typename TRequest, typename TResponse>
@@ -16,6 +16,7 @@
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include "AssetBuilderInfo.h"
+#include "AssetBuilderStatic.h"
 
 //! This bus is used to signal to the AssetBuilderComponent to start up and execute while providing a return code
 class BuilderBusTraits
@@ -89,6 +90,8 @@ protected:
         AZ::u32 m_requestSerial;
         AZStd::unique_ptr<AzFramework::AssetSystem::BaseAssetProcessorMessage> m_netRequest;
         AZStd::unique_ptr<AzFramework::AssetSystem::BaseAssetProcessorMessage> m_netResponse;
+        //! The request came through the job channel, so the response goes back through it too
+        bool m_respondThroughJobChannel = false;
     };
 
     //! Reads a command line parameter and places it in the outValue parameter.  Returns false if the value is empty, true otherwise
@@ -110,9 +113,13 @@ protected:
     bool RunOneShotTask(const AZStd::string& task);
 
     template<typename TNetRequest, typename TNetResponse>
-    void ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType);
+    void ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType, bool respondThroughJobChannel = false);
     void CreateJobsResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
     void ProcessJobResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
+    void SharedMemoryJobResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
+
+    //! Sends the response of the job back to the AP, through the job channel if the request came through it
+    void SendJobResponse(const Job& job);
 
     bool IsBuilderForFile(const AZStd::string& filePath, const AssetBuilderSDK::AssetBuilderDesc& builderDescription) const;
 
@@ -159,6 +166,9 @@ protected:
     //! Stored job that is waiting to be picked up for processing by the job thread
     AZStd::unique_ptr<Job> m_queuedJob;
 
+    //! Optional shared memory channel the AP sends job requests through, only opened in resident mode
+    AZStd::unique_ptr<AssetBuilder::JobChannel> m_jobChannel;
+
     AZStd::string m_gameName;
     AZStd::string m_projectPath;
     AZStd::string m_gameCache;
@@ -21,6 +21,8 @@ namespace AssetBuilder
         CreateJobsNetResponse::Reflect(context);
         ProcessJobNetRequest::Reflect(context);
         ProcessJobNetResponse::Reflect(context);
+        SharedMemoryJobNetRequest::Reflect(context);
+        SharedMemoryJobNetResponse::Reflect(context);
     }
 
     void InitializeSerializationContext()
@@ -143,6 +145,125 @@ namespace AssetBuilder
         return ProcessJobNetRequest::MessageType();
     }
 
+    void SharedMemoryJobNetRequest::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<SharedMemoryJobNetRequest>()
+                ->Version(1)
+                ->Field("RequestType", &SharedMemoryJobNetRequest::m_requestType)
+                ->Field("RequestSize", &SharedMemoryJobNetRequest::m_requestSize);
+        }
+    }
+
+    unsigned int SharedMemoryJobNetRequest::MessageType()
+    {
+        static unsigned int messageType = AZ_CRC_CE("AssetBuilderSDK::SharedMemoryJobNetRequest");
+
+        return messageType;
+    }
+
+    unsigned int SharedMemoryJobNetRequest::GetMessageType() const
+    {
+        return MessageType();
+    }
+
+    void SharedMemoryJobNetResponse::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<SharedMemoryJobNetResponse>()
+                ->Version(1)
+                ->Field("ResponseSize", &SharedMemoryJobNetResponse::m_responseSize)
+                ->Field("Response", &SharedMemoryJobNetResponse::m_response);
+        }
+    }
+
+    unsigned int SharedMemoryJobNetResponse::GetMessageType() const
+    {
+        return SharedMemoryJobNetRequest::MessageType();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    bool JobChannel::Create(const char* name, AZ::u32 size)
+    {
+        const AZStd::string requestsName = AZStd::string::format("%s_Requests", name);
+        const AZStd::string responsesName = AZStd::string::format("%s_Responses", name);
+
+        return m_requests.Create(requestsName.c_str(), size) && m_requests.Map()
+            && m_responses.Create(responsesName.c_str(), size) && m_responses.Map();
+    }
+
+    bool JobChannel::Open(const char* name)
+    {
+        const AZStd::string requestsName = AZStd::string::format("%s_Requests", name);
+        const AZStd::string responsesName = AZStd::string::format("%s_Responses", name);
+
+        return m_requests.Open(requestsName.c_str()) && m_requests.Map()
+            && m_responses.Open(responsesName.c_str()) && m_responses.Map();
+    }
+
+    bool JobChannel::WriteRequest(const AZStd::vector<AZ::u8>& data)
+    {
+        return Write(m_requests, data);
+    }
+
+    bool JobChannel::ReadRequest(AZStd::vector<AZ::u8>& data, AZ::u32 size)
+    {
+        return Read(m_requests, data, size);
+    }
+
+    bool JobChannel::WriteResponse(const AZStd::vector<AZ::u8>& data)
+    {
+        return Write(m_responses, data);
+    }
+
+    bool JobChannel::ReadResponse(AZStd::vector<AZ::u8>& data, AZ::u32 size)
+    {
+        return Read(m_responses, data, size);
+    }
+
+    bool JobChannel::Write(AZ::SharedMemoryRingBuffer& ringBuffer, const AZStd::vector<AZ::u8>& data)
+    {
+        if (!ringBuffer.IsMapped() || data.empty())
+        {
+            return false;
+        }
+
+        AZ::SharedMemory::MemoryGuard lock(ringBuffer);
+
+        // drop a message the other side never read, which happens when a job was abandoned after it timed out
+        AZStd::vector<AZ::u8> unreadData(ringBuffer.DataToRead());
+        if (!unreadData.empty())
+        {
+            ringBuffer.Read(unreadData.data(), aznumeric_cast<unsigned int>(unreadData.size()));
+        }
+
+        return ringBuffer.Write(data.data(), aznumeric_cast<unsigned int>(data.size()));
+    }
+
+    bool JobChannel::Read(AZ::SharedMemoryRingBuffer& ringBuffer, AZStd::vector<AZ::u8>& data, AZ::u32 size)
+    {
+        if (!ringBuffer.IsMapped() || size == 0)
+        {
+            return false;
+        }
+
+        AZ::SharedMemory::MemoryGuard lock(ringBuffer);
+
+        if (ringBuffer.DataToRead() != size)
+        {
+            AZ_Error("JobChannel", false, "Expected %u bytes in job channel %s but found %u", size, ringBuffer.GetName(), ringBuffer.DataToRead());
+            return false;
+        }
+
+        data.resize_no_construct(size);
+        return ringBuffer.Read(data.data(), size) == size;
+    }
+
     //---------------------------------------------------------------------
     void BuilderRegistration::Reflect(AZ::ReflectContext* context)
     {
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/IPC/SharedMemory.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
@@ -106,6 +108,74 @@ namespace AssetBuilder
         AssetBuilderSDK::ProcessJobResponse m_response;
     };
 
+    //! SharedMemoryJobNetRequest is sent instead of a CreateJobsNetRequest or ProcessJobNetRequest when the request itself was written
+    //! to the JobChannel of the builder
+    class SharedMemoryJobNetRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedMemoryJobNetRequest, AZ::OSAllocator);
+        AZ_RTTI(SharedMemoryJobNetRequest, "{7C7B0D8E-3F0B-4D4C-9C85-4B0C5A1E2F61}", BaseAssetProcessorMessage);
+
+        static void Reflect(AZ::ReflectContext* context);
+        static unsigned int MessageType();
+
+        unsigned int GetMessageType() const override;
+
+        //! Message type of the request in the job channel, either CreateJobsNetRequest or ProcessJobNetRequest
+        AZ::u32 m_requestType = 0;
+
+        //! Size in bytes of the packed request in the job channel
+        AZ::u32 m_requestSize = 0;
+    };
+
+    class SharedMemoryJobNetResponse : public AzFramework::AssetSystem::BaseAssetProcessorMessage
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedMemoryJobNetResponse, AZ::OSAllocator);
+        AZ_RTTI(SharedMemoryJobNetResponse, "{0E4B3C52-96A1-4E0F-A7D4-2D8F61B5C3A9}", BaseAssetProcessorMessage);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        unsigned int GetMessageType() const override;
+
+        //! Size in bytes of the packed response in the job channel, 0 if the response is in m_response instead
+        AZ::u32 m_responseSize = 0;
+
+        //! Packed response, only used when the response did not fit in the job channel
+        AZStd::vector<AZ::u8> m_response;
+    };
+
+    //! Pair of shared memory ring buffers that carry packed job requests and responses between the AssetProcessor and a resident
+    //! builder, so that only a small message has to go through the connection.
+    //! The AssetProcessor creates the channel and passes its name to the builder on the command line, the builder opens it.
+    //! A builder runs one job at a time, so each ring buffer holds at most one message.
+    class JobChannel
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JobChannel, AZ::OSAllocator);
+
+        //! Creates the ring buffers, messages larger than size bytes don't fit and have to be sent over the connection
+        bool Create(const char* name, AZ::u32 size);
+
+        //! Opens the ring buffers of a channel created by the AssetProcessor
+        bool Open(const char* name);
+
+        //! Returns false if the request doesn't fit
+        bool WriteRequest(const AZStd::vector<AZ::u8>& data);
+        bool ReadRequest(AZStd::vector<AZ::u8>& data, AZ::u32 size);
+
+        //! Returns false if the response doesn't fit
+        bool WriteResponse(const AZStd::vector<AZ::u8>& data);
+        bool ReadResponse(AZStd::vector<AZ::u8>& data, AZ::u32 size);
+
+    private:
+        static bool Write(AZ::SharedMemoryRingBuffer& ringBuffer, const AZStd::vector<AZ::u8>& data);
+        static bool Read(AZ::SharedMemoryRingBuffer& ringBuffer, AZStd::vector<AZ::u8>& data, AZ::u32 size);
+
+        AZ::SharedMemoryRingBuffer m_requests;
+        AZ::SharedMemoryRingBuffer m_responses;
+    };
+
     //////////////////////////////////////////////////////////////////////////
     struct BuilderRegistration
     {
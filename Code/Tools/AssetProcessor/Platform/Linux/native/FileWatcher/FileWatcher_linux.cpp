@@ -11,7 +11,9 @@
 #include <native/FileWatcher/FileWatcher.h>
 #include <native/FileWatcher/FileWatcher_platform.h>
 
+#include <QDateTime>
 #include <QDirIterator>
+#include <QElapsedTimer>
 #include <QHash>
 #include <QFileInfo>
 
@@ -51,6 +53,14 @@
 //  - you don't miss creation events for anything
 //  - you don't get duplicate creation events for anything
 
+// Two more things can make inotify lose events, both of which tend to happen when large branches are checked out:
+//  - the kernel queue of events overflows (fs.inotify.max_queued_events), in which case a single IN_Q_OVERFLOW event is
+//    received instead.  The watched folders are then rescanned for anything that changed since the last read.
+//  - the watches run out (fs.inotify.max_user_watches).  The folders that could not be watched are then polled instead,
+//    by comparing their contents every PollIntervalMs.
+// fanotify would avoid the per-folder watches, but watching a whole mount or filesystem with it requires CAP_SYS_ADMIN,
+// which the Asset Processor does not run with.
+
 #include <unistd.h>
 #include <sys/inotify.h>
 #include <sys/eventfd.h>
@@ -108,6 +118,7 @@ void FileWatcher::PlatformImplementation::Finalize()
     }
     m_handleToFolderMap.clear();
     m_alreadyNotifiedCreate.clear();
+    m_polledFolders.clear();
 }
 
 bool FileWatcher::PlatformImplementation::TryToWatch(const QString &pathStr, int* errnoPtr)
@@ -136,12 +147,12 @@ bool FileWatcher::PlatformImplementation::TryToWatch(const QString &pathStr, int
             DEBUG_FILEWATCHER("Not adding an additional file watch for %s - already exists\n", pathStr.toUtf8().constData());
             return false;
         }
-        [[maybe_unused]] const char* extraStr = (err == ENOSPC ? " (try increasing fs.inotify.max_user_watches with sysctl)" : "");
+        // running out of watches is handled by the caller by polling the folder instead, see AddPolledFolder.
         [[maybe_unused]] AZStd::fixed_string<255> errorString;
         AZ_Warning(
-            "FileWatcher", false,
-            "inotify_add_watch failed for path %s with error %d: %s%s",
-            path.c_str(), err, strerror_r(err, errorString.data(), errorString.capacity()), extraStr);
+            "FileWatcher", err == ENOSPC,
+            "inotify_add_watch failed for path %s with error %d: %s",
+            path.c_str(), err, strerror_r(err, errorString.data(), errorString.capacity()));
         if (errnoPtr)
         {
             *errnoPtr = err;
@@ -171,16 +182,24 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
         return; // don't watch excluded paths and don't recurse into them.
     }
 
-    if (!TryToWatch(cleanPath, nullptr))
-    {
-        return;
-    }
-    
     // Each watch costs linux a file handle from a limited (default 8k) set of handles.
     // as such, we don't want to establish a watch on any excluded dirs.
     // Its safer (and more efficient) to first establish the watches, then check for files.
     QList<QString> dirsAdded;
-    dirsAdded.push_back(cleanPath);
+
+    int rootErrno = 0;
+    if (TryToWatch(cleanPath, &rootErrno))
+    {
+        dirsAdded.push_back(cleanPath);
+    }
+    else if (rootErrno == ENOSPC)
+    {
+        AddPolledFolder(cleanPath, recursive, source, notifyFiles);
+    }
+    else
+    {
+        return;
+    }
 
     QDirIterator dirIter(
         folder, QDir::NoDotAndDotDot | QDir::Dirs,
@@ -224,6 +243,10 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
             case EEXIST:
                 // Errors specific to the directory: try next one
                 continue;
+            case ENOSPC:
+                // Out of watches: this directory and the ones after it are polled instead
+                AddPolledFolder(dirPath, true, source, notifyFiles);
+                continue;
             default:
                 // Other errors are usually non-recoverable: bail out to avoid warning spam
                 AZ_Warning(
@@ -265,6 +288,165 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
     }
 }
 
+QHash<QString, FileWatcher::PlatformImplementation::PolledEntry> FileWatcher::PlatformImplementation::ReadFolderEntries(
+    const QString& folder, FileWatcher& source) const
+{
+    QHash<QString, PolledEntry> entries;
+    const QFileInfoList entriesInDir = QDir(folder).entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
+    for (const QFileInfo& entryInfo : entriesInDir)
+    {
+        QString entryPath = entryInfo.absoluteFilePath();
+        if (source.IsExcluded(entryPath))
+        {
+            continue;
+        }
+        entries.insert(entryPath, { entryInfo.lastModified().toMSecsSinceEpoch(), entryInfo.size(), entryInfo.isDir() });
+    }
+    return entries;
+}
+
+void FileWatcher::PlatformImplementation::AddPolledFolder(const QString& folder, bool recursive, FileWatcher& source, bool notifyFiles)
+{
+    if (m_polledFolders.contains(folder))
+    {
+        return;
+    }
+
+    AZ_Warning(
+        "FileWatcher", !m_polledFolders.isEmpty(),
+        "Ran out of inotify watches at %s (try increasing fs.inotify.max_user_watches with sysctl). "
+        "Folders that can't be watched are checked for changes every %i ms instead.",
+        folder.toUtf8().constData(), PollIntervalMs);
+
+    PolledFolder& polledFolder = m_polledFolders[folder];
+    polledFolder.m_recursive = recursive;
+    polledFolder.m_entries = ReadFolderEntries(folder, source);
+
+    if (notifyFiles)
+    {
+        for (auto entry = polledFolder.m_entries.cbegin(); entry != polledFolder.m_entries.cend(); ++entry)
+        {
+            // sub folders are notified about by the crawl in AddWatchFolder.
+            // No inotify event will ever arrive for these files, so they are not added to m_alreadyNotifiedCreate.
+            if (!entry.value().m_isDirectory && !m_alreadyNotifiedCreate.contains(entry.key()))
+            {
+                DEBUG_FILEWATCHER("%s rawFileAdded for polled folder\n", entry.key().toUtf8().constData());
+                source.rawFileAdded(entry.key(), {});
+            }
+        }
+    }
+}
+
+void FileWatcher::PlatformImplementation::PollFolders(FileWatcher& source)
+{
+    // new folders are only added once all the polled folders are checked, since adding them can change m_polledFolders.
+    QList<QString> newFolders;
+
+    for (auto polledFolder = m_polledFolders.begin(); polledFolder != m_polledFolders.end();)
+    {
+        if (!QDir(polledFolder.key()).exists())
+        {
+            // the removal is notified about by whatever watches or polls its parent folder.
+            polledFolder = m_polledFolders.erase(polledFolder);
+            continue;
+        }
+
+        QHash<QString, PolledEntry> entries = ReadFolderEntries(polledFolder.key(), source);
+        const QHash<QString, PolledEntry>& previousEntries = polledFolder.value().m_entries;
+
+        for (auto previousEntry = previousEntries.cbegin(); previousEntry != previousEntries.cend(); ++previousEntry)
+        {
+            if (!entries.contains(previousEntry.key()))
+            {
+                DEBUG_FILEWATCHER("%s rawFileRemoved from polling\n", previousEntry.key().toUtf8().constData());
+                source.rawFileRemoved(previousEntry.key(), {});
+            }
+        }
+
+        for (auto entry = entries.cbegin(); entry != entries.cend(); ++entry)
+        {
+            auto previousEntry = previousEntries.find(entry.key());
+            if (previousEntry == previousEntries.end())
+            {
+                DEBUG_FILEWATCHER("%s rawFileAdded from polling\n", entry.key().toUtf8().constData());
+                source.rawFileAdded(entry.key(), {});
+                if (entry.value().m_isDirectory && polledFolder.value().m_recursive)
+                {
+                    newFolders.push_back(entry.key());
+                }
+            }
+            else if (!entry.value().m_isDirectory &&
+                (entry.value().m_modTime != previousEntry.value().m_modTime || entry.value().m_size != previousEntry.value().m_size))
+            {
+                DEBUG_FILEWATCHER("%s rawFileModified from polling\n", entry.key().toUtf8().constData());
+                source.rawFileModified(entry.key(), {});
+            }
+        }
+
+        polledFolder.value().m_entries = AZStd::move(entries);
+        ++polledFolder;
+    }
+
+    for (const QString& newFolder : newFolders)
+    {
+        // this watches the new folder if watches became available, and polls it otherwise.
+        AddWatchFolder(newFolder, true, source, true);
+    }
+}
+
+void FileWatcher::PlatformImplementation::RescanAfterOverflow(FileWatcher& source, const QDateTime& since)
+{
+    AZ_Warning(
+        "FileWatcher", false,
+        "The inotify event queue overflowed (try increasing fs.inotify.max_queued_events with sysctl). "
+        "Rescanning the watched folders for changes, files deleted in the meantime will not be noticed.");
+
+    // allow for file systems with coarse timestamps.
+    const QDateTime changedAfter = since.addSecs(-1);
+
+    // copy the folders, since AddWatchFolder adds new ones to the map.
+    const QList<QString> watchedFolders = m_handleToFolderMap.values();
+    const QSet<QString> watchedFolderSet(watchedFolders.begin(), watchedFolders.end());
+
+    for (const QString& watchedFolder : watchedFolders)
+    {
+        const auto foundRoot = AZStd::find_if(begin(source.m_folderWatchRoots), end(source.m_folderWatchRoots), [&watchedFolder](const WatchRoot& watchRoot)
+            {
+                return watchRoot.m_directory == watchedFolder;
+            });
+        const bool watchSubfolders = foundRoot == end(source.m_folderWatchRoots) || foundRoot->m_recursive;
+
+        const QFileInfoList entriesInDir = QDir(watchedFolder).entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
+        for (const QFileInfo& entryInfo : entriesInDir)
+        {
+            if (entryInfo.metadataChangeTime() < changedAfter)
+            {
+                continue;
+            }
+
+            QString entryPath = entryInfo.absoluteFilePath();
+            if (source.IsExcluded(entryPath))
+            {
+                continue;
+            }
+
+            if (!entryInfo.isDir())
+            {
+                // consumers treat an add of a file they already know about as a modification.
+                source.rawFileAdded(entryPath, {});
+            }
+            else if (!watchedFolderSet.contains(entryPath) && !m_polledFolders.contains(entryPath))
+            {
+                source.rawFileAdded(entryPath, {});
+                if (watchSubfolders)
+                {
+                    AddWatchFolder(entryPath, true, source, true);
+                }
+            }
+        }
+    }
+}
+
 void FileWatcher::PlatformImplementation::RemoveWatchFolder(int watchHandle)
 {
     if (m_inotifyHandle < 0)
@@ -294,7 +476,8 @@ bool FileWatcher::PlatformStart()
         }
     }
 
-    AZ_TracePrintf("FileWatcher", "Using %i file watch handles.\n", static_cast<int>(m_platformImpl->m_handleToFolderMap.size()));
+    AZ_TracePrintf("FileWatcher", "Using %i file watch handles and polling %i folders.\n",
+        static_cast<int>(m_platformImpl->m_handleToFolderMap.size()), static_cast<int>(m_platformImpl->m_polledFolders.size()));
 
     return true;
 }
@@ -323,6 +506,12 @@ void FileWatcher::WatchFolderLoop()
 
     m_startedSignal = true; // signal that we are no longer going to drop any events.
 
+    QElapsedTimer pollTimer;
+    pollTimer.start();
+
+    // anything changed after the previous read may be missing from the queue when it overflows.
+    QDateTime previousReadTime = QDateTime::currentDateTimeUtc();
+
     while (!m_shutdownThreadSignal)
     {
         memset(eventBuffer, 0, s_inotifyReadBufferSize);
@@ -332,7 +521,8 @@ void FileWatcher::WatchFolderLoop()
         fds[1].fd = m_platformImpl->m_inotifyHandle; 
         fds[1].events = POLLIN;
 
-        int numPollEvents = poll(fds, nfds, -1);
+        // only wake up periodically when there are folders to poll.
+        int numPollEvents = poll(fds, nfds, m_platformImpl->m_polledFolders.isEmpty() ? -1 : PlatformImplementation::PollIntervalMs);
         if (numPollEvents == -1) 
         {
             break; // error polling.
@@ -344,6 +534,13 @@ void FileWatcher::WatchFolderLoop()
             break;
         }
 
+        if (!m_platformImpl->m_polledFolders.isEmpty() && pollTimer.hasExpired(PlatformImplementation::PollIntervalMs))
+        {
+            m_platformImpl->PollFolders(*this);
+            pollTimer.restart();
+        }
+
+        const QDateTime readTime = QDateTime::currentDateTimeUtc();
         ssize_t bytesRead = 0;
         if ((fds[1].revents & POLLIN) && (!m_shutdownThreadSignal))
         {
@@ -371,7 +568,12 @@ void FileWatcher::WatchFolderLoop()
         {
             const auto* event = reinterpret_cast<inotify_event*>(&eventBuffer[index]);
 
-            if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                DEBUG_FILEWATCHER("notify event is IN_Q_OVERFLOW cycle: %i\n", cycleCount);
+                m_platformImpl->RescanAfterOverflow(*this, previousReadTime);
+            }
+            else if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
             {
                 // note that the event->name coming in is relative to the thing being watched.  Since we watch folders,
                 // for the folder itself, this will be blank, for files in it, it will be the file name.
@@ -466,5 +668,10 @@ void FileWatcher::WatchFolderLoop()
             }
             index += s_inotifyEventSize + event->len;
         }
+
+        if (bytesRead > 0)
+        {
+            previousReadTime = readTime;
+        }
     }
 }
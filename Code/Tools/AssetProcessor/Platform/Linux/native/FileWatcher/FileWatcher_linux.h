@@ -9,6 +9,7 @@
 #pragma once
 
 #include <FileWatcher/FileWatcher.h>
+#include <QDateTime>
 #include <QMutex>
 #include <QHash>
 #include <QSet>
@@ -29,6 +30,31 @@ public:
     //! @return Was the watch successful?
     bool TryToWatch(const QString &path, int* errnoPtr = nullptr);
 
+    //! How often folders that could not be watched are checked for changes.
+    static constexpr int PollIntervalMs = 2000;
+
+    //! Falls back to polling a folder that could not be watched because the inotify watches ran out.
+    void AddPolledFolder(const QString& folder, bool recursive, FileWatcher& source, bool notifyFiles);
+    //! Compares the contents of the polled folders to the last time they were checked, and notifies about the differences.
+    void PollFolders(FileWatcher& source);
+    //! Called when the inotify queue overflowed, notifies about every file in the watched folders that changed since the given time.
+    //! Events for deleted files are lost in that case since there is nothing left to compare to.
+    void RescanAfterOverflow(FileWatcher& source, const QDateTime& since);
+
+    struct PolledEntry
+    {
+        qint64 m_modTime = 0;
+        qint64 m_size = 0;
+        bool m_isDirectory = false;
+    };
+    QHash<QString, PolledEntry> ReadFolderEntries(const QString& folder, FileWatcher& source) const;
+
+    struct PolledFolder
+    {
+        bool m_recursive = false;
+        QHash<QString, PolledEntry> m_entries;
+    };
+
     // This handle represents the handle to the entire notify tree.
     // Individual watches will be added to this same handle.
     int                         m_inotifyHandle = -1;
@@ -38,4 +64,7 @@ public:
     
     QHash<int, QString>         m_handleToFolderMap;
     QSet<QString>               m_alreadyNotifiedCreate;
+
+    // Folders that are polled instead of watched. Only accessed by the watch thread once it has started.
+    QHash<QString, PolledFolder> m_polledFolders;
 };
@@ -18,6 +18,8 @@ set(FILES
     native/AssetManager/AssetRequestHandler.cpp
     native/AssetManager/AssetRequestHandler.h
     native/AssetManager/assetScanFolderInfo.h
+    native/AssetManager/AssetScanJournal.cpp
+    native/AssetManager/AssetScanJournal.h
     native/AssetManager/assetScanFolderInfo.cpp
     native/AssetManager/assetScanner.cpp
     native/AssetManager/assetScanner.h
@@ -106,6 +108,8 @@ set(FILES
     native/utilities/PlatformConfiguration.cpp
     native/utilities/PlatformConfiguration.h
     native/utilities/PotentialDependencies.h
+    native/utilities/ProductCache.cpp
+    native/utilities/ProductCache.h
     native/utilities/StatsCapture.cpp
     native/utilities/StatsCapture.h
     native/utilities/SpecializedDependencyScanner.h
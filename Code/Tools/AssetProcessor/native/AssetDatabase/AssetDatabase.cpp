@@ -882,6 +882,46 @@ namespace AssetProcessor
         CloseDatabase();
     }
 
+    AssetDatabaseConnection::ScopedWriteBatch::ScopedWriteBatch(AssetDatabaseConnection& connection, int operationsPerCommit)
+        : m_connection(connection.m_databaseConnection)
+        , m_operationsPerCommit(operationsPerCommit)
+    {
+        if (m_connection && m_connection->IsOpen())
+        {
+            m_connection->BeginTransaction();
+        }
+        else
+        {
+            m_connection = nullptr;
+        }
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::~ScopedWriteBatch()
+    {
+        if (m_connection)
+        {
+            m_connection->CommitTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::ScopedWriteBatch::Step()
+    {
+        if (++m_pendingOperations >= m_operationsPerCommit)
+        {
+            Commit();
+        }
+    }
+
+    void AssetDatabaseConnection::ScopedWriteBatch::Commit()
+    {
+        m_pendingOperations = 0;
+        if (m_connection)
+        {
+            m_connection->CommitTransaction();
+            m_connection->BeginTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::DataExists()
     {
         AZStd::string dbFilePath = GetAssetDatabaseFilePath();
@@ -36,6 +36,32 @@ namespace AssetProcessor
         AssetDatabaseConnection();
         ~AssetDatabaseConnection();
 
+        //! Groups the writes made on this connection into larger transactions, so that writing many rows in a row
+        //! doesn't commit to the database journal once per row.  Batches can be nested with ScopedTransaction.
+        //! Rows written during a batch are visible to this connection right away, but only visible to other connections
+        //! once the batch commits, so don't keep a batch open around code that notifies other threads about the rows it writes.
+        class ScopedWriteBatch
+        {
+        public:
+            static constexpr int DefaultOperationsPerCommit = 1000;
+
+            explicit ScopedWriteBatch(AssetDatabaseConnection& connection, int operationsPerCommit = DefaultOperationsPerCommit);
+            ~ScopedWriteBatch(); //!< Commits the remaining writes.
+
+            //! Counts one operation, and commits the batch every operationsPerCommit operations.
+            void Step();
+            //! Commits the writes made so far and starts a new transaction.
+            void Commit();
+
+            ScopedWriteBatch(const ScopedWriteBatch&) = delete;
+            ScopedWriteBatch& operator=(const ScopedWriteBatch&) = delete;
+
+        private:
+            AzToolsFramework::SQLite::Connection* m_connection = nullptr;
+            int m_operationsPerCommit = DefaultOperationsPerCommit;
+            int m_pendingOperations = 0;
+        };
+
         //////////////////////////////////////////////////////////////////////////
         // AzToolsFramework::AssetDatabase::Connection
     public:
@@ -12,6 +12,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -351,6 +352,9 @@ namespace AssetProcessor
                         if (moved)
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
+
+                            // Written after the regular catalog so runtimes can tell when the flat catalog is out of date.
+                            SaveFlatRegistry(platform, workSpace, actualRegistryFile);
                         }
                     }
                     else
@@ -373,6 +377,33 @@ namespace AssetProcessor
         }
     }
 
+    void AssetCatalog::SaveFlatRegistry(const QString& platform, const QString& workSpace, const QString& registryFile)
+    {
+        {
+            QMutexLocker locker(&m_registriesMutex);
+            if (!AzFramework::FlatAssetCatalog::Write(m_registries[platform], m_flatSaveBuffer))
+            {
+                AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to build the flat catalog for platform %s", platform.toUtf8().constData());
+                return;
+            }
+        }
+
+        QString tempFlatRegistryFile = QString("%1/%2.%3").arg(workSpace).arg("assetcatalog").arg(AzFramework::FlatAssetCatalog::FileExtension);
+        QString actualFlatRegistryFile = QString::fromUtf8(AzFramework::FlatAssetCatalog::GetFlatCatalogPath(registryFile.toUtf8().constData()).c_str());
+
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!AZ::IO::FileIOBase::GetInstance()->Open(tempFlatRegistryFile.toUtf8().data(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to create flat catalog file %s", tempFlatRegistryFile.toUtf8().constData());
+            return;
+        }
+        AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, m_flatSaveBuffer.data(), m_flatSaveBuffer.size());
+        AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+
+        [[maybe_unused]] bool moved = AssetUtilities::MoveFileWithTimeout(tempFlatRegistryFile, actualFlatRegistryFile, 3);
+        AZ_Warning(AssetProcessor::ConsoleChannel, moved, "Failed to move %s to %s", tempFlatRegistryFile.toUtf8().constData(), actualFlatRegistryFile.toUtf8().constData());
+    }
+
     AzFramework::AssetSystem::GetUnresolvedDependencyCountsResponse AssetCatalog::HandleGetUnresolvedDependencyCountsRequest(MessageData<AzFramework::AssetSystem::GetUnresolvedDependencyCountsRequest> messageData)
     {
         AzFramework::AssetSystem::GetUnresolvedDependencyCountsResponse response;
@@ -89,6 +89,10 @@ namespace AssetProcessor
 
         void RegistrySaveComplete(int assetCatalogVersion, bool allCatalogsSaved);
 
+        //! Writes the flat version of the platform's catalog next to the registry file so runtimes can load it without deserializing.
+        //! A failure isn't fatal since runtimes fall back to the regular catalog if the flat catalog is missing or out of date.
+        void SaveFlatRegistry(const QString& platform, const QString& workSpace, const QString& registryFile);
+
         //////////////////////////////////////////////////////////////////////////
         // AzToolsFramework::AssetSystem::AssetSystemRequestBus::Handler overrides
         bool GetRelativeProductPathFromFullSourceOrProductPath(const AZStd::string& fullPath, AZStd::string& relativeProductPath) override;
@@ -210,5 +214,6 @@ namespace AssetProcessor
         AZStd::unordered_multimap<AZ::Data::AssetId, QString> m_cachedNoPreloadDependenyAssetList;
 
         AZStd::vector<char> m_saveBuffer; // so that we don't realloc all the time
+        AZStd::vector<char> m_flatSaveBuffer;
     };
 }
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/AssetManager/AssetScanJournal.h>
+#include <native/assetprocessor.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QSaveFile>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <sys/stat.h>
+#endif
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        constexpr quint32 JournalSignature = 0x4A534341; // "ACSJ"
+        constexpr quint32 JournalVersion = 1;
+    }
+
+    AssetScanJournal::DirectoryState AssetScanJournal::GetDirectoryState(const QFileInfo& directoryInfo)
+    {
+        DirectoryState state;
+        state.m_modTime = directoryInfo.lastModified().toMSecsSinceEpoch();
+#if defined(AZ_PLATFORM_WINDOWS)
+        // there's no cheap way to get the file index without opening the directory, the creation time
+        // changes when a directory is deleted and created again which is what the file id is used to detect.
+        state.m_fileId = aznumeric_cast<quint64>(directoryInfo.birthTime().toMSecsSinceEpoch());
+#else
+        struct stat statResult;
+        if (::stat(directoryInfo.absoluteFilePath().toUtf8().constData(), &statResult) == 0)
+        {
+            state.m_fileId = aznumeric_cast<quint64>(statResult.st_ino);
+        }
+#endif
+        return state;
+    }
+
+    bool AssetScanJournal::Load(const QString& journalFilePath)
+    {
+        Clear();
+
+        QFile journalFile(journalFilePath);
+        if (!journalFile.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        QDataStream stream(&journalFile);
+        quint32 signature = 0;
+        quint32 version = 0;
+        qint32 directoryCount = 0;
+        stream >> signature >> version >> directoryCount;
+        if (signature != JournalSignature || version != JournalVersion || directoryCount < 0)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Ignoring scan journal %s, it was written by a different version.\n",
+                journalFilePath.toUtf8().constData());
+            return false;
+        }
+
+        m_directories.reserve(directoryCount);
+        for (qint32 index = 0; index < directoryCount && stream.status() == QDataStream::Ok; ++index)
+        {
+            QString absolutePath;
+            DirectoryEntry entry;
+            stream >> absolutePath >> entry.m_state.m_modTime >> entry.m_state.m_fileId >> entry.m_subDirectories >> entry.m_files;
+            m_directories.insert(absolutePath, AZStd::move(entry));
+        }
+
+        if (stream.status() != QDataStream::Ok)
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Scan journal %s is truncated and will be ignored.\n",
+                journalFilePath.toUtf8().constData());
+            Clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool AssetScanJournal::Save(const QString& journalFilePath) const
+    {
+        // write to a temporary file first so that a crash while saving can't leave a partial journal behind.
+        QSaveFile journalFile(journalFilePath);
+        if (!journalFile.open(QIODevice::WriteOnly))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to write the scan journal %s.\n", journalFilePath.toUtf8().constData());
+            return false;
+        }
+
+        QDataStream stream(&journalFile);
+        stream << JournalSignature << JournalVersion << aznumeric_cast<qint32>(m_directories.size());
+        for (auto directoryIter = m_directories.cbegin(); directoryIter != m_directories.cend(); ++directoryIter)
+        {
+            const DirectoryEntry& entry = directoryIter.value();
+            stream << directoryIter.key() << entry.m_state.m_modTime << entry.m_state.m_fileId << entry.m_subDirectories << entry.m_files;
+        }
+
+        return stream.status() == QDataStream::Ok && journalFile.commit();
+    }
+
+    void AssetScanJournal::Clear()
+    {
+        m_directories.clear();
+    }
+
+    const AssetScanJournal::DirectoryEntry* AssetScanJournal::FindUnchanged(const QString& absolutePath, const DirectoryState& currentState) const
+    {
+        auto directoryIter = m_directories.constFind(absolutePath);
+        if (directoryIter == m_directories.cend())
+        {
+            return nullptr;
+        }
+
+        const DirectoryState& recordedState = directoryIter.value().m_state;
+        if (recordedState.m_modTime != currentState.m_modTime || recordedState.m_fileId != currentState.m_fileId)
+        {
+            return nullptr;
+        }
+
+        return &directoryIter.value();
+    }
+
+    void AssetScanJournal::AddDirectory(const QString& absolutePath, DirectoryEntry entry)
+    {
+        m_directories.insert(absolutePath, AZStd::move(entry));
+    }
+
+    void AssetScanJournal::Merge(AssetScanJournal&& other)
+    {
+        if (m_directories.isEmpty())
+        {
+            m_directories.swap(other.m_directories);
+            return;
+        }
+
+        m_directories.reserve(m_directories.size() + other.m_directories.size());
+        for (auto directoryIter = other.m_directories.begin(); directoryIter != other.m_directories.end(); ++directoryIter)
+        {
+            m_directories.insert(directoryIter.key(), AZStd::move(directoryIter.value()));
+        }
+        other.m_directories.clear();
+    }
+
+    int AssetScanJournal::GetDirectoryCount() const
+    {
+        return m_directories.size();
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <QFileInfo>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace AssetProcessor
+{
+    //! Persisted record of the directories found by the asset scanner.
+    //! Every directory is stored with its modification time, its file id (the inode number on file systems that have one)
+    //! and the names of the entries it contained. If a directory still has the same modification time and file id on the
+    //! next scan, no entries were added, removed or renamed in it, so the scanner can use the recorded names instead of
+    //! enumerating the directory again.
+    //! The modification time of a directory does not change when a file in it is modified, so the journal only replaces
+    //! the directory enumeration and the scanner still has to query the state of every file.
+    class AssetScanJournal
+    {
+    public:
+        struct DirectoryState
+        {
+            qint64 m_modTime = 0; //!< Milliseconds since epoch.
+            quint64 m_fileId = 0;
+        };
+
+        struct DirectoryEntry
+        {
+            DirectoryState m_state;
+            QStringList m_subDirectories;
+            QStringList m_files;
+        };
+
+        //! Queries the current modification time and file id of a directory from the file system.
+        static DirectoryState GetDirectoryState(const QFileInfo& directoryInfo);
+
+        //! Loads a journal saved by Save, replacing the current contents.
+        //! Returns false and leaves the journal empty if the file is missing or was written by a different version.
+        bool Load(const QString& journalFilePath);
+        bool Save(const QString& journalFilePath) const;
+        void Clear();
+
+        //! Returns the recorded entries of the directory if the directory did not change since it was recorded.
+        //! This is safe to call from multiple threads as long as the journal is not modified at the same time.
+        const DirectoryEntry* FindUnchanged(const QString& absolutePath, const DirectoryState& currentState) const;
+
+        void AddDirectory(const QString& absolutePath, DirectoryEntry entry);
+        //! Moves all the directories of the other journal into this one.
+        void Merge(AssetScanJournal&& other);
+
+        int GetDirectoryCount() const;
+
+    private:
+        QHash<QString, DirectoryEntry> m_directories;
+    };
+} // namespace AssetProcessor
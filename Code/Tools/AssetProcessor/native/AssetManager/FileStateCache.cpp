@@ -10,6 +10,8 @@
 #include "native/utilities/assetUtils.h"
 #include <AssetProcessor_Traits_Platform.h>
 #include <AzToolsFramework/Asset/AssetUtils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <QDir>
 #include <QDateTime>
@@ -66,28 +68,91 @@ namespace AssetProcessor
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
         AZ_Assert(!m_fileInfoMap.empty(), "FileStateCache::Exists called before cache is initialized!");
+        QString key;
+        FileStateInfo fileInfo;
+        {
+            LockGuardType scopeLock(m_mapMutex);
+            key = PathToKey(absolutePath);
+            auto fileInfoItr = m_fileInfoMap.find(key);
+
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
+
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
+
+            fileInfo = fileInfoItr.value();
+        }
+
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done without holding the lock, so other threads can use the cache and hash other files in the meantime.
+        *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
+
+        // only keep the hash if the file did not change while it was hashed, otherwise the next request hashes it again.
         LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
+        auto fileInfoItr = m_fileInfoMap.find(key);
+        if (fileInfoItr != m_fileInfoMap.end() && fileInfoItr.value() == fileInfo)
+        {
+            m_fileHashMap[key] = *foundHash;
+        }
+        return true;
+    }
 
-        if(fileInfoItr == m_fileInfoMap.end())
+    void FileStateCache::HashFiles(const AZStd::vector<QString>& absolutePaths)
+    {
+        AZStd::vector<QString> filesToHash;
         {
-            // No info on this file, return false
-            return false;
+            LockGuardType scopeLock(m_mapMutex);
+            for (const QString& absolutePath : absolutePaths)
+            {
+                QString key = PathToKey(absolutePath);
+                if (m_fileInfoMap.contains(key) && !m_fileHashMap.contains(key))
+                {
+                    filesToHash.push_back(absolutePath);
+                }
+            }
+        }
+
+        if (filesToHash.empty())
+        {
+            return;
         }
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+        AZStd::atomic<size_t> nextFileIndex{ 0 };
+        auto hashFiles = [this, &filesToHash, &nextFileIndex]()
+        {
+            for (size_t fileIndex = nextFileIndex++; fileIndex < filesToHash.size(); fileIndex = nextFileIndex++)
+            {
+                FileHash hash = InvalidFileHash;
+                GetHash(filesToHash[fileIndex], &hash);
+            }
+        };
 
-        if (itr != m_fileHashMap.end())
+        // the calling thread hashes files as well, so it only needs threadCount - 1 extra threads.
+        const size_t threadCount = AZStd::clamp<size_t>(AZStd::thread::hardware_concurrency(), 1, AZStd::min(MaxHashThreads, filesToHash.size()));
+        AZStd::vector<AZStd::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
         {
-            *foundHash = itr.value();
-            return true;
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "FileStateCache hashing";
+            threads.emplace_back(threadDesc, hashFiles);
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
-        *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
+        hashFiles();
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
-        return true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
     }
 
     void FileStateCache::RegisterForDeleteEvent(AZ::Event<FileStateInfo>::Handler& handler)
@@ -16,6 +16,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AssetProcessor
 {
@@ -69,6 +70,11 @@ namespace AssetProcessor
         //! This can for example warm up the cache so that it can return hashes without actually hashing.
         //! (optional for implementations)
         virtual void WarmUpCache(const AssetFileInfo& existingInfo, const FileHash hash = InvalidFileHash) = 0;
+
+        //! Called when the caller knows it is about to ask for the hashes of many files.
+        //! This can for example hash the files in parallel so that later calls to GetHash return without reading the files.
+        //! (optional for implementations)
+        virtual void HashFiles(const AZStd::vector<QString>& absolutePaths) = 0;
         virtual void RegisterForDeleteEvent(AZ::Event<FileStateInfo>::Handler& handler) = 0;
 
         AZ_DISABLE_COPY_MOVE(IFileStateRequests);
@@ -101,6 +107,8 @@ namespace AssetProcessor
         virtual void RemoveFile(const QString& /*absolutePath*/) {}
 
         virtual void WarmUpCache(const AssetFileInfo& /*existingInfo*/, const FileHash /*hash*/) {}
+
+        virtual void HashFiles(const AZStd::vector<QString>& /*absolutePaths*/) {}
     };
 
     //! Caches file state information retrieved by the file scanner and file watcher.
@@ -126,6 +134,12 @@ namespace AssetProcessor
 
         void WarmUpCache(const AssetFileInfo& existingInfo, const FileHash hash = IFileStateRequests::InvalidFileHash) override;
 
+        //! Hashes the files that are in the cache but don't have a hash yet, on up to MaxHashThreads threads.
+        void HashFiles(const AZStd::vector<QString>& absolutePaths) override;
+
+        //! Hashing is mostly bound by the disk, a few threads are enough to keep it busy without making it seek back and forth.
+        static constexpr size_t MaxHashThreads = 4;
+
     private:
 
         /// Invalidates the hash for a file so it will be re-computed next time it's requested
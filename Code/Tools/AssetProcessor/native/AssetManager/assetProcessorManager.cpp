@@ -1695,6 +1695,10 @@ namespace AssetProcessor
     {
         AzToolsFramework::AssetDatabase::ProductDatabaseEntry& newProduct = pair.first;
         const AssetBuilderSDK::JobProduct* jobProduct = pair.second;
+
+        // the product, its legacy sub ids and the removal of its old dependencies are written as one transaction.
+        // Nothing is notified about the product until after this returns.
+        AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
         if (!m_stateData->SetProduct(newProduct))
         {
             //somethings wrong...
@@ -3521,6 +3525,14 @@ namespace AssetProcessor
         m_totalScannerFilesToAssess = filePaths.size();
         m_scannerFilesAssessed = 0;
 
+        if (m_allowModtimeSkippingFeature)
+        {
+            HashFilesWithChangedModTimes(filePaths);
+        }
+
+        // unchanged files only get their modtime updated, group those updates rather than committing each one.
+        AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -3542,6 +3554,7 @@ namespace AssetProcessor
                         {
                             AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
                         }
+                        writeBatch.Step();
                     }
 
                     ++m_scannerFilesAssessed;
@@ -3554,6 +3567,8 @@ namespace AssetProcessor
             ++processedFileCount;
         }
 
+        writeBatch.Commit();
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
@@ -3614,6 +3629,40 @@ namespace AssetProcessor
         m_excludedFolderCache->InitializeFromKnownSet(AZStd::move(excludedFolders));
     }
 
+    void AssetProcessorManager::HashFilesWithChangedModTimes(const QSet<AssetFileInfo>& filePaths)
+    {
+        IFileStateRequests* fileStateCache = AZ::Interface<IFileStateRequests>::Get();
+        if (!fileStateCache || m_buildersAddedOrRemoved || !AssetUtilities::ShouldUseFileHashing())
+        {
+            return;
+        }
+
+        // same checks as CanSkipProcessingFile: only files with a known hash and a different modtime get hashed there.
+        AZStd::vector<QString> filesToHash;
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            auto fileItr = m_fileModTimes.find(fileInfo.m_filePath.toUtf8().constData());
+            if (fileItr == m_fileModTimes.end() || fileItr->second == 0 ||
+                fileItr->second == aznumeric_cast<AZ::u64>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime)))
+            {
+                continue;
+            }
+
+            auto hashItr = m_fileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+            if (hashItr != m_fileHashes.end() && hashItr->second != 0)
+            {
+                filesToHash.push_back(fileInfo.m_filePath);
+            }
+        }
+
+        if (!filesToHash.empty())
+        {
+            AssetProcessor::StatsCapture::BeginCaptureStat("HashFilesWithChangedModTimes");
+            fileStateCache->HashFiles(filesToHash);
+            AssetProcessor::StatsCapture::EndCaptureStat("HashFilesWithChangedModTimes");
+        }
+    }
+
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
@@ -3749,6 +3798,25 @@ namespace AssetProcessor
         AssessFileInternal(filePath, true);
     }
 
+    void AssetProcessorManager::AssessFileChanges(FileChangeList changes)
+    {
+        for (const FileChange& change : changes)
+        {
+            switch (change.m_type)
+            {
+            case FileChange::Type::Added:
+                AssessAddedFile(change.m_filePath);
+                break;
+            case FileChange::Type::Modified:
+                AssessModifiedFile(change.m_filePath);
+                break;
+            case FileChange::Type::Removed:
+                AssessDeletedFile(change.m_filePath);
+                break;
+            }
+        }
+    }
+
     void AssetProcessorManager::ScheduleNextUpdate()
     {
         m_alreadyScheduledUpdate = false;
@@ -27,6 +27,7 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 
 #include "native/assetprocessor.h"
+#include "native/FileWatcher/FileWatcherBase.h"
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include "native/utilities/MissingDependencyScanner.h"
 #include "native/utilities/ThreadHelper.h"
@@ -328,6 +329,8 @@ namespace AssetProcessor
         virtual void AssessModifiedFile(QString filePath);
         virtual void AssessAddedFile(QString filePath);
         virtual void AssessDeletedFile(QString filePath);
+        //! Assesses a batch of coalesced changes from the file watcher, see FileWatcherBase::filesChanged.
+        void AssessFileChanges(FileChangeList changes);
         void OnAssetScannerStatusChange(AssetProcessor::AssetScanningStatus status);
         void FinishAssetScan();
         void OnJobStatusChanged(JobEntry jobEntry, JobStatus status);
@@ -453,6 +456,8 @@ namespace AssetProcessor
         void WarmUpFileCache(QSet<AssetFileInfo> filePaths);
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
+        // Hashes all the files that CanSkipProcessingFile has to hash, because their modtime changed since the last run, in parallel.
+        void HashFilesWithChangedModTimes(const QSet<AssetFileInfo>& filePaths);
 
         void CheckReadyToAssessScanFiles();
 
@@ -52,6 +52,18 @@ namespace AssetProcessor
         QMetaObject::invokeMethod(&m_assetScannerWorker, "StartScan", Qt::QueuedConnection);
     }
 
+    void AssetScanner::SetFileStateCache(FileStateBase* fileStateCache)
+    {
+        AZ_Assert(!m_workerCreated, "The file state cache must be set before the scan starts.");
+        m_assetScannerWorker.SetFileStateCache(fileStateCache);
+    }
+
+    void AssetScanner::SetScanJournalPath(QString journalFilePath)
+    {
+        AZ_Assert(!m_workerCreated, "The scan journal path must be set before the scan starts.");
+        m_assetScannerWorker.SetScanJournalPath(AZStd::move(journalFilePath));
+    }
+
     void AssetScanner::StopScan()
     {
         QMetaObject::invokeMethod(&m_assetScannerWorker, "StopScan", Qt::DirectConnection);
@@ -20,6 +20,7 @@
 namespace AssetProcessor
 {
     class PlatformConfiguration;
+    class FileStateBase;
 
     /** This Class is responsible for scanning for assets at startup
      */
@@ -36,6 +37,10 @@ namespace AssetProcessor
         void StartScan();//Should be called to start a scan
         void StopScan();//Should be called to stop a scan
 
+        //! These must be set before the first scan starts, see AssetScannerWorker.
+        void SetFileStateCache(FileStateBase* fileStateCache);
+        void SetScanJournalPath(QString journalFilePath);
+
         Q_INVOKABLE AssetScanningStatus status() const;
 
     Q_SIGNALS:
@@ -7,18 +7,230 @@
  */
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
+#include "native/AssetManager/FileStateCache.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include "native/utilities/StatsCapture.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <QDateTime>
 #include <QDir>
 #include <QtConcurrent/QtConcurrentFilter>
 
 using namespace AssetProcessor;
 
+namespace
+{
+    // Directory scanning is mostly waiting on the file system, so more threads than cores can still help,
+    // but past this point the file system itself becomes the bottleneck.
+    constexpr unsigned int MaxScanThreads = 16;
+
+    // Directories modified this close to the start of the scan are not recorded in the journal. A directory could be
+    // modified again within the resolution of the file system time stamps without its modification time changing.
+    constexpr qint64 JournalTimeStampResolutionMs = 2000;
+
+    // Idle threads wake up at least this often to notice that the scan was cancelled.
+    constexpr AZStd::chrono::milliseconds IdleWalkerCancelCheckInterval{ 10 };
+
+    // Runs a scan function over a tree of directories on a fixed set of threads.
+    // Every thread owns a queue of directories. It scans the most recently queued directory of its own queue, which keeps
+    // each thread working depth first in its own part of the tree, and steals the oldest directory from the queue of
+    // another thread when its own queue is empty. The oldest directories are usually the closest to the root and the
+    // largest subtrees, so a few steals are enough to spread the whole tree over all the threads.
+    // Threads that find every queue empty sleep until a directory is queued or the last directory has been scanned.
+    template<class DirectoryType>
+    class DirectoryWalker
+    {
+    public:
+        explicit DirectoryWalker(size_t threadCount)
+            : m_queues(AZStd::make_unique<WorkQueue[]>(threadCount))
+            , m_threadCount(threadCount)
+        {
+        }
+
+        size_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
+        void Queue(size_t threadIndex, DirectoryType&& directory)
+        {
+            m_pendingCount.fetch_add(1);
+            {
+                WorkQueue& queue = m_queues[threadIndex];
+                AZStd::scoped_lock lock(queue.m_mutex);
+                queue.m_directories.push_back(AZStd::move(directory));
+                m_queuedCount.fetch_add(1);
+            }
+            WakeIdleThreads(false);
+        }
+
+        // Calls scanFunction(threadIndex, directory) for every queued directory, including the directories queued while
+        // running, and returns once all of them have been scanned or keepScanning returns false.
+        template<class ScanFunction, class KeepScanningFunction>
+        void Run(const ScanFunction& scanFunction, const KeepScanningFunction& keepScanning)
+        {
+            auto threadMain = [this, &scanFunction, &keepScanning](size_t threadIndex)
+            {
+                DirectoryType directory;
+                while (keepScanning())
+                {
+                    if (Take(threadIndex, directory))
+                    {
+                        scanFunction(threadIndex, directory);
+                        if (m_pendingCount.fetch_sub(1) == 1)
+                        {
+                            // this was the last directory, release the idle threads so they can return.
+                            WakeIdleThreads(true);
+                        }
+                    }
+                    else if (m_pendingCount.load() == 0)
+                    {
+                        // every queue is empty and no thread is scanning a directory that could still queue more.
+                        return;
+                    }
+                    else
+                    {
+                        AZStd::unique_lock<AZStd::mutex> lock(m_idleMutex);
+                        m_idleCondition.wait_for(lock, IdleWalkerCancelCheckInterval,
+                            [this]()
+                            {
+                                return m_queuedCount.load() > 0 || m_pendingCount.load() == 0;
+                            });
+                    }
+                }
+            };
+
+            AZStd::vector<AZStd::thread> threads;
+            threads.reserve(m_threadCount - 1);
+            for (size_t threadIndex = 1; threadIndex < m_threadCount; ++threadIndex)
+            {
+                AZStd::thread_desc threadDesc;
+                threadDesc.m_name = "AssetScanner directory walker";
+                threads.emplace_back(threadDesc, [&threadMain, threadIndex]() { threadMain(threadIndex); });
+            }
+
+            // the calling thread takes part in the scan as the first thread.
+            threadMain(0);
+
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+    private:
+        struct WorkQueue
+        {
+            AZStd::mutex m_mutex;
+            AZStd::deque<DirectoryType> m_directories;
+        };
+
+        bool Take(size_t threadIndex, DirectoryType& directory)
+        {
+            {
+                WorkQueue& queue = m_queues[threadIndex];
+                AZStd::scoped_lock lock(queue.m_mutex);
+                if (!queue.m_directories.empty())
+                {
+                    directory = AZStd::move(queue.m_directories.back());
+                    queue.m_directories.pop_back();
+                    m_queuedCount.fetch_sub(1);
+                    return true;
+                }
+            }
+
+            for (size_t offset = 1; offset < m_threadCount; ++offset)
+            {
+                WorkQueue& queue = m_queues[(threadIndex + offset) % m_threadCount];
+                AZStd::scoped_lock lock(queue.m_mutex);
+                if (!queue.m_directories.empty())
+                {
+                    directory = AZStd::move(queue.m_directories.front());
+                    queue.m_directories.pop_front();
+                    m_queuedCount.fetch_sub(1);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void WakeIdleThreads(bool wakeAll)
+        {
+            // taking the lock orders this wake up after the predicate check of a thread that is about to wait.
+            {
+                AZStd::scoped_lock lock(m_idleMutex);
+            }
+            if (wakeAll)
+            {
+                m_idleCondition.notify_all();
+            }
+            else
+            {
+                m_idleCondition.notify_one();
+            }
+        }
+
+        AZStd::unique_ptr<WorkQueue[]> m_queues;
+        size_t m_threadCount;
+        // directories that are queued or being scanned.
+        AZStd::atomic<size_t> m_pendingCount{ 0 };
+        // directories that are queued and not taken by a thread yet, only changed while holding the lock of their queue.
+        AZStd::atomic<size_t> m_queuedCount{ 0 };
+        AZStd::mutex m_idleMutex;
+        AZStd::condition_variable m_idleCondition;
+    };
+} // namespace
+
+// Data that stays the same for every directory of a scan, computed once before the scan starts.
+struct AssetScannerWorker::ScanContext
+{
+    QString m_normalizedCachePath;
+    AZ::IO::Path m_cachePath;
+    QString m_normalizedIntermediateAssetsFolder;
+    qint64 m_journalCutoffTime = 0; // directories modified after this time are not recorded in the journal
+};
+
+// Results of the directories scanned by a single thread, merged once all threads are done.
+// The lists are kept per scan folder, so that a path found in several overlapping scan folders is merged in scan folder order
+// and the entry of the first scan folder wins, no matter which thread found it first.
+struct AssetScannerWorker::ScanResults
+{
+    struct ScanFolderLists
+    {
+        QSet<AssetFileInfo> m_fileList;
+        QSet<AssetFileInfo> m_folderList;
+        QSet<AssetFileInfo> m_excludedList;
+    };
+
+    AZStd::vector<ScanFolderLists> m_scanFolderLists; // indexed by scan folder index
+    AssetScanJournal m_journal;
+    AZ::s64 m_directoryCount = 0;
+    AZ::s64 m_unchangedDirectoryCount = 0;
+};
+
 AssetScannerWorker::AssetScannerWorker(PlatformConfiguration* config, QObject* parent)
     : QObject(parent)
     , m_platformConfiguration(config)
 {
 }
 
+void AssetScannerWorker::SetFileStateCache(FileStateBase* fileStateCache)
+{
+    m_fileStateCache = fileStateCache;
+}
+
+void AssetScannerWorker::SetScanJournalPath(QString journalFilePath)
+{
+    m_scanJournalPath = AZStd::move(journalFilePath);
+}
+
 void AssetScannerWorker::StartScan()
 {
     // this must be called from the thread operating it and not the main thread.
@@ -35,11 +247,7 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
-    {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
-    }
+    ScanForSourceFiles();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -50,12 +258,19 @@ void AssetScannerWorker::StartScan()
         m_fileList.clear();
         m_folderList.clear();
         m_excludedList.clear();
+        m_journal.Clear();
         
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
     else
     {
+        if (!m_scanJournalPath.isEmpty())
+        {
+            m_journal.Save(m_scanJournalPath);
+        }
+        m_journal.Clear();
+
         EmitFiles();
     }
 
@@ -72,113 +287,221 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles()
 {
-    if (!m_doScan)
+    ScanContext context;
+
+    QDir cacheDir;
+    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
+    context.m_normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
+    context.m_cachePath = context.m_normalizedCachePath.toUtf8().constData();
+
+    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(context.m_cachePath).c_str());
+    context.m_normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+    context.m_journalCutoffTime = QDateTime::currentMSecsSinceEpoch() - JournalTimeStampResolutionMs;
+
+    m_journal.Clear();
+    m_previousJournal.Clear();
+    if (!m_scanJournalPath.isEmpty())
     {
-        return;
+        m_previousJournal.Load(m_scanJournalPath);
     }
 
-    QFileInfoList entries;
+    StatsCapture::BeginCaptureStat("DirectoryScan");
 
-    QDir cacheDir;
-    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
-    QString normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
-    AZ::IO::Path cachePath(normalizedCachePath.toUtf8().constData());
+    const size_t threadCount = AZStd::clamp(AZStd::thread::hardware_concurrency(), 1u, MaxScanThreads);
+    DirectoryWalker<DirectoryToScan> walker(threadCount);
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    AZStd::vector<ScanResults> threadResults(threadCount);
+    for (ScanResults& results : threadResults)
+    {
+        results.m_scanFolderLists.resize(scanFolderCount);
+    }
 
-    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(cachePath).c_str());
-    QString normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+    // spread the scan folders over the threads up front, the threads steal from each other from there.
+    for (int idx = 0; idx < scanFolderCount; idx++)
+    {
+        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+        walker.Queue(idx % threadCount, DirectoryToScan{ scanFolderInfo.ScanPath(), &scanFolderInfo, idx });
+    }
 
-    // Implemented non-recursively so that the above functions only have to be called once per scan,
-    // and so that the performance is easy to analyze in a profiler:
-    QList<ScanFolderInfo> pathsToScanQueue;
-    pathsToScanQueue.push_back(scanFolderInfo);
+    walker.Run(
+        [this, &context, &walker, &threadResults](size_t threadIndex, const DirectoryToScan& directory)
+        {
+            ScanDirectory(context, directory, threadResults[threadIndex],
+                [&walker, threadIndex](DirectoryToScan&& subDirectory)
+                {
+                    walker.Queue(threadIndex, AZStd::move(subDirectory));
+                });
+        },
+        [this]()
+        {
+            return m_doScan;
+        });
 
-    while (!pathsToScanQueue.empty())
+    // QSet::unite keeps the entry that is already in the set, so merging in scan folder order lets the first scan folder win.
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
-        ScanFolderInfo pathToScan = pathsToScanQueue.back();
-        pathsToScanQueue.pop_back();
-        QDir dir(pathToScan.ScanPath());
-        dir.setSorting(QDir::Unsorted);
-        // Only scan sub folders if recurseSubFolders flag is set
-        if (!scanFolderInfo.RecurseSubFolders())
+        for (ScanResults& results : threadResults)
         {
-            entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+            ScanResults::ScanFolderLists& lists = results.m_scanFolderLists[idx];
+            m_fileList.unite(lists.m_fileList);
+            m_folderList.unite(lists.m_folderList);
+            m_excludedList.unite(lists.m_excludedList);
         }
-        else
+    }
+
+    AZ::s64 directoryCount = 0;
+    AZ::s64 unchangedDirectoryCount = 0;
+    for (ScanResults& results : threadResults)
+    {
+        m_journal.Merge(AZStd::move(results.m_journal));
+        directoryCount += results.m_directoryCount;
+        unchangedDirectoryCount += results.m_unchangedDirectoryCount;
+    }
+    m_previousJournal.Clear();
+
+    StatsCapture::EndCaptureStat("DirectoryScan");
+    StatsCapture::AddStatItemCount("DirectoryScan", m_fileList.size() + m_folderList.size() + m_excludedList.size());
+
+    AZ_TracePrintf(AssetProcessor::DebugChannel, "Scanned %lld directories on %zu threads, %lld did not change since the last scan.\n",
+        static_cast<long long>(directoryCount), threadCount, static_cast<long long>(unchangedDirectoryCount));
+}
+
+void AssetScannerWorker::ScanDirectory(
+    const ScanContext& context, const DirectoryToScan& directory, ScanResults& results, const QueueDirectoryFunction& queueDirectory)
+{
+    const ScanFolderInfo& rootScanFolder = *directory.m_rootScanFolder;
+    ScanResults::ScanFolderLists& lists = results.m_scanFolderLists[directory.m_scanFolderIndex];
+    ++results.m_directoryCount;
+
+    QFileInfo directoryInfo(directory.m_absolutePath);
+    AssetScanJournal::DirectoryEntry journalEntry;
+    journalEntry.m_state = AssetScanJournal::GetDirectoryState(directoryInfo);
+
+    // Directories and files are both listed even if the scan folder isn't recursive, so that the journal entry is
+    // the same no matter which scan folder the directory was found in.
+    QFileInfoList entries;
+    if (const AssetScanJournal::DirectoryEntry* unchangedEntry = m_previousJournal.FindUnchanged(directory.m_absolutePath, journalEntry.m_state))
+    {
+        // No entries were added, removed or renamed, but the files may still have been modified so query their current state.
+        ++results.m_unchangedDirectoryCount;
+        journalEntry.m_subDirectories = unchangedEntry->m_subDirectories;
+        journalEntry.m_files = unchangedEntry->m_files;
+
+        entries.reserve(journalEntry.m_subDirectories.size() + journalEntry.m_files.size());
+        for (const QString& subDirectoryName : journalEntry.m_subDirectories)
         {
-            entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+            entries.push_back(QFileInfo(directory.m_absolutePath + '/' + subDirectoryName));
         }
+        for (const QString& fileName : journalEntry.m_files)
+        {
+            entries.push_back(QFileInfo(directory.m_absolutePath + '/' + fileName));
+        }
+    }
+    else
+    {
+        QDir dir(directory.m_absolutePath);
+        dir.setSorting(QDir::Unsorted);
+        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
 
         for (const QFileInfo& entry : entries)
         {
-            if (!m_doScan) // scan was cancelled!
+            if (entry.isDir())
+            {
+                journalEntry.m_subDirectories.push_back(entry.fileName());
+            }
+            else
             {
-                return;
+                journalEntry.m_files.push_back(entry.fileName());
             }
+        }
+    }
 
-            QString absPath = entry.absoluteFilePath();
-            const bool isDirectory = entry.isDir();
-            QDateTime modTime = entry.lastModified();
-            AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-            AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
-            QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
+    if (directoryInfo.exists() && journalEntry.m_state.m_modTime < context.m_journalCutoffTime)
+    {
+        results.m_journal.AddDirectory(directory.m_absolutePath, AZStd::move(journalEntry));
+    }
 
-            if (isDirectory)
-            {
-                // in debug, assert that the paths coming from qt directory info iteration is already normalized
-                // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
-                Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
-                // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
+    for (const QFileInfo& entry : entries)
+    {
+        if (!m_doScan) // scan was cancelled!
+        {
+            return;
+        }
 
-                // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
+        const bool isDirectory = entry.isDir();
+        if (isDirectory && !rootScanFolder.RecurseSubFolders())
+        {
+            // Only scan sub folders if recurseSubFolders flag is set
+            continue;
+        }
 
-                if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
-                    continue;
-                }
+        QString absPath = entry.absoluteFilePath();
+        QDateTime modTime = entry.lastModified();
+        if (!modTime.isValid())
+        {
+            // the entry came from the journal and has been deleted since the directory was checked.
+            continue;
+        }
+
+        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
+        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
 
-                // Entry is a directory
-                // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+        if (isDirectory)
+        {
+            // in debug, assert that the paths coming from qt directory info iteration is already normalized
+            // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
+            Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
+            // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
+
+            // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
+
+            if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
+            {
+                lists.m_excludedList.insert(AZStd::move(assetFileInfo));
+                continue;
+            }
 
-                // recurse into this folder.
-                // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
+            // Entry is a directory
+            // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
+            lists.m_folderList.insert(AZStd::move(assetFileInfo));
 
-                if (absPath.startsWith(normalizedCachePath))
+            // recurse into this folder.
+            // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
+
+            if (absPath.startsWith(context.m_normalizedCachePath))
+            {
+                // its in the cache.  Is it the cache itself?
+                if (absPath.length() != context.m_normalizedCachePath.length())
                 {
-                    // its in the cache.  Is it the cache itself?
-                    if (absPath.length() != normalizedCachePath.length())
+                    // no.  Is it in the intermediateassets?
+                    if (!absPath.startsWith(context.m_normalizedIntermediateAssetsFolder))
                     {
-                        // no.  Is it in the intermediateassets?
-                        if (!absPath.startsWith(normalizedIntermediateAssetsFolder))
-                        {
-                            // Its not something in the intermediate assets folder, nor is it the cache itself,
-                            // so it is just a file somewhere in the cache.
-                            continue; // do not recurse.
-                        }
+                        // Its not something in the intermediate assets folder, nor is it the cache itself,
+                        // so it is just a file somewhere in the cache.
+                        continue; // do not recurse.
                     }
                 }
-                // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
-                ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-                pathsToScanQueue.push_back(tempScanFolderInfo);
             }
-            else
-            {
-                // Entry is a file
-                Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
+            // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
+            queueDirectory(DirectoryToScan{ absPath, &rootScanFolder, directory.m_scanFolderIndex });
+        }
+        else
+        {
+            // Entry is a file
+            Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
 
-                if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), cachePath)) // Ignore files in the cache
+            if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), context.m_cachePath)) // Ignore files in the cache
+            {
+                if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                    {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
-                    }
-                    else
-                    {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
-                    }
+                    lists.m_fileList.insert(AZStd::move(assetFileInfo));
+                }
+                else
+                {
+                    lists.m_excludedList.insert(AZStd::move(assetFileInfo));
                 }
             }
         }
@@ -187,6 +510,14 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
 
 void AssetScannerWorker::EmitFiles()
 {
+    // fill in the file state cache from this thread, so it is already up to date when the found files are processed.
+    if (m_fileStateCache)
+    {
+        m_fileStateCache->AddInfoSet(m_fileList);
+        m_fileStateCache->AddInfoSet(m_folderList);
+        m_fileStateCache->AddInfoSet(m_excludedList);
+    }
+
     Q_EMIT FilesFound(m_fileList);
     m_fileList.clear();
     Q_EMIT FoldersFound(m_folderList);
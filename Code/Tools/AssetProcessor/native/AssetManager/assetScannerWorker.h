@@ -11,6 +11,8 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include "AssetScanJournal.h"
+#include <AzCore/std/functional.h>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -19,11 +21,14 @@
 namespace AssetProcessor
 {
     class PlatformConfiguration;
+    class FileStateBase;
 
     /** This Class is actually responsible for scanning the game folder
      * and finding file of interest files.
      * Its created on the main thread and then moved to the worker thread
      * so it should contain no QObject-based classes at construction time (it can make them later)
+     * The directories of all scan folders are scanned in parallel on a set of threads owned by the scan,
+     * and the results are only emitted once every directory has been scanned.
      */
     class AssetScannerWorker
         : public QObject
@@ -32,6 +37,12 @@ namespace AssetProcessor
     public:
         explicit AssetScannerWorker(PlatformConfiguration* config, QObject* parent = 0);
 
+        //! The file state cache is filled in by the scan before the found files are emitted.
+        void SetFileStateCache(FileStateBase* fileStateCache);
+        //! The scan journal is loaded from and saved to this file, so that directories which did not change
+        //! since the last scan don't have to be enumerated again. Without a journal file every directory is enumerated.
+        void SetScanJournalPath(QString journalFilePath);
+
 Q_SIGNALS:
         void ScanningStateChanged(AssetProcessor::AssetScanningStatus status);
         void FilesFound(QSet<AssetFileInfo> files); // QSet<QString> is a refcounted copy-on-write object, do not pass by ref.
@@ -43,9 +54,21 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        struct ScanContext;
+        struct ScanResults;
+
+        struct DirectoryToScan
+        {
+            QString m_absolutePath;
+            const ScanFolderInfo* m_rootScanFolder = nullptr; // the actual scan folder this directory was found in
+            int m_scanFolderIndex = 0; // index of m_rootScanFolder in the platform configuration
+        };
+        using QueueDirectoryFunction = AZStd::function<void(DirectoryToScan&&)>;
+
+        // Scans the directories of all scan folders and collects the results in the file, folder and excluded lists.
+        void ScanForSourceFiles();
+        // Scans a single directory, queueing its sub directories to be scanned as well when the scan folder is recursive.
+        void ScanDirectory(const ScanContext& context, const DirectoryToScan& directory, ScanResults& results, const QueueDirectoryFunction& queueDirectory);
         void EmitFiles();
 
     private:
@@ -55,6 +78,11 @@ Q_SIGNALS:
         QSet<AssetFileInfo> m_excludedList;
 
         PlatformConfiguration* m_platformConfiguration;
+        FileStateBase* m_fileStateCache = nullptr;
+
+        QString m_scanJournalPath;
+        AssetScanJournal m_previousJournal; // only read from while scanning, so the scanning threads don't need to lock it
+        AssetScanJournal m_journal;
     };
 } // end namespace AssetProcessor
 
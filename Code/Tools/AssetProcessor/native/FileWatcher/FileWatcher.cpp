@@ -69,9 +69,9 @@ static bool IsSubfolder(const QString& folderA, const QString& folderB)
 FileWatcher::FileWatcher()
     : m_platformImpl(AZStd::make_unique<PlatformImplementation>())
 {
-    auto makeFilter = [this](auto signal)
+    auto makeFilter = [this](auto signal, FileChange::Type changeType)
     {
-        return [this, signal](QString path)
+        return [this, signal, changeType](QString path)
         {
             const auto foundWatchRoot = AZStd::find_if(begin(m_folderWatchRoots), end(m_folderWatchRoots), [path](const WatchRoot& watchRoot)
             {
@@ -88,15 +88,19 @@ FileWatcher::FileWatcher()
             }
 
             AZStd::invoke(signal, this, path);
+            QueueChange(path, changeType);
         };
     };
 
     // The rawFileAdded signals are emitted by the watcher thread. Use a queued
     // connection so that the consumers of the notification process the
     // notification on the main thread.
-    connect(this, &FileWatcherBase::rawFileAdded, this, makeFilter(&FileWatcherBase::fileAdded), Qt::QueuedConnection);
-    connect(this, &FileWatcherBase::rawFileRemoved, this, makeFilter(&FileWatcherBase::fileRemoved), Qt::QueuedConnection);
-    connect(this, &FileWatcherBase::rawFileModified, this, makeFilter(&FileWatcherBase::fileModified), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileAdded, this, makeFilter(&FileWatcherBase::fileAdded, FileChange::Type::Added), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileRemoved, this, makeFilter(&FileWatcherBase::fileRemoved, FileChange::Type::Removed), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileModified, this, makeFilter(&FileWatcherBase::fileModified, FileChange::Type::Modified), Qt::QueuedConnection);
+
+    m_coalesceTimer.setSingleShot(true);
+    connect(&m_coalesceTimer, &QTimer::timeout, this, &FileWatcher::EmitQueuedChanges);
 }
 
 FileWatcher::~FileWatcher()
@@ -194,9 +198,52 @@ void FileWatcher::StopWatching()
     // way before it is safe to join.
     PlatformStop(); 
 
+    m_coalesceTimer.stop();
+    m_queuedChanges.clear();
+    m_queuedChangeIndices.clear();
+
     m_startedWatching = false;
 }
 
+void FileWatcher::QueueChange(const QString& path, FileChange::Type type)
+{
+    auto found = m_queuedChangeIndices.find(path);
+    if (found == m_queuedChangeIndices.end())
+    {
+        m_queuedChangeIndices.insert(path, m_queuedChanges.size());
+        m_queuedChanges.push_back({ path, type });
+    }
+    else
+    {
+        // fold the new change into the queued one. Only an add followed by modifies keeps the earlier type,
+        // in every other case the latest change wins (a remove followed by an add is the file being replaced, so an add).
+        FileChange& queuedChange = m_queuedChanges[found.value()];
+        if (queuedChange.m_type != FileChange::Type::Added || type != FileChange::Type::Modified)
+        {
+            queuedChange.m_type = type;
+        }
+    }
+
+    // the window starts with the first change and is not extended by later ones, so a steady stream of changes
+    // still gets delivered at a regular interval.
+    if (!m_coalesceTimer.isActive())
+    {
+        m_coalesceTimer.start(CoalesceWindowMs);
+    }
+}
+
+void FileWatcher::EmitQueuedChanges()
+{
+    FileChangeList changes;
+    changes.swap(m_queuedChanges);
+    m_queuedChangeIndices.clear();
+
+    if (!changes.isEmpty())
+    {
+        Q_EMIT filesChanged(changes);
+    }
+}
+
 bool FileWatcher::Filter(QString path, const WatchRoot& watchRoot)
 {
     if (!IsSubfolder(path, watchRoot.m_directory))
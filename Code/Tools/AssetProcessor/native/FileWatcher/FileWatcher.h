@@ -15,10 +15,14 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
+#include <QHash>
 #include <QString>
 #include <QObject>
+#include <QTimer>
 #endif
 
+class FileWatcherPlatformUnitTest;
+
 //////////////////////////////////////////////////////////////////////////
 //! FileWatcher
 /*! Class that handles creation and deletion of FolderRootWatches based on
@@ -50,13 +54,20 @@ public:
 
     void InstallDefaultExclusionRules(QString cacheRootPath, QString projectRootPath) override;
 
+    //! How long changes are collected before filesChanged is emitted, counted from the first change of the window.
+    static constexpr int CoalesceWindowMs = 100;
+
 private:
+    void QueueChange(const QString& path, FileChange::Type type);
+    void EmitQueuedChanges();
+
     bool PlatformStart();
     void PlatformStop();
     void WatchFolderLoop();
 
     class PlatformImplementation;
     friend class PlatformImplementation;
+    friend class ::FileWatcherPlatformUnitTest;
     struct WatchRoot
     {
         QString m_directory;
@@ -67,6 +78,13 @@ private:
     AZStd::unique_ptr<PlatformImplementation> m_platformImpl;
     AZStd::vector<WatchRoot> m_folderWatchRoots;
     AZStd::vector<AssetBuilderSDK::FilePatternMatcher> m_excludes;
+
+    // changes waiting for filesChanged to be emitted, with the index of each path in m_queuedChanges.
+    // These are only accessed on the thread this object lives on.
+    FileChangeList m_queuedChanges;
+    QHash<QString, int> m_queuedChangeIndices;
+    QTimer m_coalesceTimer;
+
     AZStd::thread m_thread;
     bool m_startedWatching = false;
     AZStd::atomic_bool m_shutdownThreadSignal = false;
@@ -9,8 +9,10 @@
 #pragma once
 
 #if !defined(Q_MOC_RUN)
+#include <QMetaType>
 #include <QObject>
 #include <QString>
+#include <QVector>
 #endif
 
 namespace AssetBuilderSDK
@@ -18,6 +20,22 @@ namespace AssetBuilderSDK
     class FilePatternMatcher;
 }
 
+//! A change to a single file or folder, as reported by FileWatcherBase::filesChanged.
+struct FileChange
+{
+    enum class Type
+    {
+        Added,
+        Modified,
+        Removed
+    };
+
+    QString m_filePath;
+    Type m_type = Type::Modified;
+};
+using FileChangeList = QVector<FileChange>;
+Q_DECLARE_METATYPE(FileChangeList)
+
 //////////////////////////////////////////////////////////////////////////
 //! FileWatcherBase
 /*! Base class that handles creation and deletion of FolderRootWatches.
@@ -73,6 +91,12 @@ Q_SIGNALS:
     void fileRemoved(QString filePath);
     void fileModified(QString filePath);
 
+    //! Emitted with the same changes as the signals above, collected over a short window and folded into one change per file:
+    //! an add followed by modifies is a single add, and anything followed by a remove is a single remove.
+    //! Consumers that only care about the latest state of each file should use this, so that an event storm (such as
+    //! checking out a large branch) costs them one call per window instead of several calls per file.
+    void filesChanged(FileChangeList changes);
+
     // These signals are emitted by the platform implementations when files
     // change. Some platforms' file watch APIs do not support non-recursive
     // watches, so the signals are filtered before being forwarded to the
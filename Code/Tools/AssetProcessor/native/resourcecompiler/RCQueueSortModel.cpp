@@ -27,12 +27,18 @@ namespace AssetProcessor
             m_sourceModel = target;
 
             setSourceModel(target);
+            m_rowsInsertedConnection = QObject::connect(target, &QAbstractItemModel::rowsInserted, this, [this]()
+            {
+                m_criticalPathsDirty = true;
+            });
             setSortRole(RCJobListModel::jobIndexRole);
             sort(0);
         }
         else
         {
             BusDisconnect();
+            QObject::disconnect(m_rowsInsertedConnection);
+            m_criticalPathDurations.clear();
             setSourceModel(nullptr);
             m_sourceModel = nullptr;
         }
@@ -40,6 +46,12 @@ namespace AssetProcessor
 
     RCJob* RCQueueSortModel::GetNextPendingJob()
     {
+        if (m_criticalPathsDirty &&
+            (!m_criticalPathUpdateTimer.isValid() || m_criticalPathUpdateTimer.elapsed() >= CriticalPathUpdateIntervalMs))
+        {
+            UpdateCriticalPathDurations();
+        }
+
         if (m_dirtyNeedsResort)
         {
             setDynamicSortFilter(false);
@@ -273,6 +285,15 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        // start the jobs that the most remaining work waits on first, shorter jobs fill in the gaps around them.
+        AZ::s64 criticalPathLeft = GetCriticalPathDuration(leftJob->GetElementID());
+        AZ::s64 criticalPathRight = GetCriticalPathDuration(rightJob->GetElementID());
+
+        if (criticalPathLeft != criticalPathRight)
+        {
+            return criticalPathLeft > criticalPathRight;
+        }
+
         if (leftJob->GetJobEntry().m_sourceAssetReference == rightJob->GetJobEntry().m_sourceAssetReference)
         {
             // If there are two jobs for the same source, then sort by job run key.
@@ -318,6 +339,121 @@ namespace AssetProcessor
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
     }
 
+    void RCQueueSortModel::SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs)
+    {
+        durationMs = AZStd::max<AZ::s64>(durationMs, 1);
+        auto [iter, inserted] = m_expectedJobDurations.emplace(elementId, durationMs);
+        if (!inserted)
+        {
+            m_totalExpectedJobDuration -= iter->second;
+            iter->second = durationMs;
+        }
+        m_totalExpectedJobDuration += durationMs;
+        m_criticalPathsDirty = true;
+    }
+
+    AZ::s64 RCQueueSortModel::GetExpectedJobDuration(const QueueElementID& elementId) const
+    {
+        auto found = m_expectedJobDurations.find(elementId);
+        if (found != m_expectedJobDurations.end())
+        {
+            return found->second;
+        }
+
+        // jobs that never ran before are assumed to take as long as an average job.
+        // Without any history at all every job costs the same, which still favors the jobs at the start of long dependency chains.
+        return m_expectedJobDurations.empty() ? 1 : AZStd::max<AZ::s64>(m_totalExpectedJobDuration / aznumeric_cast<AZ::s64>(m_expectedJobDurations.size()), 1);
+    }
+
+    AZ::s64 RCQueueSortModel::GetCriticalPathDuration(const QueueElementID& elementId) const
+    {
+        auto found = m_criticalPathDurations.find(elementId);
+        return found != m_criticalPathDurations.end() ? found->second : GetExpectedJobDuration(elementId);
+    }
+
+    void RCQueueSortModel::UpdateCriticalPathDurations()
+    {
+        m_criticalPathsDirty = false;
+        m_criticalPathUpdateTimer.start();
+        m_criticalPathDurations.clear();
+
+        if (!m_sourceModel)
+        {
+            return;
+        }
+
+        // collect the pending jobs and, for each of them, the pending jobs that have to wait until it is done.
+        AZStd::vector<QueueElementID> pendingJobs;
+        AZStd::unordered_map<QueueElementID, AZStd::vector<QueueElementID>> dependentJobs;
+        for (int idx = 0; idx < m_sourceModel->itemCount(); ++idx)
+        {
+            RCJob* job = m_sourceModel->getItem(idx);
+            if (!job || job->GetState() != RCJob::pending)
+            {
+                continue;
+            }
+
+            pendingJobs.push_back(job->GetElementID());
+            for (const JobDependencyInternal& jobDependencyInternal : job->GetJobDependencies())
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+                if (jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                    jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                    jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+                {
+                    QueueElementID dependencyId(
+                        SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                        jobDependency.m_platformIdentifier.c_str(),
+                        jobDependency.m_jobKey.c_str());
+                    dependentJobs[dependencyId].push_back(job->GetElementID());
+                }
+            }
+        }
+
+        AZStd::unordered_map<QueueElementID, bool> visiting;
+        for (const QueueElementID& elementId : pendingJobs)
+        {
+            ComputeCriticalPathDuration(elementId, dependentJobs, visiting);
+        }
+
+        m_dirtyNeedsResort = true;
+    }
+
+    AZ::s64 RCQueueSortModel::ComputeCriticalPathDuration(
+        const QueueElementID& elementId,
+        const AZStd::unordered_map<QueueElementID, AZStd::vector<QueueElementID>>& dependentJobs,
+        AZStd::unordered_map<QueueElementID, bool>& visiting)
+    {
+        auto computed = m_criticalPathDurations.find(elementId);
+        if (computed != m_criticalPathDurations.end())
+        {
+            return computed->second;
+        }
+
+        // a job that is already being visited is part of a cyclic dependency, stop following the cycle here.
+        bool& isVisiting = visiting[elementId];
+        if (isVisiting)
+        {
+            return 0;
+        }
+        isVisiting = true;
+
+        AZ::s64 longestDependentPath = 0;
+        auto dependents = dependentJobs.find(elementId);
+        if (dependents != dependentJobs.end())
+        {
+            for (const QueueElementID& dependentId : dependents->second)
+            {
+                longestDependentPath = AZStd::max(longestDependentPath, ComputeCriticalPathDuration(dependentId, dependentJobs, visiting));
+            }
+        }
+
+        AZ::s64 criticalPathDuration = GetExpectedJobDuration(elementId) + longestDependentPath;
+        m_criticalPathDurations[elementId] = criticalPathDuration;
+        visiting[elementId] = false;
+        return criticalPathDuration;
+    }
+
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
     {
         for (const auto& jobIdEscalationPair : jobIdEscalationList)
@@ -9,6 +9,7 @@
 #define ASSETPROCESSOR_RCQUEUESORTMODEL_H
 
 #if !defined(Q_MOC_RUN)
+#include <QElapsedTimer>
 #include <QSortFilterProxyModel>
 #include <QSet>
 #include <QString>
@@ -17,6 +18,7 @@
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
+#include "native/resourcecompiler/RCCommon.h"
 #endif
 
 class RCcontrollerUnitTests;
@@ -34,7 +36,10 @@ namespace AssetProcessor
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
+    //!  * Jobs with the same priority, longest critical path first
     //!  (The same, repeated, for unconnected platforms).
+    //! The critical path of a job is its expected duration plus the longest critical path of the queued jobs that have an
+    //! order dependency on it, so jobs that hold up long chains of work start first and short jobs fill the remaining slots.
     class RCQueueSortModel
         : public QSortFilterProxyModel
         , protected AssetProcessorPlatformBus::Handler
@@ -50,6 +55,13 @@ namespace AssetProcessor
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
 
+        //! Sets the duration a job is expected to take, usually the duration of its last run.
+        void SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs);
+        //! Returns the expected duration of the job, or the average of all known durations if the job never ran before.
+        AZ::s64 GetExpectedJobDuration(const QueueElementID& elementId) const;
+        //! Returns the expected time from the start of the job until all queued jobs waiting on it are done.
+        AZ::s64 GetCriticalPathDuration(const QueueElementID& elementId) const;
+
         // implement QSortFilteRProxyModel:
         bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
         bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
@@ -67,6 +79,22 @@ namespace AssetProcessor
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
+        //! Computes the critical path of every pending job, see GetCriticalPathDuration.
+        void UpdateCriticalPathDurations();
+        AZ::s64 ComputeCriticalPathDuration(
+            const QueueElementID& elementId,
+            const AZStd::unordered_map<QueueElementID, AZStd::vector<QueueElementID>>& dependentJobs,
+            AZStd::unordered_map<QueueElementID, bool>& visiting);
+
+        // the critical paths are only recomputed when jobs were added, and at most once per interval, since it visits every pending job.
+        static constexpr qint64 CriticalPathUpdateIntervalMs = 1000;
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_expectedJobDurations;
+        AZ::s64 m_totalExpectedJobDuration = 0;
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_criticalPathDurations;
+        bool m_criticalPathsDirty = false;
+        QElapsedTimer m_criticalPathUpdateTimer;
+        QMetaObject::Connection m_rowsInsertedConnection;
+
         // ---------------------------------------------------------
         // AssetProcessorPlatformBus::Handler
         void AssetProcessorPlatformConnected(const AZStd::string platform) override;
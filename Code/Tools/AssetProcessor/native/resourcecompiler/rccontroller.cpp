@@ -8,6 +8,10 @@
 
 #include "rccontroller.h"
 #include <native/resourcecompiler/RCCommon.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+#include <native/utilities/BuilderManager.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <QTimer>
 #include <QThreadPool>
 
@@ -62,6 +66,17 @@ namespace AssetProcessor
     void RCController::StartJob(RCJob* rcJob)
     {
         Q_ASSERT(rcJob);
+
+        if (!m_makespanTimer.isValid())
+        {
+            m_makespanTimer.start();
+        }
+        // the predicted makespan is bound by the longest chain of dependent jobs and by the total work spread over all job slots.
+        // jobs are started at different times, so the critical path of each job is counted from the time it starts.
+        ++m_makespanJobCount;
+        m_predictedTotalJobDuration += m_RCQueueSortModel.GetExpectedJobDuration(rcJob->GetElementID());
+        m_predictedCriticalPathDuration = AZStd::max<AZ::s64>(
+            m_predictedCriticalPathDuration, m_makespanTimer.elapsed() + m_RCQueueSortModel.GetCriticalPathDuration(rcJob->GetElementID()));
         // request to be notified when job is done
         QObject::connect(rcJob, &RCJob::Finished, this, [this, rcJob]()
         {
@@ -156,6 +171,7 @@ namespace AssetProcessor
             // if there is no next job, and nothing is in flight, we are done.
             if (IsIdle())
             {
+                ReportMakespan();
                 Q_EMIT BecameIdle();
             }
         }
@@ -166,6 +182,63 @@ namespace AssetProcessor
         return ((!m_RCQueueSortModel.GetNextPendingJob()) && (m_RCJobListModel.jobsInFlight() == 0));
     }
 
+    void RCController::ReportMakespan()
+    {
+        if (!m_makespanTimer.isValid())
+        {
+            return;
+        }
+
+        AZ::s64 predictedMakespan = AZStd::max<AZ::s64>(m_predictedCriticalPathDuration, m_predictedTotalJobDuration / AZStd::max(m_maxJobs, 1u));
+        AZ_TracePrintf(
+            AssetProcessor::ConsoleChannel,
+            "Processed %d jobs in %lld ms, %lld ms were predicted from previous runs (critical path %lld ms, %lld ms of work on %u job slots).\n",
+            m_makespanJobCount,
+            static_cast<long long>(m_makespanTimer.elapsed()),
+            static_cast<long long>(predictedMakespan),
+            static_cast<long long>(m_predictedCriticalPathDuration),
+            static_cast<long long>(m_predictedTotalJobDuration),
+            m_maxJobs);
+
+        m_makespanTimer.invalidate();
+        m_makespanJobCount = 0;
+        m_predictedTotalJobDuration = 0;
+        m_predictedCriticalPathDuration = 0;
+    }
+
+    void RCController::PopulateJobDurationsFromDatabase()
+    {
+        AZStd::string databaseLocation;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(&AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
+        if (databaseLocation.empty())
+        {
+            return;
+        }
+
+        AssetProcessor::AssetDatabaseConnection assetDatabaseConnection;
+        assetDatabaseConnection.OpenDatabase();
+
+        // the stat names are "ProcessJob,<scan folder>,<relative source path>,<job key>,<platform>,<builder guid>", see AssetProcessorManager.
+        assetDatabaseConnection.QueryStatLikeStatName("ProcessJob,%", [this](AzToolsFramework::AssetDatabase::StatDatabaseEntry entry)
+        {
+            static constexpr int numTokensExpected = 6;
+            AZStd::vector<AZStd::string> tokens;
+            AZ::StringFunc::Tokenize(entry.m_statName, tokens, ',');
+            if (tokens.size() == numTokensExpected)
+            {
+                QueueElementID elementId(SourceAssetReference(tokens[1].c_str(), tokens[2].c_str()), tokens[4].c_str(), tokens[3].c_str());
+                m_RCQueueSortModel.SetExpectedJobDuration(elementId, entry.m_statValue);
+            }
+            return true;
+        });
+    }
+
+    void RCController::OnJobProcessDurationChanged(JobEntry jobEntry, int durationMs)
+    {
+        QueueElementID elementId(jobEntry.m_sourceAssetReference, jobEntry.m_platformInfo.m_identifier.c_str(), jobEntry.m_jobKey);
+        m_RCQueueSortModel.SetExpectedJobDuration(elementId, durationMs);
+    }
+
     void RCController::JobSubmitted(JobDetails details)
     {
         AssetProcessor::QueueElementID checkFile(details.m_jobEntry.m_sourceAssetReference,
@@ -331,6 +404,16 @@ namespace AssetProcessor
     void RCController::DispatchJobsImpl()
     {
         m_dispatchJobsQueued = false;
+
+        // Have builders started for the jobs in the queue ahead of time, including while dispatching is paused during the
+        // initial scan, so that jobs don't wait for builders to load all the gems once they are dispatched.
+        const AZ::u32 desiredBuilderCount = AZStd::min(m_maxJobs, aznumeric_cast<unsigned int>(m_RCJobListModel.itemCount()));
+        if (desiredBuilderCount != m_desiredBuilderCount)
+        {
+            m_desiredBuilderCount = desiredBuilderCount;
+            BuilderManagerBus::Broadcast(&BuilderManagerBusTraits::SetDesiredBuilderCount, desiredBuilderCount);
+        }
+
         if (!m_dispatchingJobs)
         {
             m_dispatchingJobs = true;
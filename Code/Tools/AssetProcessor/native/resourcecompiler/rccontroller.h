@@ -11,6 +11,7 @@
 #if !defined(Q_MOC_RUN)
 #include "RCCommon.h"
 
+#include <QElapsedTimer>
 #include <QObject>
 #include <QProcess>
 #include <QDir>
@@ -57,6 +58,9 @@ namespace AssetProcessor
         int NumberOfPendingJobsPerPlatform(QString platform);
         bool IsIdle();
 
+        //! Loads the durations of previous job runs from the asset database, used to find the critical path of the queued jobs.
+        void PopulateJobDurationsFromDatabase();
+
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -104,14 +108,19 @@ namespace AssetProcessor
         // its completely done.
         void OnJobComplete(JobEntry completeEntry, AzToolsFramework::AssetSystem::JobStatus status);
         void OnAddedToCatalog(JobEntry jobEntry);
+        void OnJobProcessDurationChanged(JobEntry jobEntry, int durationMs);
 
     protected:
         AssetProcessor::RCQueueSortModel m_RCQueueSortModel;
 
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
+        //! Prints how long it took to process all the jobs started since the controller was last idle, and how long it was expected to take.
+        void ReportMakespan();
 
         unsigned int m_maxJobs;
+        //! Number of builders the BuilderManager was last asked to keep running.
+        AZ::u32 m_desiredBuilderCount = 0;
 
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
@@ -134,6 +143,12 @@ namespace AssetProcessor
 
         QList<AssetCompileGroup> m_activeCompileGroups;
 
+        // makespan tracking, from the first job started after being idle until becoming idle again.
+        QElapsedTimer m_makespanTimer;
+        int m_makespanJobCount = 0;
+        AZ::s64 m_predictedTotalJobDuration = 0;
+        AZ::s64 m_predictedCriticalPathDuration = 0;
+
     };
 } // namespace AssetProcessor
 
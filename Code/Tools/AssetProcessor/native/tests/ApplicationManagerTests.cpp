@@ -9,6 +9,7 @@
 #include "ApplicationManagerTests.h"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <tests/assetmanager/MockAssetProcessorManager.h>
 #include <tests/assetmanager/MockFileProcessor.h>
 #include <AzToolsFramework/Archive/ArchiveComponent.h>
@@ -87,8 +88,11 @@ namespace UnitTests
     {
         AZ::IO::Path assetRootDir(m_databaseLocationListener.GetAssetRootDir());
 
+        // the AssetProcessorManager gets the coalesced batches, the file processor the individual changes.
+        Q_EMIT m_fileWatcher->filesChanged({ { (assetRootDir / "test").c_str(), FileChange::Type::Added },
+                                             { (assetRootDir / "test2").c_str(), FileChange::Type::Modified },
+                                             { (assetRootDir / "test3").c_str(), FileChange::Type::Removed } });
         Q_EMIT m_fileWatcher->fileAdded((assetRootDir / "test").c_str());
-        Q_EMIT m_fileWatcher->fileModified((assetRootDir / "test2").c_str());
         Q_EMIT m_fileWatcher->fileRemoved((assetRootDir / "test3").c_str());
 
         EXPECT_TRUE(m_mockAPM->m_events[Added].WaitAndCheck()) << "APM Added event failed";
@@ -99,6 +103,34 @@ namespace UnitTests
         EXPECT_TRUE(m_mockFileProcessor->m_events[Deleted].WaitAndCheck()) << "File Processor Deleted event failed";
     }
 
+    TEST_F(ApplicationManagerTest, RawFileWatcherEvents_CoalescedForAssetProcessorManager_SUITE_sandbox)
+    {
+        AZ::IO::Path assetRootDir(m_databaseLocationListener.GetAssetRootDir());
+
+        // these are the signals the platform implementations emit. The modifications of the added file are folded into the add,
+        // otherwise the mock would be signalled twice for the same event and fail.
+        Q_EMIT m_fileWatcher->rawFileAdded((assetRootDir / "test").c_str(), {});
+        Q_EMIT m_fileWatcher->rawFileModified((assetRootDir / "test").c_str(), {});
+        Q_EMIT m_fileWatcher->rawFileModified((assetRootDir / "test2").c_str(), {});
+        Q_EMIT m_fileWatcher->rawFileModified((assetRootDir / "test2").c_str(), {});
+        Q_EMIT m_fileWatcher->rawFileRemoved((assetRootDir / "test3").c_str(), {});
+
+        // the raw signals are filtered on this thread, and the batch is emitted once the coalescing window has passed.
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.elapsed() < FileWatcher::CoalesceWindowMs * 5)
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+
+        EXPECT_TRUE(m_mockAPM->m_events[Added].WaitAndCheck()) << "APM Added event failed";
+        EXPECT_TRUE(m_mockAPM->m_events[Modified].WaitAndCheck()) << "APM Modified event failed";
+        EXPECT_TRUE(m_mockAPM->m_events[Deleted].WaitAndCheck()) << "APM Deleted event failed";
+
+        EXPECT_TRUE(m_mockFileProcessor->m_events[Added].WaitAndCheck()) << "File Processor Added event failed";
+        EXPECT_TRUE(m_mockFileProcessor->m_events[Deleted].WaitAndCheck()) << "File Processor Deleted event failed";
+    }
+
     TEST(AssetProcessorAZApplicationTest, AssetProcessorAZApplication_ArchiveComponent_Exists)
     {
         int argc = 0;
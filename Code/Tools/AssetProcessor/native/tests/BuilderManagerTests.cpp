@@ -56,8 +56,115 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    TEST_F(BuilderManagerTest, SetDesiredBuilderCount_StartsBuildersAheadOfJobs)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+
+        constexpr int DesiredBuilderCount = 4;
+        bm.SetDesiredBuilderCount(DesiredBuilderCount);
+
+        auto getWarmedUpCount = [&bm]()
+        {
+            return aznumeric_cast<int>(bm.GetStatistics().m_buildersWarmedUp);
+        };
+
+        // The builders are started by a background thread
+        constexpr int MaxWaitTimeMs = 10000;
+        constexpr int WaitStepMs = 10;
+        for (int waitedMs = 0; getWarmedUpCount() < DesiredBuilderCount && waitedMs < MaxWaitTimeMs; waitedMs += WaitStepMs)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(WaitStepMs));
+        }
+        ASSERT_EQ(getWarmedUpCount(), DesiredBuilderCount);
+        ASSERT_EQ(bm.GetBuilderCreationCount(), DesiredBuilderCount + 1);
+
+        // Jobs get the builders that were started ahead of time instead of starting new ones
+        AZStd::vector<AssetProcessor::BuilderRef> builders;
+        for (int i = 0; i < DesiredBuilderCount; ++i)
+        {
+            builders.push_back(bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob));
+            ASSERT_TRUE(builders.back());
+        }
+        EXPECT_EQ(bm.GetBuilderCreationCount(), DesiredBuilderCount + 1);
+
+        bm.SetDesiredBuilderCount(0);
+    }
+
+    TEST_F(BuilderManagerTest, MaxJobsPerBuilder_IdleBuilderReachedLimit_IsRecycled)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+        bm.SetMaxJobsPerBuilder(2);
+
+        AssetProcessor::BuilderRef builder = bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob);
+        ASSERT_TRUE(builder);
+        const AZ::Uuid firstBuilderUuid = builder->GetUuid();
+        ASSERT_EQ(bm.GetBuilderCreationCount(), 2);
+
+        // Below the limit the builder keeps getting reused
+        bm.GetLastBuilder()->SetJobCount(1);
+        builder = {};
+        builder = bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob);
+        EXPECT_EQ(builder->GetUuid(), firstBuilderUuid);
+        EXPECT_EQ(bm.GetBuilderCreationCount(), 2);
+
+        // A busy builder is not recycled, even once it reached the limit
+        bm.GetLastBuilder()->SetJobCount(2);
+        AssetProcessor::BuilderRef secondBuilder = bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob);
+        EXPECT_NE(secondBuilder->GetUuid(), firstBuilderUuid);
+        EXPECT_EQ(bm.GetBuilderCreationCount(), 3);
+        EXPECT_EQ(bm.GetStatistics().m_buildersRecycled, 0);
+        secondBuilder = {};
+
+        // Once idle it is stopped and replaced, while the other builder is still used
+        builder = {};
+        AZStd::vector<AssetProcessor::BuilderRef> builders;
+        builders.push_back(bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob));
+        builders.push_back(bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob));
+        for (const AssetProcessor::BuilderRef& ref : builders)
+        {
+            ASSERT_TRUE(ref);
+            EXPECT_NE(ref->GetUuid(), firstBuilderUuid);
+        }
+        EXPECT_EQ(bm.GetBuilderCreationCount(), 4);
+        EXPECT_EQ(bm.GetStatistics().m_buildersRecycled, 1);
+    }
+
+    TEST_F(BuilderManagerTest, SetDesiredBuilderCount_BuildersFailToStart_StopsRetrying)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+        bm.SetFailBuilderStart(true);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        bm.SetDesiredBuilderCount(2);
+
+        // The retries back off, and stop after MaxConsecutiveWarmUpFailures
+        const int expectedCreationCount = 1 + aznumeric_cast<int>(AssetProcessor::BuilderManager::MaxConsecutiveWarmUpFailures);
+        constexpr int MaxWaitTimeMs = 20000;
+        constexpr int WaitStepMs = 10;
+        for (int waitedMs = 0; bm.GetBuilderCreationCount() < expectedCreationCount && waitedMs < MaxWaitTimeMs; waitedMs += WaitStepMs)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(WaitStepMs));
+        }
+        ASSERT_EQ(bm.GetBuilderCreationCount(), expectedCreationCount);
+
+        // without the backoff this would start about 10 more builders.
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1000));
+        EXPECT_EQ(bm.GetBuilderCreationCount(), expectedCreationCount);
+
+        bm.SetDesiredBuilderCount(0);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(AssetProcessor::BuilderManager::MaxConsecutiveWarmUpFailures);
+        EXPECT_EQ(bm.GetStatistics().m_buildersWarmedUp, 0);
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
+        if (m_failToStart)
+        {
+            return AZ::Failure(AZStd::string("Test builder set to fail"));
+        }
         return AZ::Success();
     }
 
@@ -71,12 +178,30 @@ namespace UnitTests
         return m_connectionCounter;
     }
 
+    void TestBuilderManager::SetMaxJobsPerBuilder(AZ::u32 maxJobsPerBuilder)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+        m_builderList.SetMaxJobsPerBuilder(maxJobsPerBuilder);
+    }
+
+    void TestBuilderManager::SetFailBuilderStart(bool failBuilderStart)
+    {
+        m_failBuilderStart = failBuilderStart;
+    }
+
+    AZStd::shared_ptr<TestBuilder> TestBuilderManager::GetLastBuilder()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+        return m_lastBuilder;
+    }
+
     AZStd::shared_ptr<AssetProcessor::Builder> TestBuilderManager::AddNewBuilder(AssetProcessor::BuilderPurpose purpose)
     {
         auto uuid = AZ::Uuid::CreateRandom();
-        auto builder = AZStd::make_shared<TestBuilder>(m_quitListener, uuid, ++m_connectionCounter);
+        auto builder = AZStd::make_shared<TestBuilder>(m_quitListener, uuid, ++m_connectionCounter, m_failBuilderStart);
 
         m_builderList.AddBuilder(builder, purpose);
+        m_lastBuilder = builder;
 
         return builder;
     }
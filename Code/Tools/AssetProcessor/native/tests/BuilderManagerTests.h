@@ -9,6 +9,7 @@
 #pragma once
 
 #include <native/utilities/BuilderManager.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace UnitTests
@@ -16,14 +17,22 @@ namespace UnitTests
     class TestBuilder : public AssetProcessor::Builder
     {
     public:
-        TestBuilder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid, int connectionId)
+        TestBuilder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid, int connectionId, bool failToStart = false)
             : Builder(quitListener, uuid)
+            , m_failToStart(failToStart)
         {
             m_connectionId = connectionId;
         }
 
+        void SetJobCount(AZ::u32 jobCount)
+        {
+            m_jobCount = jobCount;
+        }
+
     protected:
         AZ::Outcome<void, AZStd::string> Start(AssetProcessor::BuilderPurpose purpose) override;
+
+        bool m_failToStart = false;
     };
 
     class TestBuilderManager : public AssetProcessor::BuilderManager
@@ -32,10 +41,17 @@ namespace UnitTests
         TestBuilderManager(ConnectionManager* connectionManager);
 
         int GetBuilderCreationCount() const;
+        void SetMaxJobsPerBuilder(AZ::u32 maxJobsPerBuilder);
+        //! Builders added from now on fail to start when true.
+        void SetFailBuilderStart(bool failBuilderStart);
+        AZStd::shared_ptr<TestBuilder> GetLastBuilder();
 
     protected:
         AZStd::shared_ptr<AssetProcessor::Builder> AddNewBuilder(AssetProcessor::BuilderPurpose purpose) override;
 
-        int m_connectionCounter = 0;
+        // builders can also be added by the warm up thread
+        AZStd::atomic_int m_connectionCounter = 0;
+        AZStd::atomic_bool m_failBuilderStart = false;
+        AZStd::shared_ptr<TestBuilder> m_lastBuilder; // guarded by m_buildersMutex
     };
 }
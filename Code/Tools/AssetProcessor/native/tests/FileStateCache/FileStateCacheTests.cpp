@@ -170,4 +170,34 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    TEST_F(FileStateCacheTests, HashFiles_HashesAreCachedAndMatchFileContents)
+    {
+        AZStd::vector<QString> testPaths;
+        for (int fileIndex = 0; fileIndex < 16; ++fileIndex)
+        {
+            QString testPath = m_temporarySourceDir.absoluteFilePath(QString("test%1.txt").arg(fileIndex));
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, QString("contents of file %1").arg(fileIndex)));
+            m_fileStateCache->AddFile(testPath);
+            testPaths.push_back(testPath);
+        }
+
+        m_fileStateCache->HashFiles(testPaths);
+
+        // change the files without telling the cache, it should return the hashes computed by HashFiles without reading the files again.
+        AZStd::vector<AZ::u64> expectedHashes;
+        for (const QString& testPath : testPaths)
+        {
+            expectedHashes.push_back(AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true));
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "changed contents"));
+        }
+
+        for (size_t fileIndex = 0; fileIndex < testPaths.size(); ++fileIndex)
+        {
+            AssetProcessor::IFileStateRequests::FileHash hash = AssetProcessor::IFileStateRequests::InvalidFileHash;
+            EXPECT_TRUE(m_fileStateCache->GetHash(testPaths[fileIndex], &hash));
+            EXPECT_NE(hash, AssetProcessor::IFileStateRequests::InvalidFileHash);
+            EXPECT_EQ(hash, expectedHashes[fileIndex]);
+        }
+    }
 }
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/std/optional.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <AzCore/std/sort.h>
@@ -2664,4 +2665,142 @@ namespace UnitTests
 
     }
 
+    TEST_F(AssetDatabaseTest, ScopedWriteBatch_WritesAreVisibleToOtherConnectionsOnlyAfterCommit)
+    {
+        // other connections only exist for databases on disk
+        QTemporaryDir tempDir;
+        m_data->m_databaseLocationListener.m_assetDatabasePath = QDir(tempDir.path()).absoluteFilePath("test_database.sqlite").toUtf8().constData();
+        m_data->m_connection.ClearData();
+        CreateCoverageTestData();
+
+        AzToolsFramework::AssetDatabase::AssetDatabaseConnection reader;
+        ASSERT_TRUE(reader.OpenDatabase());
+
+        auto sourceExistsInReader = [&reader, this](const char* sourceName)
+        {
+            bool found = false;
+            reader.QuerySourceBySourceNameScanFolderID(sourceName, m_data->m_scanFolder.m_scanFolderID,
+                [&found](SourceDatabaseEntry&)
+                {
+                    found = true;
+                    return false;
+                });
+            return found;
+        };
+
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+
+            SourceDatabaseEntry batchedSource = { m_data->m_scanFolder.m_scanFolderID, "batched.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint" };
+            ASSERT_TRUE(m_data->m_connection.SetSource(batchedSource));
+
+            // the writing connection sees its own writes right away
+            SourceDatabaseEntry source;
+            EXPECT_TRUE(m_data->m_connection.GetSourceBySourceNameScanFolderId("batched.tif", m_data->m_scanFolder.m_scanFolderID, source));
+            EXPECT_FALSE(sourceExistsInReader("batched.tif"));
+
+            writeBatch.Commit();
+            EXPECT_TRUE(sourceExistsInReader("batched.tif"));
+
+            SourceDatabaseEntry lastSource = { m_data->m_scanFolder.m_scanFolderID, "last.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint" };
+            ASSERT_TRUE(m_data->m_connection.SetSource(lastSource));
+            EXPECT_FALSE(sourceExistsInReader("last.tif"));
+        }
+
+        // the remaining writes are committed when the batch goes out of scope
+        EXPECT_TRUE(sourceExistsInReader("last.tif"));
+        reader.CloseDatabase();
+    }
+
+    // Writes a source, a job and a product per job, the same rows the AssetProcessorManager writes for a processed job,
+    // either committing every row on its own or grouping them with a ScopedWriteBatch.
+    // Reports the rows written per second, the range is the number of jobs.
+    struct AssetDatabaseWriteBenchmarks
+        : public ::benchmark::Fixture
+    {
+        void SetUp([[maybe_unused]] const benchmark::State& st) override
+        {
+            m_databaseLocationListener = AZStd::make_unique<AssetProcessor::MockAssetDatabaseRequestsHandler>();
+            m_connection = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection>();
+        }
+
+        void SetUp([[maybe_unused]] benchmark::State& st) override
+        {
+            m_databaseLocationListener = AZStd::make_unique<AssetProcessor::MockAssetDatabaseRequestsHandler>();
+            m_connection = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection>();
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            m_connection.reset();
+            m_databaseLocationListener.reset();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            m_connection.reset();
+            m_databaseLocationListener.reset();
+        }
+
+        void WriteJobs(benchmark::State& state, bool batched)
+        {
+            const int jobCount = aznumeric_cast<int>(state.range(0));
+            const AZ::Uuid builderGuid = AZ::Uuid::CreateRandom();
+            const AZ::Data::AssetType assetType = AZ::Data::AssetType::CreateRandom();
+
+            for ([[maybe_unused]] auto unused : state)
+            {
+                state.PauseTiming();
+                m_connection->ClearData();
+                ScanFolderDatabaseEntry scanFolder("folder", "test", "test", 0);
+                m_connection->SetScanFolder(scanFolder);
+                state.ResumeTiming();
+
+                AZStd::optional<AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch> writeBatch;
+                if (batched)
+                {
+                    writeBatch.emplace(*m_connection);
+                }
+
+                for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    SourceDatabaseEntry source(
+                        scanFolder.m_scanFolderID, AZStd::string::format("folder/source%d.txt", jobIndex).c_str(), AZ::Uuid::CreateRandom(), "");
+                    m_connection->SetSource(source);
+
+                    JobDatabaseEntry job(
+                        source.m_sourceID, "jobkey", aznumeric_cast<AZ::u32>(jobIndex), "pc", builderGuid, AzToolsFramework::AssetSystem::JobStatus::Completed,
+                        aznumeric_cast<AZ::u64>(jobIndex));
+                    m_connection->SetJob(job);
+
+                    ProductDatabaseEntry product(
+                        job.m_jobID, 0, AZStd::string::format("pc/folder/product%d.bin", jobIndex).c_str(), assetType);
+                    m_connection->SetProduct(product);
+
+                    if (writeBatch)
+                    {
+                        writeBatch->Step();
+                    }
+                }
+            }
+
+            state.counters["RowsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(state.iterations() * jobCount * 3), benchmark::Counter::kIsRate);
+        }
+
+        AZStd::unique_ptr<AssetProcessor::MockAssetDatabaseRequestsHandler> m_databaseLocationListener;
+        AZStd::unique_ptr<AssetProcessor::AssetDatabaseConnection> m_connection;
+    };
+
+    BENCHMARK_DEFINE_F(AssetDatabaseWriteBenchmarks, BM_WriteJobs_CommitEachRow)(benchmark::State& state)
+    {
+        WriteJobs(state, false);
+    }
+    BENCHMARK_REGISTER_F(AssetDatabaseWriteBenchmarks, BM_WriteJobs_CommitEachRow)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(AssetDatabaseWriteBenchmarks, BM_WriteJobs_ScopedWriteBatch)(benchmark::State& state)
+    {
+        WriteJobs(state, true);
+    }
+    BENCHMARK_REGISTER_F(AssetDatabaseWriteBenchmarks, BM_WriteJobs_ScopedWriteBatch)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
 } // end namespace UnitTests
@@ -705,6 +705,44 @@ TEST_F(AssetProcessorManagerFinishTests, MultipleFiles_WithDuplicateJobs_Analysi
     EXPECT_EQ(maxWaitingFiles, 1);
 }
 
+TEST_F(AssetProcessorManagerFinishTests, AssessFileChanges_BatchOfChanges_AssessedLikeIndividualChanges)
+{
+    // A batch from the file watcher should have the same effect as assessing each of its changes on its own.
+    using namespace AssetBuilderSDK;
+
+    CreateBuilder("stage1", "*.stage1", "stage2", false, ProductOutputFlags::ProductAsset);
+
+    AZ::IO::Path scanFolderDir(m_scanfolder.m_scanFolder);
+    QString secondFilePath = (scanFolderDir / "second.stage1").AsPosix().c_str();
+    UnitTestUtils::CreateDummyFile(secondFilePath.toUtf8().constData(), "unit test file");
+
+    // both added files end up with a job
+    m_assetProcessorManager->AssessFileChanges({ { m_testFilePath.c_str(), FileChange::Type::Added }, { secondFilePath, FileChange::Type::Added } });
+    RunFile(2, 2);
+    ASSERT_EQ(m_jobDetailsList.size(), 2);
+
+    ProcessJob(*m_rc, m_jobDetailsList[0]);
+    ASSERT_TRUE(m_fileCompiled);
+    m_assetProcessorManager->AssetProcessed(m_processedJobEntry, m_processJobResponse);
+    m_fileCompiled = false;
+    ProcessJob(*m_rc, m_jobDetailsList[1]);
+    ASSERT_TRUE(m_fileCompiled);
+    m_assetProcessorManager->AssetProcessed(m_processedJobEntry, m_processJobResponse);
+    QCoreApplication::processEvents();
+
+    CheckProduct("test.stage2");
+    CheckProduct("second.stage2");
+
+    // the modified file is processed again, and the products of the removed file are deleted
+    UnitTestUtils::CreateDummyFile(secondFilePath.toUtf8().constData(), "modified unit test file");
+    AZ::IO::SystemFile::Delete(m_testFilePath.c_str());
+    m_assetProcessorManager->AssessFileChanges({ { m_testFilePath.c_str(), FileChange::Type::Removed }, { secondFilePath, FileChange::Type::Modified } });
+    RunFile(1, 2);
+    ASSERT_EQ(m_jobDetailsList.size(), 1);
+    EXPECT_STREQ(m_jobDetailsList[0].m_jobEntry.m_sourceAssetReference.RelativePath().c_str(), "second.stage1");
+
+    CheckProduct("test.stage2", false);
+}
 
 class AssetProcessorIntermediateAssetTests
     : public UnitTests::AssetManagerTestingBase
@@ -22,6 +22,7 @@ namespace AssetProcessor
         }
         friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerExcludeFileTest);
         friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerExcludeFolderTest);
+        friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerOverlappingScanFoldersTest);
     };
 
 
@@ -154,4 +155,35 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerOverlappingScanFoldersTest)
+    {
+        QDir tempDir(m_tempDir.path());
+
+        // a recursive scan folder of the lowest priority that overlaps all the other scan folders
+        AZStd::vector<AssetBuilderSDK::PlatformInfo> platforms;
+        m_platformConfig.get()->PopulatePlatformsForScanFolder(platforms);
+        m_platformConfig.get()->AddScanFolder(ScanFolderInfo(tempDir.absolutePath(), "", "ap4", false, true, platforms, 100));
+
+        QHash<QString, QString> fileScanFolders;
+        QObject::connect(m_assetScanner.get(), &AssetScanner::FilesFound, [&fileScanFolders](QSet<AssetProcessor::AssetFileInfo> fileList)
+        {
+            for (const AssetProcessor::AssetFileInfo& foundFile : fileList)
+            {
+                fileScanFolders.insert(foundFile.m_filePath, foundFile.m_scanFolder->GetPortableKey());
+            }
+        }
+        );
+
+        m_assetScanner.get()->StartScan();
+
+        BlockUntilScanComplete(5000);
+
+        // every file is found once and belongs to the first scan folder it is found in, no matter which thread scanned it first
+        EXPECT_EQ(fileScanFolders.size(), 4);
+        EXPECT_EQ(fileScanFolders.value(tempDir.filePath("rootfile.txt")), "ap1");
+        EXPECT_EQ(fileScanFolders.value(tempDir.filePath("subfolder1/basefile.txt")), "ap2");
+        EXPECT_EQ(fileScanFolders.value(tempDir.filePath("subfolder2/basefile.txt")), "ap3");
+        EXPECT_EQ(fileScanFolders.value(tempDir.filePath("subfolder2/aaa/basefile.txt")), "ap3");
+    }
 }
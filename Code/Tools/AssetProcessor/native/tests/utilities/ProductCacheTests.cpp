@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/utilities/ProductCache.h>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QHash>
+#include <QRandomGenerator>
+#include <QSet>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class ProductCacheTest
+        : public AssetProcessorTest
+    {
+    public:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            ASSERT_TRUE(m_tempDir.isValid());
+            m_cacheDir = QDir(m_tempDir.path()).filePath("cache");
+            m_storeDir = QDir(m_tempDir.path()).filePath("store");
+            m_retrieveDir = QDir(m_tempDir.path()).filePath("retrieve");
+            QDir(m_tempDir.path()).mkpath(m_cacheDir);
+            QDir(m_tempDir.path()).mkpath(m_storeDir);
+            QDir(m_tempDir.path()).mkpath(m_retrieveDir);
+            m_productCache = AZStd::make_unique<ProductCache>(AZStd::make_unique<LocalDirectoryProductCacheBackend>(m_cacheDir));
+        }
+
+        void TearDown() override
+        {
+            m_productCache.reset();
+            AssetProcessorTest::TearDown();
+        }
+
+        static QByteArray GenerateData(int size, quint32 seed)
+        {
+            QByteArray data(size, 0);
+            QRandomGenerator generator(seed);
+            for (char& byte : data)
+            {
+                byte = static_cast<char>(generator.generate() & 0xFF);
+            }
+            return data;
+        }
+
+        static void WriteFile(const QString& filePath, const QByteArray& data)
+        {
+            QDir().mkpath(QFileInfo(filePath).absolutePath());
+            QFile file(filePath);
+            ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+            file.write(data);
+        }
+
+        static QByteArray ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+        }
+
+    protected:
+        QTemporaryDir m_tempDir;
+        QString m_cacheDir;
+        QString m_storeDir;
+        QString m_retrieveDir;
+        AZStd::unique_ptr<ProductCache> m_productCache;
+    };
+
+    //! Minimal stand-in for a cache server, keeps the objects in memory and answers HEAD, GET and PUT requests.
+    //! It runs on the thread of the test, the requests are served while the backend waits for their reply in its local event loop.
+    class ProductCacheTestHttpServer
+        : public QObject
+    {
+    public:
+        bool Listen()
+        {
+            connect(&m_server, &QTcpServer::newConnection, this, &ProductCacheTestHttpServer::OnNewConnection);
+            return m_server.listen(QHostAddress::LocalHost);
+        }
+
+        QString GetBaseUrl() const
+        {
+            return QString("http://127.0.0.1:%1/cache/").arg(m_server.serverPort());
+        }
+
+        QHash<QString, QByteArray> m_objects;
+        int m_requestCount = 0;
+        int m_connectionCount = 0;
+
+    private:
+        void OnNewConnection()
+        {
+            while (QTcpSocket* socket = m_server.nextPendingConnection())
+            {
+                ++m_connectionCount;
+                connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { OnReadyRead(socket); });
+                connect(socket, &QTcpSocket::disconnected, this, [this, socket]()
+                    {
+                        m_pendingData.remove(socket);
+                        socket->deleteLater();
+                    });
+            }
+        }
+
+        void OnReadyRead(QTcpSocket* socket)
+        {
+            QByteArray& pendingData = m_pendingData[socket];
+            pendingData.append(socket->readAll());
+
+            // connections are kept alive, so there can be any number of requests in the data received so far.
+            for (;;)
+            {
+                const int headerEnd = pendingData.indexOf("\r\n\r\n");
+                if (headerEnd < 0)
+                {
+                    return;
+                }
+
+                const QList<QByteArray> headerLines = pendingData.left(headerEnd).split('\n');
+                const QList<QByteArray> requestLine = headerLines.front().trimmed().split(' ');
+                int contentLength = 0;
+                for (const QByteArray& headerLine : headerLines)
+                {
+                    const int separator = headerLine.indexOf(':');
+                    if (separator > 0 && headerLine.left(separator).trimmed().toLower() == "content-length")
+                    {
+                        contentLength = headerLine.mid(separator + 1).trimmed().toInt();
+                    }
+                }
+
+                const int requestSize = headerEnd + 4 + contentLength;
+                if (pendingData.size() < requestSize)
+                {
+                    return;
+                }
+
+                const QByteArray body = pendingData.mid(headerEnd + 4, contentLength);
+                pendingData.remove(0, requestSize);
+                Respond(socket, requestLine.value(0), QString::fromUtf8(QByteArray::fromPercentEncoding(requestLine.value(1))), body);
+            }
+        }
+
+        void Respond(QTcpSocket* socket, const QByteArray& verb, QString path, const QByteArray& body)
+        {
+            ++m_requestCount;
+            path.remove(0, path.indexOf("/cache/") + 7);
+
+            int statusCode = 404;
+            QByteArray responseBody;
+            if (verb == "PUT")
+            {
+                m_objects[path] = body;
+                statusCode = 201;
+            }
+            else if (m_objects.contains(path))
+            {
+                statusCode = 200;
+                responseBody = m_objects[path];
+            }
+
+            QByteArray response = QString("HTTP/1.1 %1 %2\r\nContent-Length: %3\r\n\r\n")
+                .arg(statusCode)
+                .arg(statusCode == 404 ? "Not Found" : "OK")
+                .arg(responseBody.size())
+                .toLatin1();
+            if (verb != "HEAD")
+            {
+                response.append(responseBody);
+            }
+            socket->write(response);
+        }
+
+        QTcpServer m_server;
+        QHash<QTcpSocket*, QByteArray> m_pendingData;
+    };
+
+    class ProductCacheHttpTest
+        : public ProductCacheTest
+    {
+    public:
+        void SetUp() override
+        {
+            ProductCacheTest::SetUp();
+            m_qApp = AZStd::make_unique<QCoreApplication>(m_argc, nullptr);
+            m_server = AZStd::make_unique<ProductCacheTestHttpServer>();
+            ASSERT_TRUE(m_server->Listen());
+            m_httpProductCache = AZStd::make_unique<ProductCache>(AZStd::make_unique<HttpProductCacheBackend>(m_server->GetBaseUrl(), 5000));
+        }
+
+        void TearDown() override
+        {
+            m_httpProductCache.reset();
+            m_server.reset();
+            m_qApp.reset();
+            ProductCacheTest::TearDown();
+        }
+
+    protected:
+        int m_argc = 0;
+        AZStd::unique_ptr<QCoreApplication> m_qApp;
+        AZStd::unique_ptr<ProductCacheTestHttpServer> m_server;
+        AZStd::unique_ptr<ProductCache> m_httpProductCache;
+    };
+
+    TEST_F(ProductCacheTest, StoreAndRetrieve_RestoresAllFiles)
+    {
+        const QByteArray largeData = GenerateData(1024 * 1024, 1);
+        const QByteArray smallData("small product");
+        WriteFile(QDir(m_storeDir).filePath("large.bin"), largeData);
+        WriteFile(QDir(m_storeDir).filePath("subfolder/small.txt"), smallData);
+
+        EXPECT_TRUE(m_productCache->Store("job", m_storeDir));
+        EXPECT_TRUE(m_productCache->Retrieve("job", m_retrieveDir));
+
+        EXPECT_EQ(ReadFile(QDir(m_retrieveDir).filePath("large.bin")), largeData);
+        EXPECT_EQ(ReadFile(QDir(m_retrieveDir).filePath("subfolder/small.txt")), smallData);
+
+        ProductCacheStatistics statistics = m_productCache->GetStatistics();
+        EXPECT_EQ(statistics.m_storeCount, 1);
+        EXPECT_EQ(statistics.m_hitCount, 1);
+        EXPECT_EQ(statistics.m_missCount, 0);
+    }
+
+    TEST_F(ProductCacheTest, Store_DuplicatedData_ChunksAreOnlyWrittenOnce)
+    {
+        const QByteArray data = GenerateData(1024 * 1024, 2);
+        WriteFile(QDir(m_storeDir).filePath("first.bin"), data);
+        WriteFile(QDir(m_storeDir).filePath("second.bin"), data);
+
+        EXPECT_TRUE(m_productCache->Store("job", m_storeDir));
+
+        ProductCacheStatistics statistics = m_productCache->GetStatistics();
+        EXPECT_GT(statistics.m_chunksWritten, 0);
+        EXPECT_EQ(statistics.m_chunksDeduplicated, statistics.m_chunksWritten);
+    }
+
+    TEST_F(ProductCacheTest, Store_ExternalFile_IsRestoredAtRelativePath)
+    {
+        const QByteArray data("source file copied to the cache");
+        const QString externalFilePath = QDir(m_tempDir.path()).filePath("source/file.cfg");
+        WriteFile(externalFilePath, data);
+
+        EXPECT_TRUE(m_productCache->Store("job", m_storeDir, { { externalFilePath, "file.cfg" } }));
+        EXPECT_TRUE(m_productCache->Retrieve("job", m_retrieveDir));
+        EXPECT_EQ(ReadFile(QDir(m_retrieveDir).filePath("file.cfg")), data);
+    }
+
+    TEST_F(ProductCacheTest, Retrieve_UnknownJob_IsAMiss)
+    {
+        EXPECT_FALSE(m_productCache->Retrieve("unknown", m_retrieveDir));
+        EXPECT_EQ(m_productCache->GetStatistics().m_missCount, 1);
+        EXPECT_TRUE(QDir(m_retrieveDir).isEmpty());
+    }
+
+    TEST_F(ProductCacheTest, Retrieve_ManifestWithPathOutsideOfJobDirectory_Fails)
+    {
+        LocalDirectoryProductCacheBackend backend(m_cacheDir);
+        ASSERT_TRUE(backend.Write("jobs/job.json", R"({"version":1,"files":[{"path":"../outside.txt","size":0,"chunks":[]}]})"));
+
+        EXPECT_FALSE(m_productCache->Retrieve("job", m_retrieveDir));
+        EXPECT_FALSE(QFile::exists(QDir(m_tempDir.path()).filePath("outside.txt")));
+        EXPECT_GT(m_errorAbsorber->m_numWarningsAbsorbed, 0);
+    }
+
+    TEST_F(ProductCacheTest, Retrieve_CorruptedChunk_FailsAndLeavesNoFiles)
+    {
+        WriteFile(QDir(m_storeDir).filePath("product.bin"), GenerateData(64 * 1024, 3));
+        EXPECT_TRUE(m_productCache->Store("job", m_storeDir));
+
+        QDirIterator chunkIterator(QDir(m_cacheDir).filePath("objects"), QDir::Files, QDirIterator::Subdirectories);
+        ASSERT_TRUE(chunkIterator.hasNext());
+        WriteFile(chunkIterator.next(), "corrupted");
+
+        EXPECT_FALSE(m_productCache->Retrieve("job", m_retrieveDir));
+        EXPECT_FALSE(QFile::exists(QDir(m_retrieveDir).filePath("product.bin")));
+        EXPECT_EQ(m_productCache->GetStatistics().m_missCount, 1);
+    }
+
+    TEST_F(ProductCacheTest, SplitIntoChunks_ChunksCoverDataWithinSizeLimits)
+    {
+        const QByteArray data = GenerateData(4 * 1024 * 1024, 4);
+
+        qint64 expectedOffset = 0;
+        int chunkCount = 0;
+        ProductCache::SplitIntoChunks(data.constData(), data.size(),
+            [&](qint64 offset, qint64 size)
+            {
+                EXPECT_EQ(offset, expectedOffset);
+                EXPECT_LE(size, ProductCache::MaxChunkSize);
+                if (offset + size < data.size())
+                {
+                    EXPECT_GE(size, ProductCache::MinChunkSize);
+                }
+                expectedOffset += size;
+                ++chunkCount;
+            });
+
+        EXPECT_EQ(expectedOffset, data.size());
+        EXPECT_GT(chunkCount, 1);
+    }
+
+    TEST_F(ProductCacheTest, SplitIntoChunks_InsertedData_OnlyChangesNearbyChunks)
+    {
+        const QByteArray data = GenerateData(2 * 1024 * 1024, 5);
+        QByteArray modifiedData = data;
+        modifiedData.insert(1024 * 1024, "inserted data");
+
+        auto collectChunks = [](const QByteArray& input)
+        {
+            QSet<QByteArray> chunks;
+            ProductCache::SplitIntoChunks(input.constData(), input.size(),
+                [&](qint64 offset, qint64 size)
+                {
+                    chunks.insert(input.mid(offset, size));
+                });
+            return chunks;
+        };
+
+        const QSet<QByteArray> originalChunks = collectChunks(data);
+        const QSet<QByteArray> modifiedChunks = collectChunks(modifiedData);
+        const int sharedChunks = QSet<QByteArray>(originalChunks).intersect(modifiedChunks).size();
+
+        // at most a couple of chunks around the insertion point are different
+        EXPECT_GE(sharedChunks, originalChunks.size() - 2);
+    }
+
+    TEST_F(ProductCacheHttpTest, StoreAndRetrieve_RestoresAllFiles)
+    {
+        const QByteArray largeData = GenerateData(1024 * 1024, 6);
+        const QByteArray smallData("small product");
+        WriteFile(QDir(m_storeDir).filePath("large.bin"), largeData);
+        WriteFile(QDir(m_storeDir).filePath("subfolder/small.txt"), smallData);
+
+        EXPECT_TRUE(m_httpProductCache->Store("job", m_storeDir));
+        EXPECT_TRUE(m_server->m_objects.contains("jobs/job.json"));
+        EXPECT_TRUE(m_httpProductCache->Retrieve("job", m_retrieveDir));
+
+        EXPECT_EQ(ReadFile(QDir(m_retrieveDir).filePath("large.bin")), largeData);
+        EXPECT_EQ(ReadFile(QDir(m_retrieveDir).filePath("subfolder/small.txt")), smallData);
+
+        ProductCacheStatistics statistics = m_httpProductCache->GetStatistics();
+        EXPECT_EQ(statistics.m_storeCount, 1);
+        EXPECT_EQ(statistics.m_hitCount, 1);
+        EXPECT_EQ(statistics.m_missCount, 0);
+
+        // the requests of a thread share its network access manager, so they reuse the connections instead of opening one each.
+        EXPECT_GT(m_server->m_requestCount, 10);
+        EXPECT_LT(m_server->m_connectionCount, m_server->m_requestCount);
+    }
+
+    TEST_F(ProductCacheHttpTest, Retrieve_UnknownJob_IsAMiss)
+    {
+        EXPECT_FALSE(m_httpProductCache->Retrieve("unknown", m_retrieveDir));
+        EXPECT_EQ(m_httpProductCache->GetStatistics().m_missCount, 1);
+        EXPECT_TRUE(QDir(m_retrieveDir).isEmpty());
+    }
+
+    TEST_F(ProductCacheHttpTest, Retrieve_CorruptedChunk_FailsAndLeavesNoFiles)
+    {
+        WriteFile(QDir(m_storeDir).filePath("product.bin"), GenerateData(64 * 1024, 7));
+        EXPECT_TRUE(m_httpProductCache->Store("job", m_storeDir));
+
+        for (auto objectIter = m_server->m_objects.begin(); objectIter != m_server->m_objects.end(); ++objectIter)
+        {
+            if (objectIter.key().startsWith("objects/"))
+            {
+                objectIter.value() = "corrupted";
+            }
+        }
+
+        EXPECT_FALSE(m_httpProductCache->Retrieve("job", m_retrieveDir));
+        EXPECT_FALSE(QFile::exists(QDir(m_retrieveDir).filePath("product.bin")));
+        EXPECT_EQ(m_httpProductCache->GetStatistics().m_missCount, 1);
+    }
+
+    TEST_F(ProductCacheTest, Retrieve_ManifestWithUnsupportedFileSize_Fails)
+    {
+        LocalDirectoryProductCacheBackend backend(m_cacheDir);
+        ASSERT_TRUE(backend.Write("jobs/job.json", R"({"version":1,"files":[{"path":"huge.bin","size":5000000000,"chunks":[]}]})"));
+
+        EXPECT_FALSE(m_productCache->Retrieve("job", m_retrieveDir));
+        EXPECT_FALSE(QFile::exists(QDir(m_retrieveDir).filePath("huge.bin")));
+        EXPECT_GT(m_errorAbsorber->m_numWarningsAbsorbed, 0);
+    }
+} // namespace AssetProcessor
@@ -8,8 +8,11 @@
 
 #include "AssetScannerUnitTests.h"
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzTest/Utils.h>
 #include <native/AssetManager/assetScanner.h>
+#include <native/AssetManager/AssetScanJournal.h>
 #include <native/utilities/PlatformConfiguration.h>
 #include <native/unittests/UnitTestUtils.h> // for CreateDummyFile
 #include <QApplication>
@@ -148,5 +151,169 @@ namespace UnitTest
         }
 
     }
+
+    TEST_F(AssetScannerUnitTest, AssetScanner_ScanWithJournal_FindsSameFilesAsFreshScan)
+    {
+        using namespace AssetProcessor;
+        AZStd::unique_ptr<QCoreApplication> m_qApp;
+
+        int argC = 0;
+        m_qApp.reset(new QApplication(argC, nullptr));
+
+        qRegisterMetaType<AssetProcessor::AssetScanningStatus>("AssetScanningStatus");
+        qRegisterMetaType<QSet<AssetProcessor::AssetFileInfo>>("QSet<AssetFileInfo>");
+
+        AZ::Test::ScopedAutoTempDirectory tempEngineRoot;
+        // the journal is kept outside of the scan folders so that saving it doesn't modify a scanned directory.
+        AZ::Test::ScopedAutoTempDirectory tempJournalDir;
+        const QString journalPath = QString::fromUtf8(tempJournalDir.Resolve("scanjournal.dat").c_str());
+
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("rootfile1.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder1/basefile.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder1/aaa/basefile.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder1/aaa/bbb/basefile.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder2/basefile.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder2/aaa/basefile1.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder2/aaa/basefile2.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempEngineRoot.Resolve("subfolder2/aaa/eee.fff.ggg/basefile.txt").c_str()));
+
+        // directories modified within the journal's time stamp resolution of the start of a scan are not recorded,
+        // wait it out so that the second scan really reads the directories back from the journal.
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(2100));
+
+        PlatformConfiguration config;
+        AZStd::vector<AssetBuilderSDK::PlatformInfo> platforms;
+        config.PopulatePlatformsForScanFolder(platforms);
+        config.AddScanFolder(ScanFolderInfo(tempEngineRoot.GetDirectory(), "temp", "ap1", true, false, platforms));
+        config.AddScanFolder(ScanFolderInfo(tempEngineRoot.Resolve("subfolder1").c_str(), "", "ap2", false, true, platforms));
+        config.AddScanFolder(ScanFolderInfo(tempEngineRoot.Resolve("subfolder2").c_str(), "", "ap3", false, true, platforms));
+
+        using FoundFiles = AZStd::map<AZStd::string, QDateTime>;
+        auto scan = [this, &config, &journalPath](FoundFiles& filesFound, FoundFiles& foldersFound)
+        {
+            AssetScanner scanner(&config);
+            scanner.SetScanJournalPath(journalPath);
+
+            bool doneScan = false;
+            connect(
+                &scanner, &AssetScanner::FilesFound, this,
+                [&filesFound](QSet<AssetFileInfo> fileList)
+                {
+                    for (const AssetFileInfo& foundFile : fileList)
+                    {
+                        filesFound[foundFile.m_filePath.toUtf8().constData()] = foundFile.m_modTime;
+                    }
+                });
+            connect(
+                &scanner, &AssetScanner::FoldersFound, this,
+                [&foldersFound](QSet<AssetFileInfo> folderList)
+                {
+                    for (const AssetFileInfo& foundFolder : folderList)
+                    {
+                        foldersFound[foundFolder.m_filePath.toUtf8().constData()] = foundFolder.m_modTime;
+                    }
+                });
+            connect(
+                &scanner, &AssetScanner::AssetScanningStatusChanged, this,
+                [&doneScan](AssetProcessor::AssetScanningStatus status)
+                {
+                    if ((status == AssetProcessor::AssetScanningStatus::Completed) || (status == AssetProcessor::AssetScanningStatus::Stopped))
+                    {
+                        doneScan = true;
+                    }
+                });
+
+            scanner.StartScan();
+            auto startTime = AZStd::chrono::steady_clock::now();
+            while (!doneScan)
+            {
+                QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 100);
+
+                auto millisecondsSpentScanning =
+                    AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - startTime);
+                if (millisecondsSpentScanning > AZStd::chrono::milliseconds(10000))
+                {
+                    break;
+                }
+            }
+            return doneScan;
+        };
+
+        FoundFiles freshFiles;
+        FoundFiles freshFolders;
+        ASSERT_TRUE(scan(freshFiles, freshFolders));
+        EXPECT_EQ(freshFiles.size(), 8);
+
+        // the first scan had no journal to start from, make sure it left one behind for the second scan to use.
+        AssetScanJournal journal;
+        ASSERT_TRUE(journal.Load(journalPath));
+        EXPECT_GT(journal.GetDirectoryCount(), 0);
+
+        FoundFiles journalFiles;
+        FoundFiles journalFolders;
+        ASSERT_TRUE(scan(journalFiles, journalFolders));
+
+        EXPECT_EQ(journalFiles, freshFiles);
+        EXPECT_EQ(journalFolders, freshFolders);
+    }
+
+    TEST_F(AssetScannerUnitTest, AssetScanJournal_SaveAndLoad_FindsOnlyUnchangedDirectories)
+    {
+        using namespace AssetProcessor;
+
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempDir.Resolve("subfolder1/file1.txt").c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempDir.Resolve("subfolder2/file2.txt").c_str()));
+
+        const QString subfolder1 = QString::fromUtf8(tempDir.Resolve("subfolder1").c_str());
+        const QString subfolder2 = QString::fromUtf8(tempDir.Resolve("subfolder2").c_str());
+        const QString journalPath = QString::fromUtf8(tempDir.Resolve("journal.dat").c_str());
+
+        AssetScanJournal::DirectoryEntry entry1;
+        entry1.m_state = AssetScanJournal::GetDirectoryState(QFileInfo(subfolder1));
+        entry1.m_files.push_back("file1.txt");
+
+        AssetScanJournal::DirectoryEntry entry2;
+        entry2.m_state = AssetScanJournal::GetDirectoryState(QFileInfo(subfolder2));
+        entry2.m_files.push_back("file2.txt");
+
+        AssetScanJournal journal;
+        journal.AddDirectory(subfolder1, entry1);
+        journal.AddDirectory(subfolder2, entry2);
+        ASSERT_TRUE(journal.Save(journalPath));
+
+        AssetScanJournal loadedJournal;
+        ASSERT_TRUE(loadedJournal.Load(journalPath));
+        EXPECT_EQ(loadedJournal.GetDirectoryCount(), 2);
+
+        const AssetScanJournal::DirectoryEntry* unchangedEntry = loadedJournal.FindUnchanged(subfolder1, entry1.m_state);
+        ASSERT_NE(unchangedEntry, nullptr);
+        EXPECT_EQ(unchangedEntry->m_files, entry1.m_files);
+        EXPECT_TRUE(unchangedEntry->m_subDirectories.isEmpty());
+
+        // a different modification time or file id means entries were added, removed or renamed, or the directory was replaced.
+        AssetScanJournal::DirectoryState modifiedState = entry2.m_state;
+        modifiedState.m_modTime += 1000;
+        EXPECT_EQ(loadedJournal.FindUnchanged(subfolder2, modifiedState), nullptr);
+
+        AssetScanJournal::DirectoryState replacedState = entry2.m_state;
+        replacedState.m_fileId += 1;
+        EXPECT_EQ(loadedJournal.FindUnchanged(subfolder2, replacedState), nullptr);
+
+        EXPECT_EQ(loadedJournal.FindUnchanged(QString::fromUtf8(tempDir.Resolve("subfolder3").c_str()), entry1.m_state), nullptr);
+    }
+
+    TEST_F(AssetScannerUnitTest, AssetScanJournal_LoadInvalidFile_ReturnsEmptyJournal)
+    {
+        using namespace AssetProcessor;
+
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempDir.Resolve("journal.dat").c_str(), "not a journal"));
+
+        AssetScanJournal journal;
+        EXPECT_FALSE(journal.Load(QString::fromUtf8(tempDir.Resolve("journal.dat").c_str())));
+        EXPECT_FALSE(journal.Load(QString::fromUtf8(tempDir.Resolve("missing.dat").c_str())));
+        EXPECT_EQ(journal.GetDirectoryCount(), 0);
+    }
 }
 
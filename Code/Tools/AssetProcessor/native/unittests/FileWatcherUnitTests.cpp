@@ -7,6 +7,7 @@
  */
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzFramework/IO/LocalFileIO.h>
@@ -18,6 +19,12 @@
 #include <native/FileWatcher/FileWatcher.h>
 #include <native/unittests/UnitTestUtils.h>
 
+#if defined(AZ_PLATFORM_LINUX)
+#include <native/FileWatcher/FileWatcher_platform.h>
+#endif
+
+#include <QDateTime>
+#include <QHash>
 #include <QSet>
 #include <QDir>
 #include <QString>
@@ -270,6 +277,59 @@ namespace FileWatcherTests
         EXPECT_TRUE(m_filesRemoved.contains(fileName));
     }
 
+    // the batches from filesChanged should contain a single change per file, no matter how many events there were for it.
+    TEST_F(FileWatcherUnitTest, WatchFilesChanged_MultipleEventsPerFile_ChangesAreCoalesced)
+    {
+        QHash<QString, QVector<FileChange::Type>> changesPerFile;
+        bool fenceFileBatched = false;
+        QMetaObject::Connection filesChangedConnection = QObject::connect(m_fileWatcher.get(), &FileWatcher::filesChanged, [&](FileChangeList changes)
+            {
+                for (const FileChange& change : changes)
+                {
+                    if (change.m_filePath == m_currentFenceFilePath)
+                    {
+                        fenceFileBatched = true;
+                    }
+                    else if (!change.m_filePath.contains("__fence__"))
+                    {
+                        changesPerFile[change.m_filePath].push_back(change.m_type);
+                    }
+                }
+            });
+
+        // let any batch that is still pending from the set up go out first, so that all the changes below fall in the same window.
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.elapsed() < FileWatcher::CoalesceWindowMs * 2)
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        }
+        changesPerFile.clear();
+
+        QString addedFileName = QDir::toNativeSeparators(QDir(m_assetRootPath).absoluteFilePath("added.tif"));
+        QString removedFileName = QDir::toNativeSeparators(QDir(m_assetRootPath).absoluteFilePath("removed.tif"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(addedFileName, "hello"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(addedFileName, "hello world"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(removedFileName, "hello world"));
+        EXPECT_TRUE(QFile::remove(removedFileName));
+
+        // the per file signals still see every event.
+        WatchUntilNoMoreEvents(2, 1, 1);
+
+        // the batch with the fence file is emitted a little later, and contains everything that happened before it.
+        timer.restart();
+        while ((timer.elapsed() < c_MaxWaitForFileChangesMS) && (!fenceFileBatched))
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        }
+        QObject::disconnect(filesChangedConnection);
+        ASSERT_TRUE(fenceFileBatched);
+
+        EXPECT_EQ(changesPerFile.size(), 2);
+        EXPECT_EQ(changesPerFile[addedFileName], QVector<FileChange::Type>{ FileChange::Type::Added });
+        EXPECT_EQ(changesPerFile[removedFileName], QVector<FileChange::Type>{ FileChange::Type::Removed });
+    }
+
     TEST_F(FileWatcherUnitTest, WatchFileCreation_MultipleFiles_FileChangesFound_ChangesAreInOrder_SUITE_periodic)
     {
         for (unsigned long fileIndex = 0; fileIndex < c_FilesInFloodTest; ++fileIndex)
@@ -791,3 +851,130 @@ namespace FileWatcherTests
     INSTANTIATE_TEST_CASE_P(FileWatcherUnitTest, FileWatcherUnitTest_DefaultExclusions, ::testing::Bool());
 
 } // namespace File Watcher Tests.
+
+#if defined(AZ_PLATFORM_LINUX)
+//! Drives the inotify fallbacks of the linux implementation directly, since running out of watches or overflowing the
+//! event queue can't be reliably provoked by a test. The watcher is never started, so nothing else touches the implementation.
+class FileWatcherPlatformUnitTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        int dummyArgC = 0;
+        m_app = AZStd::make_unique<QCoreApplication>(dummyArgC, nullptr);
+        m_tempDir = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+        m_rootPath = QFileInfo(m_tempDir->GetDirectory()).canonicalFilePath();
+
+        m_fileWatcher = AZStd::make_unique<FileWatcher>();
+        ASSERT_TRUE(m_fileWatcher->m_platformImpl->Initialize());
+
+        QObject::connect(m_fileWatcher.get(), &FileWatcher::rawFileAdded, [this](QString path) { m_added.insert(path); });
+        QObject::connect(m_fileWatcher.get(), &FileWatcher::rawFileRemoved, [this](QString path) { m_removed.insert(path); });
+        QObject::connect(m_fileWatcher.get(), &FileWatcher::rawFileModified, [this](QString path) { m_modified.insert(path); });
+    }
+
+    void TearDown() override
+    {
+        m_fileWatcher->m_platformImpl->CloseMainWatchHandle();
+        m_fileWatcher->m_platformImpl->Finalize();
+        m_fileWatcher.reset();
+        m_tempDir.reset();
+        m_app.reset();
+    }
+
+    FileWatcher::PlatformImplementation& GetPlatformImpl()
+    {
+        return *m_fileWatcher->m_platformImpl;
+    }
+
+    QString GetPath(const char* relativePath) const
+    {
+        return QDir(m_rootPath).absoluteFilePath(relativePath);
+    }
+
+    void ClearEvents()
+    {
+        m_added.clear();
+        m_removed.clear();
+        m_modified.clear();
+    }
+
+protected:
+    AZStd::unique_ptr<QCoreApplication> m_app;
+    AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDir;
+    AZStd::unique_ptr<FileWatcher> m_fileWatcher;
+    QString m_rootPath;
+
+    QSet<QString> m_added;
+    QSet<QString> m_removed;
+    QSet<QString> m_modified;
+};
+
+TEST_F(FileWatcherPlatformUnitTest, PollFolders_ChangesSinceLastPoll_AreNotified)
+{
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/modified.txt"), "hello"));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/removed.txt"), "hello"));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/unchanged.txt"), "hello"));
+
+    auto& platformImpl = GetPlatformImpl();
+    platformImpl.AddPolledFolder(GetPath("polled"), true, *m_fileWatcher, true);
+    EXPECT_EQ(m_added, QSet<QString>({ GetPath("polled/modified.txt"), GetPath("polled/removed.txt"), GetPath("polled/unchanged.txt") }));
+    ClearEvents();
+
+    // nothing changed, so nothing is notified.
+    platformImpl.PollFolders(*m_fileWatcher);
+    EXPECT_TRUE(m_added.isEmpty());
+    EXPECT_TRUE(m_removed.isEmpty());
+    EXPECT_TRUE(m_modified.isEmpty());
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/modified.txt"), "hello world"));
+    EXPECT_TRUE(QFile::remove(GetPath("polled/removed.txt")));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/added.txt"), "hello"));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/newfolder/inner.txt"), "hello"));
+
+    platformImpl.PollFolders(*m_fileWatcher);
+
+    // the new folder is handed to AddWatchFolder, which watches it and notifies about the files already in it.
+    EXPECT_EQ(m_added, QSet<QString>({ GetPath("polled/added.txt"), GetPath("polled/newfolder"), GetPath("polled/newfolder/inner.txt") }));
+    EXPECT_EQ(m_removed, QSet<QString>({ GetPath("polled/removed.txt") }));
+    EXPECT_EQ(m_modified, QSet<QString>({ GetPath("polled/modified.txt") }));
+}
+
+TEST_F(FileWatcherPlatformUnitTest, PollFolders_PolledFolderRemoved_StopsPollingIt)
+{
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("polled/file.txt"), "hello"));
+
+    auto& platformImpl = GetPlatformImpl();
+    platformImpl.AddPolledFolder(GetPath("polled"), true, *m_fileWatcher, false);
+    ASSERT_EQ(platformImpl.m_polledFolders.size(), 1);
+
+    EXPECT_TRUE(QDir(GetPath("polled")).removeRecursively());
+    platformImpl.PollFolders(*m_fileWatcher);
+
+    EXPECT_TRUE(platformImpl.m_polledFolders.isEmpty());
+}
+
+TEST_F(FileWatcherPlatformUnitTest, RescanAfterOverflow_EntriesChangedSinceLastRead_AreNotified)
+{
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("watched/old.txt"), "hello"));
+
+    auto& platformImpl = GetPlatformImpl();
+    platformImpl.AddWatchFolder(GetPath("watched"), true, *m_fileWatcher, false);
+    EXPECT_TRUE(m_added.isEmpty());
+
+    // the rescan allows a second for file systems with coarse time stamps, so the old file has to be older than that.
+    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1500));
+    const QDateTime previousReadTime = QDateTime::currentDateTimeUtc();
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("watched/new.txt"), "hello"));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("watched/newfolder/inner.txt"), "hello"));
+
+    platformImpl.RescanAfterOverflow(*m_fileWatcher, previousReadTime);
+
+    EXPECT_EQ(m_added, QSet<QString>({ GetPath("watched/new.txt"), GetPath("watched/newfolder"), GetPath("watched/newfolder/inner.txt") }));
+    EXPECT_TRUE(m_removed.isEmpty());
+
+    // the new folder is watched from now on.
+    EXPECT_TRUE(platformImpl.m_handleToFolderMap.values().contains(GetPath("watched/newfolder")));
+}
+#endif // defined(AZ_PLATFORM_LINUX)
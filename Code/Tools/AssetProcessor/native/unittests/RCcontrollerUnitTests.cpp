@@ -850,3 +850,48 @@ TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithCyclicDependencies_Al
         EXPECT_EQ(m_rcJobListModel->itemCount(), prevJobCount);
     }
 }
+
+TEST_F(RCcontrollerUnitTests, TestRCQueueSortModel_JobsOnCriticalPath_SortFirst)
+{
+    // Job C has an order job dependency on Job B, Job A has no dependencies.
+    // Every job has the same priority, so without a critical path Job A would be first because of its name.
+    auto createJob = [this](const char* fileName, const char* jobKey, const AZStd::vector<JobDependencyInternal>& jobDependencies)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_assetBuilderDesc = m_assetBuilderDesc;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), fileName);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = jobKey;
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+        jobDetails.m_jobDependencyList = jobDependencies;
+
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    };
+
+    AssetBuilderSDK::SourceFileDependency sourceFileBDependency;
+    sourceFileBDependency.m_sourceFileDependencyPath =
+        (AZ::IO::Path(TestScanFolderInfo.ScanPath().toUtf8().constData()) / "fileB.txt").Native();
+    AssetBuilderSDK::JobDependency jobDependencyB("TestJobB", "pc", AssetBuilderSDK::JobDependencyType::Order, sourceFileBDependency);
+
+    MockRCJob* jobA = createJob("fileA.txt", "TestJobA", {});
+    MockRCJob* jobB = createJob("fileB.txt", "TestJobB", {});
+    MockRCJob* jobC = createJob("fileC.txt", "TestJobC", { { jobDependencyB } });
+
+    // Without any history every job is expected to take as long, and Job C can only start once Job B is done.
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), jobB);
+    EXPECT_GT(m_rcQueueSortModel->GetCriticalPathDuration(jobB->GetElementID()), m_rcQueueSortModel->GetCriticalPathDuration(jobA->GetElementID()));
+
+    // Once Job A is known to take longer than Job B and Job C together, it is on the critical path.
+    m_rcQueueSortModel->SetExpectedJobDuration(jobA->GetElementID(), 10000);
+    m_rcQueueSortModel->SetExpectedJobDuration(jobB->GetElementID(), 100);
+    m_rcQueueSortModel->SetExpectedJobDuration(jobC->GetElementID(), 100);
+    m_rcQueueSortModel->UpdateCriticalPathDurations();
+
+    EXPECT_EQ(m_rcQueueSortModel->GetCriticalPathDuration(jobB->GetElementID()), 200);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), jobA);
+}
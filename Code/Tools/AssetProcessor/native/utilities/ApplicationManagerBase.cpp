@@ -19,6 +19,7 @@
 #include <native/AssetManager/ControlRequestHandler.h>
 #include <native/connection/connectionManager.h>
 #include <native/utilities/ByteArrayStream.h>
+#include <native/utilities/JobDiagnosticTracker.h>
 #include <native/AssetManager/AssetRequestHandler.h>
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/FileWatcher/FileWatcher.h>
@@ -393,6 +394,10 @@ void ApplicationManagerBase::InitRCController()
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::SourceDeleted, m_rcController, &AssetProcessor::RCController::RemoveJobsBySource);
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::JobComplete, m_rcController, &AssetProcessor::RCController::OnJobComplete);
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AddedToCatalog, m_rcController, &AssetProcessor::RCController::OnAddedToCatalog);
+    QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::JobProcessDurationChanged, m_rcController, &AssetProcessor::RCController::OnJobProcessDurationChanged);
+
+    // durations of the previous runs are used to start the jobs on the critical path first.
+    m_rcController->PopulateJobDurationsFromDatabase();
 }
 
 void ApplicationManagerBase::DestroyRCController()
@@ -408,6 +413,14 @@ void ApplicationManagerBase::InitAssetScanner()
 {
     using namespace AssetProcessor;
     m_assetScanner = new AssetScanner(m_platformConfiguration);
+    // the scanner fills in the file state cache itself before it emits the files it found.
+    m_assetScanner->SetFileStateCache(m_fileStateCache.get());
+
+    QDir cacheRoot;
+    if (AssetUtilities::ComputeProjectCacheRoot(cacheRoot))
+    {
+        m_assetScanner->SetScanJournalPath(cacheRoot.absoluteFilePath("AssetScanJournal.dat"));
+    }
 
     // // wait until file cache is ready before attempting to build the catalog.
     QObject::connect(
@@ -424,10 +437,6 @@ void ApplicationManagerBase::InitAssetScanner()
     QObject::connect(m_assetScanner, &AssetScanner::ExcludedFound,              m_assetProcessorManager, &AssetProcessorManager::RecordExcludesFromScanner);
 
 
-    QObject::connect(m_assetScanner, &AssetScanner::FilesFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
-    QObject::connect(m_assetScanner, &AssetScanner::FoldersFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
-    QObject::connect(m_assetScanner, &AssetScanner::ExcludedFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
-
     // file table
     QObject::connect(m_assetScanner, &AssetScanner::AssetScanningStatusChanged, m_fileProcessor.get(), &FileProcessor::OnAssetScannerStatusChange);
     QObject::connect(m_assetScanner, &AssetScanner::FilesFound,                 m_fileProcessor.get(), &FileProcessor::AssessFilesFromScanner);
@@ -551,9 +560,9 @@ void ApplicationManagerBase::InitFileMonitor(AZStd::unique_ptr<FileWatcherBase>
         connect(m_fileWatcher.get(), &FileWatcher::fileRemoved, m_fileProcessor.get(), &FileProcessor::AssessDeletedFile, Qt::QueuedConnection);
     }
 
-    connect(m_fileWatcher.get(), &FileWatcher::fileAdded, m_assetProcessorManager, &AssetProcessorManager::AssessAddedFile, Qt::QueuedConnection);
-    connect(m_fileWatcher.get(), &FileWatcher::fileModified, m_assetProcessorManager, &AssetProcessorManager::AssessModifiedFile, Qt::QueuedConnection);
-    connect(m_fileWatcher.get(), &FileWatcher::fileRemoved, m_assetProcessorManager, &AssetProcessorManager::AssessDeletedFile, Qt::QueuedConnection);
+    // the AssetProcessorManager only needs the latest state of each file, so it gets the coalesced batches.
+    // This turns the flood of events from a large checkout into one queued call per batch instead of several per file.
+    connect(m_fileWatcher.get(), &FileWatcher::filesChanged, m_assetProcessorManager, &AssetProcessorManager::AssessFileChanges, Qt::QueuedConnection);
 }
 
 void ApplicationManagerBase::DestroyFileMonitor()
@@ -935,6 +944,7 @@ ApplicationManager::BeforeRunStatus ApplicationManagerBase::BeforeRun()
     qRegisterMetaType<QSet<AssetProcessor::AssetFileInfo>>("QSet<AssetFileInfo>");
     qRegisterMetaType<AssetProcessor::SourceAssetReference>("SourceAssetReference");
     qRegisterMetaType<AZStd::unordered_set<AZ::Uuid>>("AZStd::unordered_set<AZ::Uuid>");
+    qRegisterMetaType<FileChangeList>("FileChangeList");
 
     AssetBuilderSDK::AssetBuilderBus::Handler::BusConnect();
     AssetProcessor::AssetBuilderRegistrationBus::Handler::BusConnect();
@@ -1010,6 +1020,18 @@ bool ApplicationManagerBase::Run()
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Warnings Reported: %d.\n", m_warningCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Errors Reported: %d.\n", m_errorCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Total Assets Processing Time: %fs\n", allAssetsProcessingTimer.elapsed() / 1000.0f);
+
+    AssetProcessor::ProductCacheStatistics productCacheStatistics;
+    AssetProcessor::JobDiagnosticRequestBus::BroadcastResult(
+        productCacheStatistics, &AssetProcessor::JobDiagnosticRequestBus::Events::GetProductCacheStatistics);
+    if (productCacheStatistics.m_hitCount + productCacheStatistics.m_missCount + productCacheStatistics.m_storeCount > 0)
+    {
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Product Cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " jobs stored.\n",
+            productCacheStatistics.m_hitCount, productCacheStatistics.m_missCount, productCacheStatistics.m_storeCount);
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Product Cache: %" PRIu64 " chunks written, %" PRIu64 " chunks deduplicated, %" PRIu64 " bytes read, %" PRIu64 " bytes written.\n",
+            productCacheStatistics.m_chunksWritten, productCacheStatistics.m_chunksDeduplicated,
+            productCacheStatistics.m_bytesRead, productCacheStatistics.m_bytesWritten);
+    }
     AZ_Printf(AssetProcessor::ConsoleChannel, "Asset Processor Batch Processing Completed.\n");
 
     RemoveOldTempFolders();
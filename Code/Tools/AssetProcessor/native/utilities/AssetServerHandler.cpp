@@ -8,10 +8,12 @@
 
 #include <native/utilities/AssetServerHandler.h>
 #include <native/resourcecompiler/rcjob.h>
+#include <native/utilities/ProductCache.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzCore/JSON/pointer.h>
 #include <QDir>
+#include <QUrl>
 
 namespace AssetProcessor
 {
@@ -85,6 +87,28 @@ namespace AssetProcessor
         return {};
     }
 
+    bool CheckChunkedStorage()
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            AZStd::string storage;
+            if (settingsRegistry->Get(storage,
+                AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorServerKey)
+                + "/"
+                + CacheServerStorageKey))
+            {
+                AZStd::to_lower(storage.begin(), storage.end());
+                if (storage == "chunked")
+                {
+                    return true;
+                }
+                AZ_Warning(AssetProcessor::DebugChannel, storage == "archive", "Unknown value for 'cacheServerStorage' (%s)", storage.c_str());
+            }
+        }
+        return false;
+    }
+
     QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
@@ -146,6 +170,11 @@ namespace AssetProcessor
     bool AssetServerHandler::IsServerAddressValid()
     {
         QString address{m_serverAddress.c_str()};
+        if (ProductCache::IsHttpAddress(address))
+        {
+            QUrl url(address);
+            return url.isValid() && !url.host().isEmpty();
+        }
         bool isValid = !address.isEmpty() && QDir(address).exists();
         return isValid;
     }
@@ -156,6 +185,16 @@ namespace AssetProcessor
         {
             return;
         }
+
+        m_useChunkedStorage = CheckChunkedStorage();
+        UpdateProductCache();
+
+        if (ProductCache::IsHttpAddress(QString{ m_serverAddress.c_str() }))
+        {
+            // the recognizer settings are only shared through network shares
+            return;
+        }
+
         AZ::IO::Path settingsFilePath{ m_serverAddress };
         settingsFilePath /= "settings.json";
 
@@ -246,15 +285,44 @@ namespace AssetProcessor
                 AZ_STRING_ARG(previousServerAddress));
             return false;
         }
+        UpdateProductCache();
         return true;
     }
 
+    AZStd::shared_ptr<ProductCache> AssetServerHandler::GetProductCache() const
+    {
+        AZStd::scoped_lock lock(m_productCacheMutex);
+        return m_productCache;
+    }
+
+    void AssetServerHandler::UpdateProductCache()
+    {
+        AZStd::shared_ptr<ProductCache> productCache;
+        if (m_useChunkedStorage || ProductCache::IsHttpAddress(QString{ m_serverAddress.c_str() }))
+        {
+            productCache = ProductCache::Create(m_serverAddress);
+        }
+
+        AZStd::scoped_lock lock(m_productCacheMutex);
+        m_productCache = AZStd::move(productCache);
+    }
+
     bool AssetServerHandler::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
     {
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
 
+        if (AZStd::shared_ptr<ProductCache> productCache = GetProductCache())
+        {
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieving job result canceled. \n");
+                return false;
+            }
+            return productCache->Retrieve(ProductCache::ComputeJobCacheKey(builderParams), builderParams.GetTempJobDirectory().c_str());
+        }
+
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
         if (archiveAbsFilePath.isEmpty())
         {
@@ -291,6 +359,17 @@ namespace AssetProcessor
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
+
+        if (AZStd::shared_ptr<ProductCache> productCache = GetProductCache())
+        {
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing job result canceled. \n");
+                return false;
+            }
+            return StoreJobResultInProductCache(*productCache, builderParams, sourceFileList);
+        }
+
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
 
         if (archiveAbsFilePath.isEmpty())
@@ -344,6 +423,23 @@ namespace AssetProcessor
         return success;
     }
 
+    bool AssetServerHandler::StoreJobResultInProductCache(ProductCache& productCache, const AssetProcessor::BuilderParams& builderParams, const AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing job (%s, %s, %s) with fingerprint (%u) in the product cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+
+        // source files copied into the cache are restored next to the other products, the same way AddSourceFilesToArchive does
+        QDir sourceDir{ QFileInfo(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath()).absoluteDir() };
+        AZStd::vector<ProductCache::ExternalFile> externalFiles;
+        for (const auto& thisProduct : sourceFileList)
+        {
+            externalFiles.push_back({ sourceDir.absoluteFilePath(thisProduct.c_str()), QString(thisProduct.c_str()) });
+        }
+
+        return productCache.Store(ProductCache::ComputeJobCacheKey(builderParams), builderParams.GetTempJobDirectory().c_str(), externalFiles);
+    }
+
     bool AssetServerHandler::AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList)
     {
         bool allSuccess{ true };
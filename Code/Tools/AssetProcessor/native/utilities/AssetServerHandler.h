@@ -10,13 +10,20 @@
 
 #include <native/utilities/AssetUtilEBusHelper.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AssetProcessor
 {
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
+    //! "archive" (default) stores one zip file per job, "chunked" uses the content addressed ProductCache.
+    //! Addresses starting with http:// or https:// always use the ProductCache.
+    inline constexpr const char* CacheServerStorageKey{ "cacheServerStorage" };
 
-    //! AssetServerHandler is implementing asset server using network share.
+    class ProductCache;
+
+    //! AssetServerHandler is implementing asset server using network share or a HTTP server.
     class AssetServerHandler
         : public AssetServerBus::Handler
     {
@@ -49,9 +56,19 @@ namespace AssetProcessor
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
         QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
-        
+        //! Returns the product cache if job results are stored in it rather than in zip files.
+        AZStd::shared_ptr<ProductCache> GetProductCache() const;
+        void UpdateProductCache();
+
     private:
+        bool StoreJobResultInProductCache(ProductCache& productCache, const AssetProcessor::BuilderParams& builderParams, const AZStd::vector<AZStd::string>& sourceFileList);
+
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        bool m_useChunkedStorage = false;
+
+        //! Jobs store and retrieve their results from multiple threads, the cache is replaced when the server address changes.
+        mutable AZStd::mutex m_productCacheMutex;
+        AZStd::shared_ptr<ProductCache> m_productCache;
     };
 } //namespace AssetProcessor
@@ -23,6 +23,7 @@ namespace AssetProcessor
     constexpr int MaximumSleepTimeMs = 10;
     constexpr int MillisecondsInASecond = 1000;
     constexpr const char* BuildersFolderName = "Builders";
+    constexpr AZ::u64 DefaultSharedMemoryJobTransportSizeKB = 1024;
 
     bool Builder::IsConnected() const
     {
@@ -151,7 +152,12 @@ namespace AssetProcessor
             return AZ::Failure(AZStd::string("Cannot start builder, quit was requested"));
         }
 
-        const AZStd::vector<AZStd::string> params = BuildParams("resident", buildersFolder.c_str(), UuidString(), "", "", purpose);
+        AZStd::vector<AZStd::string> params = BuildParams("resident", buildersFolder.c_str(), UuidString(), "", "", purpose);
+
+        if (purpose != BuilderPurpose::Registration)
+        {
+            CreateJobChannel(params);
+        }
 
         m_processWatcher = LaunchProcess(fullExePathString.c_str(), params);
 
@@ -169,6 +175,39 @@ namespace AssetProcessor
         return WaitForConnection();
     }
 
+    void Builder::CreateJobChannel(AZStd::vector<AZStd::string>& params)
+    {
+        bool useSharedMemoryJobTransport = false;
+        AZ::u64 sharedMemoryJobTransportSizeKB = DefaultSharedMemoryJobTransportSizeKB;
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(useSharedMemoryJobTransport, "/Amazon/AssetProcessor/Settings/BuilderManager/UseSharedMemoryJobTransport");
+            settingsRegistry->Get(
+                sharedMemoryJobTransportSizeKB, "/Amazon/AssetProcessor/Settings/BuilderManager/SharedMemoryJobTransportSizeKB");
+        }
+
+        if (!useSharedMemoryJobTransport || sharedMemoryJobTransportSizeKB == 0)
+        {
+            return;
+        }
+
+        const AZStd::string channelName =
+            AZStd::string::format("AssetBuilderJobs_%s", m_uuid.ToString<AZStd::string>(false, false).c_str());
+
+        m_jobChannel = AZStd::make_unique<AssetBuilder::JobChannel>();
+        if (!m_jobChannel->Create(channelName.c_str(), aznumeric_cast<AZ::u32>(sharedMemoryJobTransportSizeKB * 1024)))
+        {
+            // shared memory is not available on every platform, jobs are sent over the connection instead
+            AZ_Warning(
+                "Builder", false, "Failed to create shared memory job channel %s, builder %s will receive jobs over its connection",
+                channelName.c_str(), UuidString().c_str());
+            m_jobChannel.reset();
+            return;
+        }
+
+        params.emplace_back(AZStd::string::format(R"(-jobchannel="%s")", channelName.c_str()));
+    }
+
     bool Builder::IsValid() const
     {
         return m_connectionId != 0 && IsRunning();
@@ -12,6 +12,7 @@
 #include <utilities/assetUtils.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AzFramework/Process/ProcessCommunicatorTracePrinter.h>
+#include <AssetBuilder/AssetBuilderStatic.h>
 
 namespace AssetProcessor
 {
@@ -91,6 +92,9 @@ namespace AssetProcessor
         //! Sets the connection id and signals that the builder has connected
         void SetConnection(AZ::u32 connId);
 
+        //! Creates the shared memory job channel if enabled in the settings and adds its name to the builder parameters
+        void CreateJobChannel(AZStd::vector<AZStd::string>& params);
+
         AZStd::vector<AZStd::string> BuildParams(
             const char* task,
             const char* moduleFilePath,
@@ -121,6 +125,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Number of jobs this builder has completed, used to recycle builders that ran too many
+        mutable AZStd::atomic<AZ::u32> m_jobCount = 0;
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -132,6 +139,9 @@ namespace AssetProcessor
         //! Optional communicator, only available if we have a process watcher
         AZStd::unique_ptr<ProcessCommunicatorTracePrinter> m_tracePrinter = nullptr;
 
+        //! Optional shared memory channel for job requests and responses, only created when the job transport setting is enabled
+        AZStd::unique_ptr<AssetBuilder::JobChannel> m_jobChannel = nullptr;
+
         const AssetUtilities::QuitListener& m_quitListener;
 
         //! Time to wait in seconds for a builder to startup before timing out.
@@ -145,6 +145,43 @@ namespace AssetProcessor
         }
     }
 
+    size_t BuilderList::GetProcessJobBuilderCount() const
+    {
+        return m_builders.size();
+    }
+
+    void BuilderList::SetMaxJobsPerBuilder(AZ::u32 maxJobsPerBuilder)
+    {
+        m_maxJobsPerBuilder = maxJobsPerBuilder;
+    }
+
+    AZStd::vector<AZStd::shared_ptr<Builder>> BuilderList::RemoveBuildersToRecycle()
+    {
+        AZStd::vector<AZStd::shared_ptr<Builder>> buildersToRecycle;
+
+        if (m_maxJobsPerBuilder == 0)
+        {
+            return buildersToRecycle;
+        }
+
+        for (auto itr = m_builders.begin(); itr != m_builders.end();)
+        {
+            auto& builder = itr->second;
+
+            if (!builder->m_busy && builder->m_jobCount >= m_maxJobsPerBuilder)
+            {
+                buildersToRecycle.push_back(builder);
+                itr = m_builders.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+
+        return buildersToRecycle;
+    }
+
     void BuilderList::PumpIdleBuilders()
     {
         if (m_createJobsBuilder && !m_createJobsBuilder->m_busy)
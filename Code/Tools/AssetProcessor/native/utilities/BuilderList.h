@@ -26,10 +26,20 @@ namespace AssetProcessor
         void RemoveByUuid(AZ::Uuid uuid);
         void PumpIdleBuilders();
 
+        //! Number of ProcessJob builders, busy or not, including the ones that are still starting up.
+        size_t GetProcessJobBuilderCount() const;
+
+        //! Builders that have run this many jobs are recycled once idle, since some builders grow in memory with every job.
+        //! 0 means builders are never recycled.
+        void SetMaxJobsPerBuilder(AZ::u32 maxJobsPerBuilder);
+        //! Removes the idle ProcessJob builders that reached the maximum number of jobs and returns them, so they can be stopped.
+        AZStd::vector<AZStd::shared_ptr<Builder>> RemoveBuildersToRecycle();
+
         AZ_DISABLE_COPY_MOVE(BuilderList);
 
     protected:
         AZStd::unordered_map<AZ::Uuid, AZStd::shared_ptr<Builder>> m_builders;
         AZStd::shared_ptr<Builder> m_createJobsBuilder; // Special builder reserved for create jobs to ensure CreateJobs never waits for process startup
+        AZ::u32 m_maxJobsPerBuilder = 0;
     };
 } // namespace AssetProcessor
@@ -7,19 +7,30 @@
  */
 
 #include <utilities/BuilderManager.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <native/connection/connectionManager.h>
 #include <native/connection/connection.h>
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <AssetBuilder/AssetBuilderStatic.h>
 
+#include <inttypes.h>
+
 namespace AssetProcessor
 {
     //! Time in milliseconds to wait after each message pump cycle
     constexpr int IdleBuilderPumpingDelayMs = 100;
 
+    //! Time in milliseconds between checks for builders to start ahead of time or to recycle
+    constexpr int WarmUpBuildersDelayMs = 100;
+
+    //! Longest time in milliseconds to wait before starting a builder ahead of time again, after builders failed to start
+    constexpr int MaxWarmUpRetryDelayMs = 30000;
+
     BuilderManager::BuilderManager(ConnectionManager* connectionManager)
     {
         using namespace AZStd::placeholders;
@@ -37,6 +48,25 @@ namespace AssetProcessor
                 }
             });
 
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            AZ::u64 maxJobsPerBuilder = 0;
+            settingsRegistry->Get(maxJobsPerBuilder, "/Amazon/AssetProcessor/Settings/BuilderManager/MaxJobsPerBuilder");
+            m_builderList.SetMaxJobsPerBuilder(aznumeric_cast<AZ::u32>(maxJobsPerBuilder));
+        }
+
+        // Starting a builder waits for it to connect, which takes a while since it loads all the gems, so it gets its own thread.
+        AZStd::thread_desc warmUpDesc;
+        warmUpDesc.m_name = "BuilderManager Warm Up";
+        m_warmUpThread = AZStd::thread(warmUpDesc, [this]()
+            {
+                while (!m_quitListener.WasQuitRequested())
+                {
+                    WarmUpBuilders();
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(WarmUpBuildersDelayMs));
+                }
+            });
+
         m_quitListener.BusConnect();
         BusConnect();
     }
@@ -44,6 +74,7 @@ namespace AssetProcessor
     BuilderManager::~BuilderManager()
     {
         PrintDebugOutput();
+        PrintStatistics();
 
         BusDisconnect();
         m_quitListener.BusDisconnect();
@@ -53,6 +84,11 @@ namespace AssetProcessor
         {
             m_pollingThread.join();
         }
+
+        if (m_warmUpThread.joinable())
+        {
+            m_warmUpThread.join();
+        }
     }
 
     void BuilderManager::ConnectionLost(AZ::u32 connId)
@@ -167,6 +203,11 @@ namespace AssetProcessor
         {
             AZStd::unique_lock<AZStd::mutex> lock(m_buildersMutex);
 
+            if (purpose == BuilderPurpose::ProcessJob)
+            {
+                RecycleBuilders();
+            }
+
             if (purpose != BuilderPurpose::Registration)
             {
                 auto builder = m_builderList.GetFirst(purpose);
@@ -186,7 +227,17 @@ namespace AssetProcessor
             builderRef = BuilderRef(newBuilder);
         }
 
-        AZ::Outcome<void, AZStd::string> builderStartResult = newBuilder->Start(purpose);
+        StartBuilder(newBuilder, builderRef, purpose);
+
+        return builderRef;
+    }
+
+    bool BuilderManager::StartBuilder(const AZStd::shared_ptr<Builder>& builder, BuilderRef& builderRef, BuilderPurpose purpose)
+    {
+        QElapsedTimer startupTimer;
+        startupTimer.start();
+
+        AZ::Outcome<void, AZStd::string> builderStartResult = builder->Start(purpose);
 
         if (!builderStartResult.IsSuccess())
         {
@@ -196,14 +247,109 @@ namespace AssetProcessor
 
             builderRef = {}; // Release after the lock to make sure no one grabs it before we can delete it
 
-            m_builderList.RemoveByUuid(newBuilder->GetUuid());
+            m_builderList.RemoveByUuid(builder->GetUuid());
+            return false;
         }
-        else
+
+        // builders start again, so resume starting them ahead of jobs if that was given up on.
+        m_warmUpFailureCount = 0;
+
+        const qint64 startupTimeMs = startupTimer.elapsed();
+        AZ_TracePrintf("BuilderManager", "Builder started successfully in %lld ms\n", startupTimeMs);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+        ++m_statistics.m_buildersStarted;
+        m_statistics.m_totalStartupTimeMs += startupTimeMs;
+        return true;
+    }
+
+    void BuilderManager::SetDesiredBuilderCount(AZ::u32 builderCount)
+    {
+        m_desiredBuilderCount = builderCount;
+    }
+
+    void BuilderManager::RecordJobIpcTime(AZ::s64 ipcTimeUs)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+        ++m_statistics.m_jobCount;
+        m_statistics.m_totalJobIpcTimeUs += ipcTimeUs;
+    }
+
+    BuilderPoolStatistics BuilderManager::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+        return m_statistics;
+    }
+
+    void BuilderManager::RecycleBuilders()
+    {
+        AZStd::vector<AZStd::shared_ptr<Builder>> buildersToRecycle = m_builderList.RemoveBuildersToRecycle();
+
+        for (const auto& builder : buildersToRecycle)
         {
-            AZ_TracePrintf("BuilderManager", "Builder started successfully\n");
+            AZ_TracePrintf("BuilderManager", "Recycling builder %s after %u jobs\n", builder->UuidString().c_str(), builder->m_jobCount.load());
+            builder->TerminateProcess(0);
         }
 
-        return builderRef;
+        if (!buildersToRecycle.empty())
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+            m_statistics.m_buildersRecycled += buildersToRecycle.size();
+        }
+    }
+
+    void BuilderManager::WarmUpBuilders()
+    {
+        AZStd::shared_ptr<Builder> newBuilder;
+        BuilderRef builderRef;
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+
+            RecycleBuilders();
+
+            if (m_builderList.GetProcessJobBuilderCount() >= m_desiredBuilderCount)
+            {
+                return;
+            }
+
+            // a builder that fails to start usually fails quickly and keeps failing, so back off instead of retrying (and reporting
+            // an error) every cycle, and stop altogether after a few failures. Jobs still start builders when they need one.
+            if (m_warmUpFailureCount >= MaxConsecutiveWarmUpFailures || AZStd::chrono::steady_clock::now() < m_nextWarmUpTime)
+            {
+                return;
+            }
+
+            AZ_TracePrintf("BuilderManager", "Starting new builder ahead of job requests\n");
+
+            newBuilder = AddNewBuilder(BuilderPurpose::ProcessJob);
+            if (!newBuilder)
+            {
+                return;
+            }
+
+            // Hold a reference while the builder starts so no job grabs it before it is connected
+            builderRef = BuilderRef(newBuilder);
+        }
+
+        if (StartBuilder(newBuilder, builderRef, BuilderPurpose::ProcessJob))
+        {
+            // Make the builder available to jobs
+            builderRef.release();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+            ++m_statistics.m_buildersWarmedUp;
+        }
+        else
+        {
+            const AZ::u32 failureCount = ++m_warmUpFailureCount;
+            const int retryDelayMs = AZStd::min(WarmUpBuildersDelayMs << AZStd::min(failureCount, 16u), MaxWarmUpRetryDelayMs);
+            m_nextWarmUpTime = AZStd::chrono::steady_clock::now() + AZStd::chrono::milliseconds(retryDelayMs);
+
+            AZ_Warning("BuilderManager", failureCount < MaxConsecutiveWarmUpFailures,
+                "Builders failed to start %u times in a row, no longer starting builders ahead of jobs until one starts successfully.\n",
+                failureCount);
+        }
     }
 
     void BuilderManager::PumpIdleBuilders()
@@ -232,4 +378,25 @@ namespace AssetProcessor
         }
     }
 
+    void BuilderManager::PrintStatistics()
+    {
+        const BuilderPoolStatistics statistics = GetStatistics();
+
+        if (statistics.m_buildersStarted == 0)
+        {
+            return;
+        }
+
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel,
+            "Builders started: %" PRIu64 " (%" PRIu64 " ahead of time, %" PRIu64 " recycled), average startup time: %" PRId64 " ms\n",
+            statistics.m_buildersStarted, statistics.m_buildersWarmedUp, statistics.m_buildersRecycled,
+            statistics.m_totalStartupTimeMs / aznumeric_cast<AZ::s64>(statistics.m_buildersStarted));
+
+        if (statistics.m_jobCount > 0)
+        {
+            AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Builder jobs: %" PRIu64 ", average IPC overhead per job: %" PRId64 " us\n",
+                statistics.m_jobCount, statistics.m_totalJobIpcTimeUs / aznumeric_cast<AZ::s64>(statistics.m_jobCount));
+        }
+    }
+
 } // namespace AssetProcessor
@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <native/utilities/assetUtils.h>
@@ -41,6 +43,17 @@ namespace AssetProcessor
         virtual void AddAssetToBuilderProcessedList(const AZ::Uuid& /*builderId*/, const AZStd::string& /*sourceAsset*/)
         {
         }
+
+        //! Sets how many ProcessJob builders should be running, so that queued jobs don't have to wait for builders to start up.
+        //! Builders are started in the background until there are this many, but are not stopped when the count goes down.
+        virtual void SetDesiredBuilderCount(AZ::u32 /*builderCount*/)
+        {
+        }
+
+        //! Records the time a job spent serializing and sending its request and decoding its response, in microseconds.
+        virtual void RecordJobIpcTime(AZ::s64 /*ipcTimeUs*/)
+        {
+        }
     };
 
     using BuilderManagerBus = AZ::EBus<BuilderManagerBusTraits>;
@@ -51,11 +64,25 @@ namespace AssetProcessor
         AZStd::list<AZStd::string> m_assetsProcessed;
     };
 
+    //! Totals of the builder pool, printed on shutdown.
+    struct BuilderPoolStatistics
+    {
+        AZ::u64 m_buildersStarted = 0;
+        AZ::u64 m_buildersWarmedUp = 0; //!< Builders started in the background, before a job asked for them.
+        AZ::u64 m_buildersRecycled = 0; //!< Builders stopped because they reached the maximum number of jobs per builder.
+        AZ::s64 m_totalStartupTimeMs = 0;
+        AZ::u64 m_jobCount = 0;
+        AZ::s64 m_totalJobIpcTimeUs = 0;
+    };
+
     //! Manages the builder pool
     class BuilderManager
         : public BuilderManagerBus::Handler
     {
     public:
+        //! Builders are no longer started ahead of jobs after they failed to start this many times in a row.
+        static constexpr AZ::u32 MaxConsecutiveWarmUpFailures = 5;
+
         explicit BuilderManager(ConnectionManager* connectionManager);
         ~BuilderManager();
 
@@ -67,6 +94,10 @@ namespace AssetProcessor
         //BuilderManagerBus
         BuilderRef GetBuilder(BuilderPurpose purpose) override;
         void AddAssetToBuilderProcessedList(const AZ::Uuid& builderId, const AZStd::string& sourceAsset) override;
+        void SetDesiredBuilderCount(AZ::u32 builderCount) override;
+        void RecordJobIpcTime(AZ::s64 ipcTimeUs) override;
+
+        BuilderPoolStatistics GetStatistics() const;
 
     protected:
 
@@ -78,7 +109,18 @@ namespace AssetProcessor
 
         void PumpIdleBuilders();
 
+        //! Stops the idle builders that need recycling and starts a builder if there are less than the desired count.
+        void WarmUpBuilders();
+
+        //! Stops the idle builders that reached the maximum number of jobs. Must be called with m_buildersMutex locked.
+        void RecycleBuilders();
+
+        //! Starts a builder that was added to the pool, and removes it from the pool again if it fails to start.
+        //! Must be called without m_buildersMutex locked, since starting a builder waits for it to connect.
+        bool StartBuilder(const AZStd::shared_ptr<Builder>& builder, BuilderRef& builderRef, BuilderPurpose purpose);
+
         void PrintDebugOutput();
+        void PrintStatistics();
 
         AZStd::mutex m_buildersMutex;
 
@@ -95,6 +137,19 @@ namespace AssetProcessor
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
+        //! Starts builders ahead of time up to m_desiredBuilderCount, and recycles builders that ran too many jobs
+        AZStd::thread m_warmUpThread;
+
+        AZStd::atomic<AZ::u32> m_desiredBuilderCount = 0;
+
+        //! Builders that failed to start in a row on the warm up thread, reset whenever any builder starts.
+        AZStd::atomic<AZ::u32> m_warmUpFailureCount = 0;
+        //! Builders are not started ahead of time before this, only accessed by the warm up thread.
+        AZStd::chrono::steady_clock::time_point m_nextWarmUpTime;
+
+        mutable AZStd::mutex m_statisticsMutex;
+        BuilderPoolStatistics m_statistics;
+
         AssetUtilities::QuitListener m_quitListener;
     };
 } // namespace AssetProcessor
@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AssetBuilder/AssetBuilderStatic.h>
 
 namespace AssetProcessor
 {
@@ -46,14 +48,37 @@ namespace AssetProcessor
         QByteArray data;
         AZStd::binary_semaphore wait;
 
+        // the time spent serializing and sending the request and decoding the response is the overhead of running the job in
+        // a separate process, as opposed to the time the builder spends on the job itself.
+        auto ipcStartTime = AZStd::chrono::steady_clock::now();
+
+        // with a job channel only a small message goes through the connection, the request itself is written to shared memory.
+        // Requests that don't fit in the channel are sent over the connection as usual.
+        AssetBuilder::SharedMemoryJobNetRequest channelRequest;
+        bool useJobChannel = false;
+        if (m_jobChannel)
+        {
+            AZStd::vector<AZ::u8> requestData;
+            if (AzFramework::AssetSystem::PackMessage(netRequest, requestData) && m_jobChannel->WriteRequest(requestData))
+            {
+                channelRequest.m_requestType = netRequest.GetMessageType();
+                channelRequest.m_requestSize = aznumeric_cast<AZ::u32>(requestData.size());
+                useJobChannel = true;
+            }
+        }
+        const AzFramework::AssetSystem::BaseAssetProcessorMessage& sentRequest =
+            useJobChannel ? static_cast<const AzFramework::AssetSystem::BaseAssetProcessorMessage&>(channelRequest) : netRequest;
+
         unsigned int serial;
-        AssetProcessor::ConnectionBus::EventResult(serial, m_connectionId, &AssetProcessor::ConnectionBusTraits::SendRequest, netRequest, [&](AZ::u32 msgType, QByteArray msgData)
+        AssetProcessor::ConnectionBus::EventResult(serial, m_connectionId, &AssetProcessor::ConnectionBusTraits::SendRequest, sentRequest, [&](AZ::u32 msgType, QByteArray msgData)
         {
             type = msgType;
             data = msgData;
             wait.release();
         });
 
+        auto ipcTime = AZStd::chrono::steady_clock::now() - ipcStartTime;
+
         BuilderRunJobOutcome result = WaitForBuilderResponse(jobCancelListener, processTimeoutLimitInSeconds, &wait);
 
         if (result != BuilderRunJobOutcome::Ok)
@@ -63,13 +88,38 @@ namespace AssetProcessor
             return result;
         }
 
-        AZ_Assert(type == netRequest.GetMessageType(), "Response type does not match");
+        AZ_Assert(type == sentRequest.GetMessageType(), "Response type does not match");
+
+        ipcStartTime = AZStd::chrono::steady_clock::now();
+        bool decodedResponse = false;
+        if (useJobChannel)
+        {
+            // the response is in the job channel, or inline if it did not fit
+            AssetBuilder::SharedMemoryJobNetResponse channelResponse;
+            if (AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.length(), channelResponse))
+            {
+                AZStd::vector<AZ::u8>& responseData = channelResponse.m_response;
+                decodedResponse = (!responseData.empty() || m_jobChannel->ReadResponse(responseData, channelResponse.m_responseSize)) &&
+                    AZ::Utils::LoadObjectFromBufferInPlace(responseData.data(), responseData.size(), netResponse);
+            }
+        }
+        else
+        {
+            decodedResponse = AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.length(), netResponse);
+        }
 
-        if (!AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.length(), netResponse))
+        if (!decodedResponse)
         {
             AZ_Error("Builder", false, "Failed to deserialize processJobs response");
             return BuilderRunJobOutcome::FailedToDecodeResponse;
         }
+        ipcTime += AZStd::chrono::steady_clock::now() - ipcStartTime;
+
+        // only jobs the builder ran to completion count towards recycling it, builders that time out or crash are terminated anyway.
+        ++m_jobCount;
+
+        BuilderManagerBus::Broadcast(
+            &BuilderManagerBusTraits::RecordJobIpcTime, AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(ipcTime).count());
 
         if (!netResponse.m_response.Succeeded() || s_createRequestFileForSuccessfulJob)
         {
@@ -21,6 +21,18 @@ namespace AssetProcessor
         return !operator==(rhs);
     }
 
+    ProductCacheStatistics& ProductCacheStatistics::operator+=(const ProductCacheStatistics& rhs)
+    {
+        m_hitCount += rhs.m_hitCount;
+        m_missCount += rhs.m_missCount;
+        m_storeCount += rhs.m_storeCount;
+        m_chunksWritten += rhs.m_chunksWritten;
+        m_chunksDeduplicated += rhs.m_chunksDeduplicated;
+        m_bytesRead += rhs.m_bytesRead;
+        m_bytesWritten += rhs.m_bytesWritten;
+        return *this;
+    }
+
     //////////////////////////////////////////////////////////////////////////
 
     JobDiagnosticTracker::JobDiagnosticTracker()
@@ -63,4 +75,14 @@ namespace AssetProcessor
     {
         m_warningLevel = level;
     }
+
+    void JobDiagnosticTracker::RecordProductCacheStatistics(const ProductCacheStatistics& statistics)
+    {
+        m_productCacheStatistics += statistics;
+    }
+
+    ProductCacheStatistics JobDiagnosticTracker::GetProductCacheStatistics() const
+    {
+        return m_productCacheStatistics;
+    }
 }
@@ -27,6 +27,20 @@ namespace AssetProcessor
         AZ::u32 m_errorCount = 0;
     };
 
+    //! Hit and miss counts of the product cache, see ProductCache.
+    struct ProductCacheStatistics
+    {
+        ProductCacheStatistics& operator+=(const ProductCacheStatistics& rhs);
+
+        AZ::u64 m_hitCount = 0; //!< Jobs restored from the cache.
+        AZ::u64 m_missCount = 0; //!< Jobs that were not in the cache or could not be restored.
+        AZ::u64 m_storeCount = 0; //!< Jobs added to the cache.
+        AZ::u64 m_chunksWritten = 0;
+        AZ::u64 m_chunksDeduplicated = 0; //!< Chunks that didn't need to be written because the cache already had them.
+        AZ::u64 m_bytesRead = 0;
+        AZ::u64 m_bytesWritten = 0;
+    };
+
     enum class WarningLevel : AZ::u8
     {
         Default = 0,
@@ -46,6 +60,9 @@ namespace AssetProcessor
         virtual void RecordDiagnosticInfo(AZ::u64 jobRunKey, JobDiagnosticInfo info) = 0;
         virtual WarningLevel GetWarningLevel() const = 0;
         virtual void SetWarningLevel(WarningLevel level) = 0;
+        //! Adds the results of product cache operations to the totals.
+        virtual void RecordProductCacheStatistics(const ProductCacheStatistics& statistics) = 0;
+        virtual ProductCacheStatistics GetProductCacheStatistics() const = 0;
     };
 
     using JobDiagnosticRequestBus = AZ::EBus<JobDiagnosticRequests>;
@@ -61,8 +78,11 @@ namespace AssetProcessor
         void RecordDiagnosticInfo(AZ::u64 jobRunKey, JobDiagnosticInfo info) override;
         WarningLevel GetWarningLevel() const override;
         void SetWarningLevel(WarningLevel level) override;
+        void RecordProductCacheStatistics(const ProductCacheStatistics& statistics) override;
+        ProductCacheStatistics GetProductCacheStatistics() const override;
 
         WarningLevel m_warningLevel = WarningLevel::Default;
         AZStd::unordered_map<AZ::u64, JobDiagnosticInfo> m_jobInfo;
+        ProductCacheStatistics m_productCacheStatistics;
     };
 } // namespace AssetProcessor
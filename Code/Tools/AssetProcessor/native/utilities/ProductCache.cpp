@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/ProductCache.h>
+#include <native/assetprocessor.h>
+#include <native/resourcecompiler/rcjob.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QDirIterator>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSaveFile>
+#include <QThreadStorage>
+#include <QUrl>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        // Random values for the gear hash used to find chunk boundaries. They are generated with splitmix64 from a fixed seed,
+        // the chunk boundaries and so the chunk hashes depend on them so they must never change.
+        constexpr AZStd::array<AZ::u64, 256> GenerateGearTable()
+        {
+            AZStd::array<AZ::u64, 256> table{};
+            AZ::u64 state = 0x5250524F44434143ull;
+            for (AZ::u64& value : table)
+            {
+                state += 0x9E3779B97F4A7C15ull;
+                AZ::u64 mixed = state;
+                mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+                mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+                value = mixed ^ (mixed >> 31);
+            }
+            return table;
+        }
+
+        constexpr AZStd::array<AZ::u64, 256> GearTable = GenerateGearTable();
+
+        QString GetChunkKey(const QByteArray& chunkHash)
+        {
+            return QString("objects/%1/%2").arg(QString::fromLatin1(chunkHash.left(2)), QString::fromLatin1(chunkHash));
+        }
+
+        QString GetManifestKey(const QString& jobCacheKey)
+        {
+            return QString("jobs/%1.json").arg(jobCacheKey);
+        }
+
+        // One network access manager per job thread, so that connections to the cache server are kept alive and reused by
+        // the following requests of the thread. They are deleted when their thread exits, or with the application for the main thread.
+        QThreadStorage<QNetworkAccessManager*> s_networkAccessManagers;
+
+        QNetworkAccessManager& GetThreadNetworkAccessManager()
+        {
+            if (!s_networkAccessManagers.hasLocalData())
+            {
+                s_networkAccessManagers.setLocalData(new QNetworkAccessManager());
+            }
+            return *s_networkAccessManagers.localData();
+        }
+
+        // Sizes are stored as doubles in the json manifests, which represent sizes up to 2^53 exactly.
+        qint64 GetManifestFileSize(const QJsonObject& manifestFile)
+        {
+            return manifestFile["size"].toVariant().toLongLong();
+        }
+
+        // Manifests can come from another machine, so make sure they can't write outside of the temporary job directory.
+        bool IsSafeRelativePath(const QString& relativePath)
+        {
+            if (relativePath.isEmpty() || QDir::isAbsolutePath(relativePath) || relativePath.contains(':'))
+            {
+                return false;
+            }
+
+            const QString cleanPath = QDir::cleanPath(relativePath);
+            return cleanPath != ".." && !cleanPath.startsWith("../");
+        }
+    } // namespace
+
+    //////////////////////////////////////////////////////////////////////////
+
+    LocalDirectoryProductCacheBackend::LocalDirectoryProductCacheBackend(QString rootDirectory)
+        : m_rootDirectory(AZStd::move(rootDirectory))
+    {
+    }
+
+    bool LocalDirectoryProductCacheBackend::Exists(const QString& key) const
+    {
+        return QFile::exists(QDir(m_rootDirectory).filePath(key));
+    }
+
+    bool LocalDirectoryProductCacheBackend::Read(const QString& key, QByteArray& data) const
+    {
+        QFile file(QDir(m_rootDirectory).filePath(key));
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        data = file.readAll();
+        return file.error() == QFileDevice::NoError;
+    }
+
+    bool LocalDirectoryProductCacheBackend::Write(const QString& key, const QByteArray& data)
+    {
+        QFileInfo fileInfo(QDir(m_rootDirectory).filePath(key));
+        if (!fileInfo.absoluteDir().exists() && !fileInfo.absoluteDir().mkpath("."))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not create product cache folder %s.\n",
+                fileInfo.absolutePath().toUtf8().constData());
+            return false;
+        }
+
+        // write to a temporary file and rename it, so other machines never see a partially written object.
+        QSaveFile file(fileInfo.absoluteFilePath());
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return false;
+        }
+
+        file.write(data);
+        return file.commit();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    HttpProductCacheBackend::HttpProductCacheBackend(QString baseUrl, int timeoutMs)
+        : m_baseUrl(AZStd::move(baseUrl))
+        , m_timeoutMs(timeoutMs)
+    {
+        while (m_baseUrl.endsWith('/'))
+        {
+            m_baseUrl.chop(1);
+        }
+    }
+
+    bool HttpProductCacheBackend::Exists(const QString& key) const
+    {
+        return SendRequest("HEAD", key, nullptr, nullptr);
+    }
+
+    bool HttpProductCacheBackend::Read(const QString& key, QByteArray& data) const
+    {
+        return SendRequest("GET", key, nullptr, &data);
+    }
+
+    bool HttpProductCacheBackend::Write(const QString& key, const QByteArray& data)
+    {
+        return SendRequest("PUT", key, &data, nullptr);
+    }
+
+    bool HttpProductCacheBackend::SendRequest(const QByteArray& verb, const QString& key, const QByteArray* body, QByteArray* response) const
+    {
+        // This is called from the job threads, which don't run an event loop. The network access manager and the reply
+        // belong to the calling thread, so run a local event loop until the request is done.
+        QNetworkAccessManager& networkAccessManager = GetThreadNetworkAccessManager();
+        QNetworkRequest request(QUrl(QString("%1/%2").arg(m_baseUrl, key)));
+        request.setTransferTimeout(m_timeoutMs);
+        if (body)
+        {
+            request.setHeader(QNetworkRequest::ContentTypeHeader, "application/octet-stream");
+        }
+
+        QNetworkReply* reply = body
+            ? networkAccessManager.sendCustomRequest(request, verb, *body)
+            : networkAccessManager.sendCustomRequest(request, verb);
+
+        if (!reply->isFinished())
+        {
+            QEventLoop eventLoop;
+            QObject::connect(reply, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+            eventLoop.exec(QEventLoop::ExcludeUserInputEvents);
+        }
+
+        const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        const bool success = reply->error() == QNetworkReply::NoError && statusCode >= 200 && statusCode < 300;
+        if (!success && statusCode != 404)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Product cache request %s %s failed with status %d (%s).\n",
+                verb.constData(), reply->url().toString().toUtf8().constData(), statusCode, reply->errorString().toUtf8().constData());
+        }
+        else if (success && response)
+        {
+            *response = reply->readAll();
+        }
+
+        delete reply;
+        return success;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    AZStd::unique_ptr<ProductCache> ProductCache::Create(const AZStd::string& address)
+    {
+        const QString cacheAddress = QString::fromUtf8(address.c_str());
+        if (IsHttpAddress(cacheAddress))
+        {
+            return AZStd::make_unique<ProductCache>(AZStd::make_unique<HttpProductCacheBackend>(cacheAddress));
+        }
+        return AZStd::make_unique<ProductCache>(AZStd::make_unique<LocalDirectoryProductCacheBackend>(cacheAddress));
+    }
+
+    bool ProductCache::IsHttpAddress(const QString& address)
+    {
+        return address.startsWith("http://", Qt::CaseInsensitive) || address.startsWith("https://", Qt::CaseInsensitive);
+    }
+
+    QString ProductCache::ComputeJobCacheKey(const BuilderParams& builderParams)
+    {
+        // the relative path is used so that machines with the project in different locations share the same keys.
+        QString sourcePath = QString::fromUtf8(builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.RelativePath().c_str());
+        sourcePath.replace('\\', '/');
+
+        const QString keySource = QString("%1|%2|%3|%4|%5").arg(
+            sourcePath,
+            builderParams.m_rcJob->GetJobKey(),
+            QString::fromUtf8(builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str()),
+            QString::fromUtf8(builderParams.m_rcJob->GetBuilderGuid().ToString<AZStd::string>().c_str()))
+            .arg(builderParams.m_rcJob->GetOriginalFingerprint());
+
+        return QString::fromLatin1(QCryptographicHash::hash(keySource.toUtf8(), QCryptographicHash::Sha256).toHex());
+    }
+
+    void ProductCache::SplitIntoChunks(const char* data, qint64 size, const AZStd::function<void(qint64 offset, qint64 size)>& chunkCallback)
+    {
+        qint64 chunkStart = 0;
+        while (chunkStart < size)
+        {
+            const qint64 remaining = size - chunkStart;
+            if (remaining <= MinChunkSize)
+            {
+                chunkCallback(chunkStart, remaining);
+                return;
+            }
+
+            // gear hash over the bytes of the chunk, a boundary is placed where the low bits of the hash are all zero.
+            const qint64 maxChunkEnd = chunkStart + AZStd::min(remaining, MaxChunkSize);
+            qint64 chunkEnd = chunkStart + MinChunkSize;
+            AZ::u64 hash = 0;
+            for (; chunkEnd < maxChunkEnd; ++chunkEnd)
+            {
+                hash = (hash << 1) + GearTable[static_cast<AZ::u8>(data[chunkEnd])];
+                if ((hash & ChunkBoundaryMask) == 0)
+                {
+                    ++chunkEnd;
+                    break;
+                }
+            }
+
+            chunkCallback(chunkStart, chunkEnd - chunkStart);
+            chunkStart = chunkEnd;
+        }
+    }
+
+    ProductCache::ProductCache(AZStd::unique_ptr<ProductCacheBackend> backend)
+        : m_backend(AZStd::move(backend))
+    {
+    }
+
+    bool ProductCache::Store(const QString& jobCacheKey, const QString& tempJobDirectory, const AZStd::vector<ExternalFile>& externalFiles)
+    {
+        ProductCacheStatistics statistics;
+        const QString manifestKey = GetManifestKey(jobCacheKey);
+        if (m_backend->Exists(manifestKey))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job %s is already in the product cache.\n", jobCacheKey.toUtf8().constData());
+            return true;
+        }
+
+        QJsonArray manifestFiles;
+        bool success = true;
+
+        const QDir jobDirectory(tempJobDirectory);
+        QDirIterator fileIterator(tempJobDirectory, QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden, QDirIterator::Subdirectories);
+        while (success && fileIterator.hasNext())
+        {
+            const QString absolutePath = fileIterator.next();
+            success = StoreFile(absolutePath, jobDirectory.relativeFilePath(absolutePath), manifestFiles, statistics);
+        }
+
+        for (const ExternalFile& externalFile : externalFiles)
+        {
+            if (!success)
+            {
+                break;
+            }
+            success = StoreFile(externalFile.m_absolutePath, externalFile.m_relativePath, manifestFiles, statistics);
+        }
+
+        if (success)
+        {
+            QJsonObject manifest;
+            manifest["version"] = ManifestVersion;
+            manifest["files"] = manifestFiles;
+            const QByteArray manifestData = QJsonDocument(manifest).toJson(QJsonDocument::Compact);
+
+            // the manifest is written last, once every chunk it refers to is stored.
+            success = m_backend->Write(manifestKey, manifestData);
+            if (success)
+            {
+                ++statistics.m_storeCount;
+                statistics.m_bytesWritten += manifestData.size();
+            }
+        }
+
+        AZ_Warning(AssetProcessor::DebugChannel, success, "Unable to store job %s in the product cache.\n", jobCacheKey.toUtf8().constData());
+        RecordStatistics(statistics);
+        return success;
+    }
+
+    bool ProductCache::StoreFile(const QString& absolutePath, const QString& relativePath, QJsonArray& manifestFiles, ProductCacheStatistics& statistics)
+    {
+        QFile file(absolutePath);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to read %s to store it in the product cache.\n", absolutePath.toUtf8().constData());
+            return false;
+        }
+        const QByteArray fileData = file.readAll();
+
+        QJsonArray chunks;
+        bool success = true;
+        SplitIntoChunks(fileData.constData(), fileData.size(),
+            [this, &fileData, &chunks, &success, &statistics](qint64 offset, qint64 size)
+            {
+                if (!success)
+                {
+                    return;
+                }
+
+                const QByteArray chunkData = QByteArray::fromRawData(fileData.constData() + offset, aznumeric_cast<int>(size));
+                const QByteArray chunkHash = QCryptographicHash::hash(chunkData, QCryptographicHash::Sha256).toHex();
+                const QString chunkKey = GetChunkKey(chunkHash);
+                chunks.append(QString::fromLatin1(chunkHash));
+
+                if (m_backend->Exists(chunkKey))
+                {
+                    ++statistics.m_chunksDeduplicated;
+                    return;
+                }
+
+                success = m_backend->Write(chunkKey, chunkData);
+                if (success)
+                {
+                    ++statistics.m_chunksWritten;
+                    statistics.m_bytesWritten += size;
+                }
+            });
+
+        if (success)
+        {
+            QJsonObject manifestFile;
+            manifestFile["path"] = QDir::fromNativeSeparators(relativePath);
+            manifestFile["size"] = static_cast<qint64>(fileData.size());
+            manifestFile["chunks"] = chunks;
+            manifestFiles.append(manifestFile);
+        }
+        return success;
+    }
+
+    bool ProductCache::Retrieve(const QString& jobCacheKey, const QString& tempJobDirectory)
+    {
+        ProductCacheStatistics statistics;
+
+        QByteArray manifestData;
+        if (!m_backend->Read(GetManifestKey(jobCacheKey), manifestData))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job %s is not in the product cache.\n", jobCacheKey.toUtf8().constData());
+            ++statistics.m_missCount;
+            RecordStatistics(statistics);
+            return false;
+        }
+        statistics.m_bytesRead += manifestData.size();
+
+        const QJsonObject manifest = QJsonDocument::fromJson(manifestData).object();
+        bool success = manifest["version"].toInt() == ManifestVersion;
+
+        const QDir jobDirectory(tempJobDirectory);
+        QStringList writtenFiles;
+        const QJsonArray manifestFiles = manifest["files"].toArray();
+        for (auto fileIter = manifestFiles.begin(); success && fileIter != manifestFiles.end(); ++fileIter)
+        {
+            const QJsonObject manifestFile = fileIter->toObject();
+            const QString relativePath = manifestFile["path"].toString();
+            if (!IsSafeRelativePath(relativePath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Product cache job %s contains the invalid path %s.\n",
+                    jobCacheKey.toUtf8().constData(), relativePath.toUtf8().constData());
+                success = false;
+                break;
+            }
+
+            const qint64 fileSize = GetManifestFileSize(manifestFile);
+            if (fileSize < 0 || fileSize > AZStd::numeric_limits<int>::max())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Product cache job %s contains %s with the unsupported size %lld.\n",
+                    jobCacheKey.toUtf8().constData(), relativePath.toUtf8().constData(), fileSize);
+                success = false;
+                break;
+            }
+
+            QByteArray fileData;
+            fileData.reserve(aznumeric_cast<int>(fileSize));
+            const QJsonArray chunks = manifestFile["chunks"].toArray();
+            for (auto chunkIter = chunks.begin(); success && chunkIter != chunks.end(); ++chunkIter)
+            {
+                const QByteArray chunkHash = chunkIter->toString().toLatin1();
+                QByteArray chunkData;
+                // verify the chunk, a corrupted chunk would otherwise end up in the products of every job that uses it.
+                success = m_backend->Read(GetChunkKey(chunkHash), chunkData) &&
+                    QCryptographicHash::hash(chunkData, QCryptographicHash::Sha256).toHex() == chunkHash;
+                fileData.append(chunkData);
+                statistics.m_bytesRead += chunkData.size();
+            }
+
+            if (!success || fileData.size() != fileSize)
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to read %s of job %s from the product cache.\n",
+                    relativePath.toUtf8().constData(), jobCacheKey.toUtf8().constData());
+                success = false;
+                break;
+            }
+
+            const QString absolutePath = jobDirectory.absoluteFilePath(relativePath);
+            QFileInfo(absolutePath).absoluteDir().mkpath(".");
+            QFile file(absolutePath);
+            success = file.open(QIODevice::WriteOnly) && file.write(fileData) == fileData.size();
+            writtenFiles.push_back(absolutePath);
+        }
+
+        if (success)
+        {
+            ++statistics.m_hitCount;
+        }
+        else
+        {
+            // don't leave partial results behind, the job is processed locally in the same temporary directory.
+            for (const QString& writtenFile : writtenFiles)
+            {
+                QFile::remove(writtenFile);
+            }
+            ++statistics.m_missCount;
+        }
+
+        RecordStatistics(statistics);
+        return success;
+    }
+
+    ProductCacheStatistics ProductCache::GetStatistics() const
+    {
+        AZStd::scoped_lock lock(m_statisticsMutex);
+        return m_statistics;
+    }
+
+    void ProductCache::RecordStatistics(const ProductCacheStatistics& statistics)
+    {
+        {
+            AZStd::scoped_lock lock(m_statisticsMutex);
+            m_statistics += statistics;
+        }
+        JobDiagnosticRequestBus::Broadcast(&JobDiagnosticRequestBus::Events::RecordProductCacheStatistics, statistics);
+    }
+} // namespace AssetProcessor
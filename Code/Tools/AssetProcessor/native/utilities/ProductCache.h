@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <native/utilities/JobDiagnosticTracker.h>
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QString>
+
+namespace AssetProcessor
+{
+    struct BuilderParams;
+
+    //! Storage used by the ProductCache. Objects are addressed by a relative key such as "objects/ab/abcdef..."
+    //! All functions can be called from multiple job threads at the same time.
+    class ProductCacheBackend
+    {
+    public:
+        virtual ~ProductCacheBackend() = default;
+
+        virtual bool Exists(const QString& key) const = 0;
+        virtual bool Read(const QString& key, QByteArray& data) const = 0;
+        //! Writing an object that already exists must either leave it unchanged or replace it with the same data.
+        virtual bool Write(const QString& key, const QByteArray& data) = 0;
+    };
+
+    //! Stores the objects as files in a local directory or on a network share.
+    class LocalDirectoryProductCacheBackend
+        : public ProductCacheBackend
+    {
+    public:
+        explicit LocalDirectoryProductCacheBackend(QString rootDirectory);
+
+        bool Exists(const QString& key) const override;
+        bool Read(const QString& key, QByteArray& data) const override;
+        bool Write(const QString& key, const QByteArray& data) override;
+
+    private:
+        QString m_rootDirectory;
+    };
+
+    //! Stores the objects on a HTTP server, using HEAD, GET and PUT requests on "<base url>/<key>".
+    //! The layout is the same as the one of the local directory backend, so a directory written by that backend can be
+    //! served as is by any static file server for clients, while servers need a HTTP server that accepts PUT requests.
+    class HttpProductCacheBackend
+        : public ProductCacheBackend
+    {
+    public:
+        static constexpr int DefaultTimeoutMs = 30000;
+
+        explicit HttpProductCacheBackend(QString baseUrl, int timeoutMs = DefaultTimeoutMs);
+
+        bool Exists(const QString& key) const override;
+        bool Read(const QString& key, QByteArray& data) const override;
+        bool Write(const QString& key, const QByteArray& data) override;
+
+    private:
+        bool SendRequest(const QByteArray& verb, const QString& key, const QByteArray* body, QByteArray* response) const;
+
+        QString m_baseUrl;
+        int m_timeoutMs;
+    };
+
+    //! Content addressed cache for the results of jobs.
+    //! The outputs of a job are stored under a key computed from the job fingerprint, which already covers the source file hash,
+    //! the builder version and the fingerprints of the job dependencies. Every file is split into content defined chunks that
+    //! are stored by their SHA-256 hash, so identical data is only stored once even across different jobs and different
+    //! versions of the same product. A manifest per job lists the chunks of each file and is only written once all of its
+    //! chunks are stored, so a partially stored job is never retrieved.
+    class ProductCache
+    {
+    public:
+        static constexpr qint64 MinChunkSize = 16 * 1024;
+        static constexpr qint64 MaxChunkSize = 256 * 1024;
+        static constexpr AZ::u64 ChunkBoundaryMask = (64 * 1024) - 1; //!< Results in chunks of about 80KB on average, MinChunkSize plus 64KB.
+        static constexpr int ManifestVersion = 1;
+
+        //! A file outside of the temporary job directory that has to be stored with the job, see AssetServerBusTraits::StoreJobResult.
+        struct ExternalFile
+        {
+            QString m_absolutePath;
+            QString m_relativePath; //!< Path the file gets restored to, relative to the temporary job directory.
+        };
+
+        //! Creates a cache with a HTTP backend for http and https addresses, and a local directory backend for all other addresses.
+        static AZStd::unique_ptr<ProductCache> Create(const AZStd::string& address);
+        static bool IsHttpAddress(const QString& address);
+
+        //! Key of the job in the cache. Only jobs with the same source, builder, job key, platform and fingerprint share a key.
+        static QString ComputeJobCacheKey(const BuilderParams& builderParams);
+
+        //! Calls chunkCallback with the offset and size of every chunk of the data.
+        //! Chunk boundaries only depend on the bytes around them, so inserting data only changes the chunks close to the insertion.
+        static void SplitIntoChunks(const char* data, qint64 size, const AZStd::function<void(qint64 offset, qint64 size)>& chunkCallback);
+
+        explicit ProductCache(AZStd::unique_ptr<ProductCacheBackend> backend);
+
+        //! Stores every file in the temporary job directory and the external files under the job key.
+        bool Store(const QString& jobCacheKey, const QString& tempJobDirectory, const AZStd::vector<ExternalFile>& externalFiles = {});
+        //! Restores the files of the job into the temporary job directory.
+        //! Returns false if the job is not in the cache or can't be restored, in which case no files are left behind.
+        bool Retrieve(const QString& jobCacheKey, const QString& tempJobDirectory);
+
+        //! Totals of all the stores and retrieves done by this cache, these are also reported to the JobDiagnosticRequestBus.
+        ProductCacheStatistics GetStatistics() const;
+
+    private:
+        bool StoreFile(const QString& absolutePath, const QString& relativePath, QJsonArray& manifestFiles, ProductCacheStatistics& statistics);
+        void RecordStatistics(const ProductCacheStatistics& statistics);
+
+        AZStd::unique_ptr<ProductCacheBackend> m_backend;
+
+        mutable AZStd::mutex m_statisticsMutex;
+        ProductCacheStatistics m_statistics;
+    };
+} // namespace AssetProcessor
@@ -19,6 +19,7 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
 #include <inttypes.h>
@@ -38,6 +39,7 @@ namespace AssetProcessor
             StatsCaptureImpl();
             void BeginCaptureStat(AZStd::string_view statName);
             AZStd::optional<AZStd::sys_time_t> EndCaptureStat(AZStd::string_view statName, bool persistToDb);
+            void AddStatItemCount(AZStd::string_view statName, int64_t itemCount);
             void Dump();
         private:
             using timepoint = AZStd::chrono::steady_clock::time_point;
@@ -47,8 +49,11 @@ namespace AssetProcessor
                 duration m_cumulativeTime = {};    // The total amount of time spent on this.
                 timepoint m_operationStartTime = {}; // Async tracking - the last time stamp an operation started.
                 int64_t m_operationCount = 0; // In case there's more than one sample.  Used to calc average.
+                int64_t m_itemCount = 0; // Number of items processed over all the samples.  Used to calc throughput.
             };
 
+            // stats can be captured from the scanner threads as well as the main thread.
+            AZStd::mutex m_statsMutex;
             AssetDatabaseConnection m_dbConnection;
             AZStd::unordered_map<AZStd::string, StatsEntry> m_stats;
             bool m_dumpMachineReadableStats = false;
@@ -132,6 +137,35 @@ namespace AssetProcessor
                 }
             }
 
+            // Prints the number of items processed by a stat and how many were processed per second.
+            void PrintThroughput([[maybe_unused]] const char* name, const StatsEntry& stat)
+            {
+                if (stat.m_itemCount <= 0)
+                {
+                    return;
+                }
+
+                const int64_t itemsPerSecond = stat.m_cumulativeTime.count() > 0
+                    ? static_cast<int64_t>(static_cast<double>(stat.m_itemCount) * 1000.0 / static_cast<double>(stat.m_cumulativeTime.count()))
+                    : stat.m_itemCount;
+
+                if (m_dumpHumanReadableStats)
+                {
+                    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "    Items: %8" PRId64 ", Per second: %8" PRId64 ", EventName: %s\n",
+                        stat.m_itemCount,
+                        itemsPerSecond,
+                        name);
+                }
+                if (m_dumpMachineReadableStats)
+                {
+                    // 'MachineReadableThroughput:items:itemsPerSecond:name'
+                    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "MachineReadableThroughput:%" PRId64 ":%" PRId64 ":%s\n",
+                        stat.m_itemCount,
+                        itemsPerSecond,
+                        name);
+                }
+            }
+
             // calls PrintStat on each element in the vector.
             void PrintStatsArray(AZStd::vector<AZStd::string>& keys, int maxToPrint, const char* header)
             {
@@ -180,6 +214,7 @@ namespace AssetProcessor
                 return;
             }
 
+            AZStd::scoped_lock lock(m_statsMutex);
             StatsEntry& existingStat = m_stats[statName];
             if (existingStat.m_operationStartTime != timepoint())
             {
@@ -196,6 +231,7 @@ namespace AssetProcessor
                 return AZStd::optional<AZStd::sys_time_t>();
             }
 
+            AZStd::scoped_lock lock(m_statsMutex);
             StatsEntry& existingStat = m_stats[statName];
             AZStd::optional<AZStd::sys_time_t> operationDurationInMillisecond;
             if (existingStat.m_operationStartTime != timepoint())
@@ -218,6 +254,17 @@ namespace AssetProcessor
             return operationDurationInMillisecond;
         }
 
+        void StatsCaptureImpl::AddStatItemCount(AZStd::string_view statName, int64_t itemCount)
+        {
+            if (!m_dbConnectionIsOpen)
+            {
+                return;
+            }
+
+            AZStd::scoped_lock lock(m_statsMutex);
+            m_stats[statName].m_itemCount += itemCount;
+        }
+
         void StatsCaptureImpl::Dump()
         {
             if (!m_dbConnectionIsOpen)
@@ -225,6 +272,7 @@ namespace AssetProcessor
                 return;
             }
 
+            AZStd::scoped_lock lock(m_statsMutex);
             timepoint startTimeStamp = AZStd::chrono::steady_clock::now();
 
             auto settingsRegistry = AZ::SettingsRegistry::Get();
@@ -355,6 +403,9 @@ namespace AssetProcessor
 
             StatsEntry& totalScanTime = m_stats["AssetScanning"];
             PrintStat("AssetScanning", totalScanTime.m_cumulativeTime, totalScanTime.m_operationCount);
+            StatsEntry& directoryScanTime = m_stats["DirectoryScan"];
+            PrintStat("DirectoryScan", directoryScanTime.m_cumulativeTime, directoryScanTime.m_operationCount);
+            PrintThroughput("DirectoryScan", directoryScanTime);
             StatsEntry& cacheWarmTime = m_stats["WarmingFileCache"];
             PrintStat("WarmingFileCache", cacheWarmTime.m_cumulativeTime, cacheWarmTime.m_operationCount);
             StatsEntry& assessTime = m_stats["InitialFileAssessment"];
@@ -384,7 +435,7 @@ namespace AssetProcessor
             }
             duration costToGenerateStats = AZStd::chrono::duration_cast<duration>(AZStd::chrono::steady_clock::now() - startTimeStamp);
             PrintStat("ComputeStatsTime", costToGenerateStats, 1);
-        }
+        }
 
         // Public interface:
         static StatsCaptureImpl* g_instance = nullptr;
@@ -433,6 +484,15 @@ namespace AssetProcessor
             return AZStd::optional<AZStd::sys_time_t>();
         }
 
+        //! Add to the number of items that were processed during the captures of a stat.
+        void AddStatItemCount(AZStd::string_view statName, AZ::s64 itemCount)
+        {
+            if (g_instance)
+            {
+                g_instance->AddStatItemCount(statName, itemCount);
+            }
+        }
+
         //! Do additional processing and then write the cumulative stats to log.
         //! Note that since this is an AP-specific system, the analysis done in the dump function
         //! is going to make a lot of assumptions about the way the data is encoded.
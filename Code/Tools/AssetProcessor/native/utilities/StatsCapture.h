@@ -12,6 +12,7 @@
 // This is not meant to be used anywhere except in AssetProcessor.
 
 #pragma once
+#include <AzCore/base.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -33,6 +34,10 @@ namespace AssetProcessor
         //! or if BeginCaptureStat was not called before, no duration is returned.
         AZStd::optional<AZStd::sys_time_t> EndCaptureStat(AZStd::string_view statName, bool persistToDb = false);
 
+        //! Add to the number of items that were processed during the captures of a stat, for example the number of
+        //! files found by a scan. Stats with an item count also report their throughput in items per second.
+        void AddStatItemCount(AZStd::string_view statName, AZ::s64 itemCount);
+
         //! Do additional processing and then write the cumulative stats to log.
         //! Note that since this is an AP-specific system, the analysis done in the dump function
         //! is going to make a lot of assumptions about the way the data is encoded.
@@ -50,6 +50,15 @@ namespace Multiplayer
             AzNetworking::IConnection* invokingConnection,
             const Multiplayer::NetworkInputMigrationVector& inputArray
         ) override;
+
+        //! Captures the most recently received client inputs, oldest first, so they can accompany this entity on a server to server migration.
+        //! @return the captured inputs, empty if no input has been received from the client yet
+        NetworkInputMigrationVector GetServerMigrationInputs() const;
+
+        //! Seeds input processing with inputs captured by the previous authoritative server during a server to server migration.
+        //! This prevents inputs the previous server already processed from being processed a second time on this server.
+        //! @param inputArray the inputs captured by the previous authoritative server, oldest first
+        void ApplyServerMigrationInputs(const NetworkInputMigrationVector& inputArray);
 #endif
 
 #if AZ_TRAIT_CLIENT
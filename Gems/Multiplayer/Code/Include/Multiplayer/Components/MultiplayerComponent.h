@@ -11,10 +11,12 @@
 #include <AzCore/Component/Component.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
+#include <AzNetworking/Utilities/PackedQuantizers.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 
 //! Macro to declare bindings for a multiplayer component inheriting from MultiplayerComponent
 #define AZ_MULTIPLAYER_COMPONENT(ComponentClass, Guid, Base) \
@@ -163,6 +165,49 @@ namespace Multiplayer
         }
     }
 
+    //! Serializes a plain value through the provided packed quantizer.
+    template <typename QUANTIZER, typename TYPE>
+    inline bool SerializeQuantizedValue(AzNetworking::ISerializer& serializer, TYPE& value, const char* name)
+    {
+        return QUANTIZER::Serialize(serializer, value, name);
+    }
+
+    //! Serializes a rewindable value through the provided packed quantizer.
+    template <typename QUANTIZER, typename TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool SerializeQuantizedValue(AzNetworking::ISerializer& serializer, RewindableObject<TYPE, REWIND_SIZE>& value, const char* name)
+    {
+        return serializer.BeginObject(name) && value.template SerializeQuantized<QUANTIZER>(serializer) && serializer.EndObject(name);
+    }
+
+    template <typename QUANTIZER, typename TYPE>
+    inline void SerializeQuantizedNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        if (bitset.GetBit(bitIndex))
+        {
+            const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
+            const uint32_t prevUpdateSize = serializer.GetSize();
+            serializer.ClearTrackedChangesFlag();
+            SerializeQuantizedValue<QUANTIZER>(serializer, value, name);
+            if (modifyRecord && !serializer.GetTrackedChangesFlag())
+            {
+                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
+                bitset.SetBit(bitIndex, false);
+            }
+            const uint32_t postUpdateSize = serializer.GetSize();
+            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        }
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
@@ -20,12 +20,14 @@ namespace Multiplayer
 {
     constexpr AZStd::string_view MpNetworkInterfaceName("MultiplayerNetworkInterface");
     constexpr AZStd::string_view MpEditorInterfaceName("MultiplayerEditorNetworkInterface");
+    constexpr AZStd::string_view MpServerMeshInterfaceName("MultiplayerServerMeshNetworkInterface");
     constexpr AZStd::string_view LocalHost("127.0.0.1");
     constexpr AZStd::string_view NetworkFileExtension(".network");
     constexpr AZStd::string_view NetworkSpawnableFileExtension(".network.spawnable");
 
     constexpr uint16_t DefaultServerPort = 33450;
     constexpr uint16_t DefaultServerEditorPort = 33451;
+    constexpr uint16_t DefaultServerMeshPort = 33452;
 
     constexpr AZ::Metrics::EventLoggerId NetworkingMetricsId{ static_cast<AZ::u32>(AZStd::hash<AZStd::string_view>{}("Networking")) };
 }
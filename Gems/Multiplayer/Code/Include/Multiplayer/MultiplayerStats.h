@@ -29,6 +29,10 @@ namespace Multiplayer
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
+        //! Duration of the most recent multiplayer tick, and the number of ticks recorded so far.
+        AZ::TimeUs m_frameTimeUs = AZ::Time::ZeroTimeUs;
+        uint64_t m_frameCount = 0;
+
         static const uint32_t RingbufferSamples = 32;
         using MetricRingbuffer = AZStd::array<uint64_t, RingbufferSamples>;
         struct Metric
@@ -16,6 +16,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Multiplayer/NetworkInput/NetworkInputMigrationVector.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
@@ -37,7 +38,7 @@ namespace Multiplayer
     class IEntityDomain;
     class EntityReplicator;
 
-    using SendMigrateEntityEvent = AZ::Event<AzNetworking::IConnection&, const EntityMigrationMessage&>;
+    using SendMigrateEntityEvent = AZ::Event<AzNetworking::IConnection&, const EntityMigrationMessage&, const NetworkInputMigrationVector&>;
 
     //! @class EntityReplicationManager
     //! @brief Handles replication of relevant entities for one connection.
@@ -84,7 +85,7 @@ namespace Multiplayer
         void AddAutonomousEntityReplicatorCreatedHandler(AZ::Event<NetEntityId>::Handler& handler);
         void AddSendMigrateEntityEventHandler(SendMigrateEntityEvent::Handler& handler);
 
-        bool HandleEntityMigration(AzNetworking::IConnection* invokingConnection, EntityMigrationMessage& message);
+        bool HandleEntityMigration(AzNetworking::IConnection* invokingConnection, EntityMigrationMessage& message, const NetworkInputMigrationVector& inputMigrationVector);
         bool HandleEntityDeleteMessage(EntityReplicator* entityReplicator, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
         bool HandleEntityUpdateMessage(AzNetworking::IConnection* invokingConnection, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
         bool HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector);
@@ -216,6 +217,7 @@ namespace Multiplayer
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
+        float m_averageEntityUpdateSize = 0.0f; // Moving average of serialized entity update sizes, used to budget proxy sends against the connection's congestion window
         Mode m_updateMode = Mode::Invalid;
 
         friend class EntityReplicator;
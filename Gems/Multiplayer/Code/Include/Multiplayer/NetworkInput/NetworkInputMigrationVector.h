@@ -31,6 +31,10 @@ namespace Multiplayer
         const NetworkInput& operator[](uint32_t index) const;
         bool PushBack(const NetworkInput& networkInput);
 
+        //! Inputs are compared by their client input and host frame ids, component input payloads are not inspected.
+        bool operator==(const NetworkInputMigrationVector& rhs) const;
+        bool operator!=(const NetworkInputMigrationVector& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
     private:
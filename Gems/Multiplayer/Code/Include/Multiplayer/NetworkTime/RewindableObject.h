@@ -87,6 +87,12 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serialize method that transmits the current value through a packed quantizer (see AzNetworking/Utilities/PackedQuantizers.h)
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        template <typename QUANTIZER>
+        bool SerializeQuantized(AzNetworking::ISerializer& serializer);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
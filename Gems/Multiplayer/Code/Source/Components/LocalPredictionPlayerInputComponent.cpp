@@ -389,6 +389,52 @@ namespace Multiplayer
         }
     }
 
+    NetworkInputMigrationVector LocalPredictionPlayerInputComponentController::GetServerMigrationInputs() const
+    {
+        NetworkInputMigrationVector inputArray(GetEntityHandle());
+        if (!m_updateBankedTimeEvent.IsScheduled())
+        {
+            // We haven't received any input from the client yet
+            return inputArray;
+        }
+
+        // Input ids are only assigned to array entries as they are processed, so derive them from the most recent input
+        const ClientInputId newestInputId = m_lastInputReceived[0].GetClientInputId();
+        for (uint32_t i = NetworkInputArray::MaxElements; i > 0; --i)
+        {
+            NetworkInput input = m_lastInputReceived[i - 1];
+            input.SetClientInputId(newestInputId - ClientInputId(i - 1)); // This subtraction intentionally wraps around
+            inputArray.PushBack(input);
+        }
+        return inputArray;
+    }
+
+    void LocalPredictionPlayerInputComponentController::ApplyServerMigrationInputs(const NetworkInputMigrationVector& inputArray)
+    {
+        const uint32_t inputCount = inputArray.GetSize();
+        if (inputCount == 0)
+        {
+            return;
+        }
+
+        // Rebuild the last received input array, newest first
+        const uint32_t copyCount = AZStd::min(inputCount, NetworkInputArray::MaxElements);
+        for (uint32_t i = 0; i < copyCount; ++i)
+        {
+            m_lastInputReceived[i] = inputArray[inputCount - 1 - i];
+        }
+
+        // Everything in the migrated array was processed by the previous authority, resume from the newest input
+        m_lastClientInputId = inputArray[inputCount - 1].GetClientInputId();
+        SetLastInputId(m_lastClientInputId);
+        m_lastInputReceivedTimeMs = AZ::GetElapsedTimeMs();
+
+        if (!m_updateBankedTimeEvent.IsScheduled())
+        {
+            m_updateBankedTimeEvent.Enqueue(sv_InputUpdateTimeMs, true);
+        }
+    }
+
     void LocalPredictionPlayerInputComponentController::UpdateBankedTime(AZ::TimeMs deltaTimeMs)
     {
         const double deltaTime = AZ::TimeMsToSecondsDouble(deltaTimeMs);
@@ -67,6 +67,18 @@ namespace Multiplayer
         return "Unknown component";
     }
 
+    NetComponentId MultiplayerComponentRegistry::FindNetComponentId(const AZ::Name& componentName) const
+    {
+        for (const auto& [netComponentId, componentData] : m_componentData)
+        {
+            if (componentData.m_componentName == componentName)
+            {
+                return netComponentId;
+            }
+        }
+        return InvalidNetComponentId;
+    }
+
     const MultiplayerComponentRegistry::ComponentData& MultiplayerComponentRegistry::GetMultiplayerComponentData(NetComponentId netComponentId) const
     {
         static ComponentData nullComponentData;
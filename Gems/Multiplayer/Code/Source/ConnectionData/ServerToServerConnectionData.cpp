@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ConnectionData/ServerToServerConnectionData.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Source/ReplicationWindows/ServerToServerReplicationWindow.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::TimeMs, sv_ServerEntityReplicatorPendingRemovalTimeMs, AZ::TimeMs{ 1000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "How long should wait prior to removing an entity for a peer server through a change in the replication window, entity deletes are still immediate");
+
+    ServerToServerConnectionData::ServerToServerConnectionData
+    (
+        AzNetworking::IConnection* connection,
+        AzNetworking::IConnectionListener& connectionListener,
+        const HostId& remotePublicHostId,
+        const AZ::Aabb& remoteDomainAabb
+    )
+        : m_entityReplicationManager(*connection, connectionListener, EntityReplicationManager::Mode::LocalServerToRemoteServer)
+        , m_sendMigrateEntityHandler([this](AzNetworking::IConnection& connection, const EntityMigrationMessage& message, const NetworkInputMigrationVector& inputMigrationVector)
+            {
+                OnSendMigrateEntity(connection, message, inputMigrationVector);
+            })
+        , m_remotePublicHostId(remotePublicHostId)
+        , m_connection(connection)
+    {
+        m_entityReplicationManager.SetEntityPendingRemovalMs(sv_ServerEntityReplicatorPendingRemovalTimeMs);
+        m_entityReplicationManager.SetRemoteEntityDomain(AZStd::make_unique<SpatialEntityDomain>(remoteDomainAabb));
+        m_entityReplicationManager.SetReplicationWindow(AZStd::make_unique<ServerToServerReplicationWindow>(remoteDomainAabb, connection));
+        m_entityReplicationManager.AddSendMigrateEntityEventHandler(m_sendMigrateEntityHandler);
+    }
+
+    ServerToServerConnectionData::~ServerToServerConnectionData()
+    {
+        m_sendMigrateEntityHandler.Disconnect();
+        m_entityReplicationManager.Clear(false);
+    }
+
+    ConnectionDataType ServerToServerConnectionData::GetConnectionDataType() const
+    {
+        return ConnectionDataType::ServerToServer;
+    }
+
+    AzNetworking::IConnection* ServerToServerConnectionData::GetConnection() const
+    {
+        return m_connection;
+    }
+
+    EntityReplicationManager& ServerToServerConnectionData::GetReplicationManager()
+    {
+        return m_entityReplicationManager;
+    }
+
+    void ServerToServerConnectionData::Update()
+    {
+        m_entityReplicationManager.ActivatePendingEntities();
+
+        if (CanSendUpdates())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    void ServerToServerConnectionData::OnSendMigrateEntity
+    (
+        AzNetworking::IConnection& connection,
+        const EntityMigrationMessage& message,
+        const NetworkInputMigrationVector& inputMigrationVector
+    )
+    {
+        // Authority over the entity has already been released locally, so the handoff must be delivered reliably
+        connection.SendReliablePacket(MultiplayerPackets::EntityMigration(message, inputMigrationVector));
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/ConnectionData/IConnectionData.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+
+namespace Multiplayer
+{
+    class ServerToServerConnectionData final
+        : public IConnectionData
+    {
+    public:
+        ServerToServerConnectionData
+        (
+            AzNetworking::IConnection* connection,
+            AzNetworking::IConnectionListener& connectionListener,
+            const HostId& remotePublicHostId,
+            const AZ::Aabb& remoteDomainAabb
+        );
+        ~ServerToServerConnectionData() override;
+
+        //! IConnectionData interface
+        //! @{
+        ConnectionDataType GetConnectionDataType() const override;
+        AzNetworking::IConnection* GetConnection() const override;
+        EntityReplicationManager& GetReplicationManager() override;
+        void Update() override;
+        bool CanSendUpdates() const override;
+        void SetCanSendUpdates(bool canSendUpdates) override;
+        bool DidHandshake() const override;
+        void SetDidHandshake(bool didHandshake) override;
+        //! @}
+
+        //! Returns the address clients should use when connecting to the remote server.
+        //! @return the client facing address of the remote server
+        const HostId& GetRemotePublicHostId() const;
+
+    private:
+        void OnSendMigrateEntity(AzNetworking::IConnection& connection, const EntityMigrationMessage& message, const NetworkInputMigrationVector& inputMigrationVector);
+
+        EntityReplicationManager m_entityReplicationManager;
+        SendMigrateEntityEvent::Handler m_sendMigrateEntityHandler;
+        HostId m_remotePublicHostId = InvalidHostId;
+        AzNetworking::IConnection* m_connection = nullptr;
+        bool m_canSendUpdates = true;
+        bool m_didHandshake = true;
+    };
+}
+
+#include <Source/ConnectionData/ServerToServerConnectionData.inl>
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace Multiplayer
+{
+    inline bool ServerToServerConnectionData::CanSendUpdates() const
+    {
+        return m_canSendUpdates;
+    }
+
+    inline void ServerToServerConnectionData::SetCanSendUpdates(bool canSendUpdates)
+    {
+        m_canSendUpdates = canSendUpdates;
+    }
+
+    inline bool ServerToServerConnectionData::DidHandshake() const
+    {
+        return m_didHandshake;
+    }
+
+    inline void ServerToServerConnectionData::SetDidHandshake(bool didHandshake)
+    {
+        m_didHandshake = didHandshake;
+    }
+
+    inline const HostId& ServerToServerConnectionData::GetRemotePublicHostId() const
+    {
+        return m_remotePublicHostId;
+    }
+}
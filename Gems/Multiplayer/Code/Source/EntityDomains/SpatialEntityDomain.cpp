@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer 
+{
+    AZ_CVAR(float, sv_EntityDomainHysteresis, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Distance an entity may travel outside of a spatial entity domain before it is considered to have exited the domain.");
+
+    SpatialEntityDomain::SpatialEntityDomain(const AZ::Aabb& aabb)
+        : m_aabb(aabb)
+    {
+        ;
+    }
+
+    void SpatialEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+    }
+
+    const AZ::Aabb& SpatialEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool SpatialEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        if (entity == nullptr || !m_aabb.IsValid())
+        {
+            return false;
+        }
+
+        const AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (transformInterface == nullptr)
+        {
+            return false;
+        }
+
+        AZ::Aabb expandedAabb = m_aabb;
+        expandedAabb.Expand(AZ::Vector3(static_cast<float>(sv_EntityDomainHysteresis)));
+        return expandedAabb.Contains(transformInterface->GetWorldTranslation());
+    }
+
+    void SpatialEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        if (IsInDomain(entityHandle))
+        {
+            // The previous authority went away while the entity was within our region, take ownership of it
+            AZLOG_INFO("Assuming authority over entity id %llu after losing its authoritative replicator", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+            GetNetworkEntityManager()->ForceAssumeAuthority(entityHandle);
+            return;
+        }
+
+        AZLOG_ERROR("Timed out entity id %llu during migration, marking for removal", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+        GetNetworkEntityManager()->MarkForRemoval(entityHandle);
+    }
+
+    void SpatialEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            debugDisplay->SetColor(AZ::Colors::Yellow);
+            debugDisplay->SetAlpha(0.5f);
+            debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        }
+    }
+}
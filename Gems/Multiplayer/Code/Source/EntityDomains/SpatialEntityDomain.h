@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer 
+{
+    //! @class SpatialEntityDomain
+    //! @brief An entity domain that owns all entities located within an axis aligned region of the world.
+    //! Ownership is tested against the region expanded by sv_EntityDomainHysteresis, so entities straddling the boundary
+    //! between two adjacent domains do not repeatedly migrate back and forth.
+    class SpatialEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        SpatialEntityDomain() = default;
+        explicit SpatialEntityDomain(const AZ::Aabb& aabb);
+        SpatialEntityDomain(const SpatialEntityDomain& rhs) = default;
+
+        //! IEntityDomain overrides.
+        //! @{
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+    };
+}
@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <LoadTest/MultiplayerLoadGenerator.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    AZ_CVAR_EXTERNED(AZ::TimeMs, cl_InputRateMs);
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, cl_serveraddr);
+    AZ_CVAR_EXTERNED(uint16_t, cl_serverport);
+
+    AZ_CVAR(uint32_t, net_LoadTestConnectsPerSecond, 100, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of load test bots to connect per second while ramping up a load test");
+    AZ_CVAR(AZ::TimeMs, net_LoadTestReportIntervalMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Interval at which load test statistics are logged, 0 to only report on demand");
+
+    static constexpr const char* LoadTestInterfacePrefix = "LoadTestBot";
+    static constexpr const char* InputComponentName = "LocalPredictionPlayerInputComponent";
+    static constexpr const char* SendClientInputRpcName = "SendClientInput";
+    static constexpr uint16_t MaxRpcIndexSearch = 64;
+    static constexpr int MaxLoadTestBots = 4096; // Every bot owns a socket, keep well below per process descriptor limits
+
+    // Mirrors the generated parameter struct of LocalPredictionPlayerInputComponent::SendClientInput
+    struct LoadTestClientInputRpcStruct
+        : public IRpcParamStruct
+    {
+        LoadTestClientInputRpcStruct(NetworkInputArray& inputArray)
+            : m_inputArray(inputArray)
+        {
+            ;
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_inputArray, "InputArray")
+                && serializer.Serialize(m_stateHash, "StateHash");
+        }
+
+        NetworkInputArray& m_inputArray;
+        AZ::HashValue32 m_stateHash = AZ::HashValue32{ 0 };
+    };
+
+    void LoadTestSampleSet::AddSample(float sample)
+    {
+        if (m_samples.size() < MaxSamples)
+        {
+            m_samples.push_back(sample);
+        }
+        else
+        {
+            m_samples[m_nextSample] = sample;
+            m_nextSample = (m_nextSample + 1) % MaxSamples;
+        }
+    }
+
+    float LoadTestSampleSet::GetPercentile(float percentile) const
+    {
+        if (m_samples.empty())
+        {
+            return 0.0f;
+        }
+
+        m_scratch.assign(m_samples.begin(), m_samples.end());
+        const float clampedPercentile = AZStd::clamp(percentile, 0.0f, 100.0f);
+        const size_t index = AZStd::min(static_cast<size_t>(clampedPercentile * 0.01f * m_scratch.size()), m_scratch.size() - 1);
+        AZStd::nth_element(m_scratch.begin(), m_scratch.begin() + index, m_scratch.end());
+        return m_scratch[index];
+    }
+
+    uint32_t LoadTestSampleSet::GetSampleCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_samples.size());
+    }
+
+    void LoadTestSampleSet::Clear()
+    {
+        m_samples.clear();
+        m_nextSample = 0;
+    }
+
+    MultiplayerLoadGenerator::~MultiplayerLoadGenerator()
+    {
+        Stop();
+    }
+
+    bool MultiplayerLoadGenerator::Start(uint32_t botCount, const AZStd::string& remoteAddress, uint16_t port)
+    {
+        if (IsRunning())
+        {
+            AZLOG_WARN("A load test is already running, stop it before starting a new one");
+            return false;
+        }
+
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        m_inputComponentId = (componentRegistry != nullptr) ? componentRegistry->FindNetComponentId(AZ::Name(InputComponentName)) : InvalidNetComponentId;
+        if (m_inputComponentId == InvalidNetComponentId)
+        {
+            AZLOG_ERROR("Unable to start load test, %s is not registered", InputComponentName);
+            return false;
+        }
+
+        bool foundRpc = false;
+        for (uint16_t rpcIndex = 0; rpcIndex < MaxRpcIndexSearch; ++rpcIndex)
+        {
+            if (strcmp(componentRegistry->GetComponentRpcName(m_inputComponentId, RpcIndex{ rpcIndex }), SendClientInputRpcName) == 0)
+            {
+                m_sendClientInputRpcIndex = RpcIndex{ rpcIndex };
+                foundRpc = true;
+                break;
+            }
+        }
+
+        if (!foundRpc)
+        {
+            AZLOG_ERROR("Unable to start load test, %s has no %s rpc", InputComponentName, SendClientInputRpcName);
+            return false;
+        }
+
+        m_remoteAddress = IpAddress(remoteAddress.c_str(), port, ProtocolType::Udp);
+        m_bots.reserve(botCount);
+        for (uint32_t botIndex = 0; botIndex < botCount; ++botIndex)
+        {
+            AZStd::unique_ptr<LoadBot> bot = AZStd::make_unique<LoadBot>();
+            bot->m_interfaceName = AZ::Name(AZStd::string::format("%s%u", LoadTestInterfacePrefix, botIndex));
+            for (uint32_t inputIndex = 0; inputIndex < NetworkInputArray::MaxElements; ++inputIndex)
+            {
+                // Bots send inputs without any component inputs attached
+                bot->m_inputHistory[inputIndex].AttachNetBindComponent(nullptr);
+            }
+            m_bots.push_back(AZStd::move(bot));
+        }
+
+        m_nextPendingBot = 0;
+        m_connectAccumulator = 0.0f;
+        m_lastReportTimeMs = AZ::GetElapsedTimeMs();
+        m_lastServerFrameCount = GetMultiplayer()->GetStats().m_frameCount;
+        m_serverFrameTimeSamples.Clear();
+        m_replicationLatencySamples.Clear();
+        m_inputsSent = 0;
+        m_entityUpdatesReceived = 0;
+        m_entityUpdateBytesReceived = 0;
+
+        AZ::TickBus::Handler::BusConnect();
+        AZLOG_INFO("Starting load test with %u bots against %s", botCount, m_remoteAddress.GetString().c_str());
+        return true;
+    }
+
+    void MultiplayerLoadGenerator::Stop()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        Report();
+        AZ::TickBus::Handler::BusDisconnect();
+        for (AZStd::unique_ptr<LoadBot>& bot : m_bots)
+        {
+            DestroyBot(*bot);
+        }
+        m_bots.clear();
+        m_nextPendingBot = 0;
+    }
+
+    bool MultiplayerLoadGenerator::IsRunning() const
+    {
+        return !m_bots.empty();
+    }
+
+    void MultiplayerLoadGenerator::Report()
+    {
+        uint32_t connectedBots = 0;
+        uint32_t playingBots = 0;
+        float sendBytesPerSecond = 0.0f;
+        float recvBytesPerSecond = 0.0f;
+        for (const AZStd::unique_ptr<LoadBot>& bot : m_bots)
+        {
+            if (bot->m_state == BotState::Pending || bot->m_state == BotState::Disconnected)
+            {
+                continue;
+            }
+
+            IConnection* connection = bot->m_networkInterface->GetConnectionSet().GetConnection(bot->m_connectionId);
+            if (connection == nullptr)
+            {
+                continue;
+            }
+
+            ++connectedBots;
+            playingBots += (bot->m_state == BotState::Playing) ? 1 : 0;
+            sendBytesPerSecond += connection->GetMetrics().m_sendDatarate.GetBytesPerSecond();
+            recvBytesPerSecond += connection->GetMetrics().m_recvDatarate.GetBytesPerSecond();
+        }
+
+        AZLOG_INFO("Load test: %u/%u bots connected, %u playing", connectedBots, aznumeric_cast<uint32_t>(m_bots.size()), playingBots);
+        if (m_serverFrameTimeSamples.GetSampleCount() > 0)
+        {
+            AZLOG_INFO("  Server tick time p50/p90/p99: %.3f/%.3f/%.3f ms over %u ticks",
+                m_serverFrameTimeSamples.GetPercentile(50.0f),
+                m_serverFrameTimeSamples.GetPercentile(90.0f),
+                m_serverFrameTimeSamples.GetPercentile(99.0f),
+                m_serverFrameTimeSamples.GetSampleCount());
+        }
+        else
+        {
+            AZLOG_INFO("  Server tick time unavailable, the server is not hosted in this process");
+        }
+        AZLOG_INFO("  Bot bandwidth: send %.2f KB/s, recv %.2f KB/s (%.2f/%.2f KB/s per bot)",
+            sendBytesPerSecond / 1024.0f,
+            recvBytesPerSecond / 1024.0f,
+            (connectedBots > 0) ? sendBytesPerSecond / 1024.0f / connectedBots : 0.0f,
+            (connectedBots > 0) ? recvBytesPerSecond / 1024.0f / connectedBots : 0.0f);
+        AZLOG_INFO("  Replication latency p50/p90/p99: %.1f/%.1f/%.1f ms over %u updates",
+            m_replicationLatencySamples.GetPercentile(50.0f),
+            m_replicationLatencySamples.GetPercentile(90.0f),
+            m_replicationLatencySamples.GetPercentile(99.0f),
+            m_replicationLatencySamples.GetSampleCount());
+        AZLOG_INFO("  Inputs sent: %llu, entity updates received: %llu (%llu bytes)",
+            aznumeric_cast<AZ::u64>(m_inputsSent),
+            aznumeric_cast<AZ::u64>(m_entityUpdatesReceived),
+            aznumeric_cast<AZ::u64>(m_entityUpdateBytesReceived));
+
+        m_serverFrameTimeSamples.Clear();
+        m_replicationLatencySamples.Clear();
+        m_lastReportTimeMs = AZ::GetElapsedTimeMs();
+    }
+
+    void MultiplayerLoadGenerator::StartLoadTest(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("StartLoadTest requires a bot count");
+            return;
+        }
+
+        const AZStd::string botCountArgument(arguments.front());
+        int botCount = 0;
+        if (!AZ::StringFunc::LooksLikeInt(botCountArgument.c_str(), &botCount) || botCount <= 0 || botCount > MaxLoadTestBots)
+        {
+            AZLOG_ERROR("StartLoadTest bot count '%s' is invalid, expected a value between 1 and %d", botCountArgument.c_str(), MaxLoadTestBots);
+            return;
+        }
+
+        AZ::CVarFixedString remoteAddress = cl_serveraddr;
+        uint16_t port = cl_serverport;
+        if (arguments.size() > 1)
+        {
+            remoteAddress = AZ::CVarFixedString(arguments[1]);
+            const AZStd::size_t portSeparator = remoteAddress.find_first_of(':');
+            if (portSeparator != AZStd::string::npos)
+            {
+                port = aznumeric_cast<uint16_t>(atol(remoteAddress.c_str() + portSeparator + 1));
+                remoteAddress.resize(portSeparator);
+            }
+        }
+
+        Start(aznumeric_cast<uint32_t>(botCount), remoteAddress.c_str(), port);
+    }
+
+    void MultiplayerLoadGenerator::StopLoadTest([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Stop();
+    }
+
+    void MultiplayerLoadGenerator::ReportLoadTest([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Report();
+    }
+
+    void MultiplayerLoadGenerator::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ConnectPendingBots(deltaTime);
+        SampleServerFrameTime();
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        for (AZStd::unique_ptr<LoadBot>& bot : m_bots)
+        {
+            if (bot->m_state == BotState::Playing && currentTimeMs >= bot->m_nextInputTimeMs)
+            {
+                SendBotInput(*bot);
+                bot->m_nextInputTimeMs = currentTimeMs + cl_InputRateMs;
+            }
+        }
+
+        const AZ::TimeMs reportIntervalMs = net_LoadTestReportIntervalMs;
+        if (reportIntervalMs > AZ::Time::ZeroTimeMs && currentTimeMs - m_lastReportTimeMs >= reportIntervalMs)
+        {
+            Report();
+        }
+    }
+
+    bool MultiplayerLoadGenerator::IsHandshakeComplete(AzNetworking::IConnection* connection) const
+    {
+        const LoadBot* bot = GetBot(connection);
+        return bot != nullptr && (bot->m_state == BotState::Accepted || bot->m_state == BotState::Playing);
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Bots only ever act as connectors
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        MultiplayerPackets::Accept& packet
+    )
+    {
+        LoadBot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return false;
+        }
+
+        // The server only compresses if it uses the same compressor as us, and expects the same from us
+        connection->SetCompressionEnabled(packet.GetCompressorType() == bot->m_networkInterface->GetCompressorType());
+
+        // Bots have no level to load, so they immediately request entity updates
+        bot->m_state = BotState::Accepted;
+        connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Bots share the console of the process they run in, server cvars are not applied
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        LoadBot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return false;
+        }
+
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            if (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous && !updateMessage.GetIsDelete())
+            {
+                bot->m_autonomousEntityId = updateMessage.GetEntityId();
+            }
+
+            const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+            m_entityUpdateBytesReceived += (updateData != nullptr) ? updateData->GetSize() : 0;
+        }
+        m_entityUpdatesReceived += packet.GetEntityMessages().size();
+
+        if (bot->m_lastHostFrameId == InvalidHostFrameId || packet.GetHostFrameId() > bot->m_lastHostFrameId)
+        {
+            bot->m_lastHostFrameId = packet.GetHostFrameId();
+            bot->m_lastHostTimeMs = packet.GetHostTimeMs();
+        }
+
+        // Host time is relative to the server process, so track the smallest observed offset between the local and host clocks
+        // as the zero latency baseline and add half the round trip time the baseline cannot account for
+        const int64_t clockOffsetMs = static_cast<int64_t>(AZ::GetElapsedTimeMs()) - static_cast<int64_t>(packet.GetHostTimeMs());
+        bot->m_minClockOffsetMs = AZStd::min(bot->m_minClockOffsetMs, clockOffsetMs);
+        const float halfRttMs = connection->GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds() * 500.0f;
+        m_replicationLatencySamples.AddSample(aznumeric_cast<float>(clockOffsetMs - bot->m_minClockOffsetMs) + halfRttMs);
+
+        if (bot->m_state == BotState::Accepted && bot->m_autonomousEntityId != InvalidNetEntityId)
+        {
+            bot->m_state = BotState::Playing;
+        }
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Corrections and other server rpcs are consumed without being applied
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        // Migration is not simulated, the bot stays connected until the server drops it
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        AZLOG_ERROR("Load test bot was rejected by the server due to a multiplayer component version mismatch");
+        return true;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ServerMeshConnect& packet
+    )
+    {
+        // Server mesh packets are only exchanged between servers, a bot should never receive them
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ServerMeshAccept& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::NotifyClientMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadGenerator::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigrationReady& packet
+    )
+    {
+        return false;
+    }
+
+    AzNetworking::ConnectResult MultiplayerLoadGenerator::ValidateConnect
+    (
+        [[maybe_unused]] const AzNetworking::IpAddress& remoteAddress,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] AzNetworking::ISerializer& serializer
+    )
+    {
+        return ConnectResult::Accepted;
+    }
+
+    void MultiplayerLoadGenerator::OnConnect(AzNetworking::IConnection* connection)
+    {
+        const LoadBot* bot = GetBot(connection);
+        if (connection->GetConnectionRole() != ConnectionRole::Connector || bot == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+            return;
+        }
+
+        connection->SendReliablePacket(MultiplayerPackets::Connect(
+            0,
+            0,
+            "",
+            GetMultiplayerComponentRegistry()->GetSystemVersionHash(),
+            bot->m_networkInterface->GetCompressorType()));
+    }
+
+    AzNetworking::PacketDispatchResult MultiplayerLoadGenerator::OnPacketReceived
+    (
+        AzNetworking::IConnection* connection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        AzNetworking::ISerializer& serializer
+    )
+    {
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void MultiplayerLoadGenerator::OnPacketLost([[maybe_unused]] AzNetworking::IConnection* connection, [[maybe_unused]] AzNetworking::PacketId packetId)
+    {
+        ;
+    }
+
+    void MultiplayerLoadGenerator::OnDisconnect
+    (
+        AzNetworking::IConnection* connection,
+        AzNetworking::DisconnectReason reason,
+        [[maybe_unused]] AzNetworking::TerminationEndpoint endpoint
+    )
+    {
+        LoadBot* bot = GetBot(connection);
+        if (bot == nullptr)
+        {
+            return;
+        }
+
+        if (reason != DisconnectReason::TerminatedByUser)
+        {
+            AZLOG_WARN("Load test bot %s disconnected: %s", bot->m_interfaceName.GetCStr(), ToString(reason).data());
+        }
+        bot->m_state = BotState::Disconnected;
+        connection->SetUserData(nullptr);
+    }
+
+    MultiplayerLoadGenerator::LoadBot* MultiplayerLoadGenerator::GetBot(AzNetworking::IConnection* connection) const
+    {
+        return (connection != nullptr) ? reinterpret_cast<LoadBot*>(connection->GetUserData()) : nullptr;
+    }
+
+    void MultiplayerLoadGenerator::ConnectPendingBots(float deltaTime)
+    {
+        if (m_nextPendingBot >= m_bots.size())
+        {
+            return;
+        }
+
+        m_connectAccumulator += deltaTime * aznumeric_cast<float>(static_cast<uint32_t>(net_LoadTestConnectsPerSecond));
+        INetworking* networking = AZ::Interface<INetworking>::Get();
+        const int64_t inputRateMs = AZStd::max<int64_t>(static_cast<int64_t>(static_cast<AZ::TimeMs>(cl_InputRateMs)), 1);
+        while (m_connectAccumulator >= 1.0f && m_nextPendingBot < m_bots.size())
+        {
+            m_connectAccumulator -= 1.0f;
+            LoadBot& bot = *m_bots[m_nextPendingBot++];
+
+            bot.m_networkInterface = networking->CreateNetworkInterface(bot.m_interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+            bot.m_connectionId = bot.m_networkInterface->Connect(m_remoteAddress);
+            IConnection* connection = bot.m_networkInterface->GetConnectionSet().GetConnection(bot.m_connectionId);
+            if (connection == nullptr)
+            {
+                AZLOG_WARN("Load test bot %s failed to connect to %s", bot.m_interfaceName.GetCStr(), m_remoteAddress.GetString().c_str());
+                bot.m_state = BotState::Disconnected;
+                continue;
+            }
+
+            // Spread input across the input interval rather than having every bot send on the same frame
+            connection->SetUserData(&bot);
+            bot.m_state = BotState::Connecting;
+            bot.m_nextInputTimeMs = AZ::GetElapsedTimeMs() + AZ::TimeMs{ m_nextPendingBot % inputRateMs };
+        }
+    }
+
+    void MultiplayerLoadGenerator::SendBotInput(LoadBot& bot)
+    {
+        IConnection* connection = bot.m_networkInterface->GetConnectionSet().GetConnection(bot.m_connectionId);
+        if (connection == nullptr)
+        {
+            return;
+        }
+
+        // Older inputs are resent alongside the newest one so the server can recover from lost packets
+        for (uint32_t inputIndex = NetworkInputArray::MaxElements - 1; inputIndex > 0; --inputIndex)
+        {
+            bot.m_inputHistory[inputIndex] = bot.m_inputHistory[inputIndex - 1];
+        }
+
+        NetworkInput& input = bot.m_inputHistory[0];
+        input.SetClientInputId(bot.m_nextInputId);
+        input.SetHostFrameId(bot.m_lastHostFrameId);
+        input.SetHostTimeMs(bot.m_lastHostTimeMs);
+        input.SetHostBlendFactor(1.0f);
+        ++bot.m_nextInputId;
+
+        LoadTestClientInputRpcStruct rpcParams(bot.m_inputHistory);
+        NetworkEntityRpcMessage rpcMessage(RpcDeliveryType::AutonomousToAuthority, bot.m_autonomousEntityId, m_inputComponentId, m_sendClientInputRpcIndex, ReliabilityType::Unreliable);
+        if (!rpcMessage.SetRpcParams(rpcParams))
+        {
+            AZLOG_ERROR("Load test bot %s failed to serialize client input", bot.m_interfaceName.GetCStr());
+            return;
+        }
+
+        MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.ModifyEntityRpcs().push_back(AZStd::move(rpcMessage));
+        connection->SendUnreliablePacket(entityRpcsPacket);
+        ++m_inputsSent;
+    }
+
+    void MultiplayerLoadGenerator::SampleServerFrameTime()
+    {
+        // Server tick time is only observable when the server is hosted in this process
+        const MultiplayerAgentType agentType = GetMultiplayer()->GetAgentType();
+        if (agentType != MultiplayerAgentType::DedicatedServer && agentType != MultiplayerAgentType::ClientServer)
+        {
+            return;
+        }
+
+        const MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        if (stats.m_frameCount != m_lastServerFrameCount)
+        {
+            m_lastServerFrameCount = stats.m_frameCount;
+            m_serverFrameTimeSamples.AddSample(static_cast<float>(static_cast<int64_t>(stats.m_frameTimeUs)) / 1000.0f);
+        }
+    }
+
+    void MultiplayerLoadGenerator::DestroyBot(LoadBot& bot)
+    {
+        if (bot.m_networkInterface == nullptr)
+        {
+            return;
+        }
+
+        if (bot.m_state != BotState::Disconnected)
+        {
+            bot.m_networkInterface->Disconnect(bot.m_connectionId, DisconnectReason::TerminatedByUser);
+        }
+        if (INetworking* networking = AZ::Interface<INetworking>::Get())
+        {
+            networking->DestroyNetworkInterface(bot.m_interfaceName);
+        }
+        bot.m_networkInterface = nullptr;
+        bot.m_state = BotState::Disconnected;
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! @class LoadTestSampleSet
+    //! @brief Bounded collection of samples used to compute percentiles, the oldest samples are overwritten once full.
+    class LoadTestSampleSet
+    {
+    public:
+        static constexpr uint32_t MaxSamples = 64 * 1024;
+
+        //! Records a single sample.
+        //! @param sample the value to record
+        void AddSample(float sample);
+
+        //! Returns the sample at the requested percentile, or 0 if no samples were recorded.
+        //! @param percentile the percentile to compute, in the range [0, 100]
+        //! @return the sample at the requested percentile
+        float GetPercentile(float percentile) const;
+
+        //! Returns the number of samples currently held.
+        uint32_t GetSampleCount() const;
+
+        //! Discards all recorded samples.
+        void Clear();
+
+    private:
+        AZStd::vector<float> m_samples;
+        mutable AZStd::vector<float> m_scratch;
+        uint32_t m_nextSample = 0;
+    };
+
+    //! @class MultiplayerLoadGenerator
+    //! @brief Simulates many headless clients connecting to a multiplayer server from within a single process.
+    //! Each bot owns its own UDP network interface, completes the regular connection handshake, sends scripted
+    //! input to its autonomous player entity at cl_InputRateMs and consumes the entity updates it is sent.
+    //! Bots never instantiate entities, entity update payloads are only measured and discarded.
+    //! Periodically reports server tick time, bot bandwidth and replication latency percentiles.
+    class MultiplayerLoadGenerator final
+        : public AZ::TickBus::Handler
+        , public AzNetworking::IConnectionListener
+    {
+    public:
+        MultiplayerLoadGenerator() = default;
+        ~MultiplayerLoadGenerator() override;
+
+        //! Connects the requested number of bots to a remote server, bots are ramped up at net_LoadTestConnectsPerSecond.
+        //! @param botCount      number of bots to connect
+        //! @param remoteAddress address of the server to connect to
+        //! @param port          port of the server to connect to
+        //! @return boolean true if the load test was started
+        bool Start(uint32_t botCount, const AZStd::string& remoteAddress, uint16_t port);
+
+        //! Disconnects all bots and releases their network interfaces.
+        void Stop();
+
+        //! Returns true if a load test is currently running.
+        bool IsRunning() const;
+
+        //! Logs the current load test statistics and resets the collected samples.
+        void Report();
+
+        //! Console commands.
+        //! @{
+        void StartLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        void StopLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        void ReportLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        //! @}
+
+        //! AZ::TickBus::Handler overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! @}
+
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerMeshConnect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerMeshAccept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::NotifyClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigrationReady& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+        friend class MultiplayerLoadGeneratorFlowTests;
+
+        enum class BotState
+        {
+            Pending,
+            Connecting,
+            Accepted,
+            Playing,
+            Disconnected
+        };
+
+        struct LoadBot
+        {
+            AZ::Name m_interfaceName;
+            AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            BotState m_state = BotState::Pending;
+            NetEntityId m_autonomousEntityId = InvalidNetEntityId;
+            NetworkInputArray m_inputHistory;
+            ClientInputId m_nextInputId = ClientInputId{ 0 };
+            HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+            AZ::TimeMs m_lastHostTimeMs = AZ::Time::ZeroTimeMs;
+            AZ::TimeMs m_nextInputTimeMs = AZ::Time::ZeroTimeMs;
+            int64_t m_minClockOffsetMs = AZStd::numeric_limits<int64_t>::max();
+        };
+
+        LoadBot* GetBot(AzNetworking::IConnection* connection) const;
+        void ConnectPendingBots(float deltaTime);
+        void SendBotInput(LoadBot& bot);
+        void SampleServerFrameTime();
+        void DestroyBot(LoadBot& bot);
+
+        AZ_CONSOLEFUNC(MultiplayerLoadGenerator, StartLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Connects headless bots to a server: StartLoadTest <botCount> [address[:port]]");
+        AZ_CONSOLEFUNC(MultiplayerLoadGenerator, StopLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Disconnects all load test bots");
+        AZ_CONSOLEFUNC(MultiplayerLoadGenerator, ReportLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Logs the current load test statistics");
+
+        AZStd::vector<AZStd::unique_ptr<LoadBot>> m_bots;
+        AzNetworking::IpAddress m_remoteAddress;
+        uint32_t m_nextPendingBot = 0;
+        float m_connectAccumulator = 0.0f;
+
+        NetComponentId m_inputComponentId = InvalidNetComponentId;
+        RpcIndex m_sendClientInputRpcIndex = RpcIndex{ 0 };
+
+        AZ::TimeMs m_lastReportTimeMs = AZ::Time::ZeroTimeMs;
+        uint64_t m_lastServerFrameCount = 0;
+
+        LoadTestSampleSet m_serverFrameTimeSamples;
+        LoadTestSampleSet m_replicationLatencySamples;
+        uint64_t m_inputsSent = 0;
+        uint64_t m_entityUpdatesReceived = 0;
+        uint64_t m_entityUpdateBytesReceived = 0;
+    };
+}
@@ -261,6 +261,8 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordFrameTime(AZ::TimeUs networkFrameTime)
     {
+        m_frameTimeUs = networkFrameTime;
+        ++m_frameCount;
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
 } // namespace Multiplayer
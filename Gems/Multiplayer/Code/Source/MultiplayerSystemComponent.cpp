@@ -15,6 +15,7 @@
 #include <ConnectionData/ServerToClientConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
 #include <EntityDomains/NullEntityDomain.h>
+#include <EntityDomains/SpatialEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -368,6 +369,8 @@ namespace Multiplayer
         m_postSimulateHandler.Disconnect();
 
         m_metricsEvent.RemoveFromQueue();
+        m_loadGenerator.Stop();
+        m_serverMesh.reset();
         AZ::Interface<ISessionHandlingClientRequests>::Unregister(this);
         m_consoleCommandHandler.Disconnect();
         const AZ::Name interfaceName = AZ::Name(MpNetworkInterfaceName);
@@ -435,6 +438,9 @@ namespace Multiplayer
             m_networkInterface->StopListening();
         }
 
+        // Tear down the server mesh before the entity manager releases the entities it replicates
+        m_serverMesh.reset();
+
         // Clear out all the registered network entities
         GetNetworkEntityManager()->ClearAllEntities();
 
@@ -594,6 +600,11 @@ namespace Multiplayer
         // Send out the game state update to all connections
         UpdateConnections();
 
+        if (m_serverMesh != nullptr)
+        {
+            m_serverMesh->Update();
+        }
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -813,7 +824,9 @@ namespace Multiplayer
             }
         }
 
-        if (connection->SendReliablePacket(MultiplayerPackets::Accept(levelName)))
+        const AzNetworking::CompressorType compressorType =
+            connection->IsCompressionEnabled() ? m_networkInterface->GetCompressorType() : AzNetworking::InvalidCompressorType;
+        if (connection->SendReliablePacket(MultiplayerPackets::Accept(levelName, compressorType)))
         {
             reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->SetDidHandshake(true);
 
@@ -851,6 +864,19 @@ namespace Multiplayer
             }
         }
 
+        // Mismatched compressors or compression dictionaries corrupt every packet, so only compress when the client compresses the same way we do.
+        // The Connect and Accept packets are always sent uncompressed, the Accept packet tells the client whether to compress.
+        const bool compressorMatches = m_networkInterface->GetCompressorType() == packet.GetCompressorType();
+        connection->SetCompressionEnabled(compressorMatches);
+        if (!compressorMatches)
+        {
+            AZLOG_WARN(
+                "Client compressor type (%u) does not match the server compressor type (%u), packets to and from this client will not be compressed. "
+                "Check net_UdpCompressor and the compression dictionaries on both endpoints.",
+                aznumeric_cast<uint32_t>(packet.GetCompressorType()),
+                aznumeric_cast<uint32_t>(m_networkInterface->GetCompressorType()));
+        }
+
         // Make sure the client that's trying to connect has the same multiplayer components
         if (sv_versionMismatch_check_enabled && GetMultiplayerComponentRegistry()->GetSystemVersionHash() != packet.GetSystemVersionHash())
         {
@@ -881,6 +907,9 @@ namespace Multiplayer
         [[maybe_unused]] MultiplayerPackets::Accept& packet
     )
     {
+        // The server only compresses if it uses the same compressor as us, and expects the same from us
+        connection->SetCompressionEnabled(packet.GetCompressorType() == m_networkInterface->GetCompressorType());
+
         reinterpret_cast<IConnectionData*>(connection->GetUserData())->SetDidHandshake(true);
         if (m_temporaryUserIdentifier == 0)
         {
@@ -1147,6 +1176,57 @@ namespace Multiplayer
         return true;
     }
 
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ServerMeshConnect& packet
+    )
+    {
+        // Server mesh traffic is handled by the MultiplayerServerMesh on its own network interface
+        return false;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ServerMeshAccept& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::NotifyClientMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigrationReady& packet
+    )
+    {
+        return false;
+    }
+
     ConnectResult MultiplayerSystemComponent::ValidateConnect
     (
         [[maybe_unused]] const IpAddress& remoteAddress,
@@ -1173,7 +1253,8 @@ namespace Multiplayer
                 0,
                 m_temporaryUserIdentifier,
                 providerTicket.c_str(),
-                GetMultiplayerComponentRegistry()->GetSystemVersionHash()));
+                GetMultiplayerComponentRegistry()->GetSystemVersionHash(),
+                m_networkInterface->GetCompressorType()));
         }
         else
         {
@@ -1347,7 +1428,19 @@ namespace Multiplayer
             {
                 sessionStarted = true;
                 m_spawnNetboundEntities = true;
-                if (!m_networkEntityManager.IsInitialized())
+                if (!m_networkEntityManager.IsInitialized() && IsServerMeshEnabled())
+                {
+                    // Servers in a mesh share one host, so identify this server by the port it is actually bound to
+                    const AZ::CVarFixedString serverAddr = cl_serveraddr;
+                    const uint16_t serverPort = sv_port;
+                    const AzNetworking::ProtocolType serverProtocol = sv_protocol;
+                    const AzNetworking::IpAddress hostId = AzNetworking::IpAddress(serverAddr.c_str(), serverPort, serverProtocol);
+                    const AZ::Aabb entityDomainAabb = GetServerMeshEntityDomainAabb();
+                    m_networkEntityManager.Initialize(hostId, AZStd::make_unique<SpatialEntityDomain>(entityDomainAabb));
+                    m_serverMesh = AZStd::make_unique<MultiplayerServerMesh>(hostId, entityDomainAabb);
+                    m_serverMesh->Start();
+                }
+                else if (!m_networkEntityManager.IsInitialized())
                 {
                     const AZ::CVarFixedString serverAddr = cl_serveraddr;
                     const uint16_t serverPort = cl_serverport;
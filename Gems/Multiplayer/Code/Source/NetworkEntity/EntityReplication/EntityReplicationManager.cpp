@@ -9,6 +9,7 @@
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -32,6 +33,8 @@ namespace Multiplayer
     constexpr uint32_t UdpPacketHeaderSerializeSize = 12;
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
+    // Weight given to each new sample in the moving average of entity update sizes
+    constexpr float EntityUpdateSizeSmoothing = 0.1f;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
@@ -184,6 +187,15 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
+        // Proxy updates can be deferred, so limit them to what the connection's congestion controller can currently absorb
+        uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        const uint32_t availableSendBytes = m_connection.GetAvailableSendBytes();
+        if ((availableSendBytes != AZStd::numeric_limits<uint32_t>::max()) && (m_averageEntityUpdateSize > 0.0f))
+        {
+            const uint32_t budgetedSendCount = aznumeric_cast<uint32_t>(static_cast<float>(availableSendBytes) / m_averageEntityUpdateSize);
+            maxProxySendCount = AZStd::min(maxProxySendCount, budgetedSendCount);
+        }
+
         uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
@@ -222,7 +234,7 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else if (proxySendCount < maxProxySendCount)
                         {
                             toSendList.push_back(replicator);
                             ++proxySendCount;
@@ -268,6 +280,9 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
+            m_averageEntityUpdateSize = (m_averageEntityUpdateSize > 0.0f)
+                ? m_averageEntityUpdateSize + EntityUpdateSizeSmoothing * (static_cast<float>(nextMessageSize) - m_averageEntityUpdateSize)
+                : static_cast<float>(nextMessageSize);
             entityUpdates.push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
@@ -1307,6 +1322,16 @@ namespace Multiplayer
                 netBindComponent->NotifyServerMigration(GetRemoteHostId());
             }
 
+            // Capture any banked client inputs before the controllers are torn down so the new authority can continue processing them
+            NetworkInputMigrationVector inputMigrationVector;
+#if AZ_TRAIT_SERVER
+            NetworkEntityHandle inputEntityHandle(localEnt);
+            if (LocalPredictionPlayerInputComponentController* inputController = inputEntityHandle.FindController<LocalPredictionPlayerInputComponentController>())
+            {
+                inputMigrationVector = inputController->GetServerMigrationInputs();
+            }
+#endif
+
             if (localEnt->GetState() == AZ::Entity::State::Active)
             {
                 netBindComponent->DeactivateControllers(EntityIsMigrating::True);
@@ -1316,7 +1341,7 @@ namespace Multiplayer
 
             EntityMigrationMessage message = replicator->GenerateMigrationPacket();
 
-            m_sendMigrateEntityEvent.Signal(m_connection, message);
+            m_sendMigrateEntityEvent.Signal(m_connection, message, inputMigrationVector);
             AZLOG(NET_RepDeletes, "Migration packet sent %llu to remote host %s", static_cast<AZ::u64>(netEntityId), GetRemoteHostId().GetString().c_str());
 
             // Notify all other EntityReplicationManagers that this entity has migrated so they can adjust their own replicators given our new proxy status
@@ -1327,7 +1352,7 @@ namespace Multiplayer
         }
     }
 
-    bool EntityReplicationManager::HandleEntityMigration(AzNetworking::IConnection* invokingConnection, EntityMigrationMessage& message)
+    bool EntityReplicationManager::HandleEntityMigration(AzNetworking::IConnection* invokingConnection, EntityMigrationMessage& message, const NetworkInputMigrationVector& inputMigrationVector)
     {
         EntityReplicator* replicator = GetEntityReplicator(message.m_netEntityId);
         {
@@ -1372,6 +1397,19 @@ namespace Multiplayer
             netBindComponent->ActivateControllers(EntityIsMigrating::True);
         }
 
+#if AZ_TRAIT_SERVER
+        if (inputMigrationVector.GetSize() > 0)
+        {
+            NetworkEntityHandle inputEntityHandle(entityHandle.GetEntity());
+            if (LocalPredictionPlayerInputComponentController* inputController = inputEntityHandle.FindController<LocalPredictionPlayerInputComponentController>())
+            {
+                inputController->ApplyServerMigrationInputs(inputMigrationVector);
+            }
+        }
+#else
+        AZ_UNUSED(inputMigrationVector);
+#endif
+
         // Change the role on the replicator
         AddEntityReplicator(entityHandle, NetEntityRole::Server);
 
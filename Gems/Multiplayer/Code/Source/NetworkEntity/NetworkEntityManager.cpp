@@ -29,10 +29,12 @@ AZ_DECLARE_BUDGET(MULTIPLAYER);
 namespace Multiplayer
 {
     AZ_CVAR(bool, net_DebugCheckNetworkEntityManager, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables extra debug checks inside the NetworkEntityManager");
+    AZ_CVAR(AZ::TimeMs, sv_EntityDomainUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate at which authoritative entities are checked against a spatial entity domain.");
 
     NetworkEntityManager::NetworkEntityManager()
         : m_networkEntityAuthorityTracker(*this)
         , m_removeEntitiesEvent([this] { RemoveEntities(); }, AZ::Name("NetworkEntityManager remove entities event"))
+        , m_updateEntityDomainEvent([this] { UpdateEntityDomain(); }, AZ::Name("NetworkEntityManager update entity domain event"))
     {
         AZ::Interface<INetworkEntityManager>::Register(this);
         AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
@@ -64,6 +66,7 @@ namespace Multiplayer
         }
 
         m_entityDomain = AZStd::move(entityDomain);
+        m_updateEntityDomainEvent.Enqueue(sv_EntityDomainUpdateMs, true);
     }
 
     bool NetworkEntityManager::IsInitialized() const
@@ -252,7 +255,7 @@ namespace Multiplayer
             {
                 for (auto remoteEntityId : m_removeList)
                 {
-                    if (remoteEntityId == remoteEntityId)
+                    if (remoteEntityId == exitingId)
                     {
                         safeToExit = false;
                     }
@@ -392,6 +395,7 @@ namespace Multiplayer
     {
         m_multiplayerComponentRegistry.Reset();
         m_removeList.clear();
+        m_updateEntityDomainEvent.RemoveFromQueue();
         m_entityDomain = nullptr;
         m_entityExitDomainEvent.DisconnectAllHandlers();
         m_onEntityMarkedDirty.DisconnectAllHandlers();
@@ -401,6 +405,34 @@ namespace Multiplayer
         m_localDeferredRpcMessages.clear();
     }
 
+    void NetworkEntityManager::UpdateEntityDomain()
+    {
+        // Domains without bounds either own everything or nothing, there is nothing to hand off
+        if (m_entityDomain == nullptr || !m_entityDomain->GetAabb().IsValid())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "NetworkEntityManager: UpdateEntityDomain");
+
+        NetEntityIdSet entitiesNotInDomain;
+        for (const auto& [netEntityId, entity] : m_networkEntityTracker)
+        {
+            const ConstNetworkEntityHandle entityHandle(entity, &m_networkEntityTracker);
+            const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority)
+                && !m_entityDomain->IsInDomain(entityHandle))
+            {
+                entitiesNotInDomain.insert(netEntityId);
+            }
+        }
+
+        if (!entitiesNotInDomain.empty())
+        {
+            HandleEntitiesExitDomain(entitiesNotInDomain);
+        }
+    }
+
     void NetworkEntityManager::RemoveEntities()
     {
         AZStd::vector<NetEntityId> removeList;
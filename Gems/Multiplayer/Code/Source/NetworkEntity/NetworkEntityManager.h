@@ -121,6 +121,7 @@ namespace Multiplayer
 
     private:
         void RemoveEntities();
+        void UpdateEntityDomain();
         NetEntityId NextId();
         bool IsHierarchySafeToExit(NetworkEntityHandle& entityHandle, const NetEntityIdSet& entitiesNotInDomain);
 
@@ -132,6 +133,7 @@ namespace Multiplayer
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToServers;
 
         AZ::ScheduledEvent m_removeEntitiesEvent;
+        AZ::ScheduledEvent m_updateEntityDomainEvent;
         AZStd::vector<NetEntityId> m_removeList;
         AZStd::unique_ptr<IEntityDomain> m_entityDomain;
 
@@ -49,6 +49,30 @@ namespace Multiplayer
         return false;
     }
 
+    bool NetworkInputMigrationVector::operator==(const NetworkInputMigrationVector& rhs) const
+    {
+        if ((m_owner.GetNetEntityId() != rhs.m_owner.GetNetEntityId()) || (m_inputs.size() != rhs.m_inputs.size()))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < m_inputs.size(); ++i)
+        {
+            const NetworkInput& lhsInput = m_inputs[i].m_networkInput;
+            const NetworkInput& rhsInput = rhs.m_inputs[i].m_networkInput;
+            if ((lhsInput.GetClientInputId() != rhsInput.GetClientInputId()) || (lhsInput.GetHostFrameId() != rhsInput.GetHostFrameId()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NetworkInputMigrationVector::operator!=(const NetworkInputMigrationVector& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     bool NetworkInputMigrationVector::Serialize(AzNetworking::ISerializer& serializer)
     {
         NetEntityId ownerId = m_owner.GetNetEntityId();
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ServerToServerReplicationWindow.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Color.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ServerMeshHaloDistance, 20.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Distance beyond a peer server's entity domain within which authoritative entities are replicated to that peer");
+    AZ_CVAR(uint32_t, sv_ServerMeshMaxEntitiesToReplicate, 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The max number of entities to send updates for to a peer server each frame");
+
+    ServerToServerReplicationWindow::ServerToServerReplicationWindow(const AZ::Aabb& remoteDomainAabb, AzNetworking::IConnection* connection)
+        : m_remoteDomainAabb(remoteDomainAabb)
+        , m_connection(connection)
+    {
+        ;
+    }
+
+    bool ServerToServerReplicationWindow::ReplicationSetUpdateReady()
+    {
+        return m_remoteDomainAabb.IsValid();
+    }
+
+    const ReplicationSet& ServerToServerReplicationWindow::GetReplicationSet() const
+    {
+        return m_replicationSet;
+    }
+
+    uint32_t ServerToServerReplicationWindow::GetMaxProxyEntityReplicatorSendCount() const
+    {
+        return sv_ServerMeshMaxEntitiesToReplicate;
+    }
+
+    bool ServerToServerReplicationWindow::IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
+    {
+        outNetworkRole = NetEntityRole::InvalidRole;
+
+        const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if ((netBindComponent == nullptr) || (netBindComponent->GetNetEntityRole() != NetEntityRole::Authority))
+        {
+            // Only the authoritative server replicates an entity to its peers
+            return false;
+        }
+
+        const AZ::TransformInterface* transformInterface = entityHandle.GetEntity()->GetTransform();
+        if ((transformInterface == nullptr) || !GetHaloAabb().Contains(transformInterface->GetWorldTranslation()))
+        {
+            return false;
+        }
+
+        outNetworkRole = NetEntityRole::Server;
+        return true;
+    }
+
+    bool ServerToServerReplicationWindow::AddEntity(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity);
+        NetEntityRole networkRole = NetEntityRole::InvalidRole;
+        if (IsInWindow(entityHandle, networkRole))
+        {
+            m_replicationSet[entityHandle] = { networkRole, 1.0f };
+            return true;
+        }
+        return false;
+    }
+
+    void ServerToServerReplicationWindow::RemoveEntity(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity);
+        if (entityHandle.GetNetBindComponent() != nullptr)
+        {
+            m_replicationSet.erase(entityHandle);
+        }
+    }
+
+    void ServerToServerReplicationWindow::UpdateWindow()
+    {
+        m_replicationSet.clear();
+
+        if (!m_remoteDomainAabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem == nullptr)
+        {
+            return;
+        }
+
+        const AZ::Aabb haloAabb = GetHaloAabb();
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+            haloAabb,
+            [this, networkEntityTracker](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) == 0)
+                    {
+                        continue;
+                    }
+
+                    AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                    ConstNetworkEntityHandle entityHandle(entity, networkEntityTracker);
+                    NetEntityRole networkRole = NetEntityRole::InvalidRole;
+                    if (IsInWindow(entityHandle, networkRole))
+                    {
+                        m_replicationSet[entityHandle] = { networkRole, 1.0f };
+                    }
+                }
+            });
+    }
+
+    AzNetworking::PacketId ServerToServerReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
+    {
+        MultiplayerPackets::EntityUpdates entityUpdatePacket;
+        entityUpdatePacket.SetHostTimeMs(GetNetworkTime()->GetHostTimeMs());
+        entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
+        entityUpdatePacket.SetEntityMessages(entityUpdateVector);
+        return m_connection->SendUnreliablePacket(entityUpdatePacket);
+    }
+
+    void ServerToServerReplicationWindow::SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable)
+    {
+        MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.SetEntityRpcs(entityRpcVector);
+        if (reliable)
+        {
+            m_connection->SendReliablePacket(entityRpcsPacket);
+        }
+        else
+        {
+            m_connection->SendUnreliablePacket(entityRpcsPacket);
+        }
+    }
+
+    void ServerToServerReplicationWindow::SendEntityResets(const NetEntityIdSet& resetIds)
+    {
+        MultiplayerPackets::RequestReplicatorReset entityResetPacket;
+        for (NetEntityId entityId : resetIds)
+        {
+            if (entityResetPacket.GetEntityIds().full())
+            {
+                m_connection->SendUnreliablePacket(entityResetPacket);
+                entityResetPacket.ModifyEntityIds().clear();
+            }
+            entityResetPacket.ModifyEntityIds().push_back(entityId);
+        }
+
+        if (!entityResetPacket.GetEntityIds().empty())
+        {
+            m_connection->SendUnreliablePacket(entityResetPacket);
+        }
+    }
+
+    void ServerToServerReplicationWindow::DebugDraw() const
+    {
+        if (!m_remoteDomainAabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            const AZ::Aabb haloAabb = GetHaloAabb();
+            debugDisplay->SetColor(AZ::Colors::Orange);
+            debugDisplay->SetAlpha(0.25f);
+            debugDisplay->DrawWireBox(haloAabb.GetMin(), haloAabb.GetMax());
+        }
+    }
+
+    AZ::Aabb ServerToServerReplicationWindow::GetHaloAabb() const
+    {
+        AZ::Aabb haloAabb = m_remoteDomainAabb;
+        haloAabb.Expand(AZ::Vector3(static_cast<float>(sv_ServerMeshHaloDistance)));
+        return haloAabb;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer
+{
+    //! @class ServerToServerReplicationWindow
+    //! @brief Replicates the entities a server has authority over to a neighbouring server in the server mesh.
+    //! Authoritative entities within the remote server's entity domain, expanded by sv_ServerMeshHaloDistance, are sent as
+    //! server proxies so the remote server can simulate against them and assume authority once they cross the boundary.
+    class ServerToServerReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+
+        ServerToServerReplicationWindow(const AZ::Aabb& remoteDomainAabb, AzNetworking::IConnection* connection);
+
+        //! IReplicationWindow interface
+        //! @{
+        bool ReplicationSetUpdateReady() override;
+        const ReplicationSet& GetReplicationSet() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
+        bool AddEntity(AZ::Entity* entity) override;
+        void RemoveEntity(AZ::Entity* entity) override;
+        void UpdateWindow() override;
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
+        void SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable) override;
+        void SendEntityResets(const NetEntityIdSet& resetIds) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+
+        AZ::Aabb GetHaloAabb() const;
+
+        ServerToServerReplicationWindow& operator=(const ServerToServerReplicationWindow&) = delete;
+
+        ReplicationSet m_replicationSet;
+        AZ::Aabb m_remoteDomainAabb;
+        AzNetworking::IConnection* m_connection = nullptr;
+    };
+}
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ServerMesh/MultiplayerServerMesh.h>
+#include <Source/ConnectionData/ServerToServerConnectionData.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    AZ_CVAR(bool, sv_serverMesh, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether this server should join a server mesh and only own the entities within its entity domain");
+    AZ_CVAR(uint16_t, sv_serverMeshPort, DefaultServerMeshPort, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The port that this server binds to for server mesh traffic");
+    AZ_CVAR(AZ::CVarFixedString, sv_serverMeshPeers, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Comma separated list of host:port server mesh addresses of the peer servers to connect to");
+    AZ_CVAR(AZ::CVarFixedString, sv_serverMeshPublicAddress, AZ::CVarFixedString(LocalHost), nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The address clients should use to reach this server, used when redirecting migrating clients");
+    AZ_CVAR(AZ::TimeMs, sv_serverMeshReconnectMs, AZ::TimeMs{ 2000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "How often to retry connecting to server mesh peers that aren't connected");
+    AZ_CVAR(AZ::Vector3, sv_entityDomainMin, AZ::Vector3(-4096.0f), nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum corner of the region of the world this server owns when running as part of a server mesh");
+    AZ_CVAR(AZ::Vector3, sv_entityDomainMax, AZ::Vector3(4096.0f), nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum corner of the region of the world this server owns when running as part of a server mesh");
+
+    bool IsServerMeshEnabled()
+    {
+        return sv_serverMesh;
+    }
+
+    AZ::Aabb GetServerMeshEntityDomainAabb()
+    {
+        return AZ::Aabb::CreateFromMinMax(sv_entityDomainMin, sv_entityDomainMax);
+    }
+
+    MultiplayerServerMesh::MultiplayerServerMesh(const HostId& publicHostId, const AZ::Aabb& localDomainAabb)
+        : m_publicHostId(publicHostId)
+        , m_localDomainAabb(localDomainAabb)
+        , m_notifyClientMigrationHandler([this](ConnectionId clientConnectionId, const HostId& remoteHostId, uint64_t temporaryUserIdentifier, ClientInputId lastClientInputId, NetEntityId controlledEntityId)
+            {
+                OnNotifyClientMigration(clientConnectionId, remoteHostId, temporaryUserIdentifier, lastClientInputId, controlledEntityId);
+            })
+    {
+        const AZ::Name serverMeshInterfaceName = AZ::Name(MpServerMeshInterfaceName);
+        m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+            serverMeshInterfaceName, ProtocolType::Udp, TrustZone::InternalServerToServer, *this);
+        GetMultiplayer()->AddNotifyClientMigrationHandler(m_notifyClientMigrationHandler);
+
+        // Every pair of servers shares a single connection, initiated by the server with the lower mesh address
+        // This lets all servers in the mesh be launched with an identical peer list
+        const AZ::CVarFixedString publicAddress = sv_serverMeshPublicAddress;
+        const IpAddress localMeshAddress(publicAddress.c_str(), sv_serverMeshPort, ProtocolType::Udp);
+
+        AZStd::vector<AZStd::string> peerAddresses;
+        const AZ::CVarFixedString serverMeshPeers = sv_serverMeshPeers;
+        AZ::StringFunc::Tokenize(serverMeshPeers.c_str(), peerAddresses, ',');
+        for (AZStd::string& peerAddress : peerAddresses)
+        {
+            AZ::StringFunc::TrimWhiteSpace(peerAddress, true, true);
+            AZStd::vector<AZStd::string> hostAndPort;
+            AZ::StringFunc::Tokenize(peerAddress, hostAndPort, ':');
+            if (hostAndPort.size() != 2)
+            {
+                AZLOG_WARN("Ignoring malformed server mesh peer address '%s', expected host:port", peerAddress.c_str());
+                continue;
+            }
+
+            const IpAddress remoteMeshAddress(hostAndPort[0].c_str(), hostAndPort[1].c_str(), ProtocolType::Udp);
+            if (remoteMeshAddress == localMeshAddress)
+            {
+                continue;
+            }
+
+            m_peerAddresses.push_back(remoteMeshAddress);
+            if (localMeshAddress < remoteMeshAddress)
+            {
+                m_connectPeerAddresses.push_back(remoteMeshAddress);
+            }
+        }
+    }
+
+    MultiplayerServerMesh::~MultiplayerServerMesh()
+    {
+        m_notifyClientMigrationHandler.Disconnect();
+        Stop(DisconnectReason::TerminatedByServer);
+
+        const AZ::Name serverMeshInterfaceName = AZ::Name(MpServerMeshInterfaceName);
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(serverMeshInterfaceName);
+    }
+
+    bool MultiplayerServerMesh::Start()
+    {
+        const uint16_t serverMeshPort = sv_serverMeshPort;
+        if (!m_networkInterface->Listen(serverMeshPort))
+        {
+            AZLOG_ERROR("Failed to start listening for server mesh traffic on port %u, port is in use?", static_cast<uint32_t>(serverMeshPort));
+            return false;
+        }
+
+        ConnectToMissingPeers();
+
+        AZLOG_INFO("Server mesh listening on port %u", static_cast<uint32_t>(serverMeshPort));
+        return true;
+    }
+
+    void MultiplayerServerMesh::Update()
+    {
+        auto sendNetworkUpdates = [](IConnection& connection)
+        {
+            if (connection.GetUserData() != nullptr)
+            {
+                IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
+                connectionData->Update();
+            }
+        };
+        m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (currentTimeMs - m_lastConnectAttemptMs >= sv_serverMeshReconnectMs)
+        {
+            ConnectToMissingPeers();
+        }
+    }
+
+    void MultiplayerServerMesh::Stop(DisconnectReason reason)
+    {
+        auto visitor = [reason](IConnection& connection) { connection.Disconnect(reason, TerminationEndpoint::Local); };
+        m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+        m_networkInterface->StopListening();
+    }
+
+    bool MultiplayerServerMesh::IsHandshakeComplete(AzNetworking::IConnection* connection) const
+    {
+        const IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        return (connectionData != nullptr) && connectionData->DidHandshake();
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Client traffic is never expected on the server mesh interface
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+
+        bool handledAll = true;
+        for (AZStd::size_t i = 0; i < packet.GetEntityMessages().size(); ++i)
+        {
+            const NetworkEntityUpdateMessage& updateMessage = packet.GetEntityMessages()[i];
+            handledAll &= replicationManager.HandleEntityUpdateMessage(connection, packetHeader, updateMessage);
+            AZ_Assert(handledAll, "EntityUpdates did not handle all update messages");
+        }
+        return handledAll;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+        return replicationManager.HandleEntityRpcMessages(connection, packet.ModifyEntityRpcs());
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+        return replicationManager.HandleEntityResetMessages(connection, packet.GetEntityIds());
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ServerMeshConnect& packet
+    )
+    {
+        if (connection->GetConnectionRole() != ConnectionRole::Acceptor)
+        {
+            return false;
+        }
+
+        if (GetMultiplayerComponentRegistry()->GetSystemVersionHash() != packet.GetSystemVersionHash())
+        {
+            AZLOG_ERROR("Server mesh peer %s is running a different set of multiplayer components, rejecting connection", connection->GetRemoteAddress().GetString().c_str());
+            return false;
+        }
+
+        AddPeer(connection, packet.GetPublicHostAddress(), packet.GetEntityDomainAabb());
+        return connection->SendReliablePacket(MultiplayerPackets::ServerMeshAccept(m_publicHostId, m_localDomainAabb));
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ServerMeshAccept& packet
+    )
+    {
+        if (connection->GetConnectionRole() != ConnectionRole::Connector)
+        {
+            return false;
+        }
+
+        AddPeer(connection, packet.GetPublicHostAddress(), packet.GetEntityDomainAabb());
+        return true;
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityMigration& packet
+    )
+    {
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+        return replicationManager.HandleEntityMigration(connection, packet.ModifyEntityMigrationMessage(), packet.GetInputMigrationVector());
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::NotifyClientMigration& packet
+    )
+    {
+        // Prepare to re-attach the client to its migrated entity, then let the previous server redirect the client to us
+        GetMultiplayer()->RegisterPlayerIdentifierForRejoin(packet.GetTemporaryUserIdentifier(), packet.GetControlledEntityId());
+        return connection->SendReliablePacket(MultiplayerPackets::ClientMigrationReady(packet.GetClientConnectionId(), packet.GetTemporaryUserIdentifier(), packet.GetLastClientInputId()));
+    }
+
+    bool MultiplayerServerMesh::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ClientMigrationReady& packet
+    )
+    {
+        const ServerToServerConnectionData* connectionData = reinterpret_cast<ServerToServerConnectionData*>(connection->GetUserData());
+        GetMultiplayer()->CompleteClientMigration(packet.GetTemporaryUserIdentifier(), packet.GetClientConnectionId(), connectionData->GetRemotePublicHostId(), packet.GetLastClientInputId());
+        return true;
+    }
+
+    ConnectResult MultiplayerServerMesh::ValidateConnect
+    (
+        const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        // The server mesh trusts its peers with entity authority, only servers from the configured mesh may join
+        if (!IsConfiguredPeer(remoteAddress))
+        {
+            AZLOG_WARN("Rejecting server mesh connection from %s, not listed in sv_serverMeshPeers", remoteAddress.GetString().c_str());
+            return ConnectResult::Rejected;
+        }
+        return ConnectResult::Accepted;
+    }
+
+    void MultiplayerServerMesh::OnConnect(AzNetworking::IConnection* connection)
+    {
+        if (connection->GetConnectionRole() == ConnectionRole::Connector)
+        {
+            AZLOG_INFO("New outgoing server mesh connection to remote address: %s", connection->GetRemoteAddress().GetString().c_str());
+            connection->SendReliablePacket(MultiplayerPackets::ServerMeshConnect(
+                0,
+                GetMultiplayerComponentRegistry()->GetSystemVersionHash(),
+                m_publicHostId,
+                m_localDomainAabb));
+        }
+        else
+        {
+            AZLOG_INFO("New incoming server mesh connection from remote address: %s", connection->GetRemoteAddress().GetString().c_str());
+        }
+    }
+
+    PacketDispatchResult MultiplayerServerMesh::OnPacketReceived(AzNetworking::IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void MultiplayerServerMesh::OnPacketLost([[maybe_unused]] AzNetworking::IConnection* connection, [[maybe_unused]] PacketId packetId)
+    {
+        ;
+    }
+
+    void MultiplayerServerMesh::OnDisconnect(AzNetworking::IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        const char* endpointString = (endpoint == TerminationEndpoint::Local) ? "Disconnecting" : "Remotely disconnected";
+        const AZStd::string reasonString = ToString(reason);
+        AZLOG_INFO("%s from server mesh peer %s due to %s", endpointString, connection->GetRemoteAddress().GetString().c_str(), reasonString.c_str());
+
+        // Entities the peer had authority over are resolved by the entity domain once the authority tracker times them out
+        if (connection->GetUserData() != nullptr)
+        {
+            auto connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+            delete connectionData;
+            connection->SetUserData(nullptr);
+        }
+    }
+
+    void MultiplayerServerMesh::OnNotifyClientMigration
+    (
+        AzNetworking::ConnectionId clientConnectionId,
+        const HostId& remoteHostId,
+        uint64_t temporaryUserIdentifier,
+        ClientInputId lastClientInputId,
+        NetEntityId controlledEntityId
+    )
+    {
+        IConnection* peerConnection = FindPeerConnection(remoteHostId);
+        if (peerConnection == nullptr)
+        {
+            AZLOG_WARN("Unable to migrate client connection %u, no server mesh peer found for host %s",
+                static_cast<uint32_t>(clientConnectionId), remoteHostId.GetString().c_str());
+            return;
+        }
+
+        peerConnection->SendReliablePacket(MultiplayerPackets::NotifyClientMigration(clientConnectionId, temporaryUserIdentifier, lastClientInputId, controlledEntityId));
+    }
+
+    void MultiplayerServerMesh::AddPeer(AzNetworking::IConnection* connection, const HostId& remotePublicHostId, const AZ::Aabb& remoteDomainAabb)
+    {
+        if (connection->GetUserData() != nullptr)
+        {
+            // Already handshaked with this peer
+            return;
+        }
+
+        const AZ::Vector3 domainMin = remoteDomainAabb.GetMin();
+        const AZ::Vector3 domainMax = remoteDomainAabb.GetMax();
+        AZLOG_INFO("Server mesh peer %s joined, owning region (%.1f, %.1f, %.1f) - (%.1f, %.1f, %.1f)", remotePublicHostId.GetString().c_str(),
+            domainMin.GetX(), domainMin.GetY(), domainMin.GetZ(), domainMax.GetX(), domainMax.GetY(), domainMax.GetZ());
+        connection->SetUserData(new ServerToServerConnectionData(connection, *this, remotePublicHostId, remoteDomainAabb));
+    }
+
+    IConnection* MultiplayerServerMesh::FindPeerConnection(const HostId& remoteHostId) const
+    {
+        IConnection* peerConnection = nullptr;
+        auto findPeer = [&peerConnection, &remoteHostId](IConnection& connection)
+        {
+            if ((connection.GetUserData() != nullptr) && (connection.GetRemoteAddress() == remoteHostId))
+            {
+                peerConnection = &connection;
+            }
+        };
+        m_networkInterface->GetConnectionSet().VisitConnections(findPeer);
+        return peerConnection;
+    }
+
+    void MultiplayerServerMesh::ConnectToMissingPeers()
+    {
+        m_lastConnectAttemptMs = AZ::GetElapsedTimeMs();
+
+        const uint16_t serverMeshPort = sv_serverMeshPort;
+        for (const IpAddress& remoteMeshAddress : m_connectPeerAddresses)
+        {
+            // Connections that are still being established count as present, they time out and get removed if the peer never answers
+            bool connected = false;
+            auto findPeer = [&connected, &remoteMeshAddress](IConnection& connection)
+            {
+                connected |= (connection.GetRemoteAddress() == remoteMeshAddress);
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(findPeer);
+
+            if (!connected && (m_networkInterface->Connect(remoteMeshAddress, serverMeshPort) == InvalidConnectionId))
+            {
+                AZLOG_WARN("Failed to connect to server mesh peer %s", remoteMeshAddress.GetString().c_str());
+            }
+        }
+    }
+
+    bool MultiplayerServerMesh::IsConfiguredPeer(const IpAddress& remoteAddress) const
+    {
+        return AZStd::find(m_peerAddresses.begin(), m_peerAddresses.end(), remoteAddress) != m_peerAddresses.end();
+    }
+}
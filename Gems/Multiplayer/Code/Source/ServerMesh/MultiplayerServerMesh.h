@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! Returns whether the server mesh has been enabled via sv_serverMesh.
+    //! @return true if this server should join a server mesh
+    bool IsServerMeshEnabled();
+
+    //! Returns the region of the world this server is authoritative over when running as part of a server mesh.
+    //! @return the entity domain aabb configured via sv_entityDomainMin and sv_entityDomainMax
+    AZ::Aabb GetServerMeshEntityDomainAabb();
+
+    //! @class MultiplayerServerMesh
+    //! @brief Connection listener that links several servers, each owning a spatial entity domain, into a single simulation.
+    //! Every server binds sv_serverMeshPort on its own network interface and connects to the peers listed in sv_serverMeshPeers.
+    //! Peers that are unreachable or drop out are reconnected to every sv_serverMeshReconnectMs, and only listed peers may connect.
+    //! Peer servers replicate the entities near each others' domains, and hand off authority over entities that cross a domain
+    //! boundary along with their pending client input. Clients controlling a migrated entity are redirected to the new server.
+    class MultiplayerServerMesh final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        //! Constructor.
+        //! @param publicHostId     the client facing address of this server, sent to peers so they can redirect migrating clients
+        //! @param localDomainAabb  the region of the world this server is authoritative over
+        MultiplayerServerMesh(const HostId& publicHostId, const AZ::Aabb& localDomainAabb);
+        ~MultiplayerServerMesh();
+
+        //! Binds the server mesh port and initiates connections to the configured peers.
+        //! @return true if the server mesh port could be bound
+        bool Start();
+
+        //! Sends pending entity updates to all connected peers, and retries connecting to any configured peer that isn't connected.
+        void Update();
+
+        //! Disconnects from all peers and releases the server mesh port.
+        //! @param reason the reason to provide peers for the disconnect
+        void Stop(AzNetworking::DisconnectReason reason);
+
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerMeshConnect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerMeshAccept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::NotifyClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigrationReady& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+        void OnNotifyClientMigration(AzNetworking::ConnectionId clientConnectionId, const HostId& remoteHostId, uint64_t temporaryUserIdentifier, ClientInputId lastClientInputId, NetEntityId controlledEntityId);
+        void AddPeer(AzNetworking::IConnection* connection, const HostId& remotePublicHostId, const AZ::Aabb& remoteDomainAabb);
+        AzNetworking::IConnection* FindPeerConnection(const HostId& remoteHostId) const;
+        void ConnectToMissingPeers();
+        bool IsConfiguredPeer(const AzNetworking::IpAddress& remoteAddress) const;
+
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AZStd::vector<AzNetworking::IpAddress> m_peerAddresses; // Every configured peer, the ones allowed to connect to us
+        AZStd::vector<AzNetworking::IpAddress> m_connectPeerAddresses; // The subset of peers this server initiates the connection to
+        AZ::TimeMs m_lastConnectAttemptMs = AZ::Time::ZeroTimeMs;
+        HostId m_publicHostId = InvalidHostId;
+        AZ::Aabb m_localDomainAabb = AZ::Aabb::CreateNull();
+        NotifyClientMigrationEvent::Handler m_notifyClientMigrationHandler;
+    };
+}
@@ -466,4 +466,137 @@ namespace Multiplayer
         EXPECT_EQ(numInputCorrectionsProcessed, desiredInputCount - static_cast<uint64_t>(LargeCorrectionInputId));
     }
 
+    TEST_F(LocalPredictionPlayerInputTests, TestGetServerMigrationInputs)
+    {
+        ActivatePlayerEntity(NetEntityRole::Authority);
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+        ::testing::NiceMock<IMultiplayerConnectionMock> connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+
+        LocalPredictionPlayerInputComponentController* controller =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(m_localPredictionComponent->GetController());
+
+        // Nothing to migrate until the client has sent input
+        EXPECT_EQ(controller->GetServerMigrationInputs().GetSize(), 0);
+
+        m_mockElapsedTime = AZ::TimeMs(1000);
+        Multiplayer::NetworkInputArray netInputArray;
+        for (uint32_t index = 0; index < Multiplayer::NetworkInputArray::MaxElements; index++)
+        {
+            netInputArray[index].SetClientInputId(ClientInputId(0));
+            netInputArray[index].SetHostFrameId(HostFrameId(0));
+            netInputArray[index].SetHostTimeMs(AZ::TimeMs(1));
+        }
+
+        constexpr uint32_t SentInputCount = 5;
+        for (uint32_t inputId = 1; inputId <= SentInputCount; ++inputId)
+        {
+            for (uint32_t index = Multiplayer::NetworkInputArray::MaxElements - 1; index > 0; index--)
+            {
+                netInputArray[index] = netInputArray[index - 1];
+            }
+            netInputArray[0].SetClientInputId(ClientInputId(inputId));
+            netInputArray[0].SetHostFrameId(HostFrameId(inputId * 10));
+            controller->HandleSendClientInput(&connection, netInputArray, AZ::HashValue32(0));
+            m_mockElapsedTime += AZ::TimeMs(10);
+            m_eventScheduler->OnTick(1000, AZ::ScriptTimePoint());
+        }
+
+        // The whole received input history is migrated, oldest first, so the new authority can replay it in order
+        const NetworkInputMigrationVector migrationInputs = controller->GetServerMigrationInputs();
+        ASSERT_EQ(migrationInputs.GetSize(), Multiplayer::NetworkInputArray::MaxElements);
+        for (uint32_t i = 0; i < SentInputCount; ++i)
+        {
+            const NetworkInput& input = migrationInputs[migrationInputs.GetSize() - 1 - i];
+            EXPECT_EQ(input.GetClientInputId(), ClientInputId(SentInputCount - i));
+            EXPECT_EQ(input.GetHostFrameId(), HostFrameId((SentInputCount - i) * 10));
+        }
+    }
+
+    TEST_F(LocalPredictionPlayerInputTests, TestServerMigrationInputsRoundTrip)
+    {
+        ActivatePlayerEntity(NetEntityRole::Authority);
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+        ::testing::NiceMock<IMultiplayerConnectionMock> connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+
+        // The same player entity as it exists on the server that takes over authority
+        AZ::Entity migratedEntity(AZ::EntityId(2), "Migrated");
+        migratedEntity.CreateComponent<AzFramework::TransformComponent>();
+        migratedEntity.CreateComponent<NetworkTransformComponent>();
+        migratedEntity.CreateComponent<MultiplayerTest::TestMultiplayerComponent>();
+        migratedEntity.CreateComponent<MultiplayerTest::TestInputDriverComponent>();
+        LocalPredictionPlayerInputComponent* migratedInputComponent = migratedEntity.CreateComponent<LocalPredictionPlayerInputComponent>();
+        NetBindComponent* migratedNetBindComponent = migratedEntity.CreateComponent<NetBindComponent>();
+        migratedNetBindComponent->PreInit(&migratedEntity, PrefabEntityId{ AZ::Name("test"), 1 }, NetEntityId{ 2 }, NetEntityRole::Authority);
+        m_playerNetworkEntityTracker->RegisterNetBindComponent(&migratedEntity, migratedNetBindComponent);
+        migratedEntity.Init();
+        migratedEntity.Activate();
+
+        LocalPredictionPlayerInputComponentController* controller =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(m_localPredictionComponent->GetController());
+        LocalPredictionPlayerInputComponentController* migratedController =
+            dynamic_cast<LocalPredictionPlayerInputComponentController*>(migratedInputComponent->GetController());
+
+        m_mockElapsedTime = AZ::TimeMs(1000);
+        Multiplayer::NetworkInputArray netInputArray;
+        for (uint32_t index = 0; index < Multiplayer::NetworkInputArray::MaxElements; index++)
+        {
+            netInputArray[index].SetClientInputId(ClientInputId(0));
+            netInputArray[index].SetHostFrameId(HostFrameId(0));
+            netInputArray[index].SetHostTimeMs(AZ::TimeMs(1));
+        }
+
+        auto sendInput = [&](LocalPredictionPlayerInputComponentController* inputController, uint32_t inputId)
+        {
+            for (uint32_t index = Multiplayer::NetworkInputArray::MaxElements - 1; index > 0; index--)
+            {
+                netInputArray[index] = netInputArray[index - 1];
+            }
+            netInputArray[0].SetClientInputId(ClientInputId(inputId));
+            netInputArray[0].SetHostFrameId(HostFrameId(inputId));
+            inputController->HandleSendClientInput(&connection, netInputArray, AZ::HashValue32(0));
+            m_mockElapsedTime += AZ::TimeMs(10);
+            m_eventScheduler->OnTick(1000, AZ::ScriptTimePoint());
+        };
+
+        constexpr uint32_t MigratedInputId = 5;
+        for (uint32_t inputId = 1; inputId <= MigratedInputId; ++inputId)
+        {
+            sendInput(controller, inputId);
+        }
+
+        // The new authority resumes from the migrated input history
+        const NetworkInputMigrationVector migrationInputs = controller->GetServerMigrationInputs();
+        migratedController->ApplyServerMigrationInputs(migrationInputs);
+        EXPECT_EQ(migratedController->GetLastInputId(), ClientInputId(MigratedInputId));
+
+        const NetworkInputMigrationVector roundTripInputs = migratedController->GetServerMigrationInputs();
+        ASSERT_EQ(roundTripInputs.GetSize(), migrationInputs.GetSize());
+        for (uint32_t i = 0; i < migrationInputs.GetSize(); ++i)
+        {
+            EXPECT_EQ(roundTripInputs[i].GetClientInputId(), migrationInputs[i].GetClientInputId());
+            EXPECT_EQ(roundTripInputs[i].GetHostFrameId(), migrationInputs[i].GetHostFrameId());
+        }
+
+        // Input the previous authority already processed is not replayed, only the client's next input is
+        AZStd::vector<ClientInputId> processedInputIds;
+        migratedEntity.FindComponent<MultiplayerTest::TestMultiplayerComponent>()->m_processInputCallback =
+            [&processedInputIds]([[maybe_unused]] NetEntityId netEntityId, Multiplayer::NetworkInput& input, [[maybe_unused]] float deltaTime)
+        {
+            processedInputIds.push_back(input.GetClientInputId());
+        };
+        sendInput(migratedController, MigratedInputId + 1);
+        ASSERT_EQ(processedInputIds.size(), 1);
+        EXPECT_EQ(processedInputIds[0], ClientInputId(MigratedInputId + 1));
+
+        migratedEntity.Deactivate();
+    }
+
 } // namespace Multiplayer
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <IMultiplayerConnectionMock.h>
+#include <MockInterfaces.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Source/LoadTest/MultiplayerLoadGenerator.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+
+namespace UnitTest
+{
+    class MultiplayerLoadGeneratorTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(MultiplayerLoadGeneratorTests, SampleSetEmptyPercentile)
+    {
+        Multiplayer::LoadTestSampleSet samples;
+        EXPECT_EQ(samples.GetSampleCount(), 0u);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(50.0f), 0.0f);
+    }
+
+    TEST_F(MultiplayerLoadGeneratorTests, SampleSetPercentiles)
+    {
+        Multiplayer::LoadTestSampleSet samples;
+
+        // Insert out of order to ensure percentiles don't depend on insertion order
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            samples.AddSample(static_cast<float>((i * 37) % 100));
+        }
+
+        EXPECT_EQ(samples.GetSampleCount(), 100u);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(0.0f), 0.0f);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(50.0f), 50.0f);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(90.0f), 90.0f);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(99.0f), 99.0f);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(100.0f), 99.0f);
+
+        samples.Clear();
+        EXPECT_EQ(samples.GetSampleCount(), 0u);
+    }
+
+    TEST_F(MultiplayerLoadGeneratorTests, SampleSetOverwritesOldestSamples)
+    {
+        Multiplayer::LoadTestSampleSet samples;
+        for (uint32_t i = 0; i < Multiplayer::LoadTestSampleSet::MaxSamples; ++i)
+        {
+            samples.AddSample(1.0f);
+        }
+        for (uint32_t i = 0; i < Multiplayer::LoadTestSampleSet::MaxSamples; ++i)
+        {
+            samples.AddSample(2.0f);
+        }
+
+        EXPECT_EQ(samples.GetSampleCount(), Multiplayer::LoadTestSampleSet::MaxSamples);
+        EXPECT_FLOAT_EQ(samples.GetPercentile(0.0f), 2.0f);
+    }
+
+    TEST_F(MultiplayerLoadGeneratorTests, RegistryFindsComponentByName)
+    {
+        AZ::NameDictionary::Create();
+        {
+            Multiplayer::MultiplayerComponentRegistry registry;
+
+            Multiplayer::MultiplayerComponentRegistry::ComponentData componentData;
+            componentData.m_componentName = AZ::Name("FirstComponent");
+            const Multiplayer::NetComponentId firstId = registry.RegisterMultiplayerComponent(componentData);
+            componentData.m_componentName = AZ::Name("SecondComponent");
+            const Multiplayer::NetComponentId secondId = registry.RegisterMultiplayerComponent(componentData);
+
+            EXPECT_EQ(registry.FindNetComponentId(AZ::Name("FirstComponent")), firstId);
+            EXPECT_EQ(registry.FindNetComponentId(AZ::Name("SecondComponent")), secondId);
+            EXPECT_EQ(registry.FindNetComponentId(AZ::Name("MissingComponent")), Multiplayer::InvalidNetComponentId);
+        }
+        AZ::NameDictionary::Destroy();
+    }
+}
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class MockLoadTestConnectionSet
+        : public AzNetworking::IConnectionSet
+    {
+    public:
+        MOCK_METHOD1(VisitConnections, void(const ConnectionVisitor&));
+        MOCK_METHOD1(DeleteConnection, bool(AzNetworking::ConnectionId));
+        MOCK_CONST_METHOD1(GetConnection, AzNetworking::IConnection*(AzNetworking::ConnectionId));
+        MOCK_METHOD0(GetNextConnectionId, AzNetworking::ConnectionId());
+        MOCK_CONST_METHOD0(GetConnectionCount, uint32_t());
+        MOCK_CONST_METHOD0(GetActiveConnectionCount, uint32_t());
+    };
+
+    class MockLoadTestNetworkInterface
+        : public AzNetworking::INetworkInterface
+    {
+    public:
+        MOCK_CONST_METHOD0(GetName, AZ::Name());
+        MOCK_CONST_METHOD0(GetType, AzNetworking::ProtocolType());
+        MOCK_CONST_METHOD0(GetTrustZone, AzNetworking::TrustZone());
+        MOCK_CONST_METHOD0(GetPort, uint16_t());
+        MOCK_METHOD0(GetConnectionSet, AzNetworking::IConnectionSet&());
+        MOCK_METHOD0(GetConnectionListener, AzNetworking::IConnectionListener&());
+        MOCK_METHOD1(Listen, bool(uint16_t));
+        MOCK_METHOD2(Connect, AzNetworking::ConnectionId(const AzNetworking::IpAddress&, uint16_t));
+        MOCK_METHOD0(Update, void());
+        MOCK_METHOD2(SendReliablePacket, bool(AzNetworking::ConnectionId, const AzNetworking::IPacket&));
+        MOCK_METHOD2(SendUnreliablePacket, AzNetworking::PacketId(AzNetworking::ConnectionId, const AzNetworking::IPacket&));
+        MOCK_METHOD2(WasPacketAcked, bool(AzNetworking::ConnectionId, AzNetworking::PacketId));
+        MOCK_METHOD0(StopListening, bool());
+        MOCK_METHOD2(Disconnect, bool(AzNetworking::ConnectionId, AzNetworking::DisconnectReason));
+        MOCK_METHOD1(SetTimeoutMs, void(AZ::TimeMs));
+        MOCK_CONST_METHOD0(GetTimeoutMs, AZ::TimeMs());
+        MOCK_CONST_METHOD0(IsEncrypted, bool());
+        MOCK_CONST_METHOD0(IsOpen, bool());
+        MOCK_CONST_METHOD0(GetCompressorType, AzNetworking::CompressorType());
+    };
+
+    MATCHER_P(IsLoadTestPacketType, packetType, "Checks an IPacket's packet type")
+    {
+        return arg.GetPacketType() == packetType;
+    }
+
+    MATCHER_P(IsConnectPacketWithCompressor, compressorType, "Checks the compressor a Connect packet negotiates")
+    {
+        return arg.GetPacketType() == MultiplayerPackets::Connect::Type
+            && static_cast<const MultiplayerPackets::Connect&>(arg).GetCompressorType() == compressorType;
+    }
+
+    // Drives a single bot through the client side of the connection handshake and the input/update flow
+    class MultiplayerLoadGeneratorFlowTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr AzNetworking::CompressorType BotCompressorType = AzNetworking::CompressorType{ 1 };
+
+        void SetUp() override
+        {
+            AZ::NameDictionary::Create();
+
+            m_console.reset(aznew AZ::Console());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+
+            m_mockTime = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+
+            m_multiplayerComponentRegistry = AZStd::make_unique<MultiplayerComponentRegistry>();
+            m_mockNetworkEntityManager = AZStd::make_unique<NiceMock<MockNetworkEntityManager>>();
+            ON_CALL(*m_mockNetworkEntityManager, GetMultiplayerComponentRegistry()).WillByDefault(Return(m_multiplayerComponentRegistry.get()));
+            AZ::Interface<INetworkEntityManager>::Register(m_mockNetworkEntityManager.get());
+
+            m_mockMultiplayer = AZStd::make_unique<NiceMock<MockMultiplayer>>();
+            ON_CALL(*m_mockMultiplayer, GetNetworkEntityManager()).WillByDefault(Return(m_mockNetworkEntityManager.get()));
+            AZ::Interface<IMultiplayer>::Register(m_mockMultiplayer.get());
+
+            const AzNetworking::IpAddress address("127.0.0.1", DefaultServerPort, AzNetworking::ProtocolType::Udp);
+            m_connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(AzNetworking::ConnectionId{ 1 }, address, AzNetworking::ConnectionRole::Connector);
+
+            m_connectionSet = AZStd::make_unique<NiceMock<MockLoadTestConnectionSet>>();
+            ON_CALL(*m_connectionSet, GetConnection(m_connection->GetConnectionId())).WillByDefault(Return(m_connection.get()));
+
+            m_networkInterface = AZStd::make_unique<NiceMock<MockLoadTestNetworkInterface>>();
+            ON_CALL(*m_networkInterface, GetConnectionSet()).WillByDefault(ReturnRef(*m_connectionSet));
+            ON_CALL(*m_networkInterface, GetCompressorType()).WillByDefault(Return(BotCompressorType));
+
+            m_loadGenerator = AZStd::make_unique<MultiplayerLoadGenerator>();
+            AddBot();
+        }
+
+        void TearDown() override
+        {
+            m_loadGenerator.reset();
+            m_networkInterface.reset();
+            m_connectionSet.reset();
+            m_connection.reset();
+
+            AZ::Interface<IMultiplayer>::Unregister(m_mockMultiplayer.get());
+            AZ::Interface<INetworkEntityManager>::Unregister(m_mockNetworkEntityManager.get());
+            m_mockMultiplayer.reset();
+            m_mockNetworkEntityManager.reset();
+            m_multiplayerComponentRegistry.reset();
+
+            m_mockTime.reset();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        void AddBot()
+        {
+            AZStd::unique_ptr<MultiplayerLoadGenerator::LoadBot> bot = AZStd::make_unique<MultiplayerLoadGenerator::LoadBot>();
+            bot->m_interfaceName = AZ::Name("LoadTestBot0");
+            bot->m_networkInterface = m_networkInterface.get();
+            bot->m_connectionId = m_connection->GetConnectionId();
+            bot->m_state = MultiplayerLoadGenerator::BotState::Connecting;
+            for (uint32_t inputIndex = 0; inputIndex < NetworkInputArray::MaxElements; ++inputIndex)
+            {
+                bot->m_inputHistory[inputIndex].AttachNetBindComponent(nullptr);
+            }
+            m_connection->SetUserData(bot.get());
+            m_loadGenerator->m_bots.push_back(AZStd::move(bot));
+            m_loadGenerator->m_nextPendingBot = 1;
+        }
+
+        bool IsBotPlaying() const
+        {
+            return m_loadGenerator->m_bots.front()->m_state == MultiplayerLoadGenerator::BotState::Playing;
+        }
+
+        NetEntityId GetBotAutonomousEntityId() const
+        {
+            return m_loadGenerator->m_bots.front()->m_autonomousEntityId;
+        }
+
+        void SendBotInput()
+        {
+            m_loadGenerator->SendBotInput(*m_loadGenerator->m_bots.front());
+        }
+
+        uint64_t GetInputsSent() const
+        {
+            return m_loadGenerator->m_inputsSent;
+        }
+
+        void AcceptBot(AzNetworking::CompressorType serverCompressorType)
+        {
+            MultiplayerPackets::Accept acceptPacket("dummylevel", serverCompressorType);
+            EXPECT_TRUE(m_loadGenerator->HandleRequest(m_connection.get(), AzNetworking::UdpPacketHeader(), acceptPacket));
+        }
+
+        void ReceiveAutonomousEntity(NetEntityId entityId, HostFrameId hostFrameId)
+        {
+            MultiplayerPackets::EntityUpdates updatesPacket;
+            updatesPacket.SetHostFrameId(hostFrameId);
+            updatesPacket.ModifyEntityMessages().push_back(NetworkEntityUpdateMessage(NetEntityRole::Autonomous, entityId, false, false));
+            EXPECT_TRUE(m_loadGenerator->HandleRequest(m_connection.get(), AzNetworking::UdpPacketHeader(), updatesPacket));
+        }
+
+        AZStd::unique_ptr<AZ::IConsole> m_console;
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_mockTime;
+        AZStd::unique_ptr<MultiplayerComponentRegistry> m_multiplayerComponentRegistry;
+        AZStd::unique_ptr<NiceMock<MockNetworkEntityManager>> m_mockNetworkEntityManager;
+        AZStd::unique_ptr<NiceMock<MockMultiplayer>> m_mockMultiplayer;
+        AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>> m_connection;
+        AZStd::unique_ptr<NiceMock<MockLoadTestConnectionSet>> m_connectionSet;
+        AZStd::unique_ptr<NiceMock<MockLoadTestNetworkInterface>> m_networkInterface;
+        AZStd::unique_ptr<MultiplayerLoadGenerator> m_loadGenerator;
+    };
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, ConnectSendsInterfaceCompressor)
+    {
+        EXPECT_CALL(*m_connection, SendReliablePacket(IsConnectPacketWithCompressor(BotCompressorType))).WillOnce(Return(true));
+        m_loadGenerator->OnConnect(m_connection.get());
+        EXPECT_FALSE(m_loadGenerator->IsHandshakeComplete(m_connection.get()));
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, AcceptRequestsEntityUpdates)
+    {
+        EXPECT_CALL(*m_connection, SendReliablePacket(IsLoadTestPacketType(MultiplayerPackets::ReadyForEntityUpdates::Type))).WillOnce(Return(true));
+        AcceptBot(BotCompressorType);
+        EXPECT_TRUE(m_loadGenerator->IsHandshakeComplete(m_connection.get()));
+        EXPECT_FALSE(IsBotPlaying());
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, AcceptWithMatchingCompressorEnablesCompression)
+    {
+        m_connection->SetCompressionEnabled(false);
+        AcceptBot(BotCompressorType);
+        EXPECT_TRUE(m_connection->IsCompressionEnabled());
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, AcceptWithMismatchedCompressorDisablesCompression)
+    {
+        m_connection->SetCompressionEnabled(true);
+        AcceptBot(AzNetworking::CompressorType{ 2 });
+        EXPECT_FALSE(m_connection->IsCompressionEnabled());
+
+        m_connection->SetCompressionEnabled(true);
+        AcceptBot(AzNetworking::InvalidCompressorType);
+        EXPECT_FALSE(m_connection->IsCompressionEnabled());
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, EntityUpdatesBeforeAutonomousEntityKeepBotWaiting)
+    {
+        AcceptBot(BotCompressorType);
+
+        MultiplayerPackets::EntityUpdates updatesPacket;
+        updatesPacket.SetHostFrameId(HostFrameId{ 1 });
+        updatesPacket.ModifyEntityMessages().push_back(NetworkEntityUpdateMessage(NetEntityRole::Client, NetEntityId{ 7 }, false, false));
+        EXPECT_TRUE(m_loadGenerator->HandleRequest(m_connection.get(), AzNetworking::UdpPacketHeader(), updatesPacket));
+
+        EXPECT_FALSE(IsBotPlaying());
+        EXPECT_EQ(GetBotAutonomousEntityId(), InvalidNetEntityId);
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, AutonomousEntityUpdateStartsInput)
+    {
+        AcceptBot(BotCompressorType);
+        ReceiveAutonomousEntity(NetEntityId{ 3 }, HostFrameId{ 10 });
+
+        EXPECT_TRUE(IsBotPlaying());
+        EXPECT_EQ(GetBotAutonomousEntityId(), NetEntityId{ 3 });
+
+        EXPECT_CALL(*m_connection, SendUnreliablePacket(IsLoadTestPacketType(MultiplayerPackets::EntityRpcs::Type))).Times(2);
+        SendBotInput();
+        SendBotInput();
+        EXPECT_EQ(GetInputsSent(), 2u);
+    }
+
+    TEST_F(MultiplayerLoadGeneratorFlowTests, DisconnectedBotIgnoresPackets)
+    {
+        m_loadGenerator->OnDisconnect(m_connection.get(), AzNetworking::DisconnectReason::TerminatedByUser, AzNetworking::TerminationEndpoint::Remote);
+
+        EXPECT_CALL(*m_connection, SendReliablePacket(_)).Times(0);
+        MultiplayerPackets::Accept acceptPacket("dummylevel", BotCompressorType);
+        EXPECT_FALSE(m_loadGenerator->HandleRequest(m_connection.get(), AzNetworking::UdpPacketHeader(), acceptPacket));
+        EXPECT_FALSE(m_loadGenerator->IsHandshakeComplete(m_connection.get()));
+    }
+}
@@ -17,6 +17,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzTest/AzTest.h>
@@ -24,6 +25,8 @@
 #include <IMultiplayerConnectionMock.h>
 #include <IMultiplayerSpawnerMock.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
+#include <ConnectionData/ServerToServerConnectionData.h>
+#include <ServerMesh/MultiplayerServerMesh.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/MultiplayerConstants.h>
@@ -34,6 +37,7 @@ namespace Multiplayer
     AZ_CVAR_EXTERNED(AZ::CVarFixedString, sv_map);
     AZ_CVAR_EXTERNED(bool, sv_versionMismatch_autoDisconnect);
     AZ_CVAR_EXTERNED(bool, sv_versionMismatch_sendManifestToClient);
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, sv_serverMeshPeers);
 
 
     class MultiplayerSystemTests : public LeakDetectionFixture
@@ -274,7 +278,7 @@ namespace Multiplayer
 
         // Send a connection request. This should cause another player to be spawned.
         MultiplayerPackets::Connect connectPacket(
-            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash());
+            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash(), InvalidCompressorType);
         IMultiplayerConnectionMock connection(
             ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
         ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
@@ -480,7 +484,7 @@ namespace Multiplayer
         m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
 
         MultiplayerPackets::Connect connectPacket(
-            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash());
+            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash(), InvalidCompressorType);
         IMultiplayerConnectionMock connection(
             ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Acceptor);
         ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
@@ -499,7 +503,7 @@ namespace Multiplayer
         m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
 
         MultiplayerPackets::Connect connectPacket(
-            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash());
+            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash(), InvalidCompressorType);
         IMultiplayerConnectionMock connection(
             ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Acceptor);
         ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
@@ -513,6 +517,57 @@ namespace Multiplayer
         AZ::Interface<IMultiplayerSpawner>::Unregister(&m_mpSpawnerMock);
     }
 
+    TEST_F(MultiplayerSystemTests, TestConnectingWithMismatchCompressorType)
+    {
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+        // The server has no compressor registered, so any compressor type from the client is a mismatch
+        MultiplayerPackets::Connect connectPacket(
+            0, 1, "connect_ticket", GetMultiplayerComponentRegistry()->GetSystemVersionHash(), CompressorType{ 42 });
+        IMultiplayerConnectionMock connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Acceptor);
+        ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+
+        // The handshake negotiates compression, so it must be readable whatever compressor the endpoints use
+        EXPECT_FALSE(connectPacket.IsCompressible());
+        EXPECT_FALSE(MultiplayerPackets::Accept().IsCompressible());
+
+        // The client is accepted, but told not to compress
+        m_mockLevelSystem->m_levelName = "dummylevel";
+        CompressorType acceptedCompressorType{ 42 };
+        EXPECT_CALL(connection, Disconnect(testing::_, testing::_)).Times(0);
+        EXPECT_CALL(connection, SendReliablePacket(IsMultiplayerPacketType(MultiplayerPackets::Accept::Type)))
+            .WillOnce(testing::Invoke([&acceptedCompressorType](const IPacket& packet)
+            {
+                acceptedCompressorType = static_cast<const MultiplayerPackets::Accept&>(packet).GetCompressorType();
+                return true;
+            }));
+        m_mpComponent->HandleRequest(&connection, UdpPacketHeader(), connectPacket);
+
+        EXPECT_FALSE(connection.IsCompressionEnabled());
+        EXPECT_EQ(acceptedCompressorType, InvalidCompressorType);
+
+        AZ::Interface<IMultiplayerSpawner>::Unregister(&m_mpSpawnerMock);
+    }
+
+    TEST_F(MultiplayerSystemTests, TestAcceptWithMismatchCompressorType_DisablesCompression)
+    {
+        m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::Client);
+
+        IMultiplayerConnectionMock connection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+        ClientToServerConnectionData connectionUserData(&connection, *m_mpComponent);
+        connection.SetUserData(&connectionUserData);
+
+        // The server doesn't use our compressor, packets to it must not be compressed
+        const AZ::CVarFixedString previousMap = sv_map;
+        MultiplayerPackets::Accept acceptPacket("dummylevel", CompressorType{ 42 });
+        m_mpComponent->HandleRequest(&connection, UdpPacketHeader(), acceptPacket);
+        EXPECT_FALSE(connection.IsCompressionEnabled());
+        sv_map = previousMap;
+    }
+
     TEST_F(MultiplayerSystemTests, TestConnectingWithMismatchComponentHash)
     {
         // cvars affecting mismatch behavior:
@@ -524,7 +579,7 @@ namespace Multiplayer
 
         // Send a connection request with a different component hash to trigger a mismatch
         const AZ::HashValue64 differentMultiplayerComponentHash = AZ::HashValue64{ 42 };
-        MultiplayerPackets::Connect connectPacket(0, 1, "connect_ticket", differentMultiplayerComponentHash);
+        MultiplayerPackets::Connect connectPacket(0, 1, "connect_ticket", differentMultiplayerComponentHash, InvalidCompressorType);
         IMultiplayerConnectionMock connection(
             ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Acceptor);
         ServerToClientConnectionData connectionUserData(&connection, *m_mpComponent);
@@ -557,6 +612,83 @@ namespace Multiplayer
         AZ::Interface<IMultiplayerSpawner>::Unregister(&m_mpSpawnerMock);
     }
 
+    TEST_F(MultiplayerSystemTests, TestServerMeshRejectsUnknownPeers)
+    {
+        const AZ::CVarFixedString previousPeers = sv_serverMeshPeers;
+        sv_serverMeshPeers = "127.0.0.1:33460, 127.0.0.1:33461";
+
+        const HostId publicHostId(IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp));
+        MultiplayerServerMesh serverMesh(publicHostId, AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(100.0f)));
+
+        AZStd::array<uint8_t, 16> buffer = {};
+        NetworkInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_EQ(serverMesh.ValidateConnect(IpAddress("127.0.0.1", 33460, ProtocolType::Udp), UdpPacketHeader(), serializer), ConnectResult::Accepted);
+        EXPECT_EQ(serverMesh.ValidateConnect(IpAddress("127.0.0.1", 33461, ProtocolType::Udp), UdpPacketHeader(), serializer), ConnectResult::Accepted);
+
+        // Servers outside of the configured mesh must not be able to take authority over our entities
+        EXPECT_EQ(serverMesh.ValidateConnect(IpAddress("127.0.0.1", 33462, ProtocolType::Udp), UdpPacketHeader(), serializer), ConnectResult::Rejected);
+        EXPECT_EQ(serverMesh.ValidateConnect(IpAddress("10.0.0.1", 33460, ProtocolType::Udp), UdpPacketHeader(), serializer), ConnectResult::Rejected);
+
+        sv_serverMeshPeers = previousPeers;
+    }
+
+    TEST_F(MultiplayerSystemTests, TestServerMeshHandshake)
+    {
+        const HostId publicHostId(IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp));
+        const AZ::Aabb localDomainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(100.0f));
+        MultiplayerServerMesh serverMesh(publicHostId, localDomainAabb);
+
+        const HostId remoteHostId(IpAddress("127.0.0.1", DefaultServerPort + 1, ProtocolType::Udp));
+        const AZ::Aabb remoteDomainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f, 0.0f, 0.0f), AZ::Vector3(200.0f, 100.0f, 100.0f));
+
+        // A peer running different multiplayer components is refused
+        IMultiplayerConnectionMock acceptorConnection(
+            ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerMeshPort + 1, ProtocolType::Udp), ConnectionRole::Acceptor);
+        MultiplayerPackets::ServerMeshConnect mismatchConnect(0, AZ::HashValue64{ 42 }, remoteHostId, remoteDomainAabb);
+        EXPECT_CALL(acceptorConnection, SendReliablePacket(testing::_)).Times(0);
+        EXPECT_FALSE(serverMesh.HandleRequest(&acceptorConnection, UdpPacketHeader(), mismatchConnect));
+        EXPECT_FALSE(serverMesh.IsHandshakeComplete(&acceptorConnection));
+
+        // The accepting server records the peer's domain and replies with its own
+        HostId acceptedHostId = InvalidHostId;
+        AZ::Aabb acceptedDomainAabb = AZ::Aabb::CreateNull();
+        EXPECT_CALL(acceptorConnection, SendReliablePacket(IsMultiplayerPacketType(MultiplayerPackets::ServerMeshAccept::Type)))
+            .WillOnce(testing::Invoke([&acceptedHostId, &acceptedDomainAabb](const IPacket& packet)
+            {
+                const auto& accept = static_cast<const MultiplayerPackets::ServerMeshAccept&>(packet);
+                acceptedHostId = accept.GetPublicHostAddress();
+                acceptedDomainAabb = accept.GetEntityDomainAabb();
+                return true;
+            }));
+        MultiplayerPackets::ServerMeshConnect connect(0, GetMultiplayerComponentRegistry()->GetSystemVersionHash(), remoteHostId, remoteDomainAabb);
+        EXPECT_TRUE(serverMesh.HandleRequest(&acceptorConnection, UdpPacketHeader(), connect));
+        EXPECT_TRUE(serverMesh.IsHandshakeComplete(&acceptorConnection));
+        EXPECT_EQ(acceptedHostId, publicHostId);
+        EXPECT_EQ(acceptedDomainAabb, localDomainAabb);
+
+        const auto* acceptorData = reinterpret_cast<ServerToServerConnectionData*>(acceptorConnection.GetUserData());
+        EXPECT_EQ(acceptorData->GetConnectionDataType(), ConnectionDataType::ServerToServer);
+        EXPECT_EQ(acceptorData->GetRemotePublicHostId(), remoteHostId);
+
+        // The connecting server completes its side of the handshake from the accept, which only a connector expects
+        IMultiplayerConnectionMock connectorConnection(
+            ConnectionId{ 2 }, IpAddress("127.0.0.1", DefaultServerMeshPort + 2, ProtocolType::Udp), ConnectionRole::Connector);
+        MultiplayerPackets::ServerMeshAccept accept(remoteHostId, remoteDomainAabb);
+        EXPECT_FALSE(serverMesh.HandleRequest(&connectorConnection, UdpPacketHeader(), connect));
+        EXPECT_TRUE(serverMesh.HandleRequest(&connectorConnection, UdpPacketHeader(), accept));
+        EXPECT_TRUE(serverMesh.IsHandshakeComplete(&connectorConnection));
+
+        IMultiplayerConnectionMock unexpectedConnection(
+            ConnectionId{ 3 }, IpAddress("127.0.0.1", DefaultServerMeshPort + 3, ProtocolType::Udp), ConnectionRole::Acceptor);
+        EXPECT_FALSE(serverMesh.HandleRequest(&unexpectedConnection, UdpPacketHeader(), accept));
+
+        // Disconnecting releases the peer's connection data
+        serverMesh.OnDisconnect(&acceptorConnection, DisconnectReason::TerminatedByServer, TerminationEndpoint::Remote);
+        serverMesh.OnDisconnect(&connectorConnection, DisconnectReason::TerminatedByServer, TerminationEndpoint::Remote);
+        EXPECT_EQ(acceptorConnection.GetUserData(), nullptr);
+        EXPECT_EQ(connectorConnection.GetUserData(), nullptr);
+    }
+
     TEST_F(MultiplayerSystemTests, TestMiscellaneous)
     {
         m_mpComponent->DumpStats({});
@@ -12,6 +12,7 @@
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
+#include <Source/EntityDomains/SpatialEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
@@ -162,6 +163,40 @@ namespace Multiplayer
         domain->DebugDraw();
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestSpatialDomain)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const HostId localhost = HostId("127.0.0.1", 6777, ProtocolType::Udp);
+        const AZ::Aabb domainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(10.0f, 10.0f, 10.0f));
+
+        m_networkEntityManager->Initialize(localhost, AZStd::make_unique<SpatialEntityDomain>(domainAabb));
+        EXPECT_TRUE(m_networkEntityManager->IsInitialized());
+        IEntityDomain* domain = m_networkEntityManager->GetEntityDomain();
+        EXPECT_NE(domain, nullptr);
+        EXPECT_EQ(domain->GetAabb(), domainAabb);
+
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(5.0f, 5.0f, 5.0f));
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        // Just outside the domain, but within the hysteresis region
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(10.5f, 5.0f, 5.0f));
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(20.0f, 5.0f, 5.0f));
+        EXPECT_FALSE(domain->IsInDomain(handle));
+
+        const AZ::Aabb movedAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(15.0f, 0.0f, 0.0f), AZ::Vector3(25.0f, 10.0f, 10.0f));
+        domain->SetAabb(movedAabb);
+        EXPECT_EQ(domain->GetAabb(), movedAabb);
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        // Entities outside of the domain are removed when their authority times out
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(-20.0f, 5.0f, 5.0f));
+        domain->HandleLossOfAuthoritativeReplicator(handle);
+        EXPECT_TRUE(m_networkEntityManager->IsMarkedForRemoval(handle));
+        domain->DebugDraw();
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityTracker)
     {
         const NetworkEntityTracker* constNetEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
@@ -73,6 +73,8 @@ set(FILES
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
     Source/EntityDomains/NullEntityDomain.h
+    Source/EntityDomains/SpatialEntityDomain.cpp
+    Source/EntityDomains/SpatialEntityDomain.h
     Source/MultiplayerStatSystemComponent.cpp
     Source/MultiplayerStatSystemComponent.h
     Source/MultiplayerStats.cpp
@@ -46,8 +46,13 @@ set(FILES
     Source/ConnectionData/ServerToClientConnectionData.cpp
     Source/ConnectionData/ServerToClientConnectionData.h
     Source/ConnectionData/ServerToClientConnectionData.inl
+    Source/ConnectionData/ServerToServerConnectionData.cpp
+    Source/ConnectionData/ServerToServerConnectionData.h
+    Source/ConnectionData/ServerToServerConnectionData.inl
     Source/Editor/MultiplayerEditorConnection.cpp
     Source/Editor/MultiplayerEditorConnection.h
+    Source/LoadTest/MultiplayerLoadGenerator.cpp
+    Source/LoadTest/MultiplayerLoadGenerator.h
     Source/MultiplayerSystemComponent.cpp
     Source/MultiplayerSystemComponent.h
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
@@ -64,8 +69,12 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/ServerMesh/MultiplayerServerMesh.cpp
+    Source/ServerMesh/MultiplayerServerMesh.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
+    Source/ReplicationWindows/ServerToServerReplicationWindow.cpp
+    Source/ReplicationWindows/ServerToServerReplicationWindow.h
 )
@@ -24,6 +24,7 @@ set(FILES
     Tests/MockInterfaces.h
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
+    Tests/MultiplayerLoadGeneratorTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
     Tests/NetworkEntityTests.cpp
@@ -8,11 +8,45 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
+#include "ZstdDictionarySet.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of the zstd dictionary set used by ZstdCompressor, both endpoints must load the same set. Must be set before creating the network interface.");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Compression level used by ZstdCompressor.");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdCapturePath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, ZstdCompressor appends every outgoing payload to this file for offline dictionary training with net_ZstdTrainDictionaries.");
+
+    void net_ZstdTrainDictionaries(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("Usage: net_ZstdTrainDictionaries <capturePath> <outputPath> [dictionarySize]");
+            return;
+        }
+
+        const AZStd::string capturePath(arguments[0]);
+        const AZStd::string outputPath(arguments[1]);
+        size_t dictionarySize = ZstdDictionarySet::DefaultDictionarySize;
+        if (arguments.size() > 2)
+        {
+            dictionarySize = static_cast<size_t>(AZ::StringFunc::ToInt(AZStd::string(arguments[2]).c_str()));
+        }
+
+        ZstdDictionarySet dictionarySet;
+        if (ZstdDictionarySet::TrainFromCapture(capturePath.c_str(), dictionarySize, dictionarySet) && dictionarySet.SaveToFile(outputPath.c_str()))
+        {
+            AZLOG_INFO("Wrote %u zstd dictionaries to %s, set id 0x%08X", dictionarySet.GetDictionaryCount(), outputPath.c_str(), dictionarySet.GetSetId());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(net_ZstdTrainDictionaries, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary set from a net_ZstdCapturePath capture: <capturePath> <outputPath> [dictionarySize]");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +56,51 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdCompressionFactory::Create()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        const AZ::CVarFixedString dictionaryPath = net_ZstdDictionaryPath;
+        if (m_dictionaryPath != dictionaryPath.c_str())
+        {
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionarySet.reset();
+            if (!m_dictionaryPath.empty())
+            {
+                AZStd::shared_ptr<ZstdDictionarySet> dictionarySet = AZStd::make_shared<ZstdDictionarySet>();
+                if (dictionarySet->LoadFromFile(m_dictionaryPath.c_str()))
+                {
+                    m_dictionarySet = AZStd::move(dictionarySet);
+                }
+            }
+        }
+
+        const AZ::CVarFixedString capturePath = net_ZstdCapturePath;
+        if (m_capturePath != capturePath.c_str())
+        {
+            m_capturePath = capturePath.c_str();
+            m_sampleCapture.reset();
+            if (!m_capturePath.empty())
+            {
+                AZStd::shared_ptr<ZstdSampleCapture> sampleCapture = AZStd::make_shared<ZstdSampleCapture>();
+                if (sampleCapture->Open(m_capturePath.c_str()))
+                {
+                    m_sampleCapture = AZStd::move(sampleCapture);
+                }
+            }
+        }
+
+        AZStd::unique_ptr<ZstdCompressor> compressor = AZStd::make_unique<ZstdCompressor>(m_dictionarySet, static_cast<int32_t>(net_ZstdCompressionLevel), m_sampleCapture);
+        if (!compressor->Init())
+        {
+            return nullptr;
+        }
+        return compressor;
+    }
+
+    const AZStd::string_view ZstdCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -29,4 +32,31 @@ namespace MultiplayerCompression
     private:
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
     };
+
+    class ZstdDictionarySet;
+    class ZstdSampleCapture;
+
+    //! Creates Zstd compressors, selected by setting net_UdpCompressor or net_TcpCompressor to "ZstdCompressor".
+    //! The dictionary set named by net_ZstdDictionaryPath is loaded once and shared by every compressor created.
+    class ZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        static constexpr AZStd::string_view s_compressorName = "ZstdCompressor";
+
+        AZStd::mutex m_mutex;
+        AZStd::string m_dictionaryPath;
+        AZStd::shared_ptr<const ZstdDictionarySet> m_dictionarySet;
+        AZStd::string m_capturePath;
+        AZStd::shared_ptr<ZstdSampleCapture> m_sampleCapture;
+    };
 }
@@ -41,5 +41,6 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZstdCompressionFactory* m_zstdCompressionFactory;
     };
 }
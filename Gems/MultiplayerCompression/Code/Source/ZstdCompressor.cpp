@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    // Size of the zstd frame magic number elided from every compressed payload
+    static constexpr size_t FrameMagicSize = sizeof(uint32_t);
+    // Size of the dictionary slot prefixed to every compressed payload
+    static constexpr size_t SlotSize = sizeof(uint8_t);
+
+    ZstdCompressor::ZstdCompressor(AZStd::shared_ptr<const ZstdDictionarySet> dictionarySet, int32_t compressionLevel, AZStd::shared_ptr<ZstdSampleCapture> sampleCapture)
+        : m_dictionarySet(AZStd::move(dictionarySet))
+        , m_sampleCapture(AZStd::move(sampleCapture))
+        , m_compressionLevel(compressionLevel)
+    {
+        ;
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ReleaseContexts();
+    }
+
+    AzNetworking::CompressorType ZstdCompressor::GetType() const
+    {
+        AZ::Crc32 compressorType(ZstdCompressorName);
+        if (m_dictionarySet != nullptr && m_dictionarySet->GetSetId() != 0)
+        {
+            const uint32_t setId = m_dictionarySet->GetSetId();
+            compressorType.Add(&setId, sizeof(setId));
+        }
+        return aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(compressorType));
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        if (m_compressContext != nullptr)
+        {
+            return true;
+        }
+
+        m_compressContext = ZSTD_createCCtx();
+        m_decompressContext = ZSTD_createDCtx();
+        if (m_compressContext == nullptr || m_decompressContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd contexts");
+            ReleaseContexts();
+            return false;
+        }
+
+        const uint32_t dictionaryCount = (m_dictionarySet != nullptr) ? m_dictionarySet->GetDictionaryCount() : 0;
+        m_compressDictionaries.reserve(dictionaryCount);
+        m_decompressDictionaries.reserve(dictionaryCount);
+        for (uint32_t slot = 0; slot < dictionaryCount; ++slot)
+        {
+            const AZStd::vector<uint8_t>& dictionary = m_dictionarySet->GetDictionary(static_cast<uint8_t>(slot));
+            m_compressDictionaries.push_back(ZSTD_createCDict(dictionary.data(), dictionary.size(), m_compressionLevel));
+            m_decompressDictionaries.push_back(ZSTD_createDDict(dictionary.data(), dictionary.size()));
+            if (m_compressDictionaries.back() == nullptr || m_decompressDictionaries.back() == nullptr)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Failed to load zstd dictionary for packet type %u", m_dictionarySet->GetPacketType(static_cast<uint8_t>(slot)));
+                ReleaseContexts();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ZstdCompressor::ReleaseContexts()
+    {
+        for (ZSTD_CDict* compressDictionary : m_compressDictionaries)
+        {
+            ZSTD_freeCDict(compressDictionary);
+        }
+        m_compressDictionaries.clear();
+
+        for (ZSTD_DDict* decompressDictionary : m_decompressDictionaries)
+        {
+            ZSTD_freeDDict(decompressDictionary);
+        }
+        m_decompressDictionaries.clear();
+
+        ZSTD_freeCCtx(m_compressContext);
+        m_compressContext = nullptr;
+        ZSTD_freeDCtx(m_decompressContext);
+        m_decompressContext = nullptr;
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return SlotSize + ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_compressContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const uint8_t* payload = reinterpret_cast<const uint8_t*>(uncompData);
+        if (m_sampleCapture != nullptr)
+        {
+            m_sampleCapture->Append(payload, uncompSize);
+        }
+
+        uint8_t slot = ZstdDictionarySet::NoDictionarySlot;
+        ZstdPacketType packetType = 0;
+        if (m_dictionarySet != nullptr && PeekPacketType(payload, uncompSize, packetType))
+        {
+            slot = m_dictionarySet->GetSlot(packetType);
+        }
+
+        // Compress the full frame into the output buffer, then shift it over the magic number to make room for the slot
+        uint8_t* output = reinterpret_cast<uint8_t*>(compData);
+        const size_t frameSize = (slot != ZstdDictionarySet::NoDictionarySlot)
+            ? ZSTD_compress_usingCDict(m_compressContext, output, compDataSize, uncompData, uncompSize, m_compressDictionaries[slot])
+            : ZSTD_compressCCtx(m_compressContext, output, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(frameSize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(frameSize));
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        AZ_Assert(frameSize > FrameMagicSize, "Zstd frame is smaller than its header");
+        memmove(output + SlotSize, output + FrameMagicSize, frameSize - FrameMagicSize);
+        output[0] = slot;
+        compSize = SlotSize + frameSize - FrameMagicSize;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_decompressContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(compData);
+        const uint8_t slot = (compDataSize >= SlotSize) ? input[0] : ZstdDictionarySet::NoDictionarySlot;
+        if (compDataSize <= SlotSize || (slot != ZstdDictionarySet::NoDictionarySlot && slot >= m_decompressDictionaries.size()))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B), invalid dictionary slot %u", compDataSize, slot);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        // Restore the elided magic number so zstd sees a complete frame
+        const size_t payloadSize = compDataSize - SlotSize;
+        m_frameBuffer.resize_no_construct(FrameMagicSize + payloadSize);
+        const uint32_t magic = ZSTD_MAGICNUMBER;
+        m_frameBuffer[0] = static_cast<uint8_t>(magic);
+        m_frameBuffer[1] = static_cast<uint8_t>(magic >> 8);
+        m_frameBuffer[2] = static_cast<uint8_t>(magic >> 16);
+        m_frameBuffer[3] = static_cast<uint8_t>(magic >> 24);
+        memcpy(m_frameBuffer.data() + FrameMagicSize, input + SlotSize, payloadSize);
+
+        const size_t uncompSize = (slot != ZstdDictionarySet::NoDictionarySlot)
+            ? ZSTD_decompress_usingDDict(m_decompressContext, uncompData, uncompDataSize, m_frameBuffer.data(), m_frameBuffer.size(), m_decompressDictionaries[slot])
+            : ZSTD_decompressDCtx(m_decompressContext, uncompData, uncompDataSize, m_frameBuffer.data(), m_frameBuffer.size());
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(uncompSize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(uncompSize));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = uncompSize;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "ZstdDictionarySet.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+
+    /**
+    * Implements a Zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * Payloads are compressed against a dictionary trained on their packet type when one is available, which recovers most of
+    * the redundancy between small packets that a dictionary-less compressor cannot see. Each compressed payload is prefixed by
+    * the dictionary slot used, and the zstd frame magic number is elided as it is implied by the compressor type.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        //! Constructs a compressor.
+        //! @param dictionarySet    dictionaries to compress against, may be null to compress without dictionaries
+        //! @param compressionLevel zstd compression level
+        //! @param sampleCapture    optional capture to record uncompressed payloads into for dictionary training
+        ZstdCompressor(AZStd::shared_ptr<const ZstdDictionarySet> dictionarySet = nullptr, int32_t compressionLevel = 3, AZStd::shared_ptr<ZstdSampleCapture> sampleCapture = nullptr);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+
+        //! The compressor type incorporates the dictionary set identifier so endpoints with different dictionaries do not connect.
+        AzNetworking::CompressorType GetType() const override;
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        void ReleaseContexts();
+
+        AZStd::shared_ptr<const ZstdDictionarySet> m_dictionarySet;
+        AZStd::shared_ptr<ZstdSampleCapture> m_sampleCapture;
+        int32_t m_compressionLevel = 3;
+
+        ZSTD_CCtx_s* m_compressContext = nullptr;
+        ZSTD_DCtx_s* m_decompressContext = nullptr;
+        AZStd::vector<ZSTD_CDict_s*> m_compressDictionaries;
+        AZStd::vector<ZSTD_DDict_s*> m_decompressDictionaries;
+        AZStd::vector<uint8_t> m_frameBuffer;
+    };
+}
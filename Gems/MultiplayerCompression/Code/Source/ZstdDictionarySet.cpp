@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionarySet.h"
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    // All values in dictionary set and capture files are stored little endian
+    static constexpr uint32_t DictionarySetMagic = 0x5344545A; // 'ZTDS'
+    static constexpr uint32_t DictionarySetVersion = 1;
+    static constexpr uint32_t SampleCaptureMagic = 0x4354535A; // 'ZSTC'
+    static constexpr size_t HeaderSize = 3 * sizeof(uint32_t);
+    static constexpr size_t RecordHeaderSize = 2 * sizeof(uint16_t) + sizeof(uint32_t);
+
+    static void WriteUint16(AZStd::vector<uint8_t>& buffer, uint16_t value)
+    {
+        buffer.push_back(static_cast<uint8_t>(value));
+        buffer.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    static void WriteUint32(AZStd::vector<uint8_t>& buffer, uint32_t value)
+    {
+        WriteUint16(buffer, static_cast<uint16_t>(value));
+        WriteUint16(buffer, static_cast<uint16_t>(value >> 16));
+    }
+
+    static uint16_t ReadUint16(const uint8_t* buffer)
+    {
+        return static_cast<uint16_t>(buffer[0] | (buffer[1] << 8));
+    }
+
+    static uint32_t ReadUint32(const uint8_t* buffer)
+    {
+        return static_cast<uint32_t>(ReadUint16(buffer)) | (static_cast<uint32_t>(ReadUint16(buffer + 2)) << 16);
+    }
+
+    bool PeekPacketType(const uint8_t* payload, size_t payloadSize, ZstdPacketType& outType)
+    {
+        if (payload == nullptr || payloadSize < sizeof(ZstdPacketType))
+        {
+            return false;
+        }
+        outType = static_cast<ZstdPacketType>((payload[0] << 8) | payload[1]);
+        return true;
+    }
+
+    bool ZstdDictionarySet::LoadFromFile(const char* filePath)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary set %s: %s", filePath, readResult.GetError().c_str());
+            return false;
+        }
+        const AZStd::vector<uint8_t>& buffer = readResult.GetValue();
+        return LoadFromBuffer(buffer.data(), buffer.size());
+    }
+
+    bool ZstdDictionarySet::SaveToFile(const char* filePath) const
+    {
+        AZStd::vector<uint8_t> buffer;
+        SaveToBuffer(buffer);
+        auto writeResult = AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(buffer.data()), buffer.size()), filePath);
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to write zstd dictionary set %s: %s", filePath, writeResult.GetError().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool ZstdDictionarySet::LoadFromBuffer(const uint8_t* buffer, size_t bufferSize)
+    {
+        m_entries.clear();
+        m_slotLookup.clear();
+        m_setId = 0;
+
+        if (buffer == nullptr || bufferSize < HeaderSize || ReadUint32(buffer) != DictionarySetMagic)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Buffer is not a zstd dictionary set");
+            return false;
+        }
+
+        const uint32_t version = ReadUint32(buffer + sizeof(uint32_t));
+        if (version != DictionarySetVersion)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Unsupported zstd dictionary set version %u", version);
+            return false;
+        }
+
+        const uint32_t count = ReadUint32(buffer + 2 * sizeof(uint32_t));
+        size_t offset = HeaderSize;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (offset + RecordHeaderSize > bufferSize)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Truncated zstd dictionary set");
+                m_entries.clear();
+                m_slotLookup.clear();
+                return false;
+            }
+
+            const ZstdPacketType packetType = ReadUint16(buffer + offset);
+            const uint32_t dictionarySize = ReadUint32(buffer + offset + 2 * sizeof(uint16_t));
+            offset += RecordHeaderSize;
+            if (offset + dictionarySize > bufferSize || !AddEntry(packetType, AZStd::vector<uint8_t>(buffer + offset, buffer + offset + dictionarySize)))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Invalid dictionary for packet type %u in zstd dictionary set", packetType);
+                m_entries.clear();
+                m_slotLookup.clear();
+                return false;
+            }
+            offset += dictionarySize;
+        }
+
+        UpdateSetId();
+        return true;
+    }
+
+    void ZstdDictionarySet::SaveToBuffer(AZStd::vector<uint8_t>& outBuffer) const
+    {
+        outBuffer.clear();
+        WriteUint32(outBuffer, DictionarySetMagic);
+        WriteUint32(outBuffer, DictionarySetVersion);
+        WriteUint32(outBuffer, static_cast<uint32_t>(m_entries.size()));
+        for (const Entry& entry : m_entries)
+        {
+            WriteUint16(outBuffer, entry.m_packetType);
+            WriteUint16(outBuffer, 0);
+            WriteUint32(outBuffer, static_cast<uint32_t>(entry.m_dictionary.size()));
+            outBuffer.insert(outBuffer.end(), entry.m_dictionary.begin(), entry.m_dictionary.end());
+        }
+    }
+
+    bool ZstdDictionarySet::AddDictionary(ZstdPacketType packetType, AZStd::vector<uint8_t> dictionary)
+    {
+        if (!AddEntry(packetType, AZStd::move(dictionary)))
+        {
+            return false;
+        }
+        UpdateSetId();
+        return true;
+    }
+
+    bool ZstdDictionarySet::AddEntry(ZstdPacketType packetType, AZStd::vector<uint8_t>&& dictionary)
+    {
+        if (dictionary.empty())
+        {
+            return false;
+        }
+
+        auto iter = m_slotLookup.find(packetType);
+        if (iter != m_slotLookup.end())
+        {
+            m_entries[iter->second].m_dictionary = AZStd::move(dictionary);
+            return true;
+        }
+
+        if (m_entries.size() >= MaxDictionaries)
+        {
+            return false;
+        }
+        m_slotLookup.emplace(packetType, static_cast<uint8_t>(m_entries.size()));
+        m_entries.push_back(Entry{ packetType, AZStd::move(dictionary) });
+        return true;
+    }
+
+    uint8_t ZstdDictionarySet::GetSlot(ZstdPacketType packetType) const
+    {
+        auto iter = m_slotLookup.find(packetType);
+        return (iter != m_slotLookup.end()) ? iter->second : NoDictionarySlot;
+    }
+
+    uint32_t ZstdDictionarySet::GetDictionaryCount() const
+    {
+        return static_cast<uint32_t>(m_entries.size());
+    }
+
+    const AZStd::vector<uint8_t>& ZstdDictionarySet::GetDictionary(uint8_t slot) const
+    {
+        AZ_Assert(slot < m_entries.size(), "Invalid dictionary slot %u", slot);
+        return m_entries[slot].m_dictionary;
+    }
+
+    ZstdPacketType ZstdDictionarySet::GetPacketType(uint8_t slot) const
+    {
+        AZ_Assert(slot < m_entries.size(), "Invalid dictionary slot %u", slot);
+        return m_entries[slot].m_packetType;
+    }
+
+    uint32_t ZstdDictionarySet::GetSetId() const
+    {
+        return m_setId;
+    }
+
+    void ZstdDictionarySet::UpdateSetId()
+    {
+        if (m_entries.empty())
+        {
+            m_setId = 0;
+            return;
+        }
+
+        AZStd::vector<uint8_t> buffer;
+        SaveToBuffer(buffer);
+        m_setId = static_cast<uint32_t>(AZ::Crc32(buffer.data(), buffer.size()));
+    }
+
+    bool ZstdDictionarySet::TrainFromCapture(const char* capturePath, size_t dictionarySize, ZstdDictionarySet& outSet)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(capturePath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd sample capture %s: %s", capturePath, readResult.GetError().c_str());
+            return false;
+        }
+
+        const AZStd::vector<uint8_t>& capture = readResult.GetValue();
+        if (capture.size() < sizeof(uint32_t) || ReadUint32(capture.data()) != SampleCaptureMagic)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "%s is not a zstd sample capture", capturePath);
+            return false;
+        }
+
+        // ZDICT expects all samples for a dictionary to be concatenated in a single buffer, ordered map keeps slot assignment deterministic
+        struct Samples
+        {
+            AZStd::vector<uint8_t> m_data;
+            AZStd::vector<size_t> m_sizes;
+        };
+        AZStd::map<ZstdPacketType, Samples> samplesByType;
+
+        size_t offset = sizeof(uint32_t);
+        while (offset + RecordHeaderSize <= capture.size())
+        {
+            const ZstdPacketType packetType = ReadUint16(capture.data() + offset);
+            const uint32_t sampleSize = ReadUint32(capture.data() + offset + 2 * sizeof(uint16_t));
+            offset += RecordHeaderSize;
+            if (offset + sampleSize > capture.size())
+            {
+                // A capture interrupted mid-write can leave a partial trailing record
+                break;
+            }
+
+            Samples& samples = samplesByType[packetType];
+            samples.m_data.insert(samples.m_data.end(), capture.begin() + offset, capture.begin() + offset + sampleSize);
+            samples.m_sizes.push_back(sampleSize);
+            offset += sampleSize;
+        }
+
+        for (const auto& [packetType, samples] : samplesByType)
+        {
+            if (samples.m_sizes.size() < MinTrainingSamples)
+            {
+                AZ_TracePrintf("Multiplayer Compressor", "Skipping packet type %u, only %zu samples captured\n", packetType, samples.m_sizes.size());
+                continue;
+            }
+
+            AZStd::vector<uint8_t> dictionary(dictionarySize);
+            const size_t trainedSize = ZDICT_trainFromBuffer(
+                dictionary.data(), dictionary.size(), samples.m_data.data(), samples.m_sizes.data(), static_cast<unsigned>(samples.m_sizes.size()));
+            if (ZDICT_isError(trainedSize))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Failed to train dictionary for packet type %u: %s", packetType, ZDICT_getErrorName(trainedSize));
+                continue;
+            }
+
+            dictionary.resize(trainedSize);
+            if (!outSet.AddEntry(packetType, AZStd::move(dictionary)))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Dictionary set is full, remaining packet types are left untrained");
+                break;
+            }
+            AZ_TracePrintf("Multiplayer Compressor", "Trained %zu B dictionary for packet type %u from %zu samples\n", trainedSize, packetType, samples.m_sizes.size());
+        }
+
+        outSet.UpdateSetId();
+        return true;
+    }
+
+    bool ZstdSampleCapture::Open(const char* filePath)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const bool isNewFile = !AZ::IO::SystemFile::Exists(filePath) || AZ::IO::SystemFile::Length(filePath) == 0;
+        // SF_OPEN_CREATE truncates, only use it when there is no existing capture to append to
+        const int openMode = isNewFile
+            ? (AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH)
+            : (AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_APPEND);
+        if (!m_file.Open(filePath, openMode))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open zstd sample capture %s", filePath);
+            return false;
+        }
+
+        if (isNewFile)
+        {
+            AZStd::vector<uint8_t> header;
+            WriteUint32(header, SampleCaptureMagic);
+            m_file.Write(header.data(), header.size());
+        }
+        return true;
+    }
+
+    void ZstdSampleCapture::Append(const uint8_t* payload, size_t payloadSize)
+    {
+        ZstdPacketType packetType = 0;
+        if (!PeekPacketType(payload, payloadSize, packetType))
+        {
+            return;
+        }
+
+        AZStd::vector<uint8_t> record;
+        record.reserve(RecordHeaderSize + payloadSize);
+        WriteUint16(record, packetType);
+        WriteUint16(record, 0);
+        WriteUint32(record, static_cast<uint32_t>(payloadSize));
+        record.insert(record.end(), payload, payload + payloadSize);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            m_file.Write(record.data(), record.size());
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace MultiplayerCompression
+{
+    //! Packet types are serialized as a big endian uint16_t at the start of every UDP payload handed to the compressor.
+    using ZstdPacketType = uint16_t;
+
+    //! Reads the packet type from the start of an uncompressed payload.
+    //! @param payload     the uncompressed payload
+    //! @param payloadSize size of the payload in bytes
+    //! @param outType     the packet type found at the start of the payload
+    //! @return boolean true if the payload was large enough to contain a packet type
+    bool PeekPacketType(const uint8_t* payload, size_t payloadSize, ZstdPacketType& outType);
+
+    /**
+    * A versioned collection of zstd dictionaries, each trained on the payloads of a single packet type.
+    * Both endpoints of a connection must load the same set, the set identifier is folded into the compressor type so
+    * mismatched sets are rejected during the connection handshake.
+    */
+    class ZstdDictionarySet
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionarySet, AZ::SystemAllocator);
+
+        //! Slot value written for payloads compressed without a dictionary.
+        static constexpr uint8_t NoDictionarySlot = 0xFF;
+        //! Maximum number of dictionaries a set may contain, slots are encoded in a single byte.
+        static constexpr uint32_t MaxDictionaries = NoDictionarySlot;
+        //! Packet types with fewer captured samples than this are left without a dictionary.
+        static constexpr uint32_t MinTrainingSamples = 64;
+        //! Default size in bytes of each trained dictionary.
+        static constexpr size_t DefaultDictionarySize = 16 * 1024;
+
+        ZstdDictionarySet() = default;
+
+        //! Loads a dictionary set from a file produced by SaveToFile.
+        //! @param filePath path of the dictionary set file
+        //! @return boolean true on success
+        bool LoadFromFile(const char* filePath);
+
+        //! Writes this dictionary set to a file.
+        //! @param filePath path of the dictionary set file
+        //! @return boolean true on success
+        bool SaveToFile(const char* filePath) const;
+
+        //! Loads a dictionary set from a serialized buffer.
+        //! @param buffer     serialized dictionary set
+        //! @param bufferSize size of the serialized buffer in bytes
+        //! @return boolean true on success
+        bool LoadFromBuffer(const uint8_t* buffer, size_t bufferSize);
+
+        //! Serializes this dictionary set into the provided buffer.
+        //! @param outBuffer buffer to serialize into, existing contents are replaced
+        void SaveToBuffer(AZStd::vector<uint8_t>& outBuffer) const;
+
+        //! Adds a dictionary for the provided packet type, replacing any existing dictionary for that type.
+        //! @param packetType the packet type the dictionary was trained on
+        //! @param dictionary the raw dictionary content
+        //! @return boolean true on success, false if the set is full or the dictionary is empty
+        bool AddDictionary(ZstdPacketType packetType, AZStd::vector<uint8_t> dictionary);
+
+        //! Returns the slot of the dictionary to use for the provided packet type.
+        //! @param packetType the packet type to look up
+        //! @return the dictionary slot, or NoDictionarySlot if no dictionary was trained for this type
+        uint8_t GetSlot(ZstdPacketType packetType) const;
+
+        //! Returns the number of dictionaries in the set.
+        uint32_t GetDictionaryCount() const;
+
+        //! Returns the raw dictionary content for the provided slot.
+        const AZStd::vector<uint8_t>& GetDictionary(uint8_t slot) const;
+
+        //! Returns the packet type for the provided slot.
+        ZstdPacketType GetPacketType(uint8_t slot) const;
+
+        //! Returns an identifier derived from the content of the set, 0 for an empty set.
+        uint32_t GetSetId() const;
+
+        //! Trains a dictionary set from a capture file written by ZstdSampleCapture.
+        //! @param capturePath    path of the sample capture file
+        //! @param dictionarySize maximum size in bytes of each trained dictionary
+        //! @param outSet         dictionary set to populate
+        //! @return boolean true if the capture could be read, packet types that fail to train are skipped
+        static bool TrainFromCapture(const char* capturePath, size_t dictionarySize, ZstdDictionarySet& outSet);
+
+    private:
+        bool AddEntry(ZstdPacketType packetType, AZStd::vector<uint8_t>&& dictionary);
+        void UpdateSetId();
+
+        struct Entry
+        {
+            ZstdPacketType m_packetType = 0;
+            AZStd::vector<uint8_t> m_dictionary;
+        };
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::unordered_map<ZstdPacketType, uint8_t> m_slotLookup;
+        uint32_t m_setId = 0;
+    };
+
+    /**
+    * Appends uncompressed payloads to a capture file so dictionaries can be trained offline against real traffic.
+    * Each record is a packet type and payload size followed by the payload.
+    */
+    class ZstdSampleCapture
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdSampleCapture, AZ::SystemAllocator);
+
+        //! Opens the capture file for appending, creating it if necessary.
+        //! @param filePath path of the capture file
+        //! @return boolean true on success
+        bool Open(const char* filePath);
+
+        //! Appends a single payload to the capture, payloads without a packet type are ignored.
+        //! @param payload     uncompressed payload
+        //! @param payloadSize size of the payload in bytes
+        void Append(const uint8_t* payload, size_t payloadSize);
+
+    private:
+        AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+    };
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <ZstdCompressor.h>
+#include <ZstdDictionarySet.h>
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+
+class ZstdCompressorTest
+    : public UnitTest::LeakDetectionFixture
+{
+public:
+    // Builds a payload resembling an entity update packet, a big endian packet type followed by a mostly static body
+    static AZStd::vector<uint8_t> MakePayload(uint16_t packetType, uint32_t variation)
+    {
+        AZStd::vector<uint8_t> payload;
+        payload.push_back(static_cast<uint8_t>(packetType >> 8));
+        payload.push_back(static_cast<uint8_t>(packetType));
+        for (uint32_t i = 0; i < 96; ++i)
+        {
+            payload.push_back(static_cast<uint8_t>((i * 37) ^ 0x5A));
+        }
+        payload.push_back(static_cast<uint8_t>(variation));
+        payload.push_back(static_cast<uint8_t>(variation >> 8));
+        return payload;
+    }
+
+    static size_t RoundTrip(MultiplayerCompression::ZstdCompressor& compressor, const AZStd::vector<uint8_t>& payload)
+    {
+        AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(payload.size()));
+        size_t compressedSize = 0;
+        EXPECT_EQ(compressor.Compress(payload.data(), payload.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+        AZStd::vector<uint8_t> decompressed(payload.size());
+        size_t consumedSize = 0;
+        size_t decompressedSize = 0;
+        EXPECT_EQ(compressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, decompressedSize), AzNetworking::CompressorError::Ok);
+        EXPECT_EQ(consumedSize, compressedSize);
+        EXPECT_EQ(decompressed, payload);
+        return compressedSize;
+    }
+};
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_RoundTripWithoutDictionary)
+{
+    MultiplayerCompression::ZstdCompressor compressor;
+    ASSERT_TRUE(compressor.Init());
+    RoundTrip(compressor, MakePayload(1, 0));
+    EXPECT_EQ(compressor.GetType(), aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(MultiplayerCompression::ZstdCompressorName))));
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_RoundTripWithDictionary)
+{
+    // Any buffer is accepted as a raw content dictionary, a previous payload is representative of what training produces
+    AZStd::shared_ptr<MultiplayerCompression::ZstdDictionarySet> dictionarySet = AZStd::make_shared<MultiplayerCompression::ZstdDictionarySet>();
+    ASSERT_TRUE(dictionarySet->AddDictionary(7, MakePayload(7, 1234)));
+
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(dictionarySet);
+    ASSERT_TRUE(plainCompressor.Init());
+    ASSERT_TRUE(dictionaryCompressor.Init());
+
+    const AZStd::vector<uint8_t> payload = MakePayload(7, 4321);
+    EXPECT_LT(RoundTrip(dictionaryCompressor, payload), RoundTrip(plainCompressor, payload));
+
+    // Packet types without a dictionary still round trip
+    RoundTrip(dictionaryCompressor, MakePayload(8, 4321));
+
+    // Endpoints with and without the dictionary set must not negotiate the same compressor
+    EXPECT_NE(dictionaryCompressor.GetType(), plainCompressor.GetType());
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_InvalidSlot)
+{
+    MultiplayerCompression::ZstdCompressor compressor;
+    ASSERT_TRUE(compressor.Init());
+
+    const AZStd::vector<uint8_t> payload = MakePayload(1, 0);
+    AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(payload.size()));
+    size_t compressedSize = 0;
+    ASSERT_EQ(compressor.Compress(payload.data(), payload.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+    // Reference a dictionary slot this compressor has not loaded
+    compressed[0] = 0;
+    AZStd::vector<uint8_t> decompressed(payload.size());
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    EXPECT_EQ(compressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, decompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(ZstdCompressorTest, ZstdDictionarySet_SerializeRoundTrip)
+{
+    MultiplayerCompression::ZstdDictionarySet dictionarySet;
+    EXPECT_EQ(dictionarySet.GetSetId(), 0);
+    ASSERT_TRUE(dictionarySet.AddDictionary(3, MakePayload(3, 0)));
+    ASSERT_TRUE(dictionarySet.AddDictionary(9, MakePayload(9, 0)));
+    EXPECT_FALSE(dictionarySet.AddDictionary(10, {}));
+
+    AZStd::vector<uint8_t> buffer;
+    dictionarySet.SaveToBuffer(buffer);
+
+    MultiplayerCompression::ZstdDictionarySet loadedSet;
+    ASSERT_TRUE(loadedSet.LoadFromBuffer(buffer.data(), buffer.size()));
+    EXPECT_EQ(loadedSet.GetDictionaryCount(), 2);
+    EXPECT_EQ(loadedSet.GetSetId(), dictionarySet.GetSetId());
+    EXPECT_EQ(loadedSet.GetSlot(9), 1);
+    EXPECT_EQ(loadedSet.GetSlot(4), MultiplayerCompression::ZstdDictionarySet::NoDictionarySlot);
+    EXPECT_EQ(loadedSet.GetDictionary(loadedSet.GetSlot(3)), MakePayload(3, 0));
+
+    // Truncated buffers are rejected
+    EXPECT_FALSE(loadedSet.LoadFromBuffer(buffer.data(), buffer.size() - 1));
+    EXPECT_EQ(loadedSet.GetDictionaryCount(), 0);
+}
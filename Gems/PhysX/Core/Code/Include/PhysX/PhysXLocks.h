@@ -14,6 +14,17 @@ namespace PhysX
 {
     namespace Internal
     {
+        //! Number of PhysX scene locks, read or write, held by the calling thread.
+        inline thread_local uint32_t t_heldSceneLockCount = 0;
+
+        //! Returns true if the calling thread holds a read or write lock of any PhysX scene.
+        //! Code that waits for other threads to lock a scene must not run while this is true,
+        //! a thread waiting for the read lock blocks behind the writer holding it or queued for it.
+        inline bool IsHoldingSceneLock()
+        {
+            return t_heldSceneLockCount > 0;
+        }
+
         template<bool readLock = false>
         struct PhysXLock final
         {
@@ -56,10 +67,12 @@ namespace PhysX
                 {
                     m_scene->lockWrite(m_file, static_cast<physx::PxU32>(m_line));
                 }
+                ++t_heldSceneLockCount;
             }
 
             void unlock()
             {
+                --t_heldSceneLockCount;
                 if constexpr (readLock)
                 {
                     m_scene->unlockRead();
@@ -48,6 +48,7 @@ namespace PhysX
     {
     public:
         friend class RigidBodyComponent;
+        friend class PhysXScene;
 
         AZ_CLASS_ALLOCATOR(RigidBody, AZ::SystemAllocator);
         AZ_RTTI(PhysX::RigidBody, "{30CD41DD-9783-47A1-B935-9E5634238F45}", AzPhysics::RigidBody);
@@ -143,6 +144,12 @@ namespace PhysX
         AZStd::string m_name;
         PhysX::ActorData m_actorUserData;
         bool m_startAsleep = false;
+        //! World transform of the actor, read by the scene for all the active bodies at once right before sending their
+        //! transform sync events, so the handlers don't need to lock the scene and fetch the pose from PhysX again.
+        AZ::Transform m_activeBodyTransform = AZ::Transform::CreateIdentity();
+        //! Set when the transform sync handler set the entity transform without notifying its listeners,
+        //! the scene sends the notifications of all the synced bodies together once all their transforms are set.
+        bool m_transformNotificationPending = false;
     };
 
     AZ_POP_DISABLE_WARNING
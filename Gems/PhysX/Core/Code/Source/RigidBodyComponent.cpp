@@ -255,11 +255,11 @@ namespace PhysX
         m_activeBodySyncTransformHandler = AzPhysics::SimulatedBodyEvents::OnSyncTransform::Handler(
             [this](float fixedDeltatime)
             {
-                PostPhysicsTick(fixedDeltatime);
+                PostPhysicsTick(fixedDeltatime, true);
             });
     }
 
-    void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
+    void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime, bool isActiveBodySync)
     {
         // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
         // But in the case of setting the Kinematic Target directly, the transform needs to reflect the new kinematic target
@@ -284,17 +284,30 @@ namespace PhysX
             return;
         }
         
-        AZ::Transform transform = rigidBody->GetTransform();
+        // The scene reads the transforms of all the active bodies at once before sending their sync events.
+        RigidBody* physxRigidBody = isActiveBodySync ? azrtti_cast<RigidBody*>(rigidBody) : nullptr;
+        const AZ::Transform transform = physxRigidBody ? physxRigidBody->m_activeBodyTransform : rigidBody->GetTransform();
         if (m_configuration.m_interpolateMotion)
         {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
+            m_interpolator->SetTarget(transform.GetTranslation(), transform.GetRotation(), fixedDeltaTime);
         }
         else if (AZ::TransformInterface* entityTransform = GetEntity()->GetTransform())
         {
             AZ::Transform newWorldTransform = entityTransform->GetWorldTM();
-            newWorldTransform.SetRotation(rigidBody->GetOrientation());
-            newWorldTransform.SetTranslation(rigidBody->GetPosition());
-            entityTransform->SetWorldTM(newWorldTransform);
+            newWorldTransform.SetRotation(transform.GetRotation());
+            newWorldTransform.SetTranslation(transform.GetTranslation());
+
+            // The scene notifies the listeners of all the active bodies at once after their transforms are set.
+            // Kinematic bodies notify right away, their OnTransformChanged relies on m_isLastMovementFromKinematicSource.
+            if (physxRigidBody && !IsKinematic())
+            {
+                entityTransform->SetWorldTMDeferNotification(newWorldTransform);
+                physxRigidBody->m_transformNotificationPending = true;
+            }
+            else
+            {
+                entityTransform->SetWorldTM(newWorldTransform);
+            }
         }
         m_isLastMovementFromKinematicSource = false;
     }
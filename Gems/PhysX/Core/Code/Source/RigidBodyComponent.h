@@ -154,7 +154,11 @@ namespace PhysX
         void DestroyRigidBody();
         void ApplyPhysxSpecificConfiguration();
         void InitPhysicsTickHandler();
-        void PostPhysicsTick(float fixedDeltaTime);
+        //! Updates the entity transform from the rigid body after a simulation step.
+        //! @param isActiveBodySync True when called from the transform sync event of the active body, in which case
+        //! the transform read by the scene for all the active bodies is used instead of fetching it from PhysX again,
+        //! and the transform listeners are notified by the scene once all the active bodies are synced.
+        void PostPhysicsTick(float fixedDeltaTime, bool isActiveBodySync = false);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -17,19 +17,23 @@
 #include <PhysX/Utils.h>
 #include <PhysXCharacters/API/CharacterController.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXSystem.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
 #include <Joint/PhysXJoint.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -48,6 +52,18 @@ namespace PhysX
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries of a batch should be processed per task. "
+        "Batches that are not larger than this are processed on the calling thread. 0 disables parallel batch queries.");
+
+    AZ_CVAR(size_t, physx_sceneSnapshotCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many ticks of body poses each scene keeps, bounding how far back a scene can be rewound. 0 disables snapshots.");
+
+    AZ_CVAR(bool, physx_sceneSnapshotAutoCapture, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When true, every scene captures a snapshot at the end of each simulation step, using its simulation tick. "
+        "Leave false when snapshots are captured with ticks of another clock, such as network frames, "
+        "since both would share the snapshots kept by the scene.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -314,6 +330,8 @@ namespace PhysX
 
             if (status)
             {
+                // Reserve for the block and all touches up front so the hits are appended without growing the vector.
+                hits.m_hits.reserve(hits.m_hits.size() + (castResult.hasBlock ? 1 : 0) + castResult.getNbTouches());
                 if (castResult.hasBlock)
                 {
                     hits.m_hits.emplace_back(SceneQueryHelpers::GetHitFromPxHit(castResult.block, castResult.block));
@@ -388,6 +406,7 @@ namespace PhysX
 
                 if (status)
                 {
+                    hits.m_hits.reserve(hits.m_hits.size() + (castResult.hasBlock ? 1 : 0) + castResult.getNbTouches());
                     if (castResult.hasBlock)
                     {
                         hits.m_hits.emplace_back(SceneQueryHelpers::GetHitFromPxHit(castResult.block, castResult.block));
@@ -474,6 +493,25 @@ namespace PhysX
 
             return status;
         }
+
+        // Returns true if the request calls back into user code while it is processed.
+        bool HasUserCallback(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (request->m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return static_cast<const AzPhysics::RayCastRequest*>(request)->m_filterCallback != nullptr;
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return static_cast<const AzPhysics::ShapeCastRequest*>(request)->m_filterCallback != nullptr;
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                {
+                    const auto* overlapRequest = static_cast<const AzPhysics::OverlapRequest*>(request);
+                    return overlapRequest->m_filterCallback != nullptr || overlapRequest->m_unboundedOverlapHitCallback != nullptr;
+                }
+            default:
+                return false;
+            }
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -510,12 +548,24 @@ namespace PhysX
         m_pxScene->userData = this;
 
         m_gravity = m_config.m_gravity;
+
+        if (auto* physXSystem = GetPhysXSystem())
+        {
+            physXSystem->GetPhysXCpuDispatcher()->SetTaskBudget(m_pxScene->getTaskManager(), m_config.m_maxConcurrentSimulationTasks);
+        }
+
+        AZStd::to_wstring(m_simulationTimeCounterName, AZStd::string::format("PhysX/Scenes/%s/SimulationTimeUs", m_config.m_sceneName.c_str()));
     }
 
     PhysXScene::~PhysXScene()
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        if (m_rewound)
+        {
+            RestoreFromRewind();
+        }
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
@@ -545,6 +595,11 @@ namespace PhysX
 
         if (m_pxScene)
         {
+            if (auto* physXSystem = GetPhysXSystem())
+            {
+                physXSystem->GetPhysXCpuDispatcher()->SetTaskBudget(m_pxScene->getTaskManager(), 0);
+            }
+
             m_pxScene->release();
             m_pxScene = nullptr;
         }
@@ -559,22 +614,24 @@ namespace PhysX
             return;
         }
 
+        AZ_Assert(!m_rewound, "Scene '%s' is simulated while rewound to a snapshot, it must be restored first.", m_config.m_sceneName.c_str());
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationStartEvent::Signaled");
             m_sceneSimulationStartEvent.Signal(m_sceneHandle, deltatime);
         }
 
         m_currentDeltaTime = deltatime;
+        m_simulationStartTime = AZStd::chrono::steady_clock::now();
+        m_simulationResultsPending = true;
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
     }
 
-    void PhysXScene::FinishSimulation()
+    void PhysXScene::FetchResults()
     {
-        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
-
-        if (!IsEnabled())
+        if (!m_simulationResultsPending)
         {
             return;
         }
@@ -590,17 +647,39 @@ namespace PhysX
             m_pxScene->checkResults(true);
         }
 
-        bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::FetchResults");
             PHYSX_SCENE_WRITE_LOCK(m_pxScene);
 
-            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-
             // Swap the buffers, invoke callbacks, build the list of active actors.
+            // The simulation event callback only queues the events, they are sent by FinishSimulation.
             m_pxScene->fetchResults(true);
         }
 
+        m_simulationResultsPending = false;
+        m_lastSimulationTime =
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_simulationStartTime);
+    }
+
+    void PhysXScene::FinishSimulation()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
+
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        FetchResults();
+
+        m_lastTransformSyncTime = AZStd::chrono::nanoseconds::zero();
+
+        bool activeActorsEnabled = false;
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+        }
+
         if (activeActorsEnabled)
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
@@ -638,13 +717,22 @@ namespace PhysX
             }
             else
             {
+                const auto transformSyncStartTime = AZStd::chrono::steady_clock::now();
                 SyncActiveBodyTransform(activeBodyHandles);
+                m_lastTransformSyncTime = AZStd::chrono::steady_clock::now() - transformSyncStartTime;
             }
         }
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
+        // Captured before the finish event so its handlers can already rewind to this step.
+        ++m_simulationTick;
+        if (physx_sceneSnapshotAutoCapture && physx_sceneSnapshotCount > 0)
+        {
+            CaptureSnapshot(m_simulationTick);
+        }
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
             m_sceneSimulationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
@@ -681,6 +769,14 @@ namespace PhysX
     {
         if (m_config != config)
         {
+            if (m_config.m_maxConcurrentSimulationTasks != config.m_maxConcurrentSimulationTasks)
+            {
+                if (auto* physXSystem = GetPhysXSystem())
+                {
+                    physXSystem->GetPhysXCpuDispatcher()->SetTaskBudget(m_pxScene->getTaskManager(), config.m_maxConcurrentSimulationTasks);
+                }
+            }
+
             m_config = config;
             m_configChangeEvent.Signal(m_sceneHandle, m_config);
 
@@ -806,6 +902,14 @@ namespace PhysX
         if (index < m_simulatedBodies.size()
             && m_simulatedBodies[index].first == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle))
         {
+            if (m_rewound)
+            {
+                // The rewound actors are restored through raw pointers, which would dangle once the body is released.
+                AZ_Warning("PhysXScene", false, "Body removed from scene '%s' while it is rewound to a snapshot, the scene is restored first.",
+                    m_config.m_sceneName.c_str());
+                RestoreFromRewind();
+            }
+
             if (m_simulatedBodies[index].second->m_simulating)
             {
                 // Disable simulation on body (not signaling OnSimulationBodySimulationDisabled event)
@@ -1014,12 +1118,62 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_FUNCTION(Physics);
+
+        // Every result is written in place at the index of its request, so the results are in the same order as the requests
+        // no matter which task processed them, and the list is only allocated once.
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        // The tasks lock the scene for read while this thread waits for them. If this thread holds a scene lock the tasks can
+        // block behind it, or behind a writer queued after it, and never finish. Waiting on a task graph from a task worker is
+        // not supported and would take a worker away from the executor. Filter callbacks are user code that was never required
+        // to be thread safe. In all of these cases the batch stays on the calling thread.
+        const size_t batchSize = physx_parallelSceneQueryBatchSize;
+        const bool runInParallel = batchSize > 0 && requests.size() > batchSize &&
+            !Internal::IsHoldingSceneLock() && !AZ::TaskExecutor::Instance().IsTaskWorkerThread() &&
+            AZStd::none_of(requests.begin(), requests.end(),
+                [](const AZStd::shared_ptr<AzPhysics::SceneQueryRequest>& request)
+                {
+                    return request && Internal::HasUserCallback(request.get());
+                });
+
+        if (!runInParallel)
+        {
+            for (size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex)
+            {
+                QueryScene(requests[requestIndex].get(), results[requestIndex]);
+            }
+            return results;
+        }
+
+        AZ::TaskGraph taskGraph("Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Scene query batch event");
+
+        const size_t fullSize = requests.size();
+        for (size_t i = 0; i < fullSize; i += batchSize)
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZ::TaskDescriptor taskDescriptor{ "SceneQueryTask", "Physics" };
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+
+                    // Keep the scene locked for read for the entire task, the queries only take the lock again recursively.
+                    // PhysX allows any number of threads to hold the read lock at the same time. The hit buffers used by
+                    // QueryScene are thread local, so each worker reuses its own.
+                    PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+                    for (size_t requestIndex = start; requestIndex < end; ++requestIndex)
+                    {
+                        QueryScene(requests[requestIndex].get(), results[requestIndex]);
+                    }
+                });
         }
+
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
         return results;
     }
 
@@ -1246,6 +1400,8 @@ namespace PhysX
 
         AZ_PROFILE_SCOPE(Physics, "PhysX::Statistics");
 
+        AZ_PROFILE_DATAPOINT(Physics, m_lastSimulationTime.count(), m_simulationTimeCounterName.c_str());
+
         physx::PxSimulationStatistics stats;
 
         {
@@ -1318,6 +1474,14 @@ namespace PhysX
 
     void PhysXScene::SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles)
     {
+        AZStd::vector<AzPhysics::SimulatedBodyIndex> activeBodyIndices;
+        activeBodyIndices.reserve(activeBodyHandles.size());
+        for (const AzPhysics::SimulatedBodyHandle& bodyHandle : activeBodyHandles)
+        {
+            activeBodyIndices.emplace_back(AZStd::get<1>(bodyHandle));
+        }
+        ReadActiveBodyTransforms(activeBodyIndices);
+
         if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
             for (const AzPhysics::SimulatedBodyHandle& bodyHandle : activeBodyHandles)
@@ -1328,12 +1492,16 @@ namespace PhysX
                 }
             }
         }
+
+        NotifyActiveBodyTransformsChanged(activeBodyIndices);
     }
 
     void PhysXScene::FlushTransformSync()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysX::FlushTransformSync");
 
+        ReadActiveBodyTransforms(m_queuedActiveBodyIndices.GetIndices());
+
         auto transformSync = [this](AzPhysics::SimulatedBodyIndex bodyIndex)
         {
             if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second)
@@ -1351,10 +1519,216 @@ namespace PhysX
             m_queuedActiveBodyIndices.Apply(transformSync);
         }
 
+        NotifyActiveBodyTransformsChanged(m_queuedActiveBodyIndices.GetIndices());
+
         m_queuedActiveBodyIndices.Clear();
         m_accumulatedDeltaTime = 0.0f;
     }
 
+    void PhysXScene::ReadActiveBodyTransforms(const AZStd::vector<AzPhysics::SimulatedBodyIndex>& bodyIndices)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ReadActiveBodyTransforms");
+
+        // Locking the scene once for all the bodies is much cheaper than each transform sync handler
+        // locking it again to read the pose of its own body.
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+        for (AzPhysics::SimulatedBodyIndex bodyIndex : bodyIndices)
+        {
+            if (bodyIndex >= m_simulatedBodies.size())
+            {
+                continue;
+            }
+
+            if (auto* rigidBody = azrtti_cast<RigidBody*>(m_simulatedBodies[bodyIndex].second);
+                rigidBody && rigidBody->m_pxRigidActor)
+            {
+                rigidBody->m_activeBodyTransform = PxMathConvert(rigidBody->m_pxRigidActor->getGlobalPose());
+            }
+        }
+    }
+
+    void PhysXScene::NotifyActiveBodyTransformsChanged(const AZStd::vector<AzPhysics::SimulatedBodyIndex>& bodyIndices)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::NotifyActiveBodyTransformsChanged");
+
+        // Runs on this thread after all the sync handlers, including the parallel ones, so the listeners see every
+        // entity of the step at its new transform and are never called from the sync tasks.
+        for (AzPhysics::SimulatedBodyIndex bodyIndex : bodyIndices)
+        {
+            if (bodyIndex >= m_simulatedBodies.size())
+            {
+                continue;
+            }
+
+            if (auto* rigidBody = azrtti_cast<RigidBody*>(m_simulatedBodies[bodyIndex].second);
+                rigidBody && rigidBody->m_transformNotificationPending)
+            {
+                rigidBody->m_transformNotificationPending = false;
+                AZ::TransformBus::Event(rigidBody->GetEntityId(), &AZ::TransformBus::Events::NotifyTransformChanged);
+            }
+        }
+    }
+
+    void PhysXScene::CaptureSnapshot(AZ::u64 tick)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::CaptureSnapshot");
+
+        if (physx_sceneSnapshotCount == 0)
+        {
+            m_snapshots.reset();
+            return;
+        }
+
+        AZ_Warning("PhysXScene", !physx_sceneSnapshotAutoCapture || tick == m_simulationTick,
+            "Scene '%s' captures tick %llu while physx_sceneSnapshotAutoCapture captures its simulation ticks, the snapshots may replace each other.",
+            m_config.m_sceneName.c_str(), tick);
+
+        if (!m_snapshots || m_snapshots->GetCapacity() != physx_sceneSnapshotCount)
+        {
+            m_snapshots = AZStd::make_unique<SceneSnapshotRing>(physx_sceneSnapshotCount);
+        }
+
+        SceneSnapshot& snapshot = m_snapshots->AcquireSnapshot(tick);
+
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+        // Kinematic bodies and the actors of character controllers are rigid dynamic actors as well.
+        const physx::PxU32 actorCount = m_pxScene->getNbActors(physx::PxActorTypeFlag::eRIGID_DYNAMIC);
+        m_snapshotActorBuffer.resize_no_construct(actorCount);
+        m_pxScene->getActors(physx::PxActorTypeFlag::eRIGID_DYNAMIC, m_snapshotActorBuffer.data(), actorCount);
+
+        snapshot.Reserve(actorCount);
+        for (physx::PxActor* actor : m_snapshotActorBuffer)
+        {
+            const ActorData* actorData = Utils::GetUserData(actor);
+            if (!actorData)
+            {
+                continue;
+            }
+
+            const AzPhysics::SimulatedBodyHandle bodyHandle = actorData->GetBodyHandle();
+            if (bodyHandle == AzPhysics::InvalidSimulatedBodyHandle)
+            {
+                continue;
+            }
+
+            const physx::PxTransform pose = static_cast<physx::PxRigidDynamic*>(actor)->getGlobalPose();
+            snapshot.m_bodyHandles.push_back(bodyHandle);
+            snapshot.m_positions.push_back(pose.p);
+            snapshot.m_rotations.push_back(pose.q);
+        }
+        snapshot.m_valid = true;
+    }
+
+    bool PhysXScene::HasSnapshot(AZ::u64 tick) const
+    {
+        return m_snapshots && m_snapshots->FindSnapshot(tick) != nullptr;
+    }
+
+    void PhysXScene::ClearSnapshots()
+    {
+        if (m_snapshots)
+        {
+            m_snapshots->Clear();
+        }
+    }
+
+    bool PhysXScene::RewindToSnapshot(AZ::u64 tick)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::RewindToSnapshot");
+
+        if (m_rewound)
+        {
+            AZ_Warning("PhysXScene", false, "Scene '%s' is already rewound, restore it before rewinding again.", m_config.m_sceneName.c_str());
+            return false;
+        }
+
+        const SceneSnapshot* snapshot = m_snapshots ? m_snapshots->FindSnapshot(tick) : nullptr;
+        if (!snapshot)
+        {
+            return false;
+        }
+
+        const size_t bodyCount = snapshot->GetBodyCount();
+        m_rewoundActors.clear();
+        m_rewoundActors.reserve(bodyCount);
+        m_presentPoses.clear();
+        m_presentPoses.reserve(bodyCount);
+
+        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+
+        for (size_t i = 0; i < bodyCount; ++i)
+        {
+            // Bodies removed from the scene since the tick are skipped, their handle no longer resolves.
+            physx::PxRigidDynamic* actor = GetRewindableActor(snapshot->m_bodyHandles[i]);
+            if (!actor)
+            {
+                continue;
+            }
+
+            // Teleport without waking the bodies up, the present pose is restored before the next simulation step.
+            m_rewoundActors.push_back(actor);
+            m_presentPoses.push_back(actor->getGlobalPose());
+            actor->setGlobalPose(physx::PxTransform(snapshot->m_positions[i], snapshot->m_rotations[i]), false);
+        }
+
+        m_rewound = true;
+        return true;
+    }
+
+    void PhysXScene::RestoreFromRewind()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::RestoreFromRewind");
+
+        if (!m_rewound)
+        {
+            return;
+        }
+
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            for (size_t i = 0; i < m_rewoundActors.size(); ++i)
+            {
+                m_rewoundActors[i]->setGlobalPose(m_presentPoses[i], false);
+            }
+        }
+
+        m_rewoundActors.clear();
+        m_presentPoses.clear();
+        m_rewound = false;
+    }
+
+    physx::PxRigidDynamic* PhysXScene::GetRewindableActor(const AzPhysics::SimulatedBodyHandle& bodyHandle) const
+    {
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (index >= m_simulatedBodies.size() || m_simulatedBodies[index].first != AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle))
+        {
+            return nullptr;
+        }
+
+        AzPhysics::SimulatedBody* body = m_simulatedBodies[index].second;
+        if (!body || !body->m_simulating || azrtti_istypeof<PhysX::Ragdoll>(body) || azrtti_istypeof<PhysX::ArticulationLink>(body))
+        {
+            return nullptr;
+        }
+
+        physx::PxActor* actor = nullptr;
+        if (azrtti_istypeof<PhysX::CharacterController>(body))
+        {
+            if (auto* pxController = static_cast<physx::PxController*>(body->GetNativePointer()))
+            {
+                actor = pxController->getActor();
+            }
+        }
+        else
+        {
+            actor = static_cast<physx::PxActor*>(body->GetNativePointer());
+        }
+
+        return actor ? actor->is<physx::PxRigidDynamic>() : nullptr;
+    }
+
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
     {
         if (m_uniqueIndices.insert(bodyIndex).second)
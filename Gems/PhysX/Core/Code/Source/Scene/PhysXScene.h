@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsJoint.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -15,12 +17,17 @@
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <Scene/PhysXSceneSnapshot.h>
+
+#include <foundation/PxTransform.h>
 
 namespace physx
 {
+    class PxActor;
     class PxControllerManager;
     struct PxOverlapHit;
     struct PxRaycastHit;
+    class PxRigidDynamic;
     class PxScene;
     struct PxSweepHit;
 }
@@ -81,9 +88,44 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Waits for the simulation started by StartSimulation to complete and fetches its results, without sending any event.
+        //! Can be called from another thread than the one simulating the scene, FinishSimulation then only sends the events.
+        void FetchResults();
+
+        //! Time from the start of the last simulation step to its results being fetched.
+        AZStd::chrono::microseconds GetLastSimulationTime() const { return m_lastSimulationTime; }
+
+        //! Time the last FinishSimulation spent syncing the active body transforms, 0 when physx_batchTransformSync
+        //! defers the sync to FlushTransformSync.
+        AZStd::chrono::nanoseconds GetLastTransformSyncTime() const { return m_lastTransformSyncTime; }
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Number of simulation steps the scene finished. When physx_sceneSnapshotAutoCapture is true the scene captures
+        //! a snapshot at the end of every step, using this as the tick, before signaling the simulation finish event.
+        AZ::u64 GetSimulationTick() const { return m_simulationTick; }
+
+        //! Stores the poses of all the dynamic and kinematic rigid bodies and character controllers of the scene for the given tick,
+        //! in a ring holding the last physx_sceneSnapshotCount ticks. Capturing a tick again replaces its previous snapshot.
+        //! Does nothing when physx_sceneSnapshotCount is 0.
+        //! The ticks are chosen by the caller, such as network frames, and a scene only keeps snapshots of one kind of tick.
+        //! With physx_sceneSnapshotAutoCapture the ticks are the simulation ticks of GetSimulationTick.
+        void CaptureSnapshot(AZ::u64 tick);
+        //! Returns true if the given tick can be rewound to.
+        bool HasSnapshot(AZ::u64 tick) const;
+        //! Discards all the captured snapshots.
+        void ClearSnapshots();
+
+        //! Moves the bodies to their poses at the given tick, keeping their present poses to restore them later.
+        //! Prefer ScopedSceneRewind which restores the present poses when it goes out of scope.
+        //! Returns false without changing the scene if the tick is not captured or the scene is already rewound.
+        bool RewindToSnapshot(AZ::u64 tick);
+        //! Moves the bodies moved by RewindToSnapshot back to their present poses.
+        //! Removing a body from the scene while it is rewound restores the scene first.
+        void RestoreFromRewind();
+        bool IsRewound() const { return m_rewound; }
         
     private:
 
@@ -97,6 +139,7 @@ namespace PhysX
             void Clear();
             void Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction);
             void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
+            const AZStd::vector<AzPhysics::SimulatedBodyIndex>& GetIndices() const { return m_packedIndices; }
 
         private:
             AZStd::unordered_set<AzPhysics::SimulatedBodyIndex> m_uniqueIndices;
@@ -114,6 +157,15 @@ namespace PhysX
         void UpdateAzProfilerDataPoints();
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
+        //! Reads the world transforms of the given rigid bodies from PhysX with a single scene lock,
+        //! before their transform sync events are sent.
+        void ReadActiveBodyTransforms(const AZStd::vector<AzPhysics::SimulatedBodyIndex>& bodyIndices);
+        //! Notifies the transform listeners of the given rigid bodies whose sync handlers set the entity transform
+        //! without notifying, after the transforms of all the synced bodies are set.
+        void NotifyActiveBodyTransformsChanged(const AZStd::vector<AzPhysics::SimulatedBodyIndex>& bodyIndices);
+
+        //! Returns the PhysX actor of the body if it is still in the scene and its pose can be rewound.
+        physx::PxRigidDynamic* GetRewindableActor(const AzPhysics::SimulatedBodyHandle& bodyHandle) const;
 
         bool m_isEnabled = true;
 
@@ -133,6 +185,12 @@ namespace PhysX
         // Delta time for the current simulation sub-step
         float m_currentDeltaTime = 0.0f;
 
+        bool m_simulationResultsPending = false; //!< True from StartSimulation until the results are fetched.
+        AZStd::chrono::steady_clock::time_point m_simulationStartTime;
+        AZStd::chrono::microseconds m_lastSimulationTime{ 0 };
+        AZStd::chrono::nanoseconds m_lastTransformSyncTime{ 0 };
+        AZStd::wstring m_simulationTimeCounterName; //!< Profiler counter of the simulation time, named after the scene.
+
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies;
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
@@ -156,5 +214,14 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        // Snapshots for rewinding the scene to a past tick, created on the first capture.
+        AZ::u64 m_simulationTick = 0;
+        AZStd::unique_ptr<SceneSnapshotRing> m_snapshots;
+        AZStd::vector<physx::PxActor*> m_snapshotActorBuffer; //!< Reused buffer to read the actors of the scene in a single call.
+        // Actors moved by RewindToSnapshot and their present poses.
+        bool m_rewound = false;
+        AZStd::vector<physx::PxRigidDynamic*> m_rewoundActors;
+        AZStd::vector<physx::PxTransform> m_presentPoses;
     };
 }
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneSnapshot.h>
+#include <Scene/PhysXScene.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace PhysX
+{
+    void SceneSnapshot::Clear()
+    {
+        m_valid = false;
+        m_bodyHandles.clear();
+        m_positions.clear();
+        m_rotations.clear();
+    }
+
+    void SceneSnapshot::Reserve(size_t bodyCount)
+    {
+        m_bodyHandles.reserve(bodyCount);
+        m_positions.reserve(bodyCount);
+        m_rotations.reserve(bodyCount);
+    }
+
+    SceneSnapshotRing::SceneSnapshotRing(size_t capacity)
+        : m_snapshots(AZStd::max<size_t>(capacity, 1))
+    {
+    }
+
+    SceneSnapshot& SceneSnapshotRing::AcquireSnapshot(AZ::u64 tick)
+    {
+        SceneSnapshot& snapshot = m_snapshots[tick % m_snapshots.size()];
+        snapshot.Clear();
+        snapshot.m_tick = tick;
+        return snapshot;
+    }
+
+    const SceneSnapshot* SceneSnapshotRing::FindSnapshot(AZ::u64 tick) const
+    {
+        const SceneSnapshot& snapshot = m_snapshots[tick % m_snapshots.size()];
+        return (snapshot.m_valid && snapshot.m_tick == tick) ? &snapshot : nullptr;
+    }
+
+    void SceneSnapshotRing::Clear()
+    {
+        for (SceneSnapshot& snapshot : m_snapshots)
+        {
+            snapshot.Clear();
+        }
+    }
+
+    ScopedSceneRewind::ScopedSceneRewind(PhysXScene& scene, AZ::u64 tick)
+        : m_scene(scene)
+    {
+        m_rewound = m_scene.RewindToSnapshot(tick);
+    }
+
+    ScopedSceneRewind::~ScopedSceneRewind()
+    {
+        if (m_rewound)
+        {
+            m_scene.RestoreFromRewind();
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+#include <foundation/PxQuat.h>
+#include <foundation/PxVec3.h>
+
+namespace PhysX
+{
+    class PhysXScene;
+
+    //! Poses of the dynamic and kinematic bodies of a scene at one tick.
+    //! The poses are stored in separate arrays so capturing and applying them is a straight copy.
+    struct SceneSnapshot
+    {
+        void Clear();
+        void Reserve(size_t bodyCount);
+        size_t GetBodyCount() const { return m_bodyHandles.size(); }
+
+        AZ::u64 m_tick = 0;
+        bool m_valid = false;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_bodyHandles;
+        AZStd::vector<physx::PxVec3> m_positions;
+        AZStd::vector<physx::PxQuat> m_rotations;
+    };
+
+    //! Fixed size ring of the most recent snapshots of a scene, addressed by tick.
+    //! Capturing a new tick overwrites the snapshot of the tick one capacity older, the memory of the slots is reused.
+    class SceneSnapshotRing
+    {
+    public:
+        explicit SceneSnapshotRing(size_t capacity);
+
+        //! Returns the slot to capture the given tick into, discarding the snapshot previously stored in it.
+        SceneSnapshot& AcquireSnapshot(AZ::u64 tick);
+        //! Returns the snapshot of the given tick, or nullptr if the tick was not captured or is too old.
+        const SceneSnapshot* FindSnapshot(AZ::u64 tick) const;
+        void Clear();
+
+        size_t GetCapacity() const { return m_snapshots.size(); }
+
+    private:
+        AZStd::vector<SceneSnapshot> m_snapshots;
+    };
+
+    //! Moves the bodies of a scene to the poses captured at a past tick for the lifetime of this object,
+    //! so scene queries run in the scope see the scene as it was at that tick, and moves them back on destruction.
+    //! Only valid between simulation steps, and bodies must not be removed from the scene while it is rewound.
+    //! Bodies added to the scene after the tick keep their present pose.
+    class ScopedSceneRewind
+    {
+    public:
+        ScopedSceneRewind(PhysXScene& scene, AZ::u64 tick);
+        ~ScopedSceneRewind();
+
+        ScopedSceneRewind(const ScopedSceneRewind&) = delete;
+        ScopedSceneRewind& operator=(const ScopedSceneRewind&) = delete;
+
+        //! False if the tick is not in the snapshot ring of the scene, in which case the scene is left as it is.
+        bool IsRewound() const { return m_rewound; }
+
+    private:
+        PhysXScene& m_scene;
+        bool m_rewound = false;
+    };
+} // namespace PhysX
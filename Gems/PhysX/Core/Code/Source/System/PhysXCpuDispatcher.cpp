@@ -16,9 +16,131 @@ namespace PhysX
         return aznew PhysXCpuDispatcher();
     }
 
+    void PhysXCpuDispatcher::SetTaskBudget(physx::PxTaskManager* taskManager, AZ::u32 maxConcurrentTasks)
+    {
+        AZStd::deque<physx::PxBaseTask*> tasksToStart;
+        {
+            AZStd::scoped_lock lock(m_taskBudgetsMutex);
+            auto taskBudgetIt = m_taskBudgets.find(taskManager);
+            if (maxConcurrentTasks == 0)
+            {
+                if (taskBudgetIt == m_taskBudgets.end())
+                {
+                    return;
+                }
+                TaskBudget& taskBudget = taskBudgetIt->second;
+                tasksToStart = AZStd::move(taskBudget.m_pendingTasks);
+                taskBudget.m_pendingTasks.clear();
+                if (taskBudget.m_runningTasks == 0)
+                {
+                    m_taskBudgets.erase(taskBudgetIt);
+                }
+                else
+                {
+                    // Keep counting the running tasks until they are done, in case the budget is set again before then.
+                    taskBudget.m_maxConcurrentTasks = 0;
+                }
+            }
+            else
+            {
+                TaskBudget& taskBudget = (taskBudgetIt != m_taskBudgets.end()) ? taskBudgetIt->second : m_taskBudgets[taskManager];
+                taskBudget.m_maxConcurrentTasks = maxConcurrentTasks;
+                while (!taskBudget.m_pendingTasks.empty() && taskBudget.m_runningTasks < taskBudget.m_maxConcurrentTasks)
+                {
+                    tasksToStart.push_back(taskBudget.m_pendingTasks.front());
+                    taskBudget.m_pendingTasks.pop_front();
+                    ++taskBudget.m_runningTasks;
+                }
+            }
+            m_taskBudgetCount = aznumeric_cast<AZ::u32>(m_taskBudgets.size());
+        }
+
+        // Tasks of a removed budget are started without one, tasks of a raised budget still count against it.
+        PhysXCpuDispatcher* budgetDispatcher = (maxConcurrentTasks == 0) ? nullptr : this;
+        for (physx::PxBaseTask* task : tasksToStart)
+        {
+            auto azJob = aznew PhysXJob(*task, nullptr, budgetDispatcher);
+            azJob->Start();
+        }
+    }
+
+    void PhysXCpuDispatcher::OnBudgetedTaskFinished(physx::PxTaskManager* taskManager)
+    {
+        physx::PxBaseTask* nextTask = nullptr;
+        {
+            AZStd::scoped_lock lock(m_taskBudgetsMutex);
+            auto taskBudgetIt = m_taskBudgets.find(taskManager);
+            if (taskBudgetIt == m_taskBudgets.end())
+            {
+                AZ_Assert(false, "PhysXCpuDispatcher - a budgeted task finished for a scene without a budget.");
+                return;
+            }
+
+            TaskBudget& taskBudget = taskBudgetIt->second;
+            AZ_Assert(taskBudget.m_runningTasks > 0, "PhysXCpuDispatcher - more budgeted tasks finished than were started.");
+            if (!taskBudget.m_pendingTasks.empty() && taskBudget.m_runningTasks <= taskBudget.m_maxConcurrentTasks)
+            {
+                // The finished task's slot goes straight to the next pending task.
+                nextTask = taskBudget.m_pendingTasks.front();
+                taskBudget.m_pendingTasks.pop_front();
+            }
+            else if (taskBudget.m_runningTasks > 0)
+            {
+                --taskBudget.m_runningTasks;
+                if (taskBudget.m_runningTasks == 0 && taskBudget.m_maxConcurrentTasks == 0)
+                {
+                    // The last task started before the budget was removed is done.
+                    m_taskBudgets.erase(taskBudgetIt);
+                    m_taskBudgetCount = aznumeric_cast<AZ::u32>(m_taskBudgets.size());
+                }
+            }
+        }
+
+        if (nextTask)
+        {
+            auto azJob = aznew PhysXJob(*nextTask, nullptr, this);
+            azJob->Start();
+        }
+    }
+
+    AZ::u32 PhysXCpuDispatcher::GetTaskBudget(physx::PxTaskManager* taskManager) const
+    {
+        AZStd::scoped_lock lock(m_taskBudgetsMutex);
+        auto taskBudgetIt = m_taskBudgets.find(taskManager);
+        return (taskBudgetIt != m_taskBudgets.end()) ? taskBudgetIt->second.m_maxConcurrentTasks : 0;
+    }
+
+    AZ::u32 PhysXCpuDispatcher::GetBudgetedTaskCount(physx::PxTaskManager* taskManager) const
+    {
+        AZStd::scoped_lock lock(m_taskBudgetsMutex);
+        auto taskBudgetIt = m_taskBudgets.find(taskManager);
+        return (taskBudgetIt != m_taskBudgets.end()) ? taskBudgetIt->second.m_runningTasks : 0;
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
+        PhysXCpuDispatcher* budgetDispatcher = nullptr;
+        if (m_taskBudgetCount > 0)
+        {
+            AZStd::scoped_lock lock(m_taskBudgetsMutex);
+            if (auto taskBudgetIt = m_taskBudgets.find(task.getTaskManager()); taskBudgetIt != m_taskBudgets.end())
+            {
+                TaskBudget& taskBudget = taskBudgetIt->second;
+                // A budget that was removed is only kept to count the tasks started under it, new tasks run without it.
+                if (taskBudget.m_maxConcurrentTasks > 0)
+                {
+                    if (taskBudget.m_runningTasks >= taskBudget.m_maxConcurrentTasks)
+                    {
+                        taskBudget.m_pendingTasks.push_back(&task);
+                        return;
+                    }
+                    ++taskBudget.m_runningTasks;
+                    budgetDispatcher = this;
+                }
+            }
+        }
+
+        auto azJob = aznew PhysXJob(task, nullptr, budgetDispatcher);
         azJob->Start();
     }
 
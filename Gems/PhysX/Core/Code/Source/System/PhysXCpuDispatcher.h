@@ -8,6 +8,10 @@
 
 #pragma once
 #include <PxPhysicsAPI.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <System/PhysXAllocator.h>
 
 namespace PhysX
@@ -21,11 +25,40 @@ namespace PhysX
 
         PhysXCpuDispatcher() = default;
         ~PhysXCpuDispatcher() = default;
-        
+
+        //! Limits the number of tasks of a scene running at the same time.
+        //! Tasks over the budget are started once a running task of the same scene is done.
+        //! @param taskManager Task manager of the scene, every task PhysX submits for the scene belongs to it.
+        //! @param maxConcurrentTasks Maximum number of tasks running at the same time, 0 removes the budget.
+        void SetTaskBudget(physx::PxTaskManager* taskManager, AZ::u32 maxConcurrentTasks);
+
+        //! Called once a task of a scene with a budget is done.
+        void OnBudgetedTaskFinished(physx::PxTaskManager* taskManager);
+
+        //! Returns the maximum number of tasks of a scene running at the same time, 0 if the scene has no budget.
+        AZ::u32 GetTaskBudget(physx::PxTaskManager* taskManager) const;
+
+        //! Returns the number of tasks of a scene counting against its budget that are still running,
+        //! including the ones started before the budget was removed.
+        AZ::u32 GetBudgetedTaskCount(physx::PxTaskManager* taskManager) const;
+
     private:
+        struct TaskBudget
+        {
+            //! 0 once the budget is removed, the entry is kept until the tasks started under the budget are done
+            //! so they are still counted if the budget is set again.
+            AZ::u32 m_maxConcurrentTasks = 0;
+            AZ::u32 m_runningTasks = 0;
+            AZStd::deque<physx::PxBaseTask*> m_pendingTasks;
+        };
+
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        mutable AZStd::mutex m_taskBudgetsMutex;
+        AZStd::unordered_map<physx::PxTaskManager*, TaskBudget> m_taskBudgets;
+        AZStd::atomic<AZ::u32> m_taskBudgetCount{ 0 }; //!< Lets tasks skip the mutex when no scene has a budget.
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
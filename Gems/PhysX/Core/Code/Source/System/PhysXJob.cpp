@@ -7,13 +7,16 @@
  */
 
 #include <System/PhysXJob.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <AzCore/Debug/Profiler.h>
 
 namespace PhysX
 {
-    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context)
+    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context, PhysXCpuDispatcher* budgetDispatcher)
         : AZ::Job(true, context)
         , m_pxTask(pxTask)
+        , m_budgetDispatcher(budgetDispatcher)
+        , m_taskManager(pxTask.getTaskManager())
     {
     }
 
@@ -22,5 +25,10 @@ namespace PhysX
         AZ_PROFILE_SCOPE(Physics, m_pxTask.getName());
         m_pxTask.run();
         m_pxTask.release();
+
+        if (m_budgetDispatcher)
+        {
+            m_budgetDispatcher->OnBudgetedTaskFinished(m_taskManager);
+        }
     }
 }
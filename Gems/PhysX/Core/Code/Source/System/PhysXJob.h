@@ -13,6 +13,8 @@
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     //! Handles PhysX tasks in the Open 3D Engine job scheduler.
     class PhysXJob
         : public AZ::Job
@@ -20,7 +22,8 @@ namespace PhysX
     public:
         AZ_CLASS_ALLOCATOR(PhysXJob, AZ::ThreadPoolAllocator);
 
-        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr);
+        //! @param budgetDispatcher Dispatcher to notify once the task is done, when the task counts against the budget of its scene.
+        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr, PhysXCpuDispatcher* budgetDispatcher = nullptr);
         ~PhysXJob() = default;
 
     protected:
@@ -28,5 +31,7 @@ namespace PhysX
 
     private:
         physx::PxBaseTask& m_pxTask;
+        PhysXCpuDispatcher* m_budgetDispatcher = nullptr;
+        physx::PxTaskManager* m_taskManager = nullptr; //!< Kept since the task can't be accessed once released.
     };
 }
@@ -21,6 +21,7 @@
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/PlatformId/PlatformId.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 // only enable physx timestep warning when not running debug or in Release
@@ -36,6 +37,12 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_concurrentSceneSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Simulate the enabled scenes at the same time. "
+        "True: All scenes are started before any of them is finished, and their results are fetched on separate tasks. "
+        "The simulation finish events of all scenes are sent after the simulation start events of all scenes. "
+        "False: Each scene is started and finished before the next one is started.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -187,6 +194,12 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
+            if (physx_concurrentSceneSimulation)
+            {
+                SimulateScenesConcurrently(timeStep);
+                return;
+            }
+
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
@@ -260,6 +273,57 @@ namespace PhysX
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::SimulateScenesConcurrently(float timeStep)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AZStd::vector<PhysXScene*> scenes;
+        scenes.reserve(m_sceneList.size());
+        for (auto& scenePtr : m_sceneList)
+        {
+            if (scenePtr != nullptr && scenePtr->IsEnabled())
+            {
+                scenes.emplace_back(static_cast<PhysXScene*>(scenePtr.get()));
+            }
+        }
+
+        // Starting a scene only submits its simulation tasks to the job system,
+        // so the scenes started first keep simulating while the next ones are started.
+        for (PhysXScene* scene : scenes)
+        {
+            scene->StartSimulation(timeStep);
+        }
+
+        if (scenes.size() > 1)
+        {
+            // Fetch the results of each scene on its own task, so a scene that is done doesn't wait for a slower one.
+            AZ::TaskGraph taskGraph("Concurrent Scene Simulation");
+            AZ::TaskGraphEvent finishEvent("Scene results fetched event");
+            for (PhysXScene* scene : scenes)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "FetchResultsTask", "Physics" },
+                    [scene]()
+                    {
+                        scene->FetchResults();
+                    });
+            }
+            taskGraph.Submit(&finishEvent);
+            finishEvent.Wait();
+        }
+
+        // Events are sent on this thread, in the same scene order as when the scenes are simulated one after the other.
+        const bool recordSimulationTime = !m_performanceCollector->IsWaitingBeforeCapture();
+        for (PhysXScene* scene : scenes)
+        {
+            scene->FinishSimulation();
+            if (recordSimulationTime)
+            {
+                m_performanceCollector->RecordSample(PerformanceSpecPhysXSimulationTime, scene->GetLastSimulationTime());
+            }
+        }
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -461,6 +525,12 @@ namespace PhysX
         PxSetProfilerCallback(&m_pxAzProfilerCallback);
     }
 
+    physx::PxCpuDispatcher* PhysXSystem::GetPxCpuDispathcher()
+    {
+        AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
+        return m_cpuDispatcher;
+    }
+
     void PhysXSystem::ShutdownPhysXSdk()
     {
         delete m_cpuDispatcher;
@@ -37,6 +37,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
     {
@@ -76,7 +78,8 @@ namespace PhysX
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
-        physx::PxCpuDispatcher* GetPxCpuDispathcher()
+        physx::PxCpuDispatcher* GetPxCpuDispathcher();
+        PhysXCpuDispatcher* GetPhysXCpuDispatcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
@@ -96,6 +99,10 @@ namespace PhysX
 
         void InitializePerformanceCollector();
 
+        //! Starts the simulation of all the enabled scenes before waiting for any of them,
+        //! so independent scenes are simulated at the same time.
+        void SimulateScenesConcurrently(float timeStep);
+
         PhysXSystemConfiguration m_systemConfig;
         AzPhysics::SceneConfiguration m_defaultSceneConfiguration;
         AzPhysics::SceneList m_sceneList;
@@ -114,7 +121,7 @@ namespace PhysX
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
-        physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXCpuDispatcher* m_cpuDispatcher = nullptr;
 
         enum class State : AZ::u8
         {
@@ -9,6 +9,7 @@
 #ifdef HAVE_BENCHMARK
 #include <benchmark/benchmark.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -19,6 +20,12 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <Scene/PhysXScene.h>
+
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+}
 
 namespace PhysX::Benchmarks
 {
@@ -74,6 +81,10 @@ namespace PhysX::Benchmarks
 
             //! Number of iterations for each test
             static const int NumIterations = 3;
+
+            //! Flags to select how the transform write back benchmark syncs the transforms
+            static const int SyncTransformEachSubStep = 0; // physx_batchTransformSync disabled
+            static const int BatchTransformSync = 1; // physx_batchTransformSync enabled
         } // namespace BenchmarkRange
 
         //! Settings used to setup the activation benchmark
@@ -457,6 +468,115 @@ namespace PhysX::Benchmarks
         SetLabel(state, bodyType);
     }
 
+    //! BM_RigidBody_TransformWriteBack - This test uses the same setup as BM_RigidBody_MovingAndColliding with rigid body entities,
+    //! and reports the time spent writing the poses of the active rigid bodies back to the entity transforms separately from the frame time.
+    //! The write back time only covers the transform sync of FinishSimulation, as timed by the scene, and the FlushTransformSync call.
+    //! The test will run the simulation for ~1800 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)(benchmark::State& state)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        const bool batchTransformSync = state.range(1) == RigidBodyConstants::BenchmarkSettings::BatchTransformSync;
+        physx_batchTransformSync = batchTransformSync;
+
+        //setup some pieces for the test
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+        //Create a washing machine of physx objects. This is a cylinder with a spinning blade that rigid bodies are placed inside
+        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+        WashingMachine washingMachine;
+        washingMachine.SetupWashingMachine(
+            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+        //get the request number of rigid bodies and prepare to spawn them
+        const int numRigidBodies = aznumeric_cast<int>(state.range(0));
+
+        //function to generate the rigid bodies position / orientation
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+            return AZ::Vector3(x, y, z);
+        };
+        Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
+            return AZ::CreateRandomQuaternion(rand);
+        };
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+        //spawn the rigid bodies
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            numRigidBodies,
+            GetDefaultSceneHandle(),
+            RigidBodyConstants::CCDEnabled, RigidBodyEntity, &colliderGenerator, &posGenerator, &oriGenerator);
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //the scene times the transform sync done by FinishSimulation, FlushTransformSync is timed around the call
+        auto* physxScene = static_cast<PhysX::PhysXScene*>(m_defaultScene);
+
+        //setup the frame and write back timer trackers
+        Types::TimeList tickTimes;
+        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+        Types::TimeList writeBackTimes;
+        writeBackTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+
+                m_defaultScene->StartSimulation(DefaultTimeStep);
+                m_defaultScene->FinishSimulation();
+                auto flushStart = AZStd::chrono::steady_clock::now();
+                physxScene->FlushTransformSync();
+                auto end = AZStd::chrono::steady_clock::now();
+
+                //time each physics tick and its transform write back and store them to analyze
+                tickTimes.emplace_back(Types::double_milliseconds(end - start).count());
+                writeBackTimes.emplace_back(
+                    Types::double_milliseconds(physxScene->GetLastTransformSyncTime() + (end - flushStart)).count());
+            }
+        }
+        subTickTracker.Stop();
+
+        //object clean up
+        washingMachine.TearDownWashingMachine();
+
+        AZStd::visit(
+            [](auto& rigidBodies)
+            {
+                rigidBodies.clear();
+            },
+            rigidBodies);
+
+        physx_batchTransformSync = previousBatchTransformSync;
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        //report the write back times separately
+        const AZStd::vector<double> requestedPercentiles = { 0.5, 0.9, 0.99 };
+        const AZStd::vector<double> writeBackPercentiles = Utils::GetPercentiles(requestedPercentiles, writeBackTimes);
+        for (size_t i = 0; i < writeBackPercentiles.size(); i++)
+        {
+            AZStd::string label = AZStd::string::format("WriteBack-P%d", static_cast<int>(requestedPercentiles[i] * 100.0));
+            state.counters[label.c_str()] = writeBackPercentiles[i];
+        }
+        const Utils::StandardDeviationAndMeanResults writeBackStdevMean = Utils::GetStandardDeviationAndMean(writeBackTimes);
+        state.counters["WriteBack-Mean"] = writeBackStdevMean.m_mean;
+        state.counters["WriteBack-StDev"] = writeBackStdevMean.m_standardDeviation;
+
+        state.SetLabel(batchTransformSync ? "BatchTransformSync" : "SyncTransformEachSubStep");
+    }
+
     //! BM_RigidBody_Activation - This test will create the requested number of rigid bodies, including
     //! mock components that depend on the rigid bodies, and measure the time it takes to activate them.
     BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Activation)(benchmark::State& state)
@@ -768,6 +888,15 @@ namespace PhysX::Benchmarks
         ->MeasureProcessCPUTime();
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)
+        ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({ { RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange },
+                   { RigidBodyConstants::BenchmarkSettings::SyncTransformEachSubStep, RigidBodyConstants::BenchmarkSettings::BatchTransformSync } })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ->MeasureProcessCPUTime();
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_Activation)
         ->RangeMultiplier(RigidBodyConstants::ActivationBenchmarkSettings::RangeMultipler)
         ->Ranges({ { RigidBodyConstants::ActivationBenchmarkSettings::StartRange, RigidBodyConstants::ActivationBenchmarkSettings::EndRange } })
@@ -9,6 +9,7 @@
 #ifdef HAVE_BENCHMARK
 #include <vector>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
@@ -21,6 +22,12 @@
 #include <PhysX/PhysXLocks.h>
 #include <Scene/PhysXScene.h>
 
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(size_t, physx_parallelSceneQueryBatchSize);
+    AZ_CVAR_EXTERNED(size_t, physx_sceneSnapshotCount);
+}
+
 namespace PhysX::Benchmarks
 {
     namespace SceneQueryConstants
@@ -41,6 +48,16 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        // Batch benchmarks use a fixed scene and take 2 more parameters: the number of queries in the batch,
+        // and whether the batch is processed in parallel (1) or on the calling thread (0).
+        static const int64_t BatchBoxCount = 1024;
+        static const int64_t BatchMaxRadius = 64;
+        static const std::vector<int64_t> BatchSizes = { 1000, 10000, 100000 };
+
+        // Snapshot benchmarks take the number of boxes in the scene, placed within the batch benchmarks radius.
+        static const std::vector<int64_t> SnapshotBoxCounts = { 1000, 2500, 5000, 10000 };
+        static const size_t SnapshotCount = 64;
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -289,6 +306,181 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Sets physx_parallelSceneQueryBatchSize from the 4th parameter of the benchmark, and restores it when going out of scope.
+    class ScopedParallelSceneQueries
+    {
+    public:
+        explicit ScopedParallelSceneQueries(const benchmark::State& state)
+            : m_previousBatchSize(physx_parallelSceneQueryBatchSize)
+        {
+            if (state.range(3) == 0)
+            {
+                physx_parallelSceneQueryBatchSize = 0;
+            }
+        }
+
+        ~ScopedParallelSceneQueries()
+        {
+            physx_parallelSceneQueryBatchSize = m_previousBatchSize;
+        }
+
+    private:
+        size_t m_previousBatchSize;
+    };
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        ScopedParallelSceneQueries parallelSceneQueries(state);
+
+        const size_t batchSize = aznumeric_cast<size_t>(state.range(2));
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(2));
+
+        // get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastBatchRandomBoxes)(benchmark::State& state)
+    {
+        ScopedParallelSceneQueries parallelSceneQueries(state);
+
+        const size_t batchSize = aznumeric_cast<size_t>(state.range(2));
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            requests.emplace_back(AZStd::make_shared<AzPhysics::ShapeCastRequest>(AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                SceneQueryConstants::SphereShapeRadius,
+                AZ::Transform::CreateIdentity(),
+                m_boxes[i % m_numBoxes].GetNormalized(),
+                2000.0f
+            )));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(2));
+
+        //get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_SceneSnapshot_CaptureAndRewind - Captures a snapshot of every body of the scene each iteration, then rewinds the scene
+    //! to the previous tick and restores it, as a lag compensated query would. Reports the capture and the rewind with restore times.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_SceneSnapshot_CaptureAndRewind)(benchmark::State& state)
+    {
+        const size_t previousSnapshotCount = physx_sceneSnapshotCount;
+        physx_sceneSnapshotCount = SceneQueryConstants::SnapshotCount;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+
+        AZ::u64 tick = 0;
+        scene->CaptureSnapshot(tick);
+
+        AZStd::vector<int64_t> captureTimes;
+        AZStd::vector<int64_t> rewindTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ++tick;
+            auto start = AZStd::chrono::steady_clock::now();
+
+            scene->CaptureSnapshot(tick);
+
+            auto captureEnd = AZStd::chrono::steady_clock::now();
+
+            {
+                ScopedSceneRewind rewind(*scene, tick - 1);
+                benchmark::DoNotOptimize(rewind.IsRewound());
+            }
+
+            auto rewindEnd = AZStd::chrono::steady_clock::now();
+            captureTimes.emplace_back(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(captureEnd - start).count());
+            rewindTimes.emplace_back(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(rewindEnd - captureEnd).count());
+        }
+
+        scene->ClearSnapshots();
+        physx_sceneSnapshotCount = previousSnapshotCount;
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+
+        // report the capture and the rewind with restore times separately
+        auto reportCounters = [&state](const char* name, AZStd::vector<int64_t>& times)
+        {
+            const AZStd::vector<double> requestedPercentiles = { 0.5, 0.9, 0.99 };
+            const AZStd::vector<int64_t> percentiles = Utils::GetPercentiles(requestedPercentiles, times);
+            for (size_t i = 0; i < percentiles.size(); i++)
+            {
+                AZStd::string label = AZStd::string::format("%s-P%d", name, static_cast<int>(requestedPercentiles[i] * 100.0));
+                state.counters[label.c_str()] = aznumeric_cast<double>(percentiles[i]);
+            }
+            const Utils::StandardDeviationAndMeanResults stdevMean = Utils::GetStandardDeviationAndMean(times);
+            state.counters[AZStd::string::format("%s-Mean", name).c_str()] = stdevMean.m_mean;
+            state.counters[AZStd::string::format("%s-StDev", name).c_str()] = stdevMean.m_standardDeviation;
+        };
+        reportCounters("Capture", captureTimes);
+        reportCounters("RewindRestore", rewindTimes);
+    }
+
+    static void SceneSnapshotArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t boxCount : SceneQueryConstants::SnapshotBoxCounts)
+        {
+            benchmark->Args({ boxCount, SceneQueryConstants::BatchMaxRadius });
+        }
+    }
+
+    static void SceneQueryBatchArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t batchSize : SceneQueryConstants::BatchSizes)
+        {
+            for (int64_t parallel : { 0, 1 })
+            {
+                benchmark->Args({ SceneQueryConstants::BatchBoxCount, SceneQueryConstants::BatchMaxRadius, batchSize, parallel });
+            }
+        }
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -322,5 +514,20 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->Apply(SceneQueryBatchArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastBatchRandomBoxes)
+        ->Apply(SceneQueryBatchArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_SceneSnapshot_CaptureAndRewind)
+        ->Apply(SceneSnapshotArguments)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -6,9 +6,12 @@
  *
  */
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzTest/AzTest.h>
+#include <AZTestShared/Utils/Utils.h>
 #include <Tests/PhysXTestCommon.h>
 
 #include <AzFramework/Physics/PhysicsSystem.h>
@@ -18,12 +21,18 @@
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialManager.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
+#include <PhysX/PhysXLocks.h>
 #include <RigidBodyComponent.h>
 #include <SphereColliderComponent.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(size_t, physx_sceneSnapshotCount);
+    AZ_CVAR_EXTERNED(bool, physx_sceneSnapshotAutoCapture);
+
     class PhysXSceneQueryBase
     {
     public:
@@ -1007,4 +1016,322 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsResultsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        simBodies.reserve(positions.size());
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create enough raycast and sphere cast requests for the batch to be split into several tasks
+        constexpr size_t numRequests = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(numRequests);
+        for (size_t i = 0; i < numRequests; i++)
+        {
+            const AZ::Vector3 direction = positions[i % positions.size()].GetNormalized();
+            if (i % 2 == 0)
+            {
+                AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = direction;
+                request->m_distance = 200.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+            else
+            {
+                requests.emplace_back(AZStd::make_shared<AzPhysics::ShapeCastRequest>(
+                    AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(0.5f, AZ::Transform::CreateIdentity(), direction, 200.0f)));
+            }
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result is stored at the index of its request
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits& requestResult = results[i];
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_CalledWhileHoldingSceneLock_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+        [[maybe_unused]] auto* pxScene = static_cast<physx::PxScene*>(scene->GetNativePointer());
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        //create a batch large enough to be split into several tasks if it ran in parallel
+        constexpr size_t numRequests = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(numRequests);
+        for (size_t i = 0; i < numRequests; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3::CreateAxisX();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //the batch must not wait for tasks that need the lock held by this thread
+        AzPhysics::SceneQueryHitsList results;
+        {
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+            results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+        }
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (const AzPhysics::SceneQueryHits& requestResult : results)
+        {
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == sphereHandle);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_CalledFromTask_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        constexpr size_t numRequests = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(numRequests);
+        for (size_t i = 0; i < numRequests; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3::CreateAxisX();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //a task worker must not wait on the batch tasks, the batch runs on the worker itself
+        AzPhysics::SceneQueryHitsList results;
+        AZ::TaskGraph taskGraph("Scene Query Batch Test");
+        AZ::TaskGraphEvent finishEvent("Scene query batch test event");
+        taskGraph.AddTask(
+            AZ::TaskDescriptor{ "SceneQueryBatchTestTask", "Physics" },
+            [&]()
+            {
+                results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            });
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (const AzPhysics::SceneQueryHits& requestResult : results)
+        {
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == sphereHandle);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, ScopedSceneRewind_QueriesSeePastPoses_ThenPresentPosesAreRestored)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+
+        //setup a body and capture it at two different positions
+        const AZ::Vector3 pastPosition(10.0f, 0.0f, 0.0f);
+        const AZ::Vector3 presentPosition(0.0f, 10.0f, 0.0f);
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, pastPosition, 1.0f);
+        auto* sphere = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, sphereHandle));
+        ASSERT_TRUE(sphere != nullptr);
+
+        const size_t previousSnapshotCount = physx_sceneSnapshotCount;
+        physx_sceneSnapshotCount = 8;
+
+        scene->CaptureSnapshot(1);
+        sphere->SetTransform(AZ::Transform::CreateTranslation(presentPosition));
+        scene->CaptureSnapshot(2);
+
+        AzPhysics::RayCastRequest towardsPast;
+        towardsPast.m_start = AZ::Vector3::CreateZero();
+        towardsPast.m_direction = pastPosition.GetNormalized();
+        towardsPast.m_distance = 200.0f;
+
+        AzPhysics::RayCastRequest towardsPresent = towardsPast;
+        towardsPresent.m_direction = presentPosition.GetNormalized();
+
+        EXPECT_TRUE(scene->HasSnapshot(1));
+        EXPECT_FALSE(scene->HasSnapshot(3));
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &towardsPast));
+        EXPECT_TRUE(sceneInterface->QueryScene(m_testSceneHandle, &towardsPresent));
+
+        //rewind to the first tick
+        {
+            ScopedSceneRewind rewind(*scene, 1);
+            ASSERT_TRUE(rewind.IsRewound());
+
+            AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, &towardsPast);
+            ASSERT_EQ(result.m_hits.size(), 1);
+            EXPECT_TRUE(result.m_hits[0].m_bodyHandle == sphereHandle);
+            EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &towardsPresent));
+        }
+
+        //the present pose is restored when leaving the scope
+        EXPECT_FALSE(scene->IsRewound());
+        EXPECT_TRUE(sphere->GetPosition().IsClose(presentPosition));
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &towardsPast));
+        EXPECT_TRUE(sceneInterface->QueryScene(m_testSceneHandle, &towardsPresent));
+
+        //ticks that were not captured leave the scene as it is
+        {
+            ScopedSceneRewind missingRewind(*scene, 3);
+            EXPECT_FALSE(missingRewind.IsRewound());
+            EXPECT_FALSE(scene->IsRewound());
+        }
+
+        physx_sceneSnapshotCount = previousSnapshotCount;
+    }
+
+    TEST_F(PhysXSceneQueryFixture, ScopedSceneRewind_BodyRemovedWhileRewound_RestoresSceneFirst)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+
+        //setup two bodies and capture them before and after moving them
+        const AZ::Vector3 pastPosition(10.0f, 0.0f, 0.0f);
+        const AZ::Vector3 presentPosition(0.0f, 10.0f, 0.0f);
+        AzPhysics::SimulatedBodyHandle removedHandle = TestUtils::AddSphereToScene(m_testSceneHandle, pastPosition, 1.0f);
+        AzPhysics::SimulatedBodyHandle keptHandle = TestUtils::AddSphereToScene(m_testSceneHandle, pastPosition + AZ::Vector3::CreateAxisZ(5.0f), 1.0f);
+        auto* removedSphere = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, removedHandle));
+        auto* keptSphere = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, keptHandle));
+        ASSERT_TRUE(removedSphere != nullptr);
+        ASSERT_TRUE(keptSphere != nullptr);
+
+        const size_t previousSnapshotCount = physx_sceneSnapshotCount;
+        physx_sceneSnapshotCount = 8;
+
+        scene->CaptureSnapshot(1);
+        removedSphere->SetTransform(AZ::Transform::CreateTranslation(presentPosition));
+        keptSphere->SetTransform(AZ::Transform::CreateTranslation(presentPosition + AZ::Vector3::CreateAxisZ(5.0f)));
+        scene->CaptureSnapshot(2);
+
+        {
+            ScopedSceneRewind rewind(*scene, 1);
+            ASSERT_TRUE(rewind.IsRewound());
+            EXPECT_TRUE(keptSphere->GetPosition().IsClose(pastPosition + AZ::Vector3::CreateAxisZ(5.0f)));
+
+            //the scene is restored before the body and its actor are released
+            UnitTest::ErrorHandler removedWhileRewoundWarning("while it is rewound to a snapshot");
+            sceneInterface->RemoveSimulatedBody(m_testSceneHandle, removedHandle);
+            EXPECT_EQ(removedWhileRewoundWarning.GetExpectedWarningCount(), 1);
+            EXPECT_FALSE(scene->IsRewound());
+            EXPECT_TRUE(keptSphere->GetPosition().IsClose(presentPosition + AZ::Vector3::CreateAxisZ(5.0f)));
+
+            //releasing the removed body before the rewind goes out of scope doesn't leave it restoring a dangling actor
+            TestUtils::UpdateScene(scene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        EXPECT_FALSE(scene->IsRewound());
+        EXPECT_TRUE(removedHandle == AzPhysics::InvalidSimulatedBodyHandle);
+
+        physx_sceneSnapshotCount = previousSnapshotCount;
+    }
+
+    TEST_F(PhysXSceneQueryFixture, SceneSnapshots_AutoCaptureDisabled_ManualSnapshotsAreKeptWhileSimulating)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+
+        const size_t previousSnapshotCount = physx_sceneSnapshotCount;
+        physx_sceneSnapshotCount = 4;
+        const bool previousSnapshotAutoCapture = physx_sceneSnapshotAutoCapture;
+        physx_sceneSnapshotAutoCapture = false;
+
+        TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        //snapshots captured with ticks of another clock are not evicted by simulating more steps than the ring holds
+        constexpr AZ::u64 networkFrame = 1000;
+        scene->CaptureSnapshot(networkFrame);
+        TestUtils::UpdateScene(scene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        EXPECT_TRUE(scene->HasSnapshot(networkFrame));
+        EXPECT_FALSE(scene->HasSnapshot(scene->GetSimulationTick()));
+
+        scene->ClearSnapshots();
+        physx_sceneSnapshotAutoCapture = previousSnapshotAutoCapture;
+        physx_sceneSnapshotCount = previousSnapshotCount;
+    }
+
+    TEST_F(PhysXSceneQueryFixture, SceneSnapshots_AutoCaptureEnabled_CapturedAtEndOfEverySimulationStep)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = static_cast<PhysX::PhysXScene*>(sceneInterface->GetScene(m_testSceneHandle));
+
+        const size_t previousSnapshotCount = physx_sceneSnapshotCount;
+        physx_sceneSnapshotCount = 64;
+        const bool previousSnapshotAutoCapture = physx_sceneSnapshotAutoCapture;
+        physx_sceneSnapshotAutoCapture = true;
+
+        //setup a body falling from the path of a ray
+        const AZ::Vector3 startPosition(10.0f, 0.0f, 0.0f);
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, startPosition, 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = startPosition.GetNormalized();
+        request.m_distance = 200.0f;
+
+        //every step is captured before the simulation finish event is signaled
+        bool snapshotCapturedBeforeFinishEvent = true;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [scene, &snapshotCapturedBeforeFinishEvent]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                snapshotCapturedBeforeFinishEvent = snapshotCapturedBeforeFinishEvent && scene->HasSnapshot(scene->GetSimulationTick());
+            });
+        scene->RegisterSceneSimulationFinishHandler(finishHandler);
+
+        const AZ::u64 firstTick = scene->GetSimulationTick() + 1;
+        constexpr AZ::u32 numSteps = 60;
+        TestUtils::UpdateScene(scene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, numSteps);
+        finishHandler.Disconnect();
+
+        EXPECT_EQ(scene->GetSimulationTick(), firstTick + numSteps - 1);
+        EXPECT_TRUE(snapshotCapturedBeforeFinishEvent);
+        EXPECT_TRUE(scene->HasSnapshot(firstTick));
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &request));
+
+        //the body is still in the path of the ray at the first step
+        {
+            ScopedSceneRewind rewind(*scene, firstTick);
+            ASSERT_TRUE(rewind.IsRewound());
+
+            AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, &request);
+            ASSERT_EQ(result.m_hits.size(), 1);
+            EXPECT_TRUE(result.m_hits[0].m_bodyHandle == sphereHandle);
+        }
+
+        //no snapshots are captured once disabled
+        physx_sceneSnapshotAutoCapture = false;
+        TestUtils::UpdateScene(scene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_FALSE(scene->HasSnapshot(scene->GetSimulationTick()));
+
+        scene->ClearSnapshots();
+        physx_sceneSnapshotAutoCapture = previousSnapshotAutoCapture;
+        physx_sceneSnapshotCount = previousSnapshotCount;
+    }
 }
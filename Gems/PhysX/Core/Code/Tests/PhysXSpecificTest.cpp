@@ -11,6 +11,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
@@ -39,6 +40,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+
     class PhysXSpecificTest
         : public PhysXDefaultWorldTest
         , public UnitTest::TraceBusRedirector
@@ -1725,5 +1728,126 @@ namespace PhysX
         EXPECT_EQ(setKinematicFalseWarningHandler.GetWarningCount(), 1);
         EXPECT_TRUE(rigidBody->IsKinematic());
     }
-} // namespace PhysX
 
+    namespace PhysXTests
+    {
+        //! Creates spinning boxes falling at different heights, so all of them are active every step.
+        AZStd::vector<EntityPtr> CreateSpinningBoxes(AzPhysics::SceneHandle sceneHandle, int count)
+        {
+            AZStd::vector<EntityPtr> boxes;
+            boxes.reserve(count);
+            for (int i = 0; i < count; i++)
+            {
+                boxes.emplace_back(TestUtils::AddUnitTestObject(
+                    sceneHandle, AZ::Vector3(aznumeric_cast<float>(i) * 3.0f, 0.0f, 10.0f + aznumeric_cast<float>(i)), "SpinningBox"));
+                AzPhysics::RigidBody* body = boxes.back()->FindComponent<RigidBodyComponent>()->GetRigidBody();
+                body->SetAngularVelocity(AZ::Vector3(1.0f, 2.0f, 3.0f) * aznumeric_cast<float>(i + 1));
+            }
+            return boxes;
+        }
+
+        void ExpectEntityTransformsMatchActorPoses(const AZStd::vector<EntityPtr>& entities, float tolerance)
+        {
+            for (const EntityPtr& entity : entities)
+            {
+                AzPhysics::RigidBody* body = entity->FindComponent<RigidBodyComponent>()->GetRigidBody();
+                auto* pxActor = static_cast<physx::PxRigidActor*>(body->GetNativePointer());
+                ASSERT_TRUE(pxActor != nullptr);
+
+                AZ::Transform actorPose;
+                {
+                    PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+                    actorPose = PxMathConvert(pxActor->getGlobalPose());
+                }
+
+                const AZ::Transform entityTransform = entity->GetTransform()->GetWorldTM();
+                EXPECT_TRUE(entityTransform.GetTranslation().IsClose(actorPose.GetTranslation(), tolerance));
+                EXPECT_TRUE(entityTransform.GetRotation().IsClose(actorPose.GetRotation(), tolerance));
+            }
+        }
+    } // namespace PhysXTests
+
+    TEST_F(PhysXSpecificTest, RigidBody_TransformSyncEachSubStep_EntityTransformsMatchActorPoses)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        physx_batchTransformSync = false;
+
+        AZStd::vector<EntityPtr> boxes = PhysXTests::CreateSpinningBoxes(m_testSceneHandle, 10);
+        for (int timeStep = 0; timeStep < 10; timeStep++)
+        {
+            // each sub-step reads the poses of the active bodies in bulk and syncs the entity transforms right away
+            m_defaultScene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            m_defaultScene->FinishSimulation();
+        }
+
+        PhysXTests::ExpectEntityTransformsMatchActorPoses(boxes, tolerance);
+
+        physx_batchTransformSync = previousBatchTransformSync;
+    }
+
+    TEST_F(PhysXSpecificTest, RigidBody_BatchTransformSync_EntityTransformsMatchActorPosesAfterFlush)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        physx_batchTransformSync = true;
+
+        AZStd::vector<EntityPtr> boxes = PhysXTests::CreateSpinningBoxes(m_testSceneHandle, 10);
+        for (int timeStep = 0; timeStep < 10; timeStep++)
+        {
+            m_defaultScene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            m_defaultScene->FinishSimulation();
+        }
+        // the poses of the bodies queued over all the steps are read in bulk when the transform sync is flushed
+        static_cast<PhysX::PhysXScene*>(m_defaultScene)->FlushTransformSync();
+
+        PhysXTests::ExpectEntityTransformsMatchActorPoses(boxes, tolerance);
+
+        physx_batchTransformSync = previousBatchTransformSync;
+    }
+
+    TEST_F(PhysXSpecificTest, RigidBody_TransformSync_NotifiesListenersAfterAllEntityTransformsAreSet)
+    {
+        const bool previousBatchTransformSync = physx_batchTransformSync;
+        physx_batchTransformSync = false;
+
+        AZStd::vector<EntityPtr> boxes = PhysXTests::CreateSpinningBoxes(m_testSceneHandle, 10);
+
+        // every transform notification of a step has to see all the entities of the step already moved
+        AZStd::vector<AZ::Transform> transformsBeforeStep(boxes.size());
+        int notificationCount = 0;
+        bool allEntitiesMovedBeforeNotifications = true;
+        AZStd::vector<AZ::TransformChangedEvent::Handler> transformChangedHandlers;
+        transformChangedHandlers.reserve(boxes.size());
+        for (const EntityPtr& box : boxes)
+        {
+            transformChangedHandlers.emplace_back(
+                [&]([[maybe_unused]] const AZ::Transform& local, [[maybe_unused]] const AZ::Transform& world)
+                {
+                    ++notificationCount;
+                    for (size_t boxIndex = 0; boxIndex < boxes.size(); boxIndex++)
+                    {
+                        if (boxes[boxIndex]->GetTransform()->GetWorldTM().IsClose(transformsBeforeStep[boxIndex]))
+                        {
+                            allEntitiesMovedBeforeNotifications = false;
+                        }
+                    }
+                });
+            box->GetTransform()->BindTransformChangedEventHandler(transformChangedHandlers.back());
+        }
+
+        for (int timeStep = 0; timeStep < 10; timeStep++)
+        {
+            for (size_t boxIndex = 0; boxIndex < boxes.size(); boxIndex++)
+            {
+                transformsBeforeStep[boxIndex] = boxes[boxIndex]->GetTransform()->GetWorldTM();
+            }
+            m_defaultScene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            m_defaultScene->FinishSimulation();
+        }
+
+        EXPECT_GT(notificationCount, 0);
+        EXPECT_TRUE(allEntitiesMovedBeforeNotifications);
+        PhysXTests::ExpectEntityTransformsMatchActorPoses(boxes, tolerance);
+
+        physx_batchTransformSync = previousBatchTransformSync;
+    }
+} // namespace PhysX
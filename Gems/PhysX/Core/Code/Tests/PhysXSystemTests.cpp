@@ -5,6 +5,12 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
@@ -13,9 +19,14 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <PhysX/PhysXLocks.h>
+#include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_concurrentSceneSimulation);
+
     namespace Internal
     {
         static constexpr const char* DefaultSceneNameFormat = "scene-%u";
@@ -328,4 +339,348 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    namespace Internal
+    {
+        //! Meeting point of the simulation steps of several scenes. Each scene waits in it until all the scenes reached it,
+        //! which only happens when the scenes are simulating at the same time.
+        class SimulationRendezvous
+        {
+        public:
+            explicit SimulationRendezvous(int sceneCount)
+                : m_sceneCount(sceneCount)
+            {
+            }
+
+            void Arrive()
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+                if (m_timedOut)
+                {
+                    return;
+                }
+
+                const int step = m_completedSteps;
+                if (++m_arrivedScenes == m_sceneCount)
+                {
+                    m_arrivedScenes = 0;
+                    ++m_completedSteps;
+                    m_allArrived.notify_all();
+                    return;
+                }
+
+                // with scenes simulated one after the other the other scenes never arrive, stop waiting for them from then on
+                if (!m_allArrived.wait_for(lock, WaitTimeout, [this, step]() { return m_completedSteps != step; }))
+                {
+                    m_timedOut = true;
+                    m_allArrived.notify_all();
+                }
+            }
+
+            //! Number of steps in which all the scenes were simulating at the same time.
+            int GetOverlappingSteps()
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                return m_completedSteps;
+            }
+
+        private:
+            static constexpr AZStd::chrono::seconds WaitTimeout{ 5 };
+
+            const int m_sceneCount;
+            AZStd::mutex m_mutex;
+            AZStd::condition_variable m_allArrived;
+            int m_arrivedScenes = 0;
+            int m_completedSteps = 0;
+            bool m_timedOut = false;
+        };
+
+        //! Simulation event callback that waits in the rendezvous when PhysX previews the integrated poses of the step,
+        //! which happens on a worker thread while the scene is simulating. All the events are forwarded to the scene callback.
+        class SimulationRendezvousCallback
+            : public physx::PxSimulationEventCallback
+        {
+        public:
+            SimulationRendezvousCallback(physx::PxSimulationEventCallback* sceneCallback, SimulationRendezvous& rendezvous)
+                : m_sceneCallback(sceneCallback)
+                , m_rendezvous(rendezvous)
+            {
+            }
+
+            void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override
+            {
+                m_sceneCallback->onConstraintBreak(constraints, count);
+            }
+
+            void onWake(physx::PxActor** actors, physx::PxU32 count) override
+            {
+                m_sceneCallback->onWake(actors, count);
+            }
+
+            void onSleep(physx::PxActor** actors, physx::PxU32 count) override
+            {
+                m_sceneCallback->onSleep(actors, count);
+            }
+
+            void onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs) override
+            {
+                m_sceneCallback->onContact(pairHeader, pairs, nbPairs);
+            }
+
+            void onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count) override
+            {
+                m_sceneCallback->onTrigger(pairs, count);
+            }
+
+            void onAdvance(const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count) override
+            {
+                m_rendezvous.Arrive();
+                m_sceneCallback->onAdvance(bodyBuffer, poseBuffer, count);
+            }
+
+            physx::PxSimulationEventCallback* GetSceneCallback() const
+            {
+                return m_sceneCallback;
+            }
+
+        private:
+            physx::PxSimulationEventCallback* m_sceneCallback = nullptr;
+            SimulationRendezvous& m_rendezvous;
+        };
+    } // namespace Internal
+
+    TEST_F(PhysXSystemFixture, ConcurrentSceneSimulation_SimulatesAllScenes)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        //the second scene runs at most one simulation task at a time
+        m_sceneConfigs[1].m_maxConcurrentSimulationTasks = 1;
+        const AzPhysics::SceneHandle firstSceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        const AzPhysics::SceneHandle secondSceneHandle = physicsSystem->AddScene(m_sceneConfigs[1]);
+
+        const AZ::Vector3 startPosition(0.0f, 0.0f, 10.0f);
+        AzPhysics::RigidBody* firstBox = TestUtils::AddUnitBoxToScene(firstSceneHandle, startPosition);
+        AzPhysics::RigidBody* secondBox = TestUtils::AddUnitBoxToScene(secondSceneHandle, startPosition);
+
+        //the budget of the second scene is set on the dispatcher, the first scene has none
+        PhysXCpuDispatcher* dispatcher = GetPhysXSystem()->GetPhysXCpuDispatcher();
+        auto getTaskManager = [physicsSystem](AzPhysics::SceneHandle sceneHandle)
+        {
+            return static_cast<physx::PxScene*>(physicsSystem->GetScene(sceneHandle)->GetNativePointer())->getTaskManager();
+        };
+        EXPECT_EQ(dispatcher->GetTaskBudget(getTaskManager(firstSceneHandle)), 0u);
+        EXPECT_EQ(dispatcher->GetTaskBudget(getTaskManager(secondSceneHandle)), 1u);
+
+        //the simulation of each scene waits for the other one in the middle of every step, when PhysX previews the integrated
+        //poses of the boxes on a worker thread. Both scenes only get there in the same step if they are simulating at the same time.
+        Internal::SimulationRendezvous rendezvous(2);
+        AZStd::vector<AZStd::pair<physx::PxScene*, AZStd::unique_ptr<Internal::SimulationRendezvousCallback>>> rendezvousCallbacks;
+        for (AzPhysics::RigidBody* box : { firstBox, secondBox })
+        {
+            auto* pxBody = static_cast<physx::PxRigidBody*>(box->GetNativePointer());
+            physx::PxScene* pxScene = pxBody->getScene();
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+            pxBody->setRigidBodyFlag(physx::PxRigidBodyFlag::eENABLE_POSE_INTEGRATION_PREVIEW, true);
+            auto rendezvousCallback =
+                AZStd::make_unique<Internal::SimulationRendezvousCallback>(pxScene->getSimulationEventCallback(), rendezvous);
+            pxScene->setSimulationEventCallback(rendezvousCallback.get());
+            rendezvousCallbacks.emplace_back(pxScene, AZStd::move(rendezvousCallback));
+        }
+
+        AZStd::atomic<int> finishedSimulationCount{ 0 };
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [&finishedSimulationCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                finishedSimulationCount++;
+            });
+        physicsSystem->GetScene(firstSceneHandle)->RegisterSceneSimulationFinishHandler(finishHandler);
+
+        const bool previousConcurrentSceneSimulation = physx_concurrentSceneSimulation;
+        physx_concurrentSceneSimulation = true;
+
+        constexpr int numFrames = 30;
+        const float frameDeltaTime = physicsSystem->GetConfiguration()->m_fixedTimestep;
+        for (int i = 0; i < numFrames; i++)
+        {
+            physicsSystem->Simulate(frameDeltaTime);
+        }
+
+        physx_concurrentSceneSimulation = previousConcurrentSceneSimulation;
+        finishHandler.Disconnect();
+        for (const auto& [pxScene, rendezvousCallback] : rendezvousCallbacks)
+        {
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+            pxScene->setSimulationEventCallback(rendezvousCallback->GetSceneCallback());
+        }
+
+        //both scenes were simulating at the same time in every step
+        EXPECT_GT(finishedSimulationCount.load(), 0);
+        EXPECT_EQ(rendezvous.GetOverlappingSteps(), finishedSimulationCount.load());
+
+        //both boxes fell the same way, the task budget only changes how the simulation is scheduled
+        EXPECT_LT(firstBox->GetPosition().GetZ(), startPosition.GetZ());
+        EXPECT_TRUE(firstBox->GetPosition().IsClose(secondBox->GetPosition()));
+    }
+
+    namespace Internal
+    {
+        //! Counts the tasks of a test running at the same time.
+        struct TaskConcurrency
+        {
+            AZStd::atomic<AZ::u32> m_runningTasks{ 0 };
+            AZStd::atomic<AZ::u32> m_maxTrackedRunningTasks{ 0 };
+            AZStd::atomic<AZ::u32> m_finishedTasks{ 0 };
+        };
+
+        //! PhysX task tagged with the task manager the dispatcher budgets it by, which runs for a while.
+        //! Tracked tasks record the most tasks that were running at the same time while they started.
+        class ConcurrencyTrackingTask
+            : public physx::PxBaseTask
+        {
+        public:
+            ConcurrencyTrackingTask(physx::PxTaskManager* taskManager, TaskConcurrency& concurrency, bool isTracked)
+                : m_concurrency(concurrency)
+                , m_isTracked(isTracked)
+            {
+                mTm = taskManager;
+            }
+
+            void run() override
+            {
+                const AZ::u32 runningTasks = ++m_concurrency.m_runningTasks;
+                if (m_isTracked)
+                {
+                    AZ::u32 maxRunningTasks = m_concurrency.m_maxTrackedRunningTasks;
+                    while (runningTasks > maxRunningTasks &&
+                        !m_concurrency.m_maxTrackedRunningTasks.compare_exchange_weak(maxRunningTasks, runningTasks))
+                    {
+                    }
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+                --m_concurrency.m_runningTasks;
+            }
+
+            const char* getName() const override
+            {
+                return "ConcurrencyTrackingTask";
+            }
+
+            void addReference() override
+            {
+            }
+
+            void removeReference() override
+            {
+            }
+
+            physx::PxI32 getReference() const override
+            {
+                return 1;
+            }
+
+            void release() override
+            {
+                ++m_concurrency.m_finishedTasks;
+            }
+
+        private:
+            TaskConcurrency& m_concurrency;
+            bool m_isTracked = false;
+        };
+    } // namespace Internal
+
+    //setup a test fixture with a dispatcher of its own and a fake task manager to tag the tasks of a scene
+    class PhysXCpuDispatcherFixture
+        : public testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            m_dispatcher.reset(PhysXCpuDispatcherCreate());
+            m_taskManager = reinterpret_cast<physx::PxTaskManager*>(&m_taskManagerTag);
+        }
+        void TearDown() override
+        {
+            m_dispatcher.reset();
+            m_tasks.clear();
+        }
+
+        void SubmitTasks(size_t count, bool isTracked)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                m_tasks.emplace_back(AZStd::make_unique<Internal::ConcurrencyTrackingTask>(m_taskManager, m_concurrency, isTracked));
+                static_cast<physx::PxCpuDispatcher*>(m_dispatcher.get())->submitTask(*m_tasks.back());
+            }
+        }
+
+        //! Waits for all the submitted tasks to be done and to have given their budget slot back.
+        void WaitForTasks()
+        {
+            const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(30);
+            while ((m_concurrency.m_finishedTasks < m_tasks.size() || m_dispatcher->GetBudgetedTaskCount(m_taskManager) > 0) &&
+                AZStd::chrono::steady_clock::now() < timeout)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            ASSERT_EQ(m_concurrency.m_finishedTasks.load(), m_tasks.size());
+            ASSERT_EQ(m_dispatcher->GetBudgetedTaskCount(m_taskManager), 0u);
+        }
+
+        AZStd::unique_ptr<PhysXCpuDispatcher> m_dispatcher;
+        int m_taskManagerTag = 0;
+        physx::PxTaskManager* m_taskManager = nullptr;
+        Internal::TaskConcurrency m_concurrency;
+        AZStd::vector<AZStd::unique_ptr<Internal::ConcurrencyTrackingTask>> m_tasks;
+    };
+
+    TEST_F(PhysXCpuDispatcherFixture, TaskBudget_MoreTasksThanBudget_RunsAtMostBudgetTasksAtOnce)
+    {
+        m_dispatcher->SetTaskBudget(m_taskManager, 2);
+
+        //the tasks over the budget are pending until a running task hands its slot over
+        SubmitTasks(16, true);
+        WaitForTasks();
+
+        EXPECT_GT(m_concurrency.m_maxTrackedRunningTasks.load(), 0u);
+        EXPECT_LE(m_concurrency.m_maxTrackedRunningTasks.load(), 2u);
+        EXPECT_EQ(m_dispatcher->GetTaskBudget(m_taskManager), 2u);
+    }
+
+    TEST_F(PhysXCpuDispatcherFixture, TaskBudget_LoweredWhileTasksRun_NewTasksWaitForRunningTasksOverBudget)
+    {
+        m_dispatcher->SetTaskBudget(m_taskManager, 4);
+        SubmitTasks(4, false);
+
+        //the tasks submitted after lowering the budget only start once the tasks over the new budget are done
+        m_dispatcher->SetTaskBudget(m_taskManager, 1);
+        SubmitTasks(8, true);
+        WaitForTasks();
+
+        EXPECT_EQ(m_concurrency.m_maxTrackedRunningTasks.load(), 1u);
+    }
+
+    TEST_F(PhysXCpuDispatcherFixture, TaskBudget_RemovedWhileTasksRun_PendingTasksStartWithoutBudget)
+    {
+        m_dispatcher->SetTaskBudget(m_taskManager, 1);
+        SubmitTasks(4, false);
+
+        m_dispatcher->SetTaskBudget(m_taskManager, 0);
+        EXPECT_EQ(m_dispatcher->GetTaskBudget(m_taskManager), 0u);
+        WaitForTasks();
+    }
+
+    TEST_F(PhysXCpuDispatcherFixture, TaskBudget_ReaddedWhileTasksOfRemovedBudgetRun_CountsThoseTasks)
+    {
+        m_dispatcher->SetTaskBudget(m_taskManager, 2);
+        SubmitTasks(2, false);
+
+        //the two tasks started under the removed budget still take the slot of the new budget until they are done
+        m_dispatcher->SetTaskBudget(m_taskManager, 0);
+        m_dispatcher->SetTaskBudget(m_taskManager, 1);
+        SubmitTasks(8, true);
+        WaitForTasks();
+
+        EXPECT_EQ(m_concurrency.m_maxTrackedRunningTasks.load(), 1u);
+    }
 }